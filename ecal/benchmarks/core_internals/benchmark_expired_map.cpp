@@ -19,6 +19,7 @@
 
 #include <ecal/ecal.h>
 #include <util/ecal_expmap.h>
+#include <util/ecal_expmap_wheel.h>
 #include <ecal_struct_sample_registration.h>
 
 #include <benchmark/benchmark.h>
@@ -30,6 +31,7 @@
 #include <condition_variable>
 #include <map>
 #include <unordered_map>
+#include <vector>
 
 
 using namespace eCAL;
@@ -37,6 +39,32 @@ using namespace eCAL;
 namespace
 {
 
+  // steady clock that can be advanced, lets elements expire without sleeping
+  class BenchmarkClock
+  {
+  public:
+    using duration   = std::chrono::steady_clock::duration;
+    using rep        = duration::rep;
+    using period     = duration::period;
+    using time_point = std::chrono::time_point<BenchmarkClock>;
+    static const bool is_steady = true;
+
+    static time_point now() noexcept
+    {
+      return time_point(std::chrono::steady_clock::now().time_since_epoch() + offset);
+    }
+
+    static void advance(const duration& d)
+    {
+      offset += d;
+    }
+
+  private:
+    static duration offset;
+  };
+
+  BenchmarkClock::duration BenchmarkClock::offset{ 0 };
+
   Registration::Sample MakeRegPublisherSample(
     uint64_t entity_id,
     uint32_t process_id,
@@ -155,6 +183,7 @@ namespace
       {
         const auto& index_to_update = samples[i].identifier;
         const auto& cache_iterator = cache.find(index_to_update);
+        benchmark::DoNotOptimize(cache_iterator);
       }
       benchmark::DoNotOptimize(cache);
     }
@@ -229,9 +258,84 @@ namespace
     state.SetItemsProcessed(state.iterations() * N);
   }
 
+  // refreshes 90% of the elements (like registration refreshes the live entities), the rest expires
+  template <typename ExpiredMap>
+  void RefreshAndAdvance(ExpiredMap& cache_, const std::vector<Registration::Sample>& samples_, std::size_t round_)
+  {
+    BenchmarkClock::advance(std::chrono::milliseconds(110));
+    for (std::size_t i = 0; i < samples_.size(); ++i)
+    {
+      if (i % 10 == round_ % 10) continue;
+      cache_[samples_[i].identifier] = samples_[i];
+    }
+  }
+
+  /**
+   * Benchmark: erase_expired on a cache of size N, a tenth of the elements expires per call
+   */
+  template <typename ExpiredMap>
+  void BM_CExpirationMap_Expire(benchmark::State& state)
+  {
+    const std::size_t N = static_cast<std::size_t>(state.range(0));
+
+    const auto samples = MakeUniquePublisherSamples(N);
+
+    ExpiredMap cache(std::chrono::milliseconds(100));
+    for (const auto& sample : samples)
+    {
+      cache.insert({ sample.identifier, sample });
+    }
+
+    std::size_t round = 0;
+    for (auto _ : state)
+    {
+      state.PauseTiming();
+      RefreshAndAdvance(cache, samples, round++);
+      state.ResumeTiming();
+
+      auto expired = cache.erase_expired();
+      benchmark::DoNotOptimize(expired);
+    }
+
+    state.SetItemsProcessed(state.iterations() * N);
+  }
+
+  /**
+   * Benchmark: like Expire, but the expired elements are moved out instead of being returned in a std::map
+   */
+  template <typename ExpiredMap>
+  void BM_CExpirationMap_ExpireMove(benchmark::State& state)
+  {
+    const std::size_t N = static_cast<std::size_t>(state.range(0));
+
+    const auto samples = MakeUniquePublisherSamples(N);
+
+    ExpiredMap cache(std::chrono::milliseconds(100));
+    for (const auto& sample : samples)
+    {
+      cache.insert({ sample.identifier, sample });
+    }
+
+    std::size_t round = 0;
+    std::vector<Registration::Sample> expired;
+    for (auto _ : state)
+    {
+      state.PauseTiming();
+      RefreshAndAdvance(cache, samples, round++);
+      expired.clear();
+      state.ResumeTiming();
+
+      cache.erase_expired([&expired](const Registration::SampleIdentifier&, Registration::Sample&& sample_) { expired.push_back(std::move(sample_)); });
+      benchmark::DoNotOptimize(expired.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * N);
+  }
+
   // ------------------------- Registration -------------------------
-  using SampleTrackerMap = Util::CExpirationMap<Registration::SampleIdentifier, Registration::Sample, std::chrono::steady_clock, std::map>;
-  using SampleTrackerUnorderedMap = Util::CExpirationMap<Registration::SampleIdentifier, Registration::Sample, std::chrono::steady_clock, std::unordered_map>;
+  using SampleTrackerMap = Util::CExpirationMap<Registration::SampleIdentifier, Registration::Sample, BenchmarkClock, std::map>;
+  using SampleTrackerUnorderedMap = Util::CExpirationMap<Registration::SampleIdentifier, Registration::Sample, BenchmarkClock, std::unordered_map>;
+  using SampleTrackerTimerWheel = Util::CTimerWheelExpirationMap<Registration::SampleIdentifier, Registration::Sample, BenchmarkClock>;
 
 
   // Adjust the argument list to your dataset sizes
@@ -269,6 +373,13 @@ namespace
       ->Arg(1'000)
       ->Arg(10'000)
       ->Arg(100'000);
+
+    benchmark::RegisterBenchmark(
+      std::string("ExpiredMap/Expire/") + tag,
+      &BM_CExpirationMap_Expire<ExpiredMap>)
+      ->Arg(10'000)
+      ->Arg(100'000)
+      ->Unit(benchmark::kMillisecond);
   }
 }
 
@@ -279,6 +390,14 @@ int main(int argc, char** argv)
 
   RegisterFamily<SampleTrackerMap>("ExpiredMap using std::map");
   RegisterFamily<SampleTrackerUnorderedMap>("ExpiredMap using std::unordered_map");
+  RegisterFamily<SampleTrackerTimerWheel>("ExpiredMap using a timer wheel");
+
+  benchmark::RegisterBenchmark(
+    "ExpiredMap/ExpireMove/ExpiredMap using a timer wheel",
+    &BM_CExpirationMap_ExpireMove<SampleTrackerTimerWheel>)
+    ->Arg(10'000)
+    ->Arg(100'000)
+    ->Unit(benchmark::kMillisecond);
   // We can potentially register other implementations to compare the benchmarks.
 
   ::benchmark::RunSpecifiedBenchmarks();
@@ -0,0 +1,174 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "io/shm/ecal_memfile.h"
+#include "io/shm/ecal_memfile_db.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace eCAL
+{
+  std::shared_ptr<CMemFileMap> g_memfile_map()
+  {
+    static std::shared_ptr<CMemFileMap> m(new CMemFileMap);
+    return m;
+  }
+}
+
+namespace
+{
+  // Memory file page placement variants, the default one is the plain shared memory mapping
+  enum class Allocation : int
+  {
+    Default            = 0,
+    Prefault           = 1,
+    HugePages          = 2,
+    HugePagesPrefault  = 3,
+    PrefaultNumaNode0  = 4,
+  };
+
+  const char* AllocationName(Allocation allocation)
+  {
+    switch (allocation)
+    {
+    case Allocation::Default:           return "default";
+    case Allocation::Prefault:          return "prefault";
+    case Allocation::HugePages:         return "huge_pages";
+    case Allocation::HugePagesPrefault: return "huge_pages+prefault";
+    case Allocation::PrefaultNumaNode0: return "prefault+numa_node_0";
+    }
+    return "unknown";
+  }
+
+  eCAL::SMemFileAllocation MakeAllocation(Allocation allocation)
+  {
+    eCAL::SMemFileAllocation mem_file_allocation;
+    mem_file_allocation.huge_pages = (allocation == Allocation::HugePages) || (allocation == Allocation::HugePagesPrefault);
+    mem_file_allocation.prefault   = (allocation == Allocation::Prefault) || (allocation == Allocation::HugePagesPrefault) || (allocation == Allocation::PrefaultNumaNode0);
+    mem_file_allocation.numa_node  = (allocation == Allocation::PrefaultNumaNode0) ? 0 : -1;
+    return mem_file_allocation;
+  }
+
+  const std::string memfile_name = "ecal_benchmark_memfile_allocation";
+
+  void WritePayload(eCAL::CMemoryFile& mem_file, const std::vector<char>& payload)
+  {
+    mem_file.GetWriteAccess(100);
+    mem_file.WriteBuffer(payload.data(), payload.size(), 0);
+    mem_file.ReleaseWriteAccess();
+  }
+
+  // Create a new memory file (not measured) and write the first payload into it,
+  // this is what a publisher pays for the first send into a newly created memory file
+  void BM_MemFile_First_Write(benchmark::State& state)
+  {
+    const size_t payload_size = static_cast<size_t>(state.range(0));
+    const auto   allocation   = static_cast<Allocation>(state.range(1));
+    state.SetLabel(AllocationName(allocation));
+
+    const std::vector<char> payload(payload_size, 'x');
+    for (auto _ : state)
+    {
+      state.PauseTiming();
+      eCAL::CMemoryFile mem_file;
+      mem_file.Create(memfile_name.c_str(), true, payload_size, false, MakeAllocation(allocation));
+      state.ResumeTiming();
+
+      WritePayload(mem_file, payload);
+
+      state.PauseTiming();
+      mem_file.Destroy(true);
+      state.ResumeTiming();
+    }
+  }
+
+  // Creation of the memory file, prefaulting moves the page fault costs here
+  void BM_MemFile_Create(benchmark::State& state)
+  {
+    const size_t payload_size = static_cast<size_t>(state.range(0));
+    const auto   allocation   = static_cast<Allocation>(state.range(1));
+    state.SetLabel(AllocationName(allocation));
+
+    for (auto _ : state)
+    {
+      eCAL::CMemoryFile mem_file;
+      mem_file.Create(memfile_name.c_str(), true, payload_size, false, MakeAllocation(allocation));
+
+      state.PauseTiming();
+      mem_file.Destroy(true);
+      state.ResumeTiming();
+    }
+  }
+
+  // Write into an already touched memory file (TLB effects only)
+  void BM_MemFile_Steady_Write(benchmark::State& state)
+  {
+    const size_t payload_size = static_cast<size_t>(state.range(0));
+    const auto   allocation   = static_cast<Allocation>(state.range(1));
+    state.SetLabel(AllocationName(allocation));
+
+    eCAL::CMemoryFile mem_file;
+    mem_file.Create(memfile_name.c_str(), true, payload_size, false, MakeAllocation(allocation));
+
+    const std::vector<char> payload(payload_size, 'x');
+    WritePayload(mem_file, payload);
+
+    for (auto _ : state)
+    {
+      WritePayload(mem_file, payload);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(payload_size));
+
+    mem_file.Destroy(true);
+  }
+
+  void AllocationAndSizeArgs(benchmark::internal::Benchmark* b)
+  {
+    for (int allocation = static_cast<int>(Allocation::Default); allocation <= static_cast<int>(Allocation::PrefaultNumaNode0); ++allocation)
+    {
+      for (int size : { 1 << 20, 50 << 20, 200 << 20 })
+      {
+        b->Args({ size, allocation });
+      }
+    }
+  }
+}
+
+BENCHMARK(BM_MemFile_First_Write)
+  ->Apply(AllocationAndSizeArgs)
+  ->Iterations(20)
+  ->Unit(benchmark::kMicrosecond)
+  ->UseRealTime();
+
+BENCHMARK(BM_MemFile_Create)
+  ->Apply(AllocationAndSizeArgs)
+  ->Iterations(20)
+  ->Unit(benchmark::kMicrosecond)
+  ->UseRealTime();
+
+BENCHMARK(BM_MemFile_Steady_Write)
+  ->Apply(AllocationAndSizeArgs)
+  ->Unit(benchmark::kMicrosecond)
+  ->UseRealTime();
+
+BENCHMARK_MAIN();
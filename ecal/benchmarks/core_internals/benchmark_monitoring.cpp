@@ -0,0 +1,175 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <benchmark/benchmark.h>
+#include "monitoring/ecal_monitoring_store.h"
+#include "ecal_serialize_monitoring.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace eCAL;
+
+namespace
+{
+  // one publisher registration per topic, 10 topics per process
+  std::vector<Registration::Sample> GenerateTopicSamples(size_t topic_count_)
+  {
+    std::vector<Registration::Sample> samples(topic_count_);
+    for (size_t i = 0; i < topic_count_; ++i)
+    {
+      Registration::Sample& sample = samples[i];
+      sample.cmd_type                               = bct_reg_publisher;
+      sample.identifier.entity_id                   = i + 1;
+      sample.identifier.process_id                  = static_cast<int32_t>(1000 + i / 10);
+      sample.identifier.host_name                   = "host_" + std::to_string(i / 1000);
+      sample.topic.process_name                     = "process_" + std::to_string(i / 10);
+      sample.topic.unit_name                        = "unit_" + std::to_string(i / 10);
+      sample.topic.topic_name                       = "topic_" + std::to_string(i);
+      sample.topic.datatype_information.encoding    = "proto";
+      sample.topic.datatype_information.name        = "pb.Benchmark.Type" + std::to_string(i % 100);
+      sample.topic.datatype_information.descriptor  = std::string(512, static_cast<char>('a' + (i % 26)));
+      sample.topic.topic_size                       = 1024;
+    }
+    return samples;
+  }
+
+  // one registration cycle, every 100th topic sends data
+  void NextRegistrationCycle(std::vector<Registration::Sample>& samples_, Monitoring::CMonitoringStore& store_)
+  {
+    for (size_t i = 0; i < samples_.size(); ++i)
+    {
+      Registration::Sample& sample = samples_[i];
+      sample.topic.registration_clock++;
+      if (i % 100 == 0) sample.topic.data_clock += 10;
+      store_.ApplySample(sample);
+    }
+  }
+
+  // full monitoring as struct
+  void BM_GetMonitoringStruct(benchmark::State& state)
+  {
+    auto samples = GenerateTopicSamples(static_cast<size_t>(state.range(0)));
+    Monitoring::CMonitoringStore store;
+    NextRegistrationCycle(samples, store);
+
+    Monitoring::SMonitoring monitoring;
+    for (auto _ : state)
+    {
+      store.GetMonitoring(monitoring, Monitoring::Entity::All);
+      benchmark::DoNotOptimize(monitoring.publishers.data());
+    }
+  }
+
+  // full monitoring serialized, like eCAL::Monitoring::GetMonitoring(std::string&)
+  void BM_GetMonitoringSerialized(benchmark::State& state)
+  {
+    auto samples = GenerateTopicSamples(static_cast<size_t>(state.range(0)));
+    Monitoring::CMonitoringStore store;
+    NextRegistrationCycle(samples, store);
+
+    std::string buffer;
+    for (auto _ : state)
+    {
+      Monitoring::SMonitoring monitoring;
+      store.GetMonitoring(monitoring, Monitoring::Entity::All);
+      SerializeToBuffer(monitoring, buffer);
+      benchmark::DoNotOptimize(buffer.data());
+    }
+  }
+
+  // changes of one registration cycle (1% of the topics)
+  void BM_GetMonitoringChanges(benchmark::State& state)
+  {
+    auto samples = GenerateTopicSamples(static_cast<size_t>(state.range(0)));
+    Monitoring::CMonitoringStore store;
+    NextRegistrationCycle(samples, store);
+
+    Monitoring::SMonitoringChanges changes;
+    store.GetMonitoringChanges(changes, 0, Monitoring::Entity::All);
+    for (auto _ : state)
+    {
+      state.PauseTiming();
+      NextRegistrationCycle(samples, store);
+      state.ResumeTiming();
+
+      store.GetMonitoringChanges(changes, changes.generation, Monitoring::Entity::All);
+      benchmark::DoNotOptimize(changes.monitoring.publishers.data());
+    }
+  }
+
+  // registration cycle applied to the store
+  void BM_ApplyRegistrationCycle(benchmark::State& state)
+  {
+    auto samples = GenerateTopicSamples(static_cast<size_t>(state.range(0)));
+    Monitoring::CMonitoringStore store;
+    NextRegistrationCycle(samples, store);
+
+    for (auto _ : state)
+    {
+      NextRegistrationCycle(samples, store);
+    }
+  }
+
+  // registration cycle applied while a monitoring reader polls the full monitoring
+  void BM_ApplyRegistrationCycleWithReader(benchmark::State& state)
+  {
+    auto samples = GenerateTopicSamples(static_cast<size_t>(state.range(0)));
+    Monitoring::CMonitoringStore store;
+    NextRegistrationCycle(samples, store);
+
+    std::atomic<bool> stop(false);
+    std::thread reader([&store, &stop]()
+      {
+        Monitoring::SMonitoring monitoring;
+        while (!stop) store.GetMonitoring(monitoring, Monitoring::Entity::All);
+      });
+
+    for (auto _ : state)
+    {
+      NextRegistrationCycle(samples, store);
+    }
+
+    stop = true;
+    reader.join();
+  }
+
+  void RegisterMonitoringBenchmark(const char* name, void (*benchmark_)(benchmark::State&))
+  {
+    benchmark::RegisterBenchmark(name, benchmark_)
+      ->Arg(1'000)
+      ->Arg(10'000)
+      ->Unit(benchmark::kMillisecond);
+  }
+}
+
+int main(int argc, char** argv)
+{
+  ::benchmark::Initialize(&argc, argv);
+
+  RegisterMonitoringBenchmark("Monitoring/GetMonitoring/Struct",             &BM_GetMonitoringStruct);
+  RegisterMonitoringBenchmark("Monitoring/GetMonitoring/Serialized",         &BM_GetMonitoringSerialized);
+  RegisterMonitoringBenchmark("Monitoring/GetMonitoringChanges",             &BM_GetMonitoringChanges);
+  RegisterMonitoringBenchmark("Monitoring/ApplyRegistrationCycle",           &BM_ApplyRegistrationCycle);
+  RegisterMonitoringBenchmark("Monitoring/ApplyRegistrationCycle/WithReader", &BM_ApplyRegistrationCycleWithReader);
+
+  ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,176 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/ecal.h>
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ------------------------------------------------------------------------
+// Heap allocation counting (per thread)
+// ------------------------------------------------------------------------
+namespace
+{
+  thread_local std::uint64_t thread_allocations = 0;
+}
+
+void* operator new(std::size_t size_)
+{
+  ++thread_allocations;
+  void* ptr = std::malloc(size_ == 0 ? 1 : size_);
+  if (ptr == nullptr) throw std::bad_alloc();
+  return ptr;
+}
+
+void operator delete(void* ptr_) noexcept
+{
+  std::free(ptr_);
+}
+
+void operator delete(void* ptr_, std::size_t /*size_*/) noexcept
+{
+  std::free(ptr_);
+}
+
+namespace
+{
+  constexpr int registration_delay_ms = 2000;
+
+  enum class TransportLayer : int
+  {
+    Shm = 0,
+    Udp = 1,
+    Tcp = 2,
+  };
+
+  const char* TransportLayerName(TransportLayer layer)
+  {
+    switch (layer)
+    {
+    case TransportLayer::Shm: return "shm";
+    case TransportLayer::Udp: return "udp";
+    case TransportLayer::Tcp: return "tcp";
+    }
+    return "unknown";
+  }
+
+  // Counts the heap allocations of the receiving thread between two receive callbacks,
+  // that is everything a transport layer and the subscriber do to deliver one sample.
+  struct SReceiveState
+  {
+    std::mutex              mtx;
+    std::condition_variable cv;
+    bool                    received = false;
+    std::uint64_t           samples = 0;
+    std::uint64_t           allocations = 0;
+  };
+
+  // Send one sample after the other and measure the steady state receive path
+  void BM_ReceiveAllocations(benchmark::State& state)
+  {
+    const size_t payload_size = static_cast<size_t>(state.range(0));
+    const auto   layer        = static_cast<TransportLayer>(state.range(1));
+    state.SetLabel(TransportLayerName(layer));
+
+    eCAL::Configuration config;
+    config.registration.local.transport_type = eCAL::Registration::Local::eTransportType::shm;
+    eCAL::Initialize(config, "Benchmark_ReceiveAllocations", eCAL::Init::Default);
+
+    eCAL::Publisher::Configuration  pub_config;
+    eCAL::Subscriber::Configuration sub_config;
+    pub_config.layer.shm.enable = sub_config.layer.shm.enable = (layer == TransportLayer::Shm);
+    pub_config.layer.udp.enable = sub_config.layer.udp.enable = (layer == TransportLayer::Udp);
+    pub_config.layer.tcp.enable = sub_config.layer.tcp.enable = (layer == TransportLayer::Tcp);
+
+    eCAL::CPublisher  publisher("benchmark_topic", {}, pub_config);
+    eCAL::CSubscriber subscriber("benchmark_topic", {}, sub_config);
+
+    SReceiveState receive_state;
+    subscriber.SetReceiveCallback(
+      [&receive_state](const eCAL::STopicId&, const eCAL::SDataTypeInformation&, const eCAL::SReceiveCallbackData&)
+      {
+        // the first sample of a receive thread only sets its reference
+        static thread_local std::uint64_t last_thread_allocations = 0;
+        static thread_local bool          has_reference = false;
+
+        const std::uint64_t current_thread_allocations = thread_allocations;
+        {
+          const std::lock_guard<std::mutex> lock(receive_state.mtx);
+          if (has_reference)
+          {
+            receive_state.allocations += current_thread_allocations - last_thread_allocations;
+            receive_state.samples++;
+          }
+          receive_state.received = true;
+        }
+        has_reference           = true;
+        last_thread_allocations = current_thread_allocations;
+        receive_state.cv.notify_one();
+      });
+
+    // wait for registration / matching
+    std::this_thread::sleep_for(std::chrono::milliseconds(registration_delay_ms));
+
+    const std::vector<char> payload(payload_size, 'x');
+    for (auto _ : state)
+    {
+      publisher.Send(payload.data(), payload.size());
+
+      std::unique_lock<std::mutex> lock(receive_state.mtx);
+      receive_state.cv.wait_for(lock, std::chrono::seconds(1), [&receive_state]() { return receive_state.received; });
+      receive_state.received = false;
+    }
+
+    {
+      const std::lock_guard<std::mutex> lock(receive_state.mtx);
+      state.counters["samples"]            = static_cast<double>(receive_state.samples);
+      state.counters["allocations/sample"] = receive_state.samples > 0 ? static_cast<double>(receive_state.allocations) / static_cast<double>(receive_state.samples) : 0.0;
+    }
+
+    subscriber.RemoveReceiveCallback();
+    eCAL::Finalize();
+  }
+
+  void TransportAndSizeArgs(benchmark::internal::Benchmark* b)
+  {
+    for (int layer = static_cast<int>(TransportLayer::Shm); layer <= static_cast<int>(TransportLayer::Tcp); ++layer)
+    {
+      for (int size : { 64, 64 * 1024 })
+      {
+        b->Args({ size, layer });
+      }
+    }
+  }
+}
+
+BENCHMARK(BM_ReceiveAllocations)
+  ->Apply(TransportAndSizeArgs)
+  ->Iterations(10000)
+  ->UseRealTime();
+
+BENCHMARK_MAIN();
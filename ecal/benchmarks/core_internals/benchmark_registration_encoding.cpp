@@ -0,0 +1,145 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <benchmark/benchmark.h>
+#include "ecal_serialize_sample_registration.h"
+#include "ecal_serialize_sample_registration_cache.h"
+#include "registration_generate.h"
+
+#include <string>
+#include <vector>
+
+using namespace eCAL;
+
+namespace
+{
+  constexpr size_t publisher_count = 1000;
+
+  // registration samples of one process with publisher_count publishers, descriptor size given by the benchmark argument
+  Registration::SampleList GeneratePublisherSampleList(size_t descriptor_size_)
+  {
+    Registration::SampleList sample_list;
+    sample_list.push_back(Registration::GenerateProcessSample());
+    for (size_t i = 0; i < publisher_count; ++i)
+    {
+      Registration::Sample& sample = sample_list.push_back();
+      sample = Registration::GenerateTopicSample();
+      sample.cmd_type = bct_reg_publisher;
+      sample.identifier.entity_id = i + 1;
+      sample.topic.topic_name = "topic_" + std::to_string(i);
+      sample.topic.datatype_information.descriptor = std::string(descriptor_size_, static_cast<char>('a' + (i % 26)));
+    }
+    return sample_list;
+  }
+
+  // what changes between two registration cycles
+  void NextRegistrationCycle(Registration::SampleList& sample_list_)
+  {
+    for (auto& sample : sample_list_)
+    {
+      sample.process.registration_clock++;
+      sample.topic.registration_clock++;
+      sample.topic.data_clock += 10;
+      sample.topic.data_id    += 10;
+    }
+  }
+
+  // whole sample list serialized every cycle (shm registration)
+  void BM_SerializeSampleList(benchmark::State& state)
+  {
+    Registration::SampleList sample_list = GeneratePublisherSampleList(static_cast<size_t>(state.range(0)));
+    std::vector<char> buffer;
+
+    for (auto _ : state)
+    {
+      NextRegistrationCycle(sample_list);
+      SerializeToBuffer(sample_list, buffer);
+      benchmark::DoNotOptimize(buffer.data());
+    }
+  }
+
+  // whole sample list with cached entity encoding (shm registration)
+  void BM_EncodeSampleListCached(benchmark::State& state)
+  {
+    Registration::SampleList sample_list = GeneratePublisherSampleList(static_cast<size_t>(state.range(0)));
+    std::vector<char> buffer;
+    Registration::CSampleEncodingCache encoding_cache;
+
+    for (auto _ : state)
+    {
+      NextRegistrationCycle(sample_list);
+      encoding_cache.EncodeSampleList(sample_list, buffer);
+      benchmark::DoNotOptimize(buffer.data());
+    }
+  }
+
+  // every sample serialized on its own every cycle (udp registration)
+  void BM_SerializeSamples(benchmark::State& state)
+  {
+    Registration::SampleList sample_list = GeneratePublisherSampleList(static_cast<size_t>(state.range(0)));
+    std::vector<char> buffer;
+
+    for (auto _ : state)
+    {
+      NextRegistrationCycle(sample_list);
+      for (const auto& sample : sample_list)
+      {
+        SerializeToBuffer(sample, buffer);
+        benchmark::DoNotOptimize(buffer.data());
+      }
+    }
+  }
+
+  // every sample with cached entity encoding (udp registration)
+  void BM_EncodeSamplesCached(benchmark::State& state)
+  {
+    Registration::SampleList sample_list = GeneratePublisherSampleList(static_cast<size_t>(state.range(0)));
+    Registration::CSampleEncodingCache encoding_cache;
+
+    for (auto _ : state)
+    {
+      NextRegistrationCycle(sample_list);
+      for (const auto& sample : sample_list)
+      {
+        benchmark::DoNotOptimize(encoding_cache.Encode(sample).data());
+      }
+      encoding_cache.RemoveUnused();
+    }
+  }
+
+  void RegisterEncodingBenchmark(const char* name, void (*benchmark_)(benchmark::State&))
+  {
+    benchmark::RegisterBenchmark(name, benchmark_)
+      ->Arg(256)
+      ->Arg(32 * 1024)
+      ->Unit(benchmark::kMillisecond);
+  }
+}
+
+int main(int argc, char** argv)
+{
+  ::benchmark::Initialize(&argc, argv);
+
+  RegisterEncodingBenchmark("Registration1000Publishers/SampleList/Serialize", &BM_SerializeSampleList);
+  RegisterEncodingBenchmark("Registration1000Publishers/SampleList/Cached",    &BM_EncodeSampleListCached);
+  RegisterEncodingBenchmark("Registration1000Publishers/Samples/Serialize",    &BM_SerializeSamples);
+  RegisterEncodingBenchmark("Registration1000Publishers/Samples/Cached",       &BM_EncodeSamplesCached);
+
+  ::benchmark::RunSpecifiedBenchmarks();
+}
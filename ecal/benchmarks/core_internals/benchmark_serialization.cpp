@@ -19,7 +19,10 @@
 
 #include <benchmark/benchmark.h>
 #include "ecal_serialize_service.h"
+#include "ecal_serialize_sample_header.h"
+#include "ecal_serialize_sample_payload.h"
 #include "ecal_serialize_sample_registration.h"
+#include "payload_generate.h"
 #include "service_generate.h"
 #include "registration_generate.h"
 
@@ -101,6 +104,45 @@ namespace
     }
   }
 
+  // per message header of a single sample (tcp writer), assembled and serialized for every message
+  template<class SerializationProtocol>
+  void BM_SerializeSampleHeader(benchmark::State& state)
+  {
+    std::string buffer;
+    const eCAL::Payload::TopicInfo topic_info = eCAL::Payload::GenerateTopic();
+
+    int64_t clock(0);
+    for (auto _ : state)
+    {
+      eCAL::Payload::Sample sample;
+      sample.cmd_type              = eCAL::bct_set_sample;
+      sample.topic_info.topic_name = topic_info.topic_name;
+      sample.topic_info.topic_id   = topic_info.topic_id;
+      sample.content.id            = 1;
+      sample.content.clock         = ++clock;
+      sample.content.time          = clock * 1000;
+      sample.content.hash          = clock * 7;
+      sample.content.size          = 1024;
+      SerializationProtocol::SerializeToBuffer(sample, buffer);
+      benchmark::DoNotOptimize(buffer);
+    }
+  }
+
+  // per message header of a single sample, pre-encoded once and patched for every message
+  void BM_PatchFixedSampleHeader(benchmark::State& state)
+  {
+    const eCAL::Payload::TopicInfo topic_info = eCAL::Payload::GenerateTopic();
+    eCAL::Payload::CFixedSampleHeader header(topic_info, false);
+
+    int64_t clock(0);
+    for (auto _ : state)
+    {
+      ++clock;
+      header.SetContent(1, clock, clock * 1000, clock * 7, 1024);
+      benchmark::DoNotOptimize(header.Data().data());
+    }
+  }
+
   template<class SerializationProtocol>
   void RegisterFamily(const char* tag)
   {
@@ -127,6 +169,10 @@ namespace
     benchmark::RegisterBenchmark(
       std::string("Deserialize/RegistrationSampleList/") + tag,
       &BM_Deserialize<SerializationProtocol, eCAL::Registration::SampleList, GenerateSampleList>);
+
+    benchmark::RegisterBenchmark(
+      std::string("Serialize/SampleHeader/") + tag,
+      &BM_SerializeSampleHeader<SerializationProtocol>);
   }
 }
 
@@ -136,6 +182,7 @@ int main(int argc, char** argv)
 
   RegisterFamily<NanopbSerialization>("Nanopb");
   RegisterFamily<ProtozeroSerialization>("Protozero");
+  benchmark::RegisterBenchmark("Serialize/SampleHeader/Fixed", &BM_PatchFixedSampleHeader);
 
   ::benchmark::RunSpecifiedBenchmarks();
 }
\ No newline at end of file
@@ -0,0 +1,132 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/ecal.h>
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  constexpr int registration_delay_ms = 2000;
+  constexpr int receive_timeout_ms    = 1000;
+
+  struct SReceiveState
+  {
+    std::mutex              mtx;
+    std::condition_variable cv;
+    std::uint64_t           received_samples = 0;
+    std::uint64_t           received_bytes   = 0;
+  };
+
+  // Send large messages over the UDP layer (loopback) and measure the delivered throughput.
+  // Every sample is sent after the previous one was received, so the benchmark measures
+  // fragmentation, reassembly, deserialization and dispatch of one message at a time.
+  void BM_UdpReceiveThroughput(benchmark::State& state)
+  {
+    const size_t payload_size = static_cast<size_t>(state.range(0));
+    const bool   mmsg_enabled = state.range(1) != 0;
+    state.SetLabel(mmsg_enabled ? "recvmmsg" : "asio");
+
+    eCAL::Configuration config;
+    config.registration.local.transport_type  = eCAL::Registration::Local::eTransportType::shm;
+    config.transport_layer.udp.mmsg_enabled   = mmsg_enabled;
+    config.transport_layer.udp.send_buffer    = 64 * 1024 * 1024;
+    config.transport_layer.udp.receive_buffer = 64 * 1024 * 1024;
+    eCAL::Initialize(config, "Benchmark_UdpReceiveThroughput", eCAL::Init::Default);
+
+    eCAL::Publisher::Configuration  pub_config;
+    eCAL::Subscriber::Configuration sub_config;
+    pub_config.layer.shm.enable = sub_config.layer.shm.enable = false;
+    pub_config.layer.tcp.enable = sub_config.layer.tcp.enable = false;
+    pub_config.layer.udp.enable = sub_config.layer.udp.enable = true;
+
+    eCAL::CPublisher  publisher("benchmark_udp_topic", {}, pub_config);
+    eCAL::CSubscriber subscriber("benchmark_udp_topic", {}, sub_config);
+
+    SReceiveState receive_state;
+    subscriber.SetReceiveCallback(
+      [&receive_state](const eCAL::STopicId&, const eCAL::SDataTypeInformation&, const eCAL::SReceiveCallbackData& data_)
+      {
+        {
+          const std::lock_guard<std::mutex> lock(receive_state.mtx);
+          receive_state.received_samples++;
+          receive_state.received_bytes += data_.buffer_size;
+        }
+        receive_state.cv.notify_one();
+      });
+
+    // wait for registration / matching
+    std::this_thread::sleep_for(std::chrono::milliseconds(registration_delay_ms));
+
+    const std::vector<char> payload(payload_size, 'x');
+    std::uint64_t sent_samples(0);
+    for (auto _ : state)
+    {
+      publisher.Send(payload.data(), payload.size());
+      sent_samples++;
+
+      // a lost message only costs the receive timeout
+      std::unique_lock<std::mutex> lock(receive_state.mtx);
+      receive_state.cv.wait_for(lock, std::chrono::milliseconds(receive_timeout_ms), [&receive_state, sent_samples]() { return receive_state.received_samples >= sent_samples; });
+      sent_samples = receive_state.received_samples;
+    }
+
+    {
+      const std::lock_guard<std::mutex> lock(receive_state.mtx);
+      const auto iterations = static_cast<std::uint64_t>(state.iterations());
+      state.SetBytesProcessed(static_cast<int64_t>(receive_state.received_bytes));
+      state.counters["received"] = static_cast<double>(receive_state.received_samples);
+      state.counters["lost"]     = static_cast<double>(iterations > receive_state.received_samples ? iterations - receive_state.received_samples : 0);
+    }
+
+    subscriber.RemoveReceiveCallback();
+    eCAL::Finalize();
+  }
+
+  void SizeAndBackendArgs(benchmark::internal::Benchmark* b)
+  {
+#ifdef __linux__
+    const int max_backend = 1;
+#else
+    const int max_backend = 0;
+#endif
+    for (int mmsg = 0; mmsg <= max_backend; ++mmsg)
+    {
+      for (int size = 1024 * 1024; size <= 16 * 1024 * 1024; size *= 2)
+      {
+        b->Args({ size, mmsg });
+      }
+    }
+  }
+}
+
+BENCHMARK(BM_UdpReceiveThroughput)
+  ->Apply(SizeAndBackendArgs)
+  ->Iterations(200)
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -84,6 +84,118 @@
  * 
  * The disadvantage of this setting (memfile_buffer_count > 1) is the higher consumption of resources (memory files, events..)
  *
+ *
+ * --------------------------------------------------------------------------------------------------------------
+ * Lock-free ring buffer (SHM::Configuration::memfile_ring_slots)
+ * --------------------------------------------------------------------------------------------------------------
+ *
+ * With memfile_ring_slots > 0 the publisher writes into a single memory file that is organized as a ring of
+ * equally sized slots. Every slot is protected by a sequence number instead of a mutex, so the publisher never
+ * waits for a subscriber, independent of the number of connected subscribers. Subscribers copy the payload out
+ * of the ring and detect (and drop) samples that have been overwritten before they could be read.
+ *
+ * Subscribers may pin a slot instead of copying it (see CSubscriber::SetReceiveSampleCallback). The ring has a
+ * few spare slots, the publisher writes into one of them instead of overwriting a pinned slot, so it does not
+ * wait for pinned samples either. If all spare slots are pinned, subscribers copy the payload.
+ *
+ * In this mode memfile_buffer_count, zero_copy_mode and acknowledge_timeout_ms have no effect. Subscribers using
+ * an eCAL version without ring buffer support will not receive any data via shared memory from such a publisher.
+ *
+ * A classic memory file grows in place if a sample does not fit. The slots of a ring cannot grow, a larger sample
+ * makes the publisher create a new ring and register it. Its first sample waits up to 100 ms for the acknowledge of
+ * the subscribers that reattach to the new ring, so size memfile_min_size_bytes for the largest expected sample.
+ *
+ *
+ * --------------------------------------------------------------------------------------------------------------
+ * Futex notification (SHM::Configuration::futex_notification, Linux only)
+ * --------------------------------------------------------------------------------------------------------------
+ *
+ * By default a publisher signals every connected subscribing process through its own named event, so the cost
+ * of a send call grows with the number of subscribing processes. With futex_notification enabled, the publisher
+ * increments a single sequence word in the memory file header and wakes up all waiting subscribers with one
+ * system call. Subscribers detect this mode from the memory file header. Subscribers using an eCAL version
+ * without futex support will not receive any data via shared memory from such a publisher.
+ *
+ *
+ * --------------------------------------------------------------------------------------------------------------
+ * Memory file page placement (SHM::Configuration::memfile_huge_pages / memfile_prefault / memfile_numa_node)
+ * --------------------------------------------------------------------------------------------------------------
+ *
+ * Large payloads (images, point clouds) spread over thousands of 4 kB pages. Every page costs a page fault on
+ * first touch and a TLB entry on every access.
+ *
+ * With memfile_huge_pages enabled (Linux only), the memory files are created on the hugetlbfs mount
+ * /dev/hugepages, so they are backed by huge pages (typically 2 MB). Huge pages have to be reserved by the
+ * system administrator (vm.nr_hugepages) and the mount has to be writable for the publishing process. If no
+ * huge page file can be created or mapped, the publisher falls back to regular shared memory. Subscribers
+ * find the file on either location automatically.
+ *
+ * With memfile_prefault enabled, all pages are faulted in when the memory file is created, so the first send
+ * calls do not pay for the page faults. As pages are placed on the NUMA node of the thread that touches them
+ * first, this places the memory file near the publisher as well.
+ *
+ * memfile_numa_node binds the pages of the memory file explicitly to a NUMA node (Linux only).
+ *
+ *
+ * --------------------------------------------------------------------------------------------------------------
+ * Sample batching (UDP::Configuration::batching / TCP::Configuration::batching)
+ * --------------------------------------------------------------------------------------------------------------
+ *
+ * Every sample sent via UDP or TCP carries its own header (topic name, host name, ids, time stamps). For
+ * small payloads published at high rates this header is several times larger than the payload itself.
+ *
+ * With batching enabled the publisher collects the samples of a topic and sends them together in one UDP
+ * datagram / TCP frame as soon as the collected payload reaches batch_max_size_bytes or the oldest collected
+ * sample has waited batch_linger_time_us. The subscriber unpacks the batch and calls the receive callback
+ * for every single sample. The send call returns as soon as the sample is stored in the batch, so its result
+ * only tells that the sample is queued (or that a batch sent during the call failed), not that it was sent.
+ * A batch_linger_time_us of 0 disables the time bound, a batch is then only sent when it is full.
+ *
+ * The disadvantage of this setting is the additional latency of up to batch_linger_time_us per sample.
+ * Subscribers using an eCAL version without batch support are not able to receive batched samples.
+ *
+ *
+ * --------------------------------------------------------------------------------------------------------------
+ * Forward error correction (UDP::Configuration::fec_redundancy_percent)
+ * --------------------------------------------------------------------------------------------------------------
+ *
+ * Large UDP messages are split into many IP fragments, losing a single fragment loses the whole message.
+ *
+ * With fec_redundancy_percent > 0 the publisher splits every message into blocks that fit into one ethernet
+ * frame and adds XOR parity blocks. The parity blocks cover interleaved groups of data blocks, the number of
+ * parity blocks is fec_redundancy_percent of the number of data blocks (at least one). A subscriber restores
+ * one lost block per group. Restored and unrecoverable messages are reported in the subscriber monitoring
+ * (fec_recovered_messages / fec_lost_messages).
+ *
+ * The disadvantage of this setting is the additional bandwidth and the higher number of datagrams per message.
+ * Subscribers using an eCAL version without forward error correction support will not receive any data via
+ * UDP from such a publisher.
+ *
+ *
+ * --------------------------------------------------------------------------------------------------------------
+ * Transient local history for late joining subscribers (History::Configuration::depth)
+ * --------------------------------------------------------------------------------------------------------------
+ *
+ * By default a subscriber only receives samples that are sent after it has been connected to the publisher.
+ *
+ * With depth > 0 the publisher keeps a copy of its last depth samples, also of the ones sent while nobody
+ * was subscribed. As soon as a new subscriber is connected, the kept samples are replayed to it with their
+ * original clock and time stamp, via shared memory for local subscribers and via tcp or udp for remote ones.
+ * Local subscribers of other processes are not signaled, all other subscribers already connected discard the
+ * replayed samples as duplicates.
+ *
+ * The replay is done by a thread of the publisher, one sample after the other, so neither the registration
+ * nor the send calls wait for it longer than for a single replayed sample.
+ *
+ * Through a single slot memory file the publisher waits for the acknowledge of the new subscriber after every
+ * replayed sample (acknowledge_timeout_ms, at least 100 ms). Without this acknowledge the replay is repeated
+ * with every registration refresh until the subscriber has confirmed it.
+ * A ring buffer memory file (memfile_ring_slots >= depth), tcp and udp do not acknowledge samples. The replay is
+ * repeated with the next registration refreshes instead, in case the subscriber has not been attached to the
+ * layer yet, subscribers that already received the samples discard them as duplicates.
+ *
+ * The disadvantage of this setting is one additional payload copy per send call.
+ *
 **/
 
 #pragma once
@@ -111,7 +223,12 @@ namespace eCAL
                                                                The publisher send call is blocked on this event with this timeout (0 == no handshake).*/
           unsigned int memfile_buffer_count    { 1U };    /*!< Maximum number of used buffers (needs to be greater than 1, default = 1) */
           unsigned int memfile_min_size_bytes  { 4096 };  //!< Default memory file size for new publisher (Default: 4096)
-          unsigned int memfile_reserve_percent { 50 };    //!< Dynamic file size reserve before recreating memory file if topic size changes (Default: 50)
+          unsigned int memfile_reserve_percent { 50 };    //!< Dynamic file size reserve before growing the memory file if topic size changes (Default: 50)
+          unsigned int memfile_ring_slots      { 0U };    //!< Number of slots of the lock-free ring buffer memory file (0 == single slot memory file guarded by a mutex, Default: 0)
+          bool         futex_notification      { false }; //!< Signal subscribers via one futex word in the memory file instead of one named event per process (Linux only, Default: false)
+          bool         memfile_huge_pages      { false }; //!< Back memory files by huge pages of the hugetlbfs mount /dev/hugepages (Linux only, Default: false)
+          bool         memfile_prefault        { false }; //!< Fault in all pages of a memory file when it is created instead of on first write (Default: false)
+          int          memfile_numa_node       { -1 };    //!< Bind the pages of memory files to this NUMA node (Linux only, -1 == no binding, Default: -1)
         };
       }
 
@@ -119,7 +236,13 @@ namespace eCAL
       {
         struct Configuration
         {
-          bool enable { true };                          //!< enable layer
+          bool         enable                { true };   //!< enable layer
+
+          bool         batching              { false };  //!< Collect multiple samples and send them in one udp datagram (Default: false)
+          unsigned int batch_max_size_bytes  { 1200 };   //!< Send the batch as soon as its payload reaches this size (Default: 1200)
+          unsigned int batch_linger_time_us  { 1000 };   //!< Maximum time a sample waits in the batch before it is sent (Default: 1000)
+
+          unsigned int fec_redundancy_percent { 0 };     //!< Forward error correction parity data in percent of the message size (0 == disabled, Default: 0)
         };
       }
 
@@ -127,7 +250,11 @@ namespace eCAL
       {
         struct Configuration
         {
-          bool enable { true };                          //!< enable layer
+          bool         enable                { true };   //!< enable layer
+
+          bool         batching              { false };  //!< Collect multiple samples and send them in one tcp frame (Default: false)
+          unsigned int batch_max_size_bytes  { 65536 };  //!< Send the batch as soon as its payload reaches this size (Default: 65536)
+          unsigned int batch_linger_time_us  { 1000 };   //!< Maximum time a sample waits in the batch before it is sent (Default: 1000)
         };
       }
 
@@ -139,9 +266,18 @@ namespace eCAL
       };
     }
 
+    namespace History
+    {
+      struct Configuration
+      {
+        unsigned int depth { 0U };                       //!< Number of last samples replayed to late joining subscribers (0 == no history, Default: 0)
+      };
+    }
+
     struct Configuration
     {
-      Layer::Configuration layer;                        //!< Layer configuration
+      Layer::Configuration   layer;                      //!< Layer configuration
+      History::Configuration history;                    //!< Transient local history configuration
 
       using LayerPriorityVector = std::vector<TransportLayer::eType>;
       LayerPriorityVector  layer_priority_local    { TransportLayer::eType::shm,    TransportLayer::eType::udp_mc, TransportLayer::eType::tcp };
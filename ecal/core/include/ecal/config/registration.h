@@ -87,6 +87,20 @@ namespace eCAL
       };
     } // namespace Network
 
+    namespace Delta
+    {
+      struct Configuration
+      {
+        bool         enable             { false }; /*!< Send the full registration state of an entity only if it changed and small heartbeats
+                                                        (entity id + state generation) otherwise. Receivers request the full state if they miss a change.
+                                                        As long as processes of older eCAL versions are registered, full states are sent every cycle (Default: false) */
+        unsigned int statistics_cycles  { 10U };   //!< Number of registration refresh cycles after which entities with changed statistics only (data clock, frequency, drops, ..) send their full state (Default: 10)
+        bool         descriptor_hashing { false }; /*!< Send the datatype descriptors of publishers and subscribers once, keyed by their content hash.
+                                                        Registrations carry the hash only, receivers request unknown descriptors.
+                                                        As long as processes of older eCAL versions are registered, descriptors are sent with every registration (Default: false) */
+      };
+    } // namespace Delta
+
     struct Configuration
     {
       unsigned int           registration_timeout { 10000U }; //!< Timeout for topic registration in ms (internal) (Default: 10000)
@@ -97,6 +111,7 @@ namespace eCAL
                                                                  (virtual) host borders (e.g, Docker); by default equivalent to local host name (Default: "") */
       Local::Configuration   local;
       Network::Configuration network; 
+      Delta::Configuration   delta;
     };
   }
 }
\ No newline at end of file
@@ -38,7 +38,8 @@ namespace eCAL
       {
         struct Configuration
         {
-          bool enable { true }; //!< enable layer (Default: true)
+          bool   enable             { true }; //!< enable layer (Default: true)
+          size_t max_pinned_samples { 1 };    //!< maximum number of ring buffer memory file samples a sample callback receiver can hold pinned at once, further samples are copied (0 == always copy, Default: 1)
         };
       }
 
@@ -66,11 +67,55 @@ namespace eCAL
       };
     }
 
+    namespace Callback
+    {
+      enum class eExecutor
+      {
+        synchronous,       //!< execute the receive callback on the transport layer thread
+        dedicated_thread,  //!< execute the receive callback on an own thread of the subscriber
+        shared_pool        //!< execute the receive callback on a thread pool shared by all subscribers of the process
+      };
+
+      enum class eQueuePolicy
+      {
+        keep_latest,       //!< drop the oldest queued sample if the queue is full
+        keep_all,          //!< drop the new sample if the queue is full
+        block_publisher    //!< block the transport layer (and with that the publisher via the shm acknowledge, if configured) until the queue has space
+      };
+
+      struct Configuration
+      {
+        eExecutor    executor         { eExecutor::synchronous };        //!< receive callback executor (Default: synchronous)
+        eQueuePolicy queue_policy     { eQueuePolicy::keep_latest };     //!< behavior of a full receive queue, asynchronous executors only (Default: keep_latest)
+        size_t       queue_size       { 1 };                             //!< maximum number of queued samples, asynchronous executors only (Default: 1)
+        size_t       shared_pool_size { 2 };                             //!< number of threads of the process wide shared pool, applied by the first subscriber that creates the pool (Default: 2)
+      };
+    }
+
+    namespace Filter
+    {
+      /**
+       * @brief Sample filter, evaluated per publisher based on the send clock and the send time stamp of the samples.
+       *
+       * The filter is announced via registration, so publishers skip signaling (shm) or sending (tcp, udp)
+       * samples that no connected subscriber wants. The subscriber applies it locally too.
+       * Filtered samples are not counted as message drops.
+      **/
+      struct Configuration
+      {
+        unsigned int downsampling_factor { 1 };   //!< pass only every Nth sample of a publisher (0, 1 == every sample, Default: 1)
+        double       max_frequency       { 0.0 }; //!< pass samples of a publisher with at most this frequency [Hz] (0 == unlimited, Default: 0)
+      };
+    }
+
     struct Configuration
     {
-      Layer::Configuration layer;
+      Layer::Configuration    layer;
+      Callback::Configuration callback;
+      Filter::Configuration   filter;
 
       bool drop_out_of_order_messages { true }; //!< Enable dropping of payload messages that arrive out of order
+      bool latency_tracing            { false }; //!< Collect delivery latency and callback execution time histograms per publisher and transport layer, reported in the topic monitoring (Default: false)
     };
   }
 }
@@ -63,6 +63,14 @@ namespace eCAL
                                                                          independent of their link state. Enabling this makes sure that eCAL processes
                                                                          receive data if they are started before network devices are up and running. (Default: false)*/
         bool                    npcap_enabled       { false };   //!< Enable to receive UDP traffic with the Npcap based receiver (Default: false)
+        bool                    mmsg_enabled        { false };   /*!< Linux specific setting to send and receive the topic payload with the sendmmsg / recvmmsg
+                                                                         based UDP backend. All datagrams of a fragmented message are handed over
+                                                                         to the kernel with one call, received datagrams are read in batches. (Default: false)*/
+        unsigned int            receive_threads     { 1 };       /*!< Number of sockets / threads receiving the topic payload. Topics are distributed across them
+                                                                         by their multicast group, so a busy group does not delay the others.
+                                                                         Only used in network mode on Linux, otherwise one thread is used. (Default: 1)*/
+        unsigned int            max_message_size    { 67108864 }; /*!< Maximum size of a received topic payload message in bytes. Larger (or damaged) messages
+                                                                         announced by a datagram header are dropped before any buffer is allocated. (Default: 64 MiB)*/
       
         MulticastConfiguration  network             { "239.0.0.1", 3U };      //!< default: "239.0.0.1", 3U
         MulticastConfiguration  local               { "127.255.255.255", 1U}; //!< default: "127.255.255.255", 1U
@@ -79,10 +87,26 @@ namespace eCAL
       };
     }
 
+    namespace SHM
+    {
+      struct Configuration
+      {
+        size_t             observer_threads           { 0 }; /*!< Number of threads that share the observation of memory files of publishers
+                                                                  using futex notification. The data callbacks of these memory files are
+                                                                  executed by the shared threads (Linux only).
+                                                                  Only applies to publishers with futex_notification enabled (publisher
+                                                                  shm configuration), memory files signaled via named events (the default)
+                                                                  are always observed by one thread per memory file.
+                                                                  0 == one thread per memory file (Default: 0) */
+        unsigned long long observer_cpu_affinity_mask { 0 }; //!< CPUs the shared observer threads are distributed to (bit n == CPU n, 0 == no affinity, Linux only, Default: 0)
+      };
+    }
+
     struct Configuration
     {
       UDP::Configuration udp;
       TCP::Configuration tcp;
+      SHM::Configuration shm;
     };
   }
 }
\ No newline at end of file
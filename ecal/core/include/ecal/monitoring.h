@@ -26,6 +26,7 @@
 
 #include <ecal/os.h>
 #include <ecal/types/monitoring.h>
+#include <cstdint>
 #include <string>
 
 namespace eCAL
@@ -51,6 +52,22 @@ namespace eCAL
      * @return True if succeeded.
     **/
     ECAL_API bool GetMonitoring(SMonitoring& mon_, unsigned int entities_ = Entity::All);
+
+    /**
+     * @brief Get the monitoring entities that changed since a former call.
+     *
+     * Only entities that were registered, changed (apart from their registration clock) or removed
+     * after the passed generation are returned. Removals have to be applied before the changed entities.
+     * If the generation is 0, was handed out before eCAL was finalized and initialized again or is no longer
+     * known (e.g. too many removals since then), the full monitoring is returned and full_state is set.
+     *
+     * @param [out] changes_     Target struct to store the changed entities and the new generation.
+     * @param       generation_  Generation of the last result, 0 to get the full monitoring.
+     * @param       entities_    Entities definition.
+     *
+     * @return True if succeeded.
+    **/
+    ECAL_API bool GetMonitoringChanges(SMonitoringChanges& changes_, uint64_t generation_, unsigned int entities_ = Entity::All);
   }
   /** @example monitoring_rec.cpp
   * This is an example how the eCAL Monitoring API may be utilized to print monitoring information.
@@ -0,0 +1,124 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @file   pubsub/payload_loan.h
+ * @brief  eCAL publisher payload loan
+**/
+
+#pragma once
+
+#include <ecal/os.h>
+
+#include <cstddef>
+#include <memory>
+
+namespace eCAL
+{
+  class CPublisherImpl;
+
+  /**
+   * @brief Payload buffer loaned from a publisher (see CPublisher::Loan).
+   *
+   * The message is constructed directly in the loaned buffer and published via
+   * CPublisher::Publish. If shared memory is the only active transport layer and the
+   * publisher writes a ring buffer memory file (memfile_ring_slots > 0), the buffer is
+   * the next ring slot, so the payload is never copied on the publisher side. Otherwise
+   * it is a buffer owned by the publisher that all transport layers read from.
+   *
+   * A loan that is destroyed without being published is given back to the publisher.
+   * A publisher hands out one loan at a time, a loan must not outlive its publisher.
+   * A loan does not lock any memory file, so it may be filled, published or given
+   * back by any thread.
+  **/
+  class ECAL_API_CLASS CPayloadLoan
+  {
+  public:
+    /**
+     * @brief Constructor (invalid loan).
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      CPayloadLoan();
+
+    /**
+     * @brief Destructor, gives back a loan that was not published.
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      ~CPayloadLoan();
+
+    /**
+     * @brief CPayloadLoans are non-copyable
+    **/
+    CPayloadLoan(const CPayloadLoan&) = delete;
+
+    /**
+     * @brief CPayloadLoans are non-copyable
+    **/
+    CPayloadLoan& operator=(const CPayloadLoan&) = delete;
+
+    /**
+     * @brief CPayloadLoans are move-enabled
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      CPayloadLoan(CPayloadLoan&& rhs) noexcept;
+
+    /**
+     * @brief CPayloadLoans are move-enabled
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      CPayloadLoan& operator=(CPayloadLoan&& rhs) noexcept;
+
+    /**
+     * @brief Give back the loan without publishing it.
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      void Return();
+
+    /**
+     * @brief Check if the loan holds a buffer.
+     *
+     * @return  True if the loan can be filled and published.
+    **/
+    bool IsValid() const { return m_valid; }
+
+    /**
+     * @brief Address of the loaned buffer.
+     *
+     * @return  The buffer address (nullptr for an invalid loan).
+    **/
+    void* GetData() const { return m_data; }
+
+    /**
+     * @brief Size of the loaned buffer.
+     *
+     * @return  The size in bytes.
+    **/
+    size_t GetSize() const { return m_size; }
+
+  private:
+    friend class CPublisher;
+
+    CPayloadLoan(const std::shared_ptr<CPublisherImpl>& publisher_impl_, void* data_, size_t size_);
+
+    std::weak_ptr<CPublisherImpl> m_publisher_impl;
+    void*                         m_data  = nullptr;
+    size_t                        m_size  = 0;
+    bool                          m_valid = false;
+  };
+}
@@ -31,6 +31,7 @@
 
 #include <ecal/pubsub/types.h>
 #include <ecal/pubsub/payload_writer.h>
+#include <ecal/pubsub/payload_loan.h>
 
 #include <ecal/config.h>
 
@@ -133,6 +134,32 @@ namespace eCAL
     ECAL_API_EXPORTED_MEMBER
       bool Send(const std::string& payload_, long long time_ = DEFAULT_TIME_ARGUMENT);
 
+    /**
+     * @brief Loan a payload buffer to construct a message in place.
+     *
+     * If shared memory is the only active transport layer and a ring buffer memory file is
+     * used (memfile_ring_slots > 0), the buffer is located in the memory file, so the message
+     * is never copied on the publisher side. The loan may be published from any thread.
+     * Only one loan can be pending per publisher, Send fails while a loan is pending.
+     *
+     * @param size_  Size of the message in bytes.
+     *
+     * @return  The loan (check CPayloadLoan::IsValid).
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      CPayloadLoan Loan(size_t size_);
+
+    /**
+     * @brief Publish a loaned payload buffer to all subscribers.
+     *
+     * @param loan_  The loan filled by the application (it is invalid afterwards).
+     * @param time_  Send time (-1 = use eCAL system time in us, default = -1).
+     *
+     * @return  True if succeeded, false if not.
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      bool Publish(CPayloadLoan&& loan_, long long time_ = DEFAULT_TIME_ARGUMENT);
+
     /**
      * @brief Query the number of subscribers.
      *
@@ -0,0 +1,124 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @file   pubsub/receive_sample.h
+ * @brief  eCAL subscriber sample handle
+**/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace eCAL
+{
+  class CSubscriberImpl;
+
+  /**
+   * @brief Reference counted handle of a received sample (see CSubscriber::SetReceiveSampleCallback).
+   *
+   * Copies of the handle share the sample, the payload buffer stays accessible until the
+   * last copy is destroyed or released, even if that happens after the subscriber has been
+   * destroyed. So a sample can be handed over to another thread without copying its payload.
+   *
+   * A pinned sample references a slot of a ring buffer memory file publisher directly. The
+   * publisher does not block on pinned samples, it writes the following samples into spare
+   * slots of the ring and does not reuse the pinned one until the sample is released. The
+   * number of spare slots is limited and shared by all subscribers of the publisher, samples
+   * are copied if all of them are in use. So pinned samples should be released soon.
+   *
+   * If the observation ends before (the publisher disconnects or the subscriber is destroyed),
+   * the memory file is kept mapped until the last pinned sample is released, so its buffer
+   * stays accessible.
+  **/
+  class CReceiveSample
+  {
+  public:
+    /**
+     * @brief Constructor (empty sample).
+    **/
+    CReceiveSample() = default;
+
+    /**
+     * @brief Payload buffer, containing the sent data.
+    **/
+    const void* GetBuffer() const { return m_buffer; }
+
+    /**
+     * @brief Payload buffer size.
+    **/
+    size_t GetBufferSize() const { return m_buffer_size; }
+
+    /**
+     * @brief Publisher send timestamp in µs.
+    **/
+    int64_t GetSendTimestamp() const { return m_send_timestamp; }
+
+    /**
+     * @brief Publisher send clock.
+    **/
+    int64_t GetSendClock() const { return m_send_clock; }
+
+    /**
+     * @brief Check if the payload is located in the transport layer buffer (no copy).
+    **/
+    bool IsPinned() const { return m_pinned; }
+
+    /**
+     * @brief Check if the handle references a sample.
+    **/
+    bool IsValid() const { return m_owner != nullptr; }
+
+    /**
+     * @brief Drop the reference of this handle, the sample is released with its last reference.
+    **/
+    void Release()
+    {
+      m_owner.reset();
+      m_buffer         = nullptr;
+      m_buffer_size    = 0;
+      m_send_timestamp = 0;
+      m_send_clock     = 0;
+      m_pinned         = false;
+    }
+
+  private:
+    friend class CSubscriberImpl;
+
+    CReceiveSample(std::shared_ptr<const void> owner_, const void* buffer_, size_t buffer_size_, int64_t send_timestamp_, int64_t send_clock_, bool pinned_) :
+      m_owner(std::move(owner_)),
+      m_buffer(buffer_),
+      m_buffer_size(buffer_size_),
+      m_send_timestamp(send_timestamp_),
+      m_send_clock(send_clock_),
+      m_pinned(pinned_)
+    {
+    }
+
+    std::shared_ptr<const void> m_owner;          // keeps the payload alive (copied buffer or transport layer pin)
+    const void*                 m_buffer         = nullptr;
+    size_t                      m_buffer_size    = 0;
+    int64_t                     m_send_timestamp = 0;
+    int64_t                     m_send_clock     = 0;
+    bool                        m_pinned         = false;
+  };
+}
@@ -102,6 +102,21 @@ namespace eCAL
     ECAL_API_EXPORTED_MEMBER
       void SetReceiveCallback(ReceiveCallbackT callback_);
 
+    /**
+     * @brief Set/overwrite callback function for incoming receives, delivering sample handles.
+     *
+     * The sample handle can be copied and kept beyond the callback (e.g. handed over to a worker thread).
+     * Samples of shared memory publishers using a ring buffer memory file (memfile_ring_slots > 0) are pinned
+     * without copying the payload, as long as less than max_pinned_samples (subscriber shm configuration) are
+     * held and the ring has a spare slot, further samples are copied. Pinned samples never block the publisher.
+     * Samples queued for an asynchronous callback executor (callback configuration) are always copied.
+     * A receive callback set via SetReceiveCallback is replaced and vice versa.
+     *
+     * @param callback_  The callback function to set.
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      void SetReceiveSampleCallback(ReceiveSampleCallbackT callback_);
+
     /**
      * @brief Remove callback function for incoming receives.
     **/
@@ -27,6 +27,7 @@
 #include <ecal/deprecate.h>
 #include <ecal/namespace.h>
 #include <ecal/types.h>
+#include <ecal/pubsub/receive_sample.h>
 
 #include <functional>
 #include <string>
@@ -122,6 +123,15 @@ namespace eCAL
   **/
   using ReceiveCallbackT = std::function<void(const STopicId& publisher_id_, const SDataTypeInformation& data_type_info_, const SReceiveCallbackData& data_)>;
 
+  /**
+   * @brief Receive sample callback function type. Like ReceiveCallbackT, but the sample handle may be copied and kept beyond the callback.
+   *
+   * @param publisher_id_    The topic id of the publisher that has sent the data which is now being received.
+   * @param data_type_info_  Topic metadata, as set by the publisher (encoding, type, descriptor).
+   * @param sample_          Reference counted handle of the received sample.
+  **/
+  using ReceiveSampleCallbackT = std::function<void(const STopicId& publisher_id_, const SDataTypeInformation& data_type_info_, const CReceiveSample& sample_)>;
+
   /**
    * @brief eCAL publisher event callback struct.
   **/
@@ -69,6 +69,37 @@ namespace eCAL
       bool         active  = false;                                //<! transport layer used?
     };
 
+    struct SLatencyHistogram                                       //<! latency histogram
+    {
+      std::vector<int64_t> bucket_limits_us;                       //!< upper bucket limits [us], one more bucket counts all greater latencies
+      std::vector<int64_t> bucket_counts;                          //!< number of samples per bucket
+    };
+
+    struct SAcknowledgeStatistics                                  //<! shm acknowledge statistics of a local subscriber process
+    {
+      int32_t              process_id{0};                          //!< subscriber process id
+      int64_t              acknowledge_count{0};                   //!< number of samples acknowledged in time
+      int64_t              timeout_count{0};                       //!< number of acknowledge timeouts
+      SLatencyHistogram    latency;                                //!< acknowledge latency
+    };
+
+    struct SCallbackStatistics                                     //<! asynchronous receive callback statistics of a subscriber
+    {
+      int32_t              queue_size{0};                          //!< maximum number of queued samples (0 == synchronous callbacks)
+      int32_t              queue_depth{0};                         //!< currently queued samples
+      int64_t              executed_count{0};                      //!< number of executed samples
+      int64_t              drop_count{0};                          //!< number of samples dropped by the queue policy
+      SLatencyHistogram    latency;                                //!< latency from reception to callback return
+    };
+
+    struct SLatencyStatistics                                      //<! receive latency statistics of a subscriber for one publisher and transport layer
+    {
+      EntityIdT            publisher_id{0};                        //!< publisher entity id
+      eTransportLayerType  layer = eTransportLayerType::none;      //!< receiving transport layer
+      SLatencyHistogram    delivery_latency;                       //!< latency from the send time stamp to the reception (requires synchronized clocks for remote publishers)
+      SLatencyHistogram    callback_latency;                       //!< execution time of the receive callback
+    };
+
     struct STopic                                                  //<! eCAL Topic struct
     {
       int32_t                             registration_clock{0};   //!< registration clock (heart beat)
@@ -92,6 +123,13 @@ namespace eCAL
       int64_t                             data_id{0};              //!< data send id (publisher setid)
       int64_t                             data_clock{0};           //!< data clock (send / receive action)
       int32_t                             data_frequency{0};       //!< data frequency (send / receive samples per second) [mHz]
+
+      int64_t                             fec_recovered_messages{0}; //!< udp messages restored from forward error correction parity (subscriber only)
+      int64_t                             fec_lost_messages{0};      //!< udp messages that could not be restored from forward error correction parity (subscriber only)
+
+      std::vector<SAcknowledgeStatistics> acknowledge_statistics;  //!< shm acknowledge statistics per subscriber process (publisher only)
+      SCallbackStatistics                 callback_statistics;     //!< asynchronous receive callback statistics (subscriber only)
+      std::vector<SLatencyStatistics>     latency_statistics;      //!< receive latency per publisher and transport layer (subscriber only, latency tracing enabled)
     };
 
     struct SProcess                                                //<! eCAL Process struct
@@ -182,5 +220,17 @@ namespace eCAL
       std::vector<SServer>   servers;                         //<! server info vector
       std::vector<SClient>   clients;                        //<! clients info vector
     };
+
+    struct SMonitoringChanges                                   //<! eCAL Monitoring changes since a generation
+    {
+      uint64_t               generation{0};                  //<! generation of this result (opaque), pass it to the next GetMonitoringChanges call
+      bool                   full_state{false};              //<! monitoring contains all entities (no known generation was passed)
+      SMonitoring            monitoring;                     //<! new or changed entities (all entities for a full state)
+      std::vector<EntityIdT> removed_processes;              //<! removed process entity ids
+      std::vector<EntityIdT> removed_publishers;             //<! removed publisher ids
+      std::vector<EntityIdT> removed_subscribers;            //<! removed subscriber ids
+      std::vector<EntityIdT> removed_servers;                //<! removed server ids
+      std::vector<EntityIdT> removed_clients;                //<! removed client ids
+    };
   }
 }
@@ -41,6 +41,10 @@ namespace eCAL
 
     attr.shm.domain        = reg_config.local.shm.domain;
     attr.shm.queue_size    = reg_config.local.shm.queue_size;
+
+    attr.delta.enable            = reg_config.delta.enable;
+    attr.delta.statistics_cycles = reg_config.delta.statistics_cycles;
+    attr.delta.descriptor_hashing = reg_config.delta.descriptor_hashing;
      
     switch (config_.communication_mode)
     {
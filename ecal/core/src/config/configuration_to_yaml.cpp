@@ -182,6 +182,23 @@ namespace YAML
     return true;
   }
   
+  Node convert<eCAL::Registration::Delta::Configuration>::encode(const eCAL::Registration::Delta::Configuration& config_)
+  {
+    Node node;
+    node["enable"]            = config_.enable;
+    node["statistics_cycles"] = config_.statistics_cycles;
+    node["descriptor_hashing"] = config_.descriptor_hashing;
+    return node;
+  }
+
+  bool convert<eCAL::Registration::Delta::Configuration>::decode(const Node& node_, eCAL::Registration::Delta::Configuration& config_)
+  {
+    AssignValue<bool>(config_.enable, node_, "enable");
+    AssignValue<unsigned int>(config_.statistics_cycles, node_, "statistics_cycles");
+    AssignValue<bool>(config_.descriptor_hashing, node_, "descriptor_hashing");
+    return true;
+  }
+
   Node convert<eCAL::Registration::Configuration>::encode(const eCAL::Registration::Configuration& config_)
   {
     Node node;
@@ -189,6 +206,7 @@ namespace YAML
     node["registration_refresh"] = config_.registration_refresh;
     node["loopback"]             = config_.loopback;
     node["shm_transport_domain"] = config_.shm_transport_domain;
+    node["delta"]                = config_.delta;
     return node;
   }
 
@@ -199,6 +217,7 @@ namespace YAML
     AssignValue<bool>(config_.loopback, node_, "loopback");    
     AssignValue<eCAL::Registration::Local::Configuration>(config_.local, node_, "local");
     AssignValue<eCAL::Registration::Network::Configuration>(config_.network, node_, "network");
+    AssignValue<eCAL::Registration::Delta::Configuration>(config_.delta, node_, "delta");
 
     std::string shm_transport_domain;
     AssignValue<std::string>(shm_transport_domain, node_, "shm_transport_domain");
@@ -233,6 +252,21 @@ namespace YAML
     return true;
   }
 
+  Node convert<eCAL::TransportLayer::SHM::Configuration>::encode(const eCAL::TransportLayer::SHM::Configuration& config_)
+  {
+    Node node;
+    node["observer_threads"]           = config_.observer_threads;
+    node["observer_cpu_affinity_mask"] = config_.observer_cpu_affinity_mask;
+    return node;
+  }
+
+  bool convert<eCAL::TransportLayer::SHM::Configuration>::decode(const Node& node_, eCAL::TransportLayer::SHM::Configuration& config_)
+  {
+    AssignValue<unsigned int>(config_.observer_threads, node_, "observer_threads");
+    AssignValue<unsigned long long>(config_.observer_cpu_affinity_mask, node_, "observer_cpu_affinity_mask");
+    return true;
+  }
+
   Node convert<eCAL::TransportLayer::UDP::MulticastConfiguration>::encode(const eCAL::TransportLayer::UDP::MulticastConfiguration& config_)
   {
     Node node;
@@ -258,6 +292,9 @@ namespace YAML
     node["receive_buffer"]      = config_.receive_buffer;
     node["join_all_interfaces"] = config_.join_all_interfaces;
     node["npcap_enabled"]       = config_.npcap_enabled;
+    node["mmsg_enabled"]        = config_.mmsg_enabled;
+    node["receive_threads"]     = config_.receive_threads;
+    node["max_message_size"]    = config_.max_message_size;
     node["network"]             = config_.network;
     node["local"]               = config_.local;
     return node;
@@ -276,6 +313,9 @@ namespace YAML
     AssignValue<unsigned int>(config_.receive_buffer, node_, "receive_buffer");
     AssignValue<bool>(config_.join_all_interfaces, node_, "join_all_interfaces");
     AssignValue<bool>(config_.npcap_enabled, node_, "npcap_enabled");
+    AssignValue<bool>(config_.mmsg_enabled, node_, "mmsg_enabled");
+    AssignValue<unsigned int>(config_.receive_threads, node_, "receive_threads");
+    AssignValue<unsigned int>(config_.max_message_size, node_, "max_message_size");
 
     AssignValue<eCAL::TransportLayer::UDP::MulticastConfiguration>(config_.network, node_, "network");
     AssignValue<eCAL::TransportLayer::UDP::MulticastConfiguration>(config_.local, node_, "local");
@@ -287,6 +327,7 @@ namespace YAML
     Node node;
     node["udp"] = config_.udp;
     node["tcp"] = config_.tcp;
+    node["shm"] = config_.shm;
 
     return node;
   }
@@ -295,6 +336,7 @@ namespace YAML
   {
     AssignValue<eCAL::TransportLayer::UDP::Configuration>(config_.udp, node_, "udp");
     AssignValue<eCAL::TransportLayer::TCP::Configuration>(config_.tcp, node_, "tcp");
+    AssignValue<eCAL::TransportLayer::SHM::Configuration>(config_.shm, node_, "shm");
     return true;
   }
 
@@ -315,6 +357,11 @@ namespace YAML
     node["memfile_buffer_count"]     = config_.memfile_buffer_count;
     node["memfile_min_size_bytes"]   = config_.memfile_min_size_bytes;
     node["memfile_reserve_percent"]  = config_.memfile_reserve_percent;
+    node["memfile_ring_slots"]       = config_.memfile_ring_slots;
+    node["futex_notification"]       = config_.futex_notification;
+    node["memfile_huge_pages"]       = config_.memfile_huge_pages;
+    node["memfile_prefault"]         = config_.memfile_prefault;
+    node["memfile_numa_node"]        = config_.memfile_numa_node;
     return node;
   }
 
@@ -326,13 +373,22 @@ namespace YAML
     AssignValue<unsigned int>(config_.memfile_buffer_count, node_, "memfile_buffer_count");
     AssignValue<unsigned int>(config_.memfile_min_size_bytes, node_, "memfile_min_size_bytes");
     AssignValue<unsigned int>(config_.memfile_reserve_percent, node_, "memfile_reserve_percent");
+    AssignValue<unsigned int>(config_.memfile_ring_slots, node_, "memfile_ring_slots");
+    AssignValue<bool>(config_.futex_notification, node_, "futex_notification");
+    AssignValue<bool>(config_.memfile_huge_pages, node_, "memfile_huge_pages");
+    AssignValue<bool>(config_.memfile_prefault, node_, "memfile_prefault");
+    AssignValue<int>(config_.memfile_numa_node, node_, "memfile_numa_node");
     return true;
   }
   
   Node convert<eCAL::Publisher::Layer::UDP::Configuration>::encode(const eCAL::Publisher::Layer::UDP::Configuration& config_)
   {
     Node node;
-    node["enable"] = config_.enable;
+    node["enable"]               = config_.enable;
+    node["batching"]             = config_.batching;
+    node["batch_max_size_bytes"] = config_.batch_max_size_bytes;
+    node["batch_linger_time_us"] = config_.batch_linger_time_us;
+    node["fec_redundancy_percent"] = config_.fec_redundancy_percent;
 
     return node;
   }
@@ -340,13 +396,20 @@ namespace YAML
   bool convert<eCAL::Publisher::Layer::UDP::Configuration>::decode(const Node& node_, eCAL::Publisher::Layer::UDP::Configuration& config_)
   {
     AssignValue<bool>(config_.enable, node_, "enable");
+    AssignValue<bool>(config_.batching, node_, "batching");
+    AssignValue<unsigned int>(config_.batch_max_size_bytes, node_, "batch_max_size_bytes");
+    AssignValue<unsigned int>(config_.batch_linger_time_us, node_, "batch_linger_time_us");
+    AssignValue<unsigned int>(config_.fec_redundancy_percent, node_, "fec_redundancy_percent");
     return true;
   }
   
   Node convert<eCAL::Publisher::Layer::TCP::Configuration>::encode(const eCAL::Publisher::Layer::TCP::Configuration& config_)
   {
     Node node;
-    node["enable"] = config_.enable;
+    node["enable"]               = config_.enable;
+    node["batching"]             = config_.batching;
+    node["batch_max_size_bytes"] = config_.batch_max_size_bytes;
+    node["batch_linger_time_us"] = config_.batch_linger_time_us;
 
     return node;
   }
@@ -354,6 +417,9 @@ namespace YAML
   bool convert<eCAL::Publisher::Layer::TCP::Configuration>::decode(const Node& node_, eCAL::Publisher::Layer::TCP::Configuration& config_)
   {
     AssignValue<bool>(config_.enable, node_, "enable");
+    AssignValue<bool>(config_.batching, node_, "batching");
+    AssignValue<unsigned int>(config_.batch_max_size_bytes, node_, "batch_max_size_bytes");
+    AssignValue<unsigned int>(config_.batch_linger_time_us, node_, "batch_linger_time_us");
     return true;
   }
   
@@ -374,10 +440,24 @@ namespace YAML
     return true;
   }
   
+  Node convert<eCAL::Publisher::History::Configuration>::encode(const eCAL::Publisher::History::Configuration& config_)
+  {
+    Node node;
+    node["depth"] = config_.depth;
+    return node;
+  }
+
+  bool convert<eCAL::Publisher::History::Configuration>::decode(const Node& node_, eCAL::Publisher::History::Configuration& config_)
+  {
+    AssignValue<unsigned int>(config_.depth, node_, "depth");
+    return true;
+  }
+
   Node convert<eCAL::Publisher::Configuration>::encode(const eCAL::Publisher::Configuration& config_)
   {
     Node node;
     node["layer"]                   = config_.layer;
+    node["history"]                 = config_.history;
     node["priority_local"]          = transformLayerEnumToStr(config_.layer_priority_local);
     node["priority_network"]        = transformLayerEnumToStr(config_.layer_priority_remote);
     return node;
@@ -393,6 +473,7 @@ namespace YAML
     config_.layer_priority_remote = transformLayerStrToEnum(tmp);
 
     AssignValue<eCAL::Publisher::Layer::Configuration>(config_.layer, node_, "layer");    
+    AssignValue<eCAL::Publisher::History::Configuration>(config_.history, node_, "history");
     return true;
   }
 
@@ -407,13 +488,15 @@ namespace YAML
   Node convert<eCAL::Subscriber::Layer::SHM::Configuration>::encode(const eCAL::Subscriber::Layer::SHM::Configuration& config_)
   {
     Node node;
-    node["enable"] = config_.enable;
+    node["enable"]             = config_.enable;
+    node["max_pinned_samples"] = config_.max_pinned_samples;
     return node;
   }
 
   bool convert<eCAL::Subscriber::Layer::SHM::Configuration>::decode(const Node& node_, eCAL::Subscriber::Layer::SHM::Configuration& config_)
   {
     AssignValue<bool>(config_.enable, node_, "enable");
+    AssignValue<unsigned int>(config_.max_pinned_samples, node_, "max_pinned_samples");
     return true;
   }
   
@@ -460,18 +543,110 @@ namespace YAML
     return true;
   }
 
+  Node convert<eCAL::Subscriber::Callback::Configuration>::encode(const eCAL::Subscriber::Callback::Configuration& config_)
+  {
+    Node node;
+    switch (config_.executor)
+    {
+    case eCAL::Subscriber::Callback::eExecutor::synchronous:
+      node["executor"] = "synchronous";
+      break;
+    case eCAL::Subscriber::Callback::eExecutor::dedicated_thread:
+      node["executor"] = "dedicated_thread";
+      break;
+    case eCAL::Subscriber::Callback::eExecutor::shared_pool:
+      node["executor"] = "shared_pool";
+      break;
+    }
+    switch (config_.queue_policy)
+    {
+    case eCAL::Subscriber::Callback::eQueuePolicy::keep_latest:
+      node["queue_policy"] = "keep_latest";
+      break;
+    case eCAL::Subscriber::Callback::eQueuePolicy::keep_all:
+      node["queue_policy"] = "keep_all";
+      break;
+    case eCAL::Subscriber::Callback::eQueuePolicy::block_publisher:
+      node["queue_policy"] = "block_publisher";
+      break;
+    }
+    node["queue_size"]       = config_.queue_size;
+    node["shared_pool_size"] = config_.shared_pool_size;
+    return node;
+  }
+
+  bool convert<eCAL::Subscriber::Callback::Configuration>::decode(const Node& node_, eCAL::Subscriber::Callback::Configuration& config_)
+  {
+    std::string executor;
+    AssignValue<std::string>(executor, node_, "executor");
+
+    if (executor == "synchronous")
+    {
+      config_.executor = eCAL::Subscriber::Callback::eExecutor::synchronous;
+    }
+    else if (executor == "dedicated_thread")
+    {
+      config_.executor = eCAL::Subscriber::Callback::eExecutor::dedicated_thread;
+    }
+    else if (executor == "shared_pool")
+    {
+      config_.executor = eCAL::Subscriber::Callback::eExecutor::shared_pool;
+    }
+
+    std::string queue_policy;
+    AssignValue<std::string>(queue_policy, node_, "queue_policy");
+
+    if (queue_policy == "keep_latest")
+    {
+      config_.queue_policy = eCAL::Subscriber::Callback::eQueuePolicy::keep_latest;
+    }
+    else if (queue_policy == "keep_all")
+    {
+      config_.queue_policy = eCAL::Subscriber::Callback::eQueuePolicy::keep_all;
+    }
+    else if (queue_policy == "block_publisher")
+    {
+      config_.queue_policy = eCAL::Subscriber::Callback::eQueuePolicy::block_publisher;
+    }
+
+    AssignValue<unsigned int>(config_.queue_size, node_, "queue_size");
+    AssignValue<unsigned int>(config_.shared_pool_size, node_, "shared_pool_size");
+    return true;
+  }
+
+  Node convert<eCAL::Subscriber::Filter::Configuration>::encode(const eCAL::Subscriber::Filter::Configuration& config_)
+  {
+    Node node;
+    node["downsampling_factor"] = config_.downsampling_factor;
+    node["max_frequency"] = config_.max_frequency;
+    return node;
+  }
+
+  bool convert<eCAL::Subscriber::Filter::Configuration>::decode(const Node& node_, eCAL::Subscriber::Filter::Configuration& config_)
+  {
+    AssignValue<unsigned int>(config_.downsampling_factor, node_, "downsampling_factor");
+    AssignValue<double>(config_.max_frequency, node_, "max_frequency");
+    return true;
+  }
+
   Node convert<eCAL::Subscriber::Configuration>::encode(const eCAL::Subscriber::Configuration& config_)
   {
     Node node;
     node["layer"] = config_.layer;
+    node["callback"] = config_.callback;
+    node["filter"] = config_.filter;
     node["drop_out_of_order_messages"] = config_.drop_out_of_order_messages;
+    node["latency_tracing"] = config_.latency_tracing;
     return node;
   }
 
   bool convert<eCAL::Subscriber::Configuration>::decode(const Node& node_, eCAL::Subscriber::Configuration& config_)
   {
     AssignValue<eCAL::Subscriber::Layer::Configuration>(config_.layer, node_, "layer");
+    AssignValue<eCAL::Subscriber::Callback::Configuration>(config_.callback, node_, "callback");
+    AssignValue<eCAL::Subscriber::Filter::Configuration>(config_.filter, node_, "filter");
     AssignValue<bool>(config_.drop_out_of_order_messages, node_, "drop_out_of_order_messages");
+    AssignValue<bool>(config_.latency_tracing, node_, "latency_tracing");
     return true;
   }
 
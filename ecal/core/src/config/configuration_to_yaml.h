@@ -89,6 +89,14 @@ namespace YAML
     static bool decode(const Node& node_, eCAL::Registration::Local::Configuration& config_);
   };
 
+  template<>
+  struct convert<eCAL::Registration::Delta::Configuration>
+  {
+    static Node encode(const eCAL::Registration::Delta::Configuration& config_);
+
+    static bool decode(const Node& node_, eCAL::Registration::Delta::Configuration& config_);
+  };
+
   template<>
   struct convert<eCAL::Registration::Configuration>
   {
@@ -113,6 +121,14 @@ namespace YAML
     static bool decode(const Node& node_, eCAL::TransportLayer::TCP::Configuration& config_);
   };
 
+  template<>
+  struct convert<eCAL::TransportLayer::SHM::Configuration>
+  {
+    static Node encode(const eCAL::TransportLayer::SHM::Configuration& config_);
+
+    static bool decode(const Node& node_, eCAL::TransportLayer::SHM::Configuration& config_);
+  };
+
   template<>
   struct convert<eCAL::TransportLayer::UDP::MulticastConfiguration>
   {
@@ -176,6 +192,14 @@ namespace YAML
     static bool decode(const Node& node_, eCAL::Publisher::Layer::Configuration& config_);
   };
 
+  template<>
+  struct convert<eCAL::Publisher::History::Configuration>
+  {
+    static Node encode(const eCAL::Publisher::History::Configuration& config_);
+
+    static bool decode(const Node& node_, eCAL::Publisher::History::Configuration& config_);
+  };
+
   template<>
   struct convert<eCAL::Publisher::Configuration>
   {
@@ -223,6 +247,22 @@ namespace YAML
     static bool decode(const Node& node_, eCAL::Subscriber::Layer::Configuration& config_);
   };
 
+  template<>
+  struct convert<eCAL::Subscriber::Callback::Configuration>
+  {
+    static Node encode(const eCAL::Subscriber::Callback::Configuration& config_);
+
+    static bool decode(const Node& node_, eCAL::Subscriber::Callback::Configuration& config_);
+  };
+
+  template<>
+  struct convert<eCAL::Subscriber::Filter::Configuration>
+  {
+    static Node encode(const eCAL::Subscriber::Filter::Configuration& config_);
+
+    static bool decode(const Node& node_, eCAL::Subscriber::Filter::Configuration& config_);
+  };
+
   template<>
   struct convert<eCAL::Subscriber::Configuration>
   {
@@ -134,6 +134,46 @@ namespace
     }
   }
 
+  std::string quoteString(const eCAL::Subscriber::Callback::eExecutor executor_)
+  {
+    switch (executor_)
+    {
+      case eCAL::Subscriber::Callback::eExecutor::synchronous:
+        return "\"synchronous\"";
+        break;
+      case eCAL::Subscriber::Callback::eExecutor::dedicated_thread:
+        return "\"dedicated_thread\"";
+        break;
+      case eCAL::Subscriber::Callback::eExecutor::shared_pool:
+        return "\"shared_pool\"";
+        break;
+
+      default:
+        return "";
+        break;
+    }
+  }
+
+  std::string quoteString(const eCAL::Subscriber::Callback::eQueuePolicy queue_policy_)
+  {
+    switch (queue_policy_)
+    {
+      case eCAL::Subscriber::Callback::eQueuePolicy::keep_latest:
+        return "\"keep_latest\"";
+        break;
+      case eCAL::Subscriber::Callback::eQueuePolicy::keep_all:
+        return "\"keep_all\"";
+        break;
+      case eCAL::Subscriber::Callback::eQueuePolicy::block_publisher:
+        return "\"block_publisher\"";
+        break;
+
+      default:
+        return "";
+        break;
+    }
+  }
+
   std::string quoteString(const eCAL::Types::IpAddressV4& ip_)
   {
     return std::string("\"") + ip_.Get() + std::string("\"");
@@ -203,6 +243,15 @@ namespace eCAL
       ss << R"(    # Specify port for network registration traffic)"                                                                << "\n";
       ss << R"(      port: )"                                        << config_.registration.network.udp.port                       << "\n";
       ss << R"()"                                                                                                                   << "\n";
+      ss << R"(  delta:)"                                                                                                           << "\n";
+      ss << R"(    # Send the full registration state of an entity only if it changed and small heartbeats otherwise)"              << "\n";
+      ss << R"(    # (full states are sent every cycle as long as processes of older eCAL versions are registered))"                << "\n";
+      ss << R"(    enable: )"                                        << config_.registration.delta.enable                           << "\n";
+      ss << R"(    # Number of refresh cycles after which entities with changed statistics only send their full state)"             << "\n";
+      ss << R"(    statistics_cycles: )"                             << config_.registration.delta.statistics_cycles                << "\n";
+      ss << R"(    # Send datatype descriptors once keyed by their content hash, registrations carry the hash only)"               << "\n";
+      ss << R"(    descriptor_hashing: )"                            << config_.registration.delta.descriptor_hashing               << "\n";
+      ss << R"()"                                                                                                                   << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"(# Transport layer configuration)"                                                                                    << "\n";
       ss << R"(transport_layer:)"                                                                                                   << "\n";
@@ -226,6 +275,14 @@ namespace eCAL
       ss << R"(    join_all_interfaces: )"                           << config_.transport_layer.udp.join_all_interfaces             << "\n";
       ss << R"(    # Windows specific setting to enable receiving UDP traffic with the Npcap based receiver)"                       << "\n";
       ss << R"(    npcap_enabled: )"                                 << config_.transport_layer.udp.npcap_enabled                   << "\n";
+      ss << R"(    # Linux specific setting to send and receive the topic payload with sendmmsg / recvmmsg.)"                      << "\n";
+      ss << R"(    # All datagrams of a fragmented message are sent with one system call.)"                                        << "\n";
+      ss << R"(    mmsg_enabled: )"                                  << config_.transport_layer.udp.mmsg_enabled                    << "\n";
+      ss << R"(    # Number of threads receiving the topic payload, topics are distributed by their multicast group)"             << "\n";
+      ss << R"(    # (Linux, network mode only))"                                                                                   << "\n";
+      ss << R"(    receive_threads: )"                               << config_.transport_layer.udp.receive_threads                 << "\n";
+      ss << R"(    # Maximum size of a received topic payload message in bytes, larger messages are dropped)"                     << "\n";
+      ss << R"(    max_message_size: )"                              << config_.transport_layer.udp.max_message_size                << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"(    # Local mode multicast group and ttl)"                                                                           << "\n";
       ss << R"(    local:)"                                                                                                         << "\n";
@@ -248,6 +305,14 @@ namespace eCAL
       ss << R"(    # Reconnection attemps the session will try to reconnect in case of an issue)"                                   << "\n";
       ss << R"(    max_reconnections: )"                             << config_.transport_layer.tcp.max_reconnections               << "\n";
       ss << R"()"                                                                                                                   << "\n";
+      ss << R"(  shm: )"                                                                                                            << "\n";
+      ss << R"(    # Number of threads that share the observation of memory files of publishers using futex notification (Linux only))" << "\n";
+      ss << R"(    # Only applies to publishers with futex_notification enabled, named event signaled memory files keep a thread each)" << "\n";
+      ss << R"(    # 0 == one thread per memory file)"                                                                              << "\n";
+      ss << R"(    observer_threads: )"                              << config_.transport_layer.shm.observer_threads                << "\n";
+      ss << R"(    # CPUs the shared observer threads are distributed to (bit n == CPU n, 0 == no affinity, Linux only))"          << "\n";
+      ss << R"(    observer_cpu_affinity_mask: )"                    << config_.transport_layer.shm.observer_cpu_affinity_mask      << "\n";
+      ss << R"()"                                                                                                                   << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"(# Publisher specific base settings)"                                                                                 << "\n";
       ss << R"(publisher:)"                                                                                                         << "\n";
@@ -265,18 +330,47 @@ namespace eCAL
       ss << R"(      memfile_buffer_count: )"                        << config_.publisher.layer.shm.memfile_buffer_count            << "\n";
       ss << R"(      # Default memory file size for new publisher)"                                                                 << "\n";
       ss << R"(      memfile_min_size_bytes: )"                      << config_.publisher.layer.shm.memfile_min_size_bytes          << "\n";
-      ss << R"(      # Dynamic file size reserve before recreating memory file if topic size changes)"                              << "\n";
+      ss << R"(      # Dynamic file size reserve before growing the memory file if topic size changes)"                              << "\n";
       ss << R"(      memfile_reserve_percent: )"                     << config_.publisher.layer.shm.memfile_reserve_percent         << "\n";
+      ss << R"(      # Number of slots of the lock-free ring buffer memory file (0 == single slot memory file guarded by a mutex))"  << "\n";
+      ss << R"(      memfile_ring_slots: )"                          << config_.publisher.layer.shm.memfile_ring_slots              << "\n";
+      ss << R"(      # Signal subscribers via one futex word in the memory file instead of one named event per process (Linux only))" << "\n";
+      ss << R"(      futex_notification: )"                          << config_.publisher.layer.shm.futex_notification              << "\n";
+      ss << R"(      # Back memory files by huge pages of the hugetlbfs mount /dev/hugepages (Linux only))"                        << "\n";
+      ss << R"(      memfile_huge_pages: )"                          << config_.publisher.layer.shm.memfile_huge_pages              << "\n";
+      ss << R"(      # Fault in all pages of a memory file when it is created instead of on first write)"                          << "\n";
+      ss << R"(      memfile_prefault: )"                            << config_.publisher.layer.shm.memfile_prefault                << "\n";
+      ss << R"(      # Bind the pages of memory files to this NUMA node (Linux only, -1 == no binding))"                            << "\n";
+      ss << R"(      memfile_numa_node: )"                           << config_.publisher.layer.shm.memfile_numa_node               << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"(    # Base configuration for UDP publisher)"                                                                         << "\n";
       ss << R"(    udp:)"                                                                                                           << "\n";
       ss << R"(      # Enable layer)"                                                                                               << "\n";
       ss << R"(      enable: )"                                      << config_.publisher.layer.udp.enable                          << "\n";
+      ss << R"(      # Collect multiple samples and send them in one udp datagram)"                                                 << "\n";
+      ss << R"(      batching: )"                                    << config_.publisher.layer.udp.batching                        << "\n";
+      ss << R"(      # Send the batch as soon as its payload reaches this size)"                                                    << "\n";
+      ss << R"(      batch_max_size_bytes: )"                        << config_.publisher.layer.udp.batch_max_size_bytes            << "\n";
+      ss << R"(      # Maximum time a sample waits in the batch before it is sent)"                                                 << "\n";
+      ss << R"(      batch_linger_time_us: )"                        << config_.publisher.layer.udp.batch_linger_time_us            << "\n";
+      ss << R"(      # Forward error correction parity data in percent of the message size (0 == disabled))"                        << "\n";
+      ss << R"(      fec_redundancy_percent: )"                      << config_.publisher.layer.udp.fec_redundancy_percent          << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"(    # Base configuration for TCP publisher)"                                                                         << "\n";
       ss << R"(    tcp:)"                                                                                                           << "\n";
       ss << R"(      # Enable layer)"                                                                                               << "\n";
       ss << R"(      enable: )"                                      << config_.publisher.layer.shm.enable                          << "\n";
+      ss << R"(      # Collect multiple samples and send them in one tcp frame)"                                                    << "\n";
+      ss << R"(      batching: )"                                    << config_.publisher.layer.tcp.batching                        << "\n";
+      ss << R"(      # Send the batch as soon as its payload reaches this size)"                                                    << "\n";
+      ss << R"(      batch_max_size_bytes: )"                        << config_.publisher.layer.tcp.batch_max_size_bytes            << "\n";
+      ss << R"(      # Maximum time a sample waits in the batch before it is sent)"                                                 << "\n";
+      ss << R"(      batch_linger_time_us: )"                        << config_.publisher.layer.tcp.batch_linger_time_us            << "\n";
+      ss << R"()"                                                                                                                   << "\n";
+      ss << R"(  # Transient local history for late joining subscribers)"                                                        << "\n";
+      ss << R"(  history:)"                                                                                                         << "\n";
+      ss << R"(    # Number of last samples replayed to a newly connected subscriber (0 == no history))"                           << "\n";
+      ss << R"(    depth: )"                                         << config_.publisher.history.depth                             << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"(  # Priority list for layer usage in local mode (Default: SHM > UDP > TCP))"                                         << "\n";
       ss << R"(  priority_local: )"                                  << quoteString(config_.publisher.layer_priority_local)         << "\n";
@@ -291,6 +385,8 @@ namespace eCAL
       ss << R"(    shm:)"                                                                                                           << "\n";
       ss << R"(      # Enable layer)"                                                                                               << "\n";
       ss << R"(      enable: )"                                        << config_.subscriber.layer.shm.enable                       << "\n";
+      ss << R"(      # Maximum number of ring buffer memory file samples a sample callback receiver can hold pinned at once, further samples are copied (0 == always copy))"  << "\n";
+      ss << R"(      max_pinned_samples: )"                            << config_.subscriber.layer.shm.max_pinned_samples           << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"(    # Base configuration for UDP subscriber)"                                                                        << "\n";
       ss << R"(    udp:)"                                                                                                           << "\n";
@@ -302,8 +398,28 @@ namespace eCAL
       ss << R"(      # Enable layer)"                                                                                               << "\n";
       ss << R"(      enable: )"                                        << config_.subscriber.layer.tcp.enable                       << "\n";
       ss << R"()"                                                                                                                   << "\n";
+      ss << R"(  # Receive callback execution)"                                                                         << "\n";
+      ss << R"(  callback:)"                                                                                                        << "\n";
+      ss << R"(    # Executor: "synchronous" (transport layer thread), "dedicated_thread" (own thread per subscriber), "shared_pool" (process wide pool))" << "\n";
+      ss << R"(    executor: )"                                        << quoteString(config_.subscriber.callback.executor)         << "\n";
+      ss << R"(    # Full queue behavior of asynchronous executors: "keep_latest" (drop oldest), "keep_all" (drop newest), "block_publisher" (wait for space))" << "\n";
+      ss << R"(    queue_policy: )"                                    << quoteString(config_.subscriber.callback.queue_policy)     << "\n";
+      ss << R"(    # Maximum number of queued samples of asynchronous executors)"                                                   << "\n";
+      ss << R"(    queue_size: )"                                      << config_.subscriber.callback.queue_size                   << "\n";
+      ss << R"(    # Number of threads of the process wide shared pool (applied by the first subscriber creating the pool))"       << "\n";
+      ss << R"(    shared_pool_size: )"                                << config_.subscriber.callback.shared_pool_size             << "\n";
+      ss << R"()"                                                                                                                   << "\n";
+      ss << R"(  # Sample filter, announced to the publishers to skip samples no subscriber wants)"                                << "\n";
+      ss << R"(  filter:)"                                                                                                          << "\n";
+      ss << R"(    # Pass only every Nth sample of a publisher (0, 1 == every sample))"                                            << "\n";
+      ss << R"(    downsampling_factor: )"                             << config_.subscriber.filter.downsampling_factor            << "\n";
+      ss << R"(    # Pass samples of a publisher with at most this frequency [Hz] (0 == unlimited))"                               << "\n";
+      ss << R"(    max_frequency: )"                                   << config_.subscriber.filter.max_frequency                  << "\n";
+      ss << R"()"                                                                                                                   << "\n";
       ss << R"(  # Enable dropping of payload messages that arrive out of order)"                                                   << "\n";
       ss << R"(  drop_out_of_order_messages: )"                        << config_.subscriber.drop_out_of_order_messages             << "\n";
+      ss << R"(  # Collect delivery latency and callback execution time histograms per publisher and layer (reported in the monitoring))" << "\n";
+      ss << R"(  latency_tracing: )"                                   << config_.subscriber.latency_tracing                        << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"(# Time configuration)"                                                                                               << "\n";
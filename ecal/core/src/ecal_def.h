@@ -66,11 +66,33 @@ constexpr unsigned int NET_UDP_MULTICAST_PORT_REG_OFF     = 0U; // to delete
 constexpr unsigned int NET_UDP_MULTICAST_PORT_LOG_OFF     = 1U; // to delete
 constexpr unsigned int NET_UDP_MULTICAST_PORT_SAMPLE_OFF  = 2U; // to delete
 
+/* sendmmsg / recvmmsg udp backend (linux only) */
+constexpr unsigned int NET_UDP_MMSG_RECEIVE_BATCH_SIZE    = 32U;   // maximum number of datagrams received with one recvmmsg call
+constexpr unsigned int NET_UDP_REASSEMBLY_TIMEOUT         = 1000U; // incomplete fragmented messages are dropped after this time in ms
+constexpr unsigned int NET_UDP_MAX_MESSAGE_SIZE           = 64U * 1024U * 1024U; // default of the maximum size of a received message in bytes
+constexpr unsigned int NET_UDP_MAX_PENDING_REASSEMBLIES   = 64U;   // maximum number of incomplete fragmented / forward error corrected messages per receiver
+constexpr unsigned int NET_UDP_RECEIVE_ERROR_BACKOFF      = 10U;   // time in ms a receiver waits before receiving again after a socket error
+
 /* timeout for create / open a memory file using mutex lock in ms */
 constexpr unsigned int PUB_MEMFILE_CREATE_TO              = 200U;
 constexpr unsigned int PUB_MEMFILE_OPEN_TO                = 200U;
 /* memory file access timeout */
 constexpr unsigned int EXP_MEMFILE_ACCESS_TIMEOUT         = 100U;
+/* number of samples the subscribers of a ring buffer memory file can pin at once (spare ring blocks) */
+constexpr unsigned int PUB_MEMFILE_RING_PIN_SLOTS         = 4U;
+/* acknowledge timeout of the first sample written into a recreated memory file (the subscribers have to reattach) in ms */
+constexpr unsigned int PUB_MEMFILE_RECREATE_ACK_TO        = 100U;
+/* minimal acknowledge timeout per sample when replaying the publisher history through a single slot memory file in ms */
+constexpr unsigned int PUB_HISTORY_REPLAY_ACK_TO          = 100U;
+/* number of history replays to a subscriber on layers without acknowledge (one per registration refresh) */
+constexpr unsigned int PUB_HISTORY_REPLAY_ATTEMPTS        = 3U;
+
+/* registration protocol version of this eCAL version (0 == full state every cycle, 1 == delta registration with heartbeats and requests, 2 == datatype descriptors by content hash) */
+constexpr int REGISTRATION_PROTOCOL_VERSION               = 2;
+/* first registration protocol version supporting delta registration */
+constexpr int REGISTRATION_PROTOCOL_VERSION_DELTA         = 1;
+/* first registration protocol version supporting datatype descriptors by content hash */
+constexpr int REGISTRATION_PROTOCOL_VERSION_DESCRIPTOR    = 2;
 
 
 /**********************************************************************************************/
@@ -1,5 +1,7 @@
 #include "ecal_descgate.h"
+#include "util/descriptor_hash.h"
 
+#include <algorithm>
 #include <iostream>
 
 namespace
@@ -58,7 +60,12 @@ namespace
 
 namespace eCAL
 {
-  CDescGate::CDescGate() = default;
+  CDescGate::CDescGate()
+    : m_publisher_infos(m_descriptor_pool)
+    , m_subscriber_infos(m_descriptor_pool)
+  {
+  }
+
   CDescGate::~CDescGate() = default;
 
   std::set<STopicId> CDescGate::GetPublisherIDs() const
@@ -200,13 +207,14 @@ namespace eCAL
     if (it != map.end())
     {
       // Update normalized datatype info (v6 should be invariant, but we keep it robust)
-      it->second.datatype_info = sample_.topic.datatype_information;
+      AssignDatatypeInformation(it->second, sample_.topic);
       return;
     }
 
     const STopicId           topic_id{ ConvertToEntityId(sample_.identifier), sample_.topic.topic_name };
-    SDataTypeInformation     datatype = sample_.topic.datatype_information;
-    TopicInfo                topic_info{ topic_id, std::move(datatype) };
+    TopicInfo                topic_info;
+    topic_info.id = topic_id;
+    AssignDatatypeInformation(topic_info, sample_.topic);
 
     map.emplace(sample_.identifier.entity_id, std::move(topic_info));
 
@@ -251,10 +259,75 @@ namespace eCAL
     if (iterator == map.end())
       return false;
 
-    topic_info_ = iterator->second.datatype_info;
+    topic_info_.name     = iterator->second.datatype_name;
+    topic_info_.encoding = iterator->second.datatype_encoding;
+    if (iterator->second.descriptor) topic_info_.descriptor = *iterator->second.descriptor;
+    else                             topic_info_.descriptor.clear();
     return true;
   }
 
+  void CDescGate::CollectedTopicInfo::AssignDatatypeInformation(TopicInfo& topic_info_, const Registration::Topic& topic_)
+  {
+    topic_info_.datatype_name     = topic_.datatype_information.name;
+    topic_info_.datatype_encoding = topic_.datatype_information.encoding;
+
+    const std::string& descriptor = topic_.datatype_information.descriptor;
+    const uint64_t     hash       = topic_.datatype_descriptor_hash;
+
+    // registration with descriptor hash only, the descriptor has not been received yet
+    // (keep the descriptor we already know for this hash)
+    if (descriptor.empty())
+    {
+      if ((hash == 0) || (hash != topic_info_.descriptor_hash))
+      {
+        topic_info_.descriptor_hash = hash;
+        topic_info_.descriptor.reset();
+      }
+      return;
+    }
+
+    // unchanged descriptor
+    if (topic_info_.descriptor)
+    {
+      if ((hash != 0) && (hash == topic_info_.descriptor_hash)) return;
+      if ((hash == 0) && (*topic_info_.descriptor == descriptor)) return;
+    }
+
+    topic_info_.descriptor_hash = (hash != 0) ? hash : Util::ComputeDescriptorHash(descriptor);
+    topic_info_.descriptor      = descriptor_pool.Get(topic_info_.descriptor_hash, descriptor);
+  }
+
+  // ---------- CDescriptorPool ----------
+
+  std::shared_ptr<const std::string> CDescGate::CDescriptorPool::Get(uint64_t hash_, const std::string& descriptor_)
+  {
+    const std::lock_guard<std::mutex> guard(mutex);
+
+    auto& pooled_descriptor = map[hash_];
+    auto descriptor = pooled_descriptor.lock();
+    if (descriptor)
+    {
+      // a hash collision gets its own copy
+      if (*descriptor == descriptor_) return descriptor;
+      return std::make_shared<const std::string>(descriptor_);
+    }
+
+    descriptor = std::make_shared<const std::string>(descriptor_);
+    pooled_descriptor = descriptor;
+
+    // remove the descriptors of unregistered entities
+    if (map.size() >= cleanup_size)
+    {
+      for (auto iter = map.begin(); iter != map.end();)
+      {
+        if (iter->second.expired()) iter = map.erase(iter);
+        else                        ++iter;
+      }
+      cleanup_size = std::max<size_t>(64, 2 * map.size());
+    }
+    return descriptor;
+  }
+
   void CDescGate::CollectedServiceInfo::RegisterSample(const Registration::SampleIdentifier& sample_id_,
     const std::string& service_name_,
     const ServiceMethodInformationSetT& method_info_)
@@ -32,6 +32,8 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <memory>
 #include <unordered_map>
 #include <mutex>
 #include <string>
@@ -76,18 +78,37 @@ namespace eCAL
     CDescGate& operator=(CDescGate&&) = delete;
 
   private:
+    // Datatype descriptors by content hash, entities with the same descriptor share one copy
+    class CDescriptorPool
+    {
+      mutable std::mutex                                                 mutex;
+      std::unordered_map<uint64_t, std::weak_ptr<const std::string>>     map;
+      size_t                                                             cleanup_size = 64;
+
+    public:
+      std::shared_ptr<const std::string> Get(uint64_t hash_, const std::string& descriptor_);
+    };
+
     class CollectedTopicInfo
     {
       struct TopicInfo
       {
-        STopicId              id;
-        SDataTypeInformation  datatype_info;
+        STopicId                            id;
+        std::string                         datatype_name;
+        std::string                         datatype_encoding;
+        uint64_t                            descriptor_hash = 0;
+        std::shared_ptr<const std::string>  descriptor;          // nullptr == no descriptor (or not received yet)
       };
 
+      void AssignDatatypeInformation(TopicInfo& topic_info_, const Registration::Topic& topic_);
+
+      CDescriptorPool&                                 descriptor_pool;
       mutable std::mutex                               mutex;
       std::unordered_map<EntityIdT, TopicInfo>         map;
 
     public:
+      explicit CollectedTopicInfo(CDescriptorPool& descriptor_pool_) : descriptor_pool(descriptor_pool_) {}
+
       void RegisterSample(
         const Registration::Sample& sample_,
         const std::function<void(const STopicId&)>& on_new_topic);
@@ -133,6 +154,9 @@ namespace eCAL
 
     Registration::CallbackToken CreateToken();
 
+    // datatype descriptors shared by publishers and subscribers
+    CDescriptorPool                          m_descriptor_pool;
+
     // internal quality topic info publisher/subscriber maps
     CollectedTopicInfo                       m_publisher_infos;
     STopicEventCallbackMap                   m_publisher_callback_map;
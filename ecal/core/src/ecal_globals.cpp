@@ -99,7 +99,8 @@ namespace eCAL
     /////////////////////
     if (!memfile_pool_instance)
     {
-      memfile_pool_instance = std::make_shared<CMemFileThreadPool>();
+      const auto& shm_config = eCAL::GetConfiguration().transport_layer.shm;
+      memfile_pool_instance = std::make_shared<CMemFileThreadPool>(shm_config.observer_threads, shm_config.observer_cpu_affinity_mask);
       new_initialization = true;
     }
 #endif // defined(ECAL_CORE_REGISTRATION_SHM) || defined(ECAL_CORE_TRANSPORT_SHM)
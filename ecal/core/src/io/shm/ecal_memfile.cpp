@@ -29,6 +29,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
@@ -55,7 +56,7 @@ namespace eCAL
     Destroy(false);
   }
 
-  bool CMemoryFile::Create(const char* name_, const bool create_, const size_t len_, bool auto_sanitizing_)
+  bool CMemoryFile::Create(const char* name_, const bool create_, const size_t len_, bool auto_sanitizing_, const SMemFileAllocation& allocation_)
   {
     assert((create_ && len_ > 0) || (!create_ && len_ == 0));
     assert((auto_sanitizing_ && create_) || !auto_sanitizing_);
@@ -84,6 +85,7 @@ namespace eCAL
       m_header       = SInternalHeader();
 
       m_memfile_info = std::make_shared<SMemFileInfo>();
+      if (create_) m_memfile_info->allocation = allocation_;
 
       // create memory file
       if (!memfile::db::AddFile(name_, create_, create_ ? len_ + m_header.int_hdr_size : SIZEOF_PARTIAL_STRUCT(SInternalHeader, int_hdr_size), m_memfile_info))
@@ -120,7 +122,7 @@ namespace eCAL
 
           // reset header if memfile does not exist or rather is not initialized as well as if lock state is inconsistent
           if (!m_memfile_info->exists || header->int_hdr_size == 0 || (m_auto_sanitizing && m_memfile_mutex.WasRecovered()))
-            *header = m_header;
+            ResetHeader(header);
           else
           {
             // read compatible header part if magic number already exists
@@ -357,6 +359,81 @@ namespace eCAL
     }
   }
 
+  bool CMemoryFile::Grow(const size_t len_, const int timeout_)
+  {
+    if (!m_created)                             return(false);
+    if (m_access_state != access_state::closed) return(false);
+    if (len_ <= MaxDataSize())                  return(true);
+
+    // lock mutex, no reader is accessing the file while it is extended
+    if (!m_memfile_mutex.Lock(timeout_)) return(false);
+
+    bool grown(false);
+    if (memfile::db::GrowFile(static_cast<size_t>(m_header.int_hdr_size) + len_, m_memfile_info))
+    {
+      // readers remap the file on their next access when they see the new size
+      m_header.max_data_size = (unsigned long)len_;
+      static_cast<SInternalHeader*>(m_memfile_info->mem_address)->max_data_size = m_header.max_data_size;
+      grown = true;
+    }
+
+    // the payload content has to be fully written again
+    m_payload_initialized = false;
+
+    // unlock mutex
+    m_memfile_mutex.Unlock();
+
+    return(grown);
+  }
+
+  bool CMemoryFile::EnableFutexNotification()
+  {
+    if (!m_created)                             return(false);
+    if (m_access_state != access_state::closed) return(false);
+    if (GetNotifyAddress() == nullptr)          return(false);
+
+    // lock mutex
+    if (!m_memfile_mutex.Lock(PUB_MEMFILE_CREATE_TO)) return(false);
+
+    m_header.notify_futex = 1;
+    static_cast<SInternalHeader*>(m_memfile_info->mem_address)->notify_futex = 1;
+
+    // unlock mutex
+    m_memfile_mutex.Unlock();
+
+    return(true);
+  }
+
+  bool CMemoryFile::HasFutexNotification() const
+  {
+    if (!m_created) return(false);
+    if (static_cast<size_t>(m_header.int_hdr_size) < SIZEOF_PARTIAL_STRUCT(SInternalHeader, notify_futex)) return(false);
+    return(m_header.notify_futex != 0);
+  }
+
+  std::uint32_t* CMemoryFile::GetNotifyAddress() const
+  {
+    if (!m_created) return(nullptr);
+    auto memfile_info = m_memfile_info;
+    if (!memfile_info || (memfile_info->mem_address == nullptr)) return(nullptr);
+    if (static_cast<size_t>(m_header.int_hdr_size) < SIZEOF_PARTIAL_STRUCT(SInternalHeader, notify_seq)) return(nullptr);
+
+    // the field is 4 byte aligned within the (page aligned) mapping on all platforms
+    return(reinterpret_cast<std::uint32_t*>(static_cast<char*>(memfile_info->mem_address) + offsetof(SInternalHeader, notify_seq)));
+  }
+
+  void CMemoryFile::ResetHeader(SInternalHeader* header_) const
+  {
+    // field by field, the futex word is left alone, it is accessed atomically by
+    // writers and readers that may be still (or already) using the memory file
+    header_->int_hdr_size  = m_header.int_hdr_size;
+    header_->_reserved_0   = m_header._reserved_0;
+    header_->cur_data_size = m_header.cur_data_size;
+    header_->max_data_size = m_header.max_data_size;
+    header_->notify_futex  = m_header.notify_futex;
+    header_->_reserved_1   = m_header._reserved_1;
+  }
+
   bool CMemoryFile::GetAccess(int timeout_)
   {
     if (!m_created)                                              return(false);
@@ -372,11 +449,11 @@ namespace eCAL
       return(false);
     }
 
-    // reset current data size field of memfile header if lock is inconsistent 
+    // reset current data size field of memfile header if lock is inconsistent,
+    // the other fields are still valid (and readers may wait on the futex word)
     if (m_auto_sanitizing && m_memfile_mutex.WasRecovered())
     {
-      m_header.cur_data_size = 0;
-      *reinterpret_cast<SInternalHeader*>(memfile_info->mem_address) = m_header;
+      static_cast<SInternalHeader*>(memfile_info->mem_address)->cur_data_size = 0;
     }
 
     // update compatible header part of m_header
@@ -58,10 +58,12 @@ namespace eCAL
      * @param name_    Unique file name. 
      * @param create_  Add file to system if not exists.
      * @param len_     Number of bytes to allocate (only if create_ == true). 
+     * @param auto_sanitizing_  Apply the consistency check of the memory file mutex (only if create_ == true).
+     * @param allocation_       Page placement of the memory file (only if create_ == true).
      *
      * @return  true if it succeeds, false if it fails. 
     **/
-    bool Create(const char* name_, bool create_, size_t len_ = 0, bool auto_sanitizing_ = false);
+    bool Create(const char* name_, bool create_, size_t len_ = 0, bool auto_sanitizing_ = false, const SMemFileAllocation& allocation_ = SMemFileAllocation());
 
     /**
      * @brief Delete the associated memory file from system. 
@@ -173,6 +175,40 @@ namespace eCAL
     **/
     size_t CurDataSize()     const {return static_cast<size_t>(m_header.cur_data_size);};
 
+    /**
+     * @brief Extend the memory file in place, keeping its name and content (writer side only).
+     *
+     * The file must not be opened. Readers remap the file on their next access.
+     * The address of the memory file (and of its futex word) may change.
+     *
+     * @param len_      The new maximum data size.
+     * @param timeout_  The timeout in ms for access via mutex.
+     *
+     * @return  true if it succeeds, false if the file could not be extended (e.g. not supported on this platform).
+    **/
+    bool Grow(size_t len_, int timeout_);
+
+    /**
+     * @brief Mark the memory file to signal updates via the futex word of the header (writer side only).
+     *
+     * @return  true if it succeeds, false if it fails.
+    **/
+    bool EnableFutexNotification();
+
+    /**
+     * @brief Check if the writer of the memory file signals updates via futex.
+     *
+     * @return  true if the futex word has to be used instead of the named events.
+    **/
+    bool HasFutexNotification() const;
+
+    /**
+     * @brief Get the address of the futex word in the memory file header.
+     *
+     * @return  The address or nullptr if the memory file header does not contain it.
+    **/
+    std::uint32_t* GetNotifyAddress() const;
+
     bool IsCreated()         const {return(m_created);};
     std::string Name()       const {return(m_name);};
 
@@ -201,12 +237,14 @@ namespace eCAL
       std::uint64_t               max_data_size = 0;
 #endif
       // New fields should only declare well defined data types and be aligned to 8 bytes
-      // std::uint8_t                 _new_field  = 0;
-      // std::array<std::uint8_t, 7>  _reserved_1 = {};
+      std::uint32_t               notify_seq    = 0;  // update sequence, incremented by the writer on every update (futex word)
+      std::uint8_t                notify_futex  = 0;  // 1 == the writer signals updates via notify_seq instead of named events
+      std::array<std::uint8_t, 3> _reserved_1   = {};
     };
 #pragma pack(pop)
 
   protected:
+    void ResetHeader(SInternalHeader* header_) const;
     bool GetAccess(int timeout_);
 
     enum class access_state
@@ -0,0 +1,367 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  shared acknowledge memory file (linux only)
+**/
+
+#include "ecal_memfile_ack.h"
+#include "ecal_memfile_notify.h"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <new>
+
+namespace
+{
+  const std::uint32_t ack_magic = 0x4B434145; // "EACK"
+}
+#endif
+
+namespace eCAL
+{
+  constexpr size_t   CMemoryFileAck::max_processes;
+  constexpr uint64_t CMemoryFileAck::released_clock;
+
+  CMemoryFileAck::CMemoryFileAck() :
+    m_created(false),
+    m_writer(false),
+    m_address(nullptr),
+    m_size(0),
+    m_reader_slot(max_processes)
+  {
+  }
+
+  CMemoryFileAck::~CMemoryFileAck()
+  {
+    Destroy();
+  }
+
+#if defined(__linux__)
+  bool CMemoryFileAck::Create(const std::string& memfile_name_, const bool create_)
+  {
+    if (m_created) return false;
+    if (!memfile::notify::IsSupported()) return false;
+
+    // make memory file path compatible for all posix systems
+    std::string name = memfile_name_ + "_ack";
+    if (name[0] != '/') name = "/" + name;
+
+    const size_t size = sizeof(SAckHeader) + max_processes * sizeof(SAckSlot);
+
+    int fd(-1);
+    if (create_)
+    {
+      // set umask to nothing, so every subscriber can open the segment for writing
+      const mode_t previous_umask = umask(000);
+      fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+      umask(previous_umask);
+      if ((fd != -1) && (::ftruncate(fd, static_cast<off_t>(size)) != 0))
+      {
+        ::close(fd);
+        ::shm_unlink(name.c_str());
+        fd = -1;
+      }
+    }
+    else
+    {
+      fd = ::shm_open(name.c_str(), O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+      struct stat st;
+      if ((fd != -1) && ((::fstat(fd, &st) != 0) || (static_cast<size_t>(st.st_size) < size)))
+      {
+        ::close(fd);
+        fd = -1;
+      }
+    }
+    if (fd == -1) return false;
+
+    void* address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (address == MAP_FAILED)
+    {
+      if (create_) ::shm_unlink(name.c_str());
+      return false;
+    }
+
+    m_address = address;
+    m_size    = size;
+
+    if (create_)
+    {
+      // the segment is zero initialized by ftruncate, the magic is set last
+      auto* header = new (m_address) SAckHeader();
+      header->slot_count = static_cast<std::uint32_t>(max_processes);
+      for (size_t slot = 0; slot < max_processes; ++slot) new (GetSlot(slot)) SAckSlot();
+      __atomic_store_n(&header->magic, ack_magic, __ATOMIC_RELEASE);
+    }
+    else
+    {
+      const auto* header = GetHeader();
+      if ((__atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) != ack_magic) || (header->slot_count != max_processes))
+      {
+        ::munmap(m_address, m_size);
+        m_address = nullptr;
+        m_size    = 0;
+        return false;
+      }
+    }
+
+    m_writer      = create_;
+    m_name        = name;
+    m_reader_slot = max_processes;
+    m_created     = true;
+
+    return true;
+  }
+
+  bool CMemoryFileAck::Destroy()
+  {
+    if (!m_created) return false;
+
+    ::munmap(m_address, m_size);
+    if (m_writer) ::shm_unlink(m_name.c_str());
+
+    {
+      const std::lock_guard<std::mutex> lock(m_slot_map_sync);
+      m_slot_map.clear();
+    }
+
+    m_created     = false;
+    m_writer      = false;
+    m_address     = nullptr;
+    m_size        = 0;
+    m_reader_slot = max_processes;
+    m_name.clear();
+
+    return true;
+  }
+
+  bool CMemoryFileAck::AddProcess(const int32_t process_id_)
+  {
+    if (!m_created || !m_writer) return false;
+    if (process_id_ == 0)        return false;
+
+    const std::lock_guard<std::mutex> lock(m_slot_map_sync);
+
+    // reactivate the slot of a process that reconnects
+    auto iter = m_slot_map.find(process_id_);
+    if (iter != m_slot_map.end())
+    {
+      std::uint64_t released(released_clock);
+      __atomic_compare_exchange_n(&GetSlot(iter->second)->ack_clock, &released, 0, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+      return true;
+    }
+
+    // the writer is the only one assigning slots, so the next free one is the number of used slots,
+    // if there is none left, a slot of a released or dead process is reused
+    size_t slot_index = m_slot_map.size();
+    if (slot_index >= max_processes) slot_index = ReclaimSlot();
+    if (slot_index >= max_processes) return false;
+
+    auto* slot = GetSlot(slot_index);
+    __atomic_store_n(&slot->ack_clock, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&slot->process_id, process_id_, __ATOMIC_RELEASE);
+    m_slot_map[process_id_] = slot_index;
+
+    return true;
+  }
+
+  size_t CMemoryFileAck::ReclaimSlot()
+  {
+    // called with m_slot_map_sync locked, prefer the slots of disconnected processes
+    auto reclaimable = m_slot_map.end();
+    for (auto iter = m_slot_map.begin(); iter != m_slot_map.end(); ++iter)
+    {
+      if (__atomic_load_n(&GetSlot(iter->second)->ack_clock, __ATOMIC_ACQUIRE) == released_clock)
+      {
+        reclaimable = iter;
+        break;
+      }
+    }
+
+    // a crashed subscriber never disconnects
+    if (reclaimable == m_slot_map.end())
+    {
+      for (auto iter = m_slot_map.begin(); iter != m_slot_map.end(); ++iter)
+      {
+        if ((::kill(iter->first, 0) == -1) && (errno == ESRCH))
+        {
+          reclaimable = iter;
+          break;
+        }
+      }
+    }
+    if (reclaimable == m_slot_map.end()) return max_processes;
+
+    // the caller assigns the slot to the new owner, so the previous one finds no slot anymore
+    // (an acknowledge of the previous owner racing with that is taken for the new owner,
+    // so the writer does not wait for the new owner for at most one sample)
+    const size_t slot_index = reclaimable->second;
+    m_slot_map.erase(reclaimable);
+    return slot_index;
+  }
+
+  bool CMemoryFileAck::ReleaseProcess(const int32_t process_id_)
+  {
+    if (!m_created || !m_writer) return false;
+
+    size_t slot_index(0);
+    {
+      const std::lock_guard<std::mutex> lock(m_slot_map_sync);
+      auto iter = m_slot_map.find(process_id_);
+      if (iter == m_slot_map.end()) return false;
+      slot_index = iter->second;
+    }
+
+    // unlock a writer that is waiting for this process
+    __atomic_store_n(&GetSlot(slot_index)->ack_clock, released_clock, __ATOMIC_RELEASE);
+    memfile::notify::Signal(&GetHeader()->ack_seq);
+
+    return true;
+  }
+
+  bool CMemoryFileAck::HasProcess(const int32_t process_id_) const
+  {
+    if (!m_created) return false;
+
+    const std::lock_guard<std::mutex> lock(m_slot_map_sync);
+    return m_slot_map.find(process_id_) != m_slot_map.end();
+  }
+
+  uint64_t CMemoryFileAck::AckClock(const int32_t process_id_) const
+  {
+    if (!m_created) return 0;
+
+    size_t slot_index(0);
+    {
+      const std::lock_guard<std::mutex> lock(m_slot_map_sync);
+      auto iter = m_slot_map.find(process_id_);
+      if (iter == m_slot_map.end()) return 0;
+      slot_index = iter->second;
+    }
+
+    return __atomic_load_n(&GetSlot(slot_index)->ack_clock, __ATOMIC_ACQUIRE);
+  }
+
+  uint32_t CMemoryFileAck::LoadSequence() const
+  {
+    if (!m_created) return 0;
+    return memfile::notify::Load(&GetHeader()->ack_seq);
+  }
+
+  bool CMemoryFileAck::WaitForAcknowledge(const uint32_t expected_seq_, const int timeout_ms_) const
+  {
+    if (!m_created) return false;
+    return memfile::notify::Wait(&GetHeader()->ack_seq, expected_seq_, timeout_ms_);
+  }
+
+  bool CMemoryFileAck::Acknowledge(const int32_t process_id_, const uint64_t clock_)
+  {
+    if (!m_created) return false;
+
+    // look up (and remember) the slot the writer assigned to us
+    if ((m_reader_slot >= max_processes) || (__atomic_load_n(&GetSlot(m_reader_slot)->process_id, __ATOMIC_ACQUIRE) != process_id_))
+    {
+      m_reader_slot = max_processes;
+      const SAckSlot* slot = FindSlot(process_id_);
+      if (slot == nullptr) return false;
+      m_reader_slot = static_cast<size_t>(slot - GetSlot(0));
+    }
+
+    __atomic_store_n(&GetSlot(m_reader_slot)->ack_clock, clock_, __ATOMIC_RELEASE);
+    memfile::notify::Signal(&GetHeader()->ack_seq);
+
+    return true;
+  }
+
+#else
+  bool CMemoryFileAck::Create(const std::string& /*memfile_name_*/, const bool /*create_*/)
+  {
+    return false;
+  }
+
+  bool CMemoryFileAck::Destroy()
+  {
+    return false;
+  }
+
+  bool CMemoryFileAck::AddProcess(const int32_t /*process_id_*/)
+  {
+    return false;
+  }
+
+  bool CMemoryFileAck::ReleaseProcess(const int32_t /*process_id_*/)
+  {
+    return false;
+  }
+
+  bool CMemoryFileAck::HasProcess(const int32_t /*process_id_*/) const
+  {
+    return false;
+  }
+
+  uint64_t CMemoryFileAck::AckClock(const int32_t /*process_id_*/) const
+  {
+    return 0;
+  }
+
+  uint32_t CMemoryFileAck::LoadSequence() const
+  {
+    return 0;
+  }
+
+  bool CMemoryFileAck::WaitForAcknowledge(const uint32_t /*expected_seq_*/, const int /*timeout_ms_*/) const
+  {
+    return false;
+  }
+
+  bool CMemoryFileAck::Acknowledge(const int32_t /*process_id_*/, const uint64_t /*clock_*/)
+  {
+    return false;
+  }
+#endif
+
+  CMemoryFileAck::SAckHeader* CMemoryFileAck::GetHeader() const
+  {
+    return static_cast<SAckHeader*>(m_address);
+  }
+
+  CMemoryFileAck::SAckSlot* CMemoryFileAck::GetSlot(const size_t index_) const
+  {
+    return reinterpret_cast<SAckSlot*>(static_cast<char*>(m_address) + sizeof(SAckHeader)) + index_;
+  }
+
+  CMemoryFileAck::SAckSlot* CMemoryFileAck::FindSlot(const int32_t process_id_) const
+  {
+    for (size_t slot = 0; slot < max_processes; ++slot)
+    {
+      const std::int32_t slot_process_id = __atomic_load_n(&GetSlot(slot)->process_id, __ATOMIC_ACQUIRE);
+      if (slot_process_id == process_id_) return GetSlot(slot);
+      // slots are assigned in order, so there is nothing behind the first unused one
+      if (slot_process_id == 0) break;
+    }
+    return nullptr;
+  }
+}
@@ -0,0 +1,160 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  shared acknowledge memory file (linux only)
+**/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace eCAL
+{
+  /**
+   * @brief Small read/write shared memory segment next to a memory file that collects
+   *        the read acknowledges of all subscribing processes.
+   *
+   * The writer assigns one slot per subscribing process, the slot stores the process id of its
+   * owner. If all slots are in use, the slot of a released (disconnected) or dead process is
+   * reassigned. A reader stores the clock of
+   * the last sample it has processed into its slot, increments the shared acknowledge
+   * counter and wakes up the writer via futex. So the writer waits for all subscribers
+   * at once instead of waiting for one named event after the other.
+   *
+   * The segment is only available where futex based notification is supported,
+   * all callers have to fall back to the named acknowledge events otherwise.
+  **/
+  class CMemoryFileAck
+  {
+  public:
+    static constexpr size_t   max_processes  = 64;
+    static constexpr uint64_t released_clock = UINT64_MAX;  //!< slot ack clock of a disconnected process
+
+    CMemoryFileAck();
+    ~CMemoryFileAck();
+
+    CMemoryFileAck(const CMemoryFileAck&) = delete;
+    CMemoryFileAck& operator=(const CMemoryFileAck&) = delete;
+    CMemoryFileAck(CMemoryFileAck&& rhs) = delete;
+    CMemoryFileAck& operator=(CMemoryFileAck&& rhs) = delete;
+
+    /**
+     * @brief Create (writer) or open (reader) the acknowledge segment of a memory file.
+     *
+     * @param memfile_name_  The name of the memory file the acknowledges belong to.
+     * @param create_        Create the segment (writer side) or open an existing one (reader side).
+     *
+     * @return  true if it succeeds, false if it fails or is not supported.
+    **/
+    bool Create(const std::string& memfile_name_, bool create_);
+
+    /**
+     * @brief Unmap the segment, the writer removes it from the system.
+    **/
+    bool Destroy();
+
+    /**
+     * @brief Assign a slot to a subscribing process or reactivate a released one (writer side).
+     *
+     * If all slots are in use, the slot of a released or dead process is reclaimed.
+     *
+     * @return  true if the process owns a slot, false if all slots are owned by live, connected processes.
+    **/
+    bool AddProcess(int32_t process_id_);
+
+    /**
+     * @brief Release the slot of a process and wake up a waiting writer (writer side).
+    **/
+    bool ReleaseProcess(int32_t process_id_);
+
+    /**
+     * @brief Check if the process owns a slot (writer side).
+    **/
+    bool HasProcess(int32_t process_id_) const;
+
+    /**
+     * @brief Clock of the last sample acknowledged by the process (writer side).
+     *
+     * @return  The clock, released_clock if the process has been released, 0 if it is unknown.
+    **/
+    uint64_t AckClock(int32_t process_id_) const;
+
+    /**
+     * @brief Current value of the shared acknowledge counter.
+    **/
+    uint32_t LoadSequence() const;
+
+    /**
+     * @brief Wait until any reader acknowledges (writer side).
+     *
+     * @param expected_seq_  Acknowledge counter value loaded before checking the slots.
+     * @param timeout_ms_    The timeout in ms.
+     *
+     * @return  true if the counter changed, false on timeout.
+    **/
+    bool WaitForAcknowledge(uint32_t expected_seq_, int timeout_ms_) const;
+
+    /**
+     * @brief Acknowledge a sample (reader side).
+     *
+     * @param process_id_  The process id of the reader.
+     * @param clock_       The clock of the processed sample.
+     *
+     * @return  true if it succeeds, false if the writer did not assign a slot to the process (yet).
+    **/
+    bool Acknowledge(int32_t process_id_, uint64_t clock_);
+
+    bool IsCreated() const { return m_created; };
+
+  protected:
+    struct SAckHeader
+    {
+      std::uint32_t magic      = 0;
+      std::uint32_t slot_count = 0;
+      std::uint32_t ack_seq    = 0;   //!< futex word, incremented by every acknowledge
+      std::uint32_t reserved   = 0;
+    };
+
+    struct SAckSlot
+    {
+      std::int32_t  process_id = 0;   //!< 0 = unused slot
+      std::uint32_t reserved   = 0;
+      std::uint64_t ack_clock  = 0;   //!< clock of the last acknowledged sample
+    };
+
+    SAckHeader* GetHeader() const;
+    SAckSlot*   GetSlot(size_t index_) const;
+    SAckSlot*   FindSlot(int32_t process_id_) const;
+    size_t      ReclaimSlot();
+
+    bool                                m_created;
+    bool                                m_writer;
+    std::string                         m_name;
+    void*                               m_address;
+    size_t                              m_size;
+    mutable std::mutex                  m_slot_map_sync;
+    std::unordered_map<int32_t, size_t> m_slot_map;        //!< writer side process id -> slot index
+    size_t                              m_reader_slot;     //!< reader side cached slot index
+  };
+}
@@ -165,6 +165,14 @@ namespace eCAL
     return(true);
   }
 
+  bool CMemFileMap::GrowFile(const size_t len_, std::shared_ptr<SMemFileInfo>& mem_file_info_)
+  {
+    // lock memory map access, readers of this process share the file info
+    const std::lock_guard<std::mutex> lock(m_memfile_map_mtx);
+
+    return memfile::os::GrowFile(len_, *mem_file_info_);
+  }
+
   namespace memfile
   {
     namespace db
@@ -189,6 +197,13 @@ namespace eCAL
         if (memfile_map) return memfile_map->CheckFileSize(len_, mem_file_info_);
         return false;
       }
+
+      bool GrowFile(const size_t len_, std::shared_ptr<SMemFileInfo>& mem_file_info_)
+      {
+        auto memfile_map = g_memfile_map();
+        if (memfile_map) return memfile_map->GrowFile(len_, mem_file_info_);
+        return false;
+      }
     }
   }
 }
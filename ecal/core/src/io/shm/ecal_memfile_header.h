@@ -39,9 +39,10 @@ namespace eCAL
     struct optflags
     {
       unsigned char zero_copy : 1;    // allow reader to access memory without copying
-      unsigned char unused    : 7;
+      unsigned char replayed  : 1;    // sample replayed from the publisher history (older clock than the last written sample)
+      unsigned char unused    : 6;
     };
-    optflags   options = { 0, 0 };
+    optflags   options = { 0, 0, 0 };
     // ----- > 5.11 ----
     int64_t    ack_timout_ms = 0;
   };
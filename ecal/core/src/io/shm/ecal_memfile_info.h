@@ -47,6 +47,13 @@ typedef int  MapRegionT;
 
 namespace eCAL
 {
+  struct SMemFileAllocation
+  {
+    bool         huge_pages  = false;  // back the file by the hugetlbfs mount (linux only, falls back to regular shared memory)
+    bool         prefault    = false;  // fault in all pages when the file is created
+    int          numa_node   = -1;     // bind the pages to this numa node (linux only, -1 == no binding)
+  };
+
   struct SMemFileInfo
   {
     int          refcnt      = 0;
@@ -57,5 +64,9 @@ namespace eCAL
     std::string  name;
     size_t       size        = 0;
     bool         exists      = false;
+    bool         huge_pages  = false;  // the file is located on the hugetlbfs mount
+    size_t       page_size   = 0;      // mapping granularity, file sizes are rounded up to it
+
+    SMemFileAllocation allocation;     // requested allocation (creating side only)
   };
 }
@@ -0,0 +1,179 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  memory file update notification via futex (linux only)
+**/
+
+#include "ecal_memfile_notify.h"
+
+#if defined(__linux__)
+#include <cerrno>
+#include <climits>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// futex_waitv is available since Linux 5.16, older headers do not know it
+#ifndef SYS_futex_waitv
+#define SYS_futex_waitv 449
+#endif
+
+namespace
+{
+  // layout of struct futex_waitv (linux/futex.h)
+  struct SFutexWaitV
+  {
+    std::uint64_t val;
+    std::uint64_t uaddr;
+    std::uint32_t flags;
+    std::uint32_t reserved;
+  };
+
+  const std::uint32_t futex_waitv_size_u32 = 0x02;  // FUTEX2_SIZE_U32, shared (no FUTEX2_PRIVATE)
+
+  bool ProbeWaitAny()
+  {
+    // an empty wait list is rejected with EINVAL by every kernel that knows the syscall
+    const long ret = ::syscall(SYS_futex_waitv, nullptr, 0, 0, nullptr, CLOCK_MONOTONIC);
+    return (ret == -1) && (errno == EINVAL);
+  }
+}
+#endif
+
+namespace eCAL
+{
+  namespace memfile
+  {
+    namespace notify
+    {
+#if defined(__linux__)
+      bool IsSupported()
+      {
+        return(true);
+      }
+
+      std::uint32_t Load(const std::uint32_t* word_)
+      {
+        if (word_ == nullptr) return(0);
+        return(__atomic_load_n(word_, __ATOMIC_ACQUIRE));
+      }
+
+      void Signal(std::uint32_t* word_)
+      {
+        if (word_ == nullptr) return;
+        __atomic_add_fetch(word_, 1, __ATOMIC_RELEASE);
+        Wake(word_);
+      }
+
+      void Wake(std::uint32_t* word_)
+      {
+        if (word_ == nullptr) return;
+        // the memory file is shared between processes, so we cannot use FUTEX_PRIVATE_FLAG
+        ::syscall(SYS_futex, word_, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+      }
+
+      bool Wait(const std::uint32_t* word_, const std::uint32_t expected_, const int timeout_ms_)
+      {
+        if (word_ == nullptr) return(false);
+        if (Load(word_) != expected_) return(true);
+
+        struct timespec timeout;
+        timeout.tv_sec  = timeout_ms_ / 1000;
+        timeout.tv_nsec = (timeout_ms_ % 1000) * 1000000L;
+
+        // returns immediately (EAGAIN) if the word has been changed in between
+        ::syscall(SYS_futex, word_, FUTEX_WAIT, expected_, &timeout, nullptr, 0);
+
+        return(Load(word_) != expected_);
+      }
+
+      bool IsWaitAnySupported()
+      {
+        static const bool supported = ProbeWaitAny();
+        return(supported);
+      }
+
+      bool WaitAny(const std::uint32_t* const* words_, const std::uint32_t* expected_, const std::size_t count_, const int timeout_ms_)
+      {
+        if ((words_ == nullptr) || (expected_ == nullptr))   return(false);
+        if ((count_ == 0) || (count_ > max_wait_any_words)) return(false);
+
+        SFutexWaitV waiters[max_wait_any_words];
+        for (std::size_t i = 0; i < count_; ++i)
+        {
+          waiters[i].val      = expected_[i];
+          waiters[i].uaddr    = reinterpret_cast<std::uintptr_t>(words_[i]);
+          waiters[i].flags    = futex_waitv_size_u32;
+          waiters[i].reserved = 0;
+        }
+
+        // futex_waitv takes an absolute timeout
+        struct timespec timeout;
+        ::clock_gettime(CLOCK_MONOTONIC, &timeout);
+        timeout.tv_sec  += timeout_ms_ / 1000;
+        timeout.tv_nsec += (timeout_ms_ % 1000) * 1000000L;
+        if (timeout.tv_nsec >= 1000000000L)
+        {
+          timeout.tv_sec  += 1;
+          timeout.tv_nsec -= 1000000000L;
+        }
+
+        // returns the index of the woken word, or immediately (EAGAIN) if any word has been changed in between
+        const long ret = ::syscall(SYS_futex_waitv, waiters, static_cast<unsigned int>(count_), 0, &timeout, CLOCK_MONOTONIC);
+        return((ret >= 0) || (errno == EAGAIN) || (errno == EINTR));
+      }
+#else
+      bool IsSupported()
+      {
+        return(false);
+      }
+
+      std::uint32_t Load(const std::uint32_t* /*word_*/)
+      {
+        return(0);
+      }
+
+      void Signal(std::uint32_t* /*word_*/)
+      {
+      }
+
+      void Wake(std::uint32_t* /*word_*/)
+      {
+      }
+
+      bool Wait(const std::uint32_t* /*word_*/, const std::uint32_t /*expected_*/, const int /*timeout_ms_*/)
+      {
+        return(false);
+      }
+
+      bool IsWaitAnySupported()
+      {
+        return(false);
+      }
+
+      bool WaitAny(const std::uint32_t* const* /*words_*/, const std::uint32_t* /*expected_*/, const std::size_t /*count_*/, const int /*timeout_ms_*/)
+      {
+        return(false);
+      }
+#endif
+    }
+  }
+}
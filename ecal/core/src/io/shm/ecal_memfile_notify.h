@@ -0,0 +1,89 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  memory file update notification via futex (linux only)
+**/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace eCAL
+{
+  namespace memfile
+  {
+    namespace notify
+    {
+      /**
+       * @brief Check if futex based notification is available on this platform.
+      **/
+      bool IsSupported();
+
+      /**
+       * @brief Read the current value of a notification word.
+      **/
+      std::uint32_t Load(const std::uint32_t* word_);
+
+      /**
+       * @brief Increment the notification word and wake up all waiting processes (writer side).
+      **/
+      void Signal(std::uint32_t* word_);
+
+      /**
+       * @brief Wake up all processes waiting on the notification word without changing it.
+      **/
+      void Wake(std::uint32_t* word_);
+
+      /**
+       * @brief Wait until the notification word differs from the expected value.
+       *
+       * @param word_        The notification word.
+       * @param expected_    The last seen value.
+       * @param timeout_ms_  The timeout in ms.
+       *
+       * @return  true if the word changed, false on timeout or spurious wake up.
+      **/
+      bool Wait(const std::uint32_t* word_, std::uint32_t expected_, int timeout_ms_);
+
+      /**
+       * @brief Maximum number of notification words for WaitAny.
+      **/
+      constexpr std::size_t max_wait_any_words = 128;
+
+      /**
+       * @brief Check if waiting on several notification words at once is available (futex_waitv, Linux >= 5.16).
+      **/
+      bool IsWaitAnySupported();
+
+      /**
+       * @brief Wait until any of the notification words differs from its expected value.
+       *
+       * @param words_       The notification words.
+       * @param expected_    The last seen values (one per word).
+       * @param count_       The number of words (max_wait_any_words at most).
+       * @param timeout_ms_  The timeout in ms.
+       *
+       * @return  true if the wait returned before the timeout (a word changed or a spurious wake up), false on timeout or failure.
+      **/
+      bool WaitAny(const std::uint32_t* const* words_, const std::uint32_t* expected_, std::size_t count_, int timeout_ms_);
+    }
+  }
+}
@@ -42,6 +42,9 @@ namespace eCAL
       bool UnMapFile(SMemFileInfo& mem_file_info_);
 
       bool CheckFileSize(const size_t len_, const bool create_, SMemFileInfo& mem_file_info_);
+
+      // extend a created memory file in place, readers pick up the new size on their next access
+      bool GrowFile(const size_t len_, SMemFileInfo& mem_file_info_);
     }
   }
 }
@@ -23,8 +23,10 @@
 **/
 
 #include "ecal_event.h"
+#include "ecal_memfile_notify.h"
 #include "ecal_memfile_pool.h"
 
+#include <algorithm>
 #include <chrono>
 #include <mutex>
 #include <string>
@@ -32,6 +34,11 @@
 #include <utility>
 #include <vector>
 
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 namespace eCAL
 {
   ////////////////////////////////////////
@@ -41,7 +48,15 @@ namespace eCAL
     m_created(false),
     m_do_stop(false),
     m_is_observing(false),
-    m_time_of_last_life_signal(std::chrono::steady_clock::now())
+    m_time_of_last_life_signal(std::chrono::steady_clock::now()),
+    m_timeout(0),
+    m_worker(nullptr),
+    m_memfile_ring(std::make_shared<CMemoryFileRing>()),
+    m_process_id(0),
+    m_last_sample_clock(0),
+    m_ring_read_count(0),
+    m_last_notify_seq(0),
+    m_has_unprocessed_data(false)
   {
   }
 
@@ -54,16 +69,28 @@ namespace eCAL
     Destroy();
   }
 
-  bool CMemFileObserver::Create(const std::string& memfile_name_, const std::string& memfile_event_)
+  bool CMemFileObserver::Create(const std::string& memfile_name_, const std::string& memfile_event_, const int32_t process_id_)
   {
     if (m_created) return false;
 
+    m_process_id = process_id_;
+
     // open memory file events
     gOpenNamedEvent(&m_event_snd, memfile_event_, false);
     gOpenNamedEvent(&m_event_ack, memfile_event_ + "_ack", false);
 
     // create memory file access
-    m_memfile.Create(memfile_name_.c_str(), false);
+    // lock-free ring memory files are detected by their header, all others are classic memory files
+    if (!m_memfile_ring->Create(memfile_name_, false))
+    {
+      m_memfile.Create(memfile_name_.c_str(), false);
+
+      // writers with futex notification collect acknowledges in a shared acknowledge file
+      if (m_memfile.HasFutexNotification())
+      {
+        m_memfile_ack.Create(memfile_name_, false);
+      }
+    }
 
     m_created = true;
 
@@ -80,7 +107,10 @@ namespace eCAL
     if (!m_created) return false;
 
     // destroy memory file (access only)
+    // pinned samples still point into the ring, it is unmapped with the last of them
+    m_memfile_ring = std::make_shared<CMemoryFileRing>();
     m_memfile.Destroy(false);
+    m_memfile_ack.Destroy();
 
     // close memory file events
     gCloseEvent(m_event_snd);
@@ -101,14 +131,11 @@ namespace eCAL
     if (!m_created)     return false;
     if (m_is_observing) return false;
 
-    // assign callback
-    m_data_callback = callback_;
-
-    // mark as running
-    m_is_observing = true;
+    // assign callback, reset read state and mark as running
+    Prepare(timeout_, callback_);
 
     // start observer thread
-    m_thread = std::thread(&CMemFileObserver::Observe, this, timeout_);
+    m_thread = std::thread(&CMemFileObserver::Observe, this);
 
 #ifndef NDEBUG
     // log it
@@ -118,6 +145,31 @@ namespace eCAL
     return true;
   }
 
+  bool CMemFileObserver::Start(const int timeout_, const MemFileDataCallbackT& callback_, CMemFileObserverWorker& worker_)
+  {
+    if (!m_created)               return false;
+    if (m_is_observing)           return false;
+    if (!HasFutexNotification())  return false;
+
+    // assign callback, reset read state and mark as running
+    Prepare(timeout_, callback_);
+
+    // hand over to the worker thread
+    m_worker = &worker_;
+    if (!worker_.Add(shared_from_this()))
+    {
+      m_worker         = nullptr;
+      m_is_observing   = false;
+      return false;
+    }
+
+#ifndef NDEBUG
+    // log it
+    Logging::Log(Logging::log_level_debug2, std::string("CMemFileObserver started (shared worker)."));
+#endif
+
+    return true;
+  }
 
   bool CMemFileObserver::Stop()
   {
@@ -128,8 +180,17 @@ namespace eCAL
       // signal observer to stop
       m_do_stop = true;
 
-      // set sync event to unlock loop
+      // set sync event (or wake up futex waiter) to unlock loop
       gSetEvent(m_event_snd);
+      memfile::notify::Wake(GetNotifyAddress());
+    }
+
+    // detach from the worker, this waits until the worker has finished processing our memory file
+    CMemFileObserverWorker* worker = m_worker.exchange(nullptr);
+    if (worker != nullptr)
+    {
+      worker->Remove(this);
+      m_is_observing = false;
     }
 
     // wait for finalization
@@ -147,28 +208,47 @@ namespace eCAL
     return true;
   }
 
-  void CMemFileObserver::Observe(const int timeout_)
+  bool CMemFileObserver::HasFutexNotification() const
   {
+    return GetNotifyAddress() != nullptr;
+  }
+
+  void CMemFileObserver::Prepare(const int timeout_, const MemFileDataCallbackT& callback_)
+  {
+    // assign callback
+    m_data_callback = callback_;
+    m_timeout       = timeout_;
+
     // internal clock sample update checking
-    uint64_t last_sample_clock(0);
+    m_last_sample_clock    = 0;
+    m_has_unprocessed_data = false;
 
-    // buffer to store memory file content
-    std::vector<char> receive_buffer;
+    // ring read cursor, start with the latest sample like in the single slot case
+    m_ring_read_count = m_memfile_ring->WriteCount();
+    if (m_ring_read_count > 0) m_ring_read_count--;
 
-    // Boolean that tells whether the SHM file has new data that we have NOT already accessed
-    bool has_unprocessed_data = false;
+    // futex notification sequence, start with the latest update like in the event case
+    m_last_notify_seq = memfile::notify::Load(GetNotifyAddress());
+    if (m_last_notify_seq > 0) m_last_notify_seq--;
 
+    // mark as running
+    m_time_of_last_life_signal = std::chrono::steady_clock::now();
+    m_do_stop      = false;
+    m_is_observing = true;
+  }
+
+  void CMemFileObserver::Observe()
+  {
     // runs as long as there is no timeout and no external stop request
-    while(std::chrono::steady_clock::now() - std::chrono::steady_clock::time_point(m_time_of_last_life_signal) < std::chrono::milliseconds(timeout_)
-           && !m_do_stop)
+    while(!IsTimedOut() && !m_do_stop)
     {
-      if (!has_unprocessed_data)
+      if (!m_has_unprocessed_data)
       {
         // Only wait for the new-data-event, if we haven't processed the data, yet
-        // check for memory file update event from shm writer (20 ms)
-        has_unprocessed_data = gWaitForEvent(m_event_snd, 500);
+        // check for memory file update event from shm writer (500 ms)
+        m_has_unprocessed_data = WaitForUpdate(500);
 
-        if (has_unprocessed_data)
+        if (m_has_unprocessed_data)
         {
           // We got a signal from the publisher! It is alive! So we reset the time since the last live signal
           m_time_of_last_life_signal = std::chrono::steady_clock::now();
@@ -176,104 +256,13 @@ namespace eCAL
       }
 
       // If we have unprocessed data, we try to access (and process!) it
-      if(has_unprocessed_data)
+      if(m_has_unprocessed_data)
       {
         // last chance to stop ..
         if(m_do_stop) break;
 
         // try to open memory file (timeout 5 ms)
-        if(m_memfile.GetReadAccess(5))
-        {
-          // We have gotten access! Now the data qualifies as processed, so next loop we will wait for the signal for new data, again.
-          has_unprocessed_data = false;
-
-          // read the file header
-          SMemFileHeader mfile_hdr;
-          ReadFileHeader(mfile_hdr);
-
-          // check for new content
-          if (mfile_hdr.clock <= last_sample_clock)
-          {
-            // release access and leave
-            m_memfile.ReleaseReadAccess();
-          }
-          else
-          {
-            const bool zero_copy_allowed = mfile_hdr.options.zero_copy != 0;
-            bool post_process_buffer(false);
-            // -------------------------------------------------------------------------
-            // zero copy mode
-            // -------------------------------------------------------------------------
-            // That means we call the user callback (ApplySample) from within the opened memory file.
-            // So we do not waste time by copying the payload in an intermediate buffer
-            // but the file keeps opened and blocked until the callback returns.
-            // Other subscriber can not access the content this time !
-            // -------------------------------------------------------------------------
-            if (zero_copy_allowed)
-            {
-              if (m_data_callback)
-              {
-                const char* data_buf = nullptr;
-                if (mfile_hdr.data_size > 0)
-                {
-                  // acquire memory file payload pointer (no copying here)
-                  const void* buf(nullptr);
-                  if (m_memfile.GetReadAddress(buf, mfile_hdr.data_size) > 0)
-                  {
-                    // calculate user payload address
-                    data_buf = static_cast<const char*>(buf) + mfile_hdr.hdr_size;
-                    // call user callback function
-                    m_data_callback(data_buf, mfile_hdr.data_size, (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash);
-                  }
-                }
-                else
-                {
-                  // call user callback function
-                  m_data_callback(data_buf, mfile_hdr.data_size, (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash);
-                }
-              }
-            }
-            // -------------------------------------------------------------------------
-            // buffered mode
-            // -------------------------------------------------------------------------
-            // we copy the data into the receive buffer (standard mode for eCAL < 5.10)
-            // and close the file immediately
-            else
-            {
-              // need to resize the buffer especially if data_size = 0, otherwise it might contain stale data.
-              receive_buffer.resize((size_t)mfile_hdr.data_size);
-
-              // read payload
-              // if data length == 0, there is no need to further read data
-              // we just flag to process the empty buffer
-              if (mfile_hdr.data_size != 0)
-              {
-                m_memfile.Read(receive_buffer.data(), (size_t)mfile_hdr.data_size, mfile_hdr.hdr_size);
-              }
-
-              post_process_buffer = true;
-            }
-
-            // store clock
-            last_sample_clock = mfile_hdr.clock;
-
-            // release access
-            m_memfile.ReleaseReadAccess();
-
-            // process receive buffer if buffered mode read some data in
-            if (post_process_buffer)
-            {
-              // add sample to data reader (and call user callback function)
-              if (m_data_callback) m_data_callback(receive_buffer.data(), receive_buffer.size(), (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash);
-            }
-
-            // send acknowledge event
-            if (mfile_hdr.ack_timout_ms != 0)
-            {
-              gSetEvent(m_event_ack);
-            }
-          }
-        }
+        ProcessUpdate(5);
       }
     }
 
@@ -293,6 +282,200 @@ namespace eCAL
     m_is_observing = false; //-V1020
   }
 
+  bool CMemFileObserver::IsTimedOut() const
+  {
+    return std::chrono::steady_clock::now() - std::chrono::steady_clock::time_point(m_time_of_last_life_signal) >= std::chrono::milliseconds(m_timeout);
+  }
+
+  bool CMemFileObserver::ProcessUpdate(const int access_timeout_)
+  {
+    // lock-free ring, read all samples written since the last wake up
+    if (m_memfile_ring->IsCreated())
+    {
+      m_has_unprocessed_data = false;
+      ReadRing();
+      return true;
+    }
+
+    // try to open memory file
+    if(!m_memfile.GetReadAccess(access_timeout_)) return false;
+
+    // We have gotten access! Now the data qualifies as processed, so next loop we will wait for the signal for new data, again.
+    m_has_unprocessed_data = false;
+
+    // read the file header
+    SMemFileHeader mfile_hdr;
+    ReadFileHeader(mfile_hdr);
+
+    // check for new content (a replayed history sample is older than the live samples by design)
+    const bool replayed = mfile_hdr.options.replayed != 0;
+    if ((mfile_hdr.clock <= m_last_sample_clock) && !replayed)
+    {
+      // release access and leave
+      m_memfile.ReleaseReadAccess();
+      return true;
+    }
+
+    const bool zero_copy_allowed = mfile_hdr.options.zero_copy != 0;
+    bool post_process_buffer(false);
+    bool applied(false);
+    // -------------------------------------------------------------------------
+    // zero copy mode
+    // -------------------------------------------------------------------------
+    // That means we call the user callback (ApplySample) from within the opened memory file.
+    // So we do not waste time by copying the payload in an intermediate buffer
+    // but the file keeps opened and blocked until the callback returns.
+    // Other subscriber can not access the content this time !
+    // -------------------------------------------------------------------------
+    if (zero_copy_allowed)
+    {
+      if (m_data_callback)
+      {
+        const char* data_buf = nullptr;
+        if (mfile_hdr.data_size > 0)
+        {
+          // acquire memory file payload pointer (no copying here)
+          const void* buf(nullptr);
+          if (m_memfile.GetReadAddress(buf, mfile_hdr.data_size) > 0)
+          {
+            // calculate user payload address
+            data_buf = static_cast<const char*>(buf) + mfile_hdr.hdr_size;
+            // call user callback function
+            applied = m_data_callback(data_buf, mfile_hdr.data_size, (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash, replayed, nullptr);
+          }
+        }
+        else
+        {
+          // call user callback function
+          applied = m_data_callback(data_buf, mfile_hdr.data_size, (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash, replayed, nullptr);
+        }
+      }
+    }
+    // -------------------------------------------------------------------------
+    // buffered mode
+    // -------------------------------------------------------------------------
+    // we copy the data into the receive buffer (standard mode for eCAL < 5.10)
+    // and close the file immediately
+    else
+    {
+      // need to resize the buffer especially if data_size = 0, otherwise it might contain stale data.
+      m_receive_buffer.resize((size_t)mfile_hdr.data_size);
+
+      // read payload
+      // if data length == 0, there is no need to further read data
+      // we just flag to process the empty buffer
+      if (mfile_hdr.data_size != 0)
+      {
+        m_memfile.Read(m_receive_buffer.data(), (size_t)mfile_hdr.data_size, mfile_hdr.hdr_size);
+      }
+
+      post_process_buffer = true;
+    }
+
+    // store clock
+    m_last_sample_clock = std::max(m_last_sample_clock, mfile_hdr.clock);
+
+    // release access
+    m_memfile.ReleaseReadAccess();
+
+    // process receive buffer if buffered mode read some data in
+    if (post_process_buffer)
+    {
+      // add sample to data reader (and call user callback function)
+      if (m_data_callback) applied = m_data_callback(m_receive_buffer.data(), m_receive_buffer.size(), (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash, replayed, nullptr);
+    }
+
+    // send acknowledge (via our slot in the shared acknowledge file if the writer assigned one)
+    // a replayed history sample is acknowledged only if a subscriber applied it, the publisher
+    // takes the acknowledge as confirmation that the history was delivered
+    if ((mfile_hdr.ack_timout_ms != 0) && (applied || !replayed))
+    {
+      if (!m_memfile_ack.Acknowledge(m_process_id, mfile_hdr.clock))
+      {
+        gSetEvent(m_event_ack);
+      }
+    }
+
+    return true;
+  }
+
+  bool CMemFileObserver::WaitForUpdate(const int timeout_)
+  {
+    // the writer signals updates via one futex word for all subscribers
+    // the address has to be requested every time, the memory file may be remapped on read access
+    const uint32_t* notify_address = GetNotifyAddress();
+    if (notify_address != nullptr)
+    {
+      memfile::notify::Wait(notify_address, m_last_notify_seq, timeout_);
+      return CheckForUpdate();
+    }
+
+    // the writer signals updates via our named event
+    return gWaitForEvent(m_event_snd, timeout_);
+  }
+
+  bool CMemFileObserver::CheckForUpdate()
+  {
+    const uint32_t* notify_address = GetNotifyAddress();
+    if (notify_address == nullptr) return false;
+
+    const uint32_t notify_seq = memfile::notify::Load(notify_address);
+    if (notify_seq == m_last_notify_seq) return false;
+
+    m_last_notify_seq = notify_seq;
+    return true;
+  }
+
+  std::uint32_t* CMemFileObserver::GetNotifyAddress() const
+  {
+    if (m_memfile_ring->IsCreated())
+    {
+      return m_memfile_ring->HasFutexNotification() ? m_memfile_ring->GetNotifyAddress() : nullptr;
+    }
+    return m_memfile.HasFutexNotification() ? m_memfile.GetNotifyAddress() : nullptr;
+  }
+
+  void CMemFileObserver::ReadRing()
+  {
+    // the payload is pinned in the ring if a pin slot is available, the writer does not reuse
+    // a pinned block, so the sample may be kept beyond the callback without blocking the writer
+    // all other samples are copied, holding a slot during the user callback would not prevent
+    // the writer from overwriting it
+    SMemFileHeader mfile_hdr;
+    uint64_t dropped(0);
+    while (!m_do_stop)
+    {
+      const char* payload(nullptr);
+      uint64_t    block(0);
+      if (m_data_callback && m_memfile_ring->ReadPinned(m_ring_read_count, mfile_hdr, payload, block, dropped))
+      {
+        const auto pin = std::make_shared<CSamplePin>(m_memfile_ring, [ring = m_memfile_ring.get(), block]() { ring->Unpin(block); });
+        m_data_callback(payload, (size_t)mfile_hdr.data_size, (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash, mfile_hdr.options.replayed != 0, pin);
+      }
+      else
+      {
+        if (!m_memfile_ring->Read(m_ring_read_count, mfile_hdr, m_receive_buffer, dropped)) break;
+        if (m_data_callback) m_data_callback(m_receive_buffer.data(), m_receive_buffer.size(), (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash, mfile_hdr.options.replayed != 0, nullptr);
+      }
+
+      // the writer of a ring waits for the acknowledge of the first sample after recreating the ring only
+      if (mfile_hdr.ack_timout_ms != 0)
+      {
+        if (!m_memfile_ack.Acknowledge(m_process_id, mfile_hdr.clock))
+        {
+          gSetEvent(m_event_ack);
+        }
+      }
+    }
+
+#ifndef NDEBUG
+    if (dropped > 0)
+    {
+      Logging::Log(Logging::log_level_debug2, std::string("CMemFileObserver " + m_memfile_ring->Name() + " ring overrun, dropped samples: ") + std::to_string(dropped));
+    }
+#endif
+  }
+
   bool CMemFileObserver::ReadFileHeader(SMemFileHeader& mfile_hdr_)
   {
     // retrieve size of received buffer
@@ -316,11 +499,210 @@ namespace eCAL
     return false;
   }
 
+  ////////////////////////////////////////
+  // CMemFileObserverWorker
+  ////////////////////////////////////////
+  constexpr size_t CMemFileObserverWorker::max_observers;
+
+  CMemFileObserverWorker::CMemFileObserverWorker() :
+    m_do_stop(false),
+    m_wake_word(0),
+    m_processing_observer(nullptr)
+  {
+  }
+
+  CMemFileObserverWorker::~CMemFileObserverWorker()
+  {
+    Stop();
+  }
+
+  void CMemFileObserverWorker::Start(const int cpu_)
+  {
+    if (m_thread.joinable()) return;
+
+    m_do_stop = false;
+    m_thread  = std::thread(&CMemFileObserverWorker::Run, this);
+
+#if defined(__linux__)
+    // pin the worker to the given cpu
+    if (cpu_ >= 0)
+    {
+      cpu_set_t cpu_set;
+      CPU_ZERO(&cpu_set);
+      CPU_SET(cpu_, &cpu_set);
+      pthread_setaffinity_np(m_thread.native_handle(), sizeof(cpu_set_t), &cpu_set);
+    }
+#else
+    (void)cpu_;
+#endif
+  }
+
+  void CMemFileObserverWorker::Stop()
+  {
+    if (!m_thread.joinable()) return;
+
+    m_do_stop = true;
+    Wake();
+    m_thread.join();
+
+    // release all remaining observers
+    std::vector<std::shared_ptr<CMemFileObserver>> observers;
+    {
+      const std::lock_guard<std::mutex> lock(m_observers_sync);
+      for (auto& observer : m_observers)
+      {
+        observer->m_worker       = nullptr;
+        observer->m_is_observing = false;
+      }
+      observers.swap(m_observers);
+    }
+  }
+
+  bool CMemFileObserverWorker::Add(const std::shared_ptr<CMemFileObserver>& observer_)
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_observers_sync);
+      if (m_observers.size() >= max_observers) return false;
+      m_observers.push_back(observer_);
+    }
+
+    // make the worker wait for the new memory file too
+    Wake();
+    return true;
+  }
+
+  void CMemFileObserverWorker::Remove(const CMemFileObserver* observer_)
+  {
+    std::shared_ptr<CMemFileObserver> removed_observer;
+    {
+      std::unique_lock<std::mutex> lock(m_observers_sync);
+      auto iter = std::find_if(m_observers.begin(), m_observers.end(), [observer_](const std::shared_ptr<CMemFileObserver>& observer) { return observer.get() == observer_; });
+      if (iter == m_observers.end()) return;
+      removed_observer = *iter;
+      m_observers.erase(iter);
+
+      // the observer is not in use after this block, wait if the worker is processing its update right now
+      // (unless we are called from a data callback on the worker thread itself)
+      if (std::this_thread::get_id() != m_thread.get_id())
+      {
+        m_processing_cv.wait(lock, [this, observer_]() { return m_processing_observer != observer_; });
+      }
+    }
+    Wake();
+  }
+
+  size_t CMemFileObserverWorker::ObserverCount() const
+  {
+    const std::lock_guard<std::mutex> lock(m_observers_sync);
+    return m_observers.size();
+  }
+
+  void CMemFileObserverWorker::Wake()
+  {
+    memfile::notify::Signal(&m_wake_word);
+  }
+
+  void CMemFileObserverWorker::Run()
+  {
+    std::vector<const std::uint32_t*> notify_words;
+    std::vector<std::uint32_t>        notify_seqs;
+    notify_words.reserve(memfile::notify::max_wait_any_words);
+    notify_seqs.reserve(memfile::notify::max_wait_any_words);
+
+    std::vector<std::shared_ptr<CMemFileObserver>> finished_observers;
+    std::vector<std::shared_ptr<CMemFileObserver>> updated_observers;
+
+    while (!m_do_stop)
+    {
+      // collect the futex words of all observed memory files, the first one wakes up the worker itself
+      // the addresses have to be requested every time, the memory files may be remapped on read access
+      notify_words.clear();
+      notify_seqs.clear();
+      notify_words.push_back(&m_wake_word);
+      notify_seqs.push_back(memfile::notify::Load(&m_wake_word));
+
+      bool has_unprocessed_data(false);
+      {
+        const std::lock_guard<std::mutex> lock(m_observers_sync);
+        for (const auto& observer : m_observers)
+        {
+          const std::uint32_t* notify_address = observer->GetNotifyAddress();
+          if (notify_address == nullptr) continue;
+          notify_words.push_back(notify_address);
+          notify_seqs.push_back(observer->m_last_notify_seq);
+          has_unprocessed_data = has_unprocessed_data || observer->m_has_unprocessed_data;
+        }
+      }
+
+      // retry memory files we could not access soon, otherwise wake up regularly to check the observer timeouts
+      memfile::notify::WaitAny(notify_words.data(), notify_seqs.data(), notify_words.size(), has_unprocessed_data ? 1 : 500);
+      if (m_do_stop) break;
+
+      {
+        const std::lock_guard<std::mutex> lock(m_observers_sync);
+        for (auto iter = m_observers.begin(); iter != m_observers.end();)
+        {
+          auto& observer = *iter;
+
+          // stopped or no life signal from the publisher
+          if (observer->m_do_stop || observer->IsTimedOut())
+          {
+#ifndef NDEBUG
+            Logging::Log(Logging::log_level_debug2, std::string("CMemFileObserver " + observer->m_memfile.Name() + (observer->m_do_stop ? " stopped" : " timeout")));
+#endif
+            observer->m_worker       = nullptr;
+            observer->m_is_observing = false;
+            finished_observers.push_back(observer);
+            iter = m_observers.erase(iter);
+            continue;
+          }
+
+          if (!observer->m_has_unprocessed_data && observer->CheckForUpdate())
+          {
+            // We got a signal from the publisher! It is alive! So we reset the time since the last live signal
+            observer->m_has_unprocessed_data     = true;
+            observer->m_time_of_last_life_signal = std::chrono::steady_clock::now();
+          }
+
+          if (observer->m_has_unprocessed_data) updated_observers.push_back(observer);
+
+          ++iter;
+        }
+      }
+
+      // process the updates outside of the lock, the data callbacks may add or remove observers of this worker
+      for (const auto& observer : updated_observers)
+      {
+        {
+          // skip observers removed in the meantime (e.g. by a previous data callback)
+          const std::lock_guard<std::mutex> lock(m_observers_sync);
+          if (observer->m_do_stop || (observer->m_worker != this)) continue;
+          m_processing_observer = observer.get();
+        }
+
+        // never block the other memory files of this worker while waiting for read access
+        observer->ProcessUpdate(0);
+
+        {
+          const std::lock_guard<std::mutex> lock(m_observers_sync);
+          m_processing_observer = nullptr;
+        }
+        m_processing_cv.notify_all();
+      }
+
+      // release finished and processed observers outside of the lock, this may destroy them
+      updated_observers.clear();
+      finished_observers.clear();
+    }
+  }
+
   ////////////////////////////////////////
   // CMemFileThreadPool
   ////////////////////////////////////////
-  CMemFileThreadPool::CMemFileThreadPool() :
+  CMemFileThreadPool::CMemFileThreadPool(const size_t observer_thread_count_, const uint64_t observer_cpu_affinity_mask_) :
   m_created(false),
+  m_observer_thread_count(observer_thread_count_),
+  m_observer_cpu_affinity_mask(observer_cpu_affinity_mask_),
   m_do_cleanup(false)
   {
   }
@@ -334,6 +716,24 @@ namespace eCAL
   {
     if(m_created) return;
 
+    // start the shared observer threads (futex notified memory files only)
+    if ((m_observer_thread_count > 0) && memfile::notify::IsWaitAnySupported())
+    {
+      // distribute the workers round robin over the cpus of the affinity mask
+      std::vector<int> cpus;
+      for (int cpu = 0; cpu < 64; ++cpu)
+      {
+        if ((m_observer_cpu_affinity_mask & (uint64_t(1) << cpu)) != 0) cpus.push_back(cpu);
+      }
+
+      for (size_t worker_index = 0; worker_index < m_observer_thread_count; ++worker_index)
+      {
+        std::unique_ptr<CMemFileObserverWorker> worker(new CMemFileObserverWorker());
+        worker->Start(cpus.empty() ? -1 : cpus[worker_index % cpus.size()]);
+        m_observer_workers.push_back(std::move(worker));
+      }
+    }
+
     // start cleanup thread
     m_do_cleanup = true;
     m_cleanup_thread = std::thread(&CMemFileThreadPool::CleanupPoolThread, this);
@@ -353,19 +753,25 @@ namespace eCAL
     }
     if (m_cleanup_thread.joinable()) m_cleanup_thread.join();
 
-    // lock pool
-    const std::lock_guard<std::mutex> lock(m_observer_pool_sync);
+    {
+      // lock pool
+      const std::lock_guard<std::mutex> lock(m_observer_pool_sync);
+
+      // stop all running observers
+      for (auto & observer : m_observer_pool) observer.second->Stop();
 
-    // stop all running observers
-    for (auto & observer : m_observer_pool) observer.second->Stop();
+      // clear pool (and destroy all)
+      m_observer_pool.clear();
+    }
 
-    // clear pool (and destroy all)
-    m_observer_pool.clear();
+    // stop the shared observer threads
+    for (auto& worker : m_observer_workers) worker->Stop();
+    m_observer_workers.clear();
 
     m_created = false;
   }
 
-  bool CMemFileThreadPool::ObserveFile(const std::string& memfile_name_, const std::string& memfile_event_, int timeout_observation_ms, const MemFileDataCallbackT& callback_)
+  bool CMemFileThreadPool::ObserveFile(const std::string& memfile_name_, const std::string& memfile_event_, const int32_t process_id_, int timeout_observation_ms, const MemFileDataCallbackT& callback_)
   {
     if(!m_created)            return(false);
     if(memfile_name_.empty()) return(false);
@@ -388,7 +794,7 @@ namespace eCAL
       else
       {
         observer->Stop();
-        observer->Start(timeout_observation_ms, callback_);
+        StartObserver(observer, timeout_observation_ms, callback_);
       }
 
       return(true);
@@ -397,8 +803,8 @@ namespace eCAL
     else
     {
       auto observer = std::make_shared<CMemFileObserver>();
-      observer->Create(memfile_name_, memfile_event_);
-      observer->Start(timeout_observation_ms, callback_);
+      observer->Create(memfile_name_, memfile_event_, process_id_);
+      StartObserver(observer, timeout_observation_ms, callback_);
       m_observer_pool[memfile_name_] = observer;
 #ifndef NDEBUG
       // log it
@@ -408,6 +814,20 @@ namespace eCAL
     }
   }
 
+  void CMemFileThreadPool::StartObserver(const std::shared_ptr<CMemFileObserver>& observer_, const int timeout_observation_ms, const MemFileDataCallbackT& callback_)
+  {
+    // futex notified memory files are shared by the worker threads (least loaded first),
+    // memory files signaled via named events need a thread of their own
+    if (observer_->HasFutexNotification() && !m_observer_workers.empty())
+    {
+      auto worker = std::min_element(m_observer_workers.begin(), m_observer_workers.end(),
+        [](const std::unique_ptr<CMemFileObserverWorker>& lhs, const std::unique_ptr<CMemFileObserverWorker>& rhs) { return lhs->ObserverCount() < rhs->ObserverCount(); });
+      if (observer_->Start(timeout_observation_ms, callback_, **worker)) return;
+    }
+
+    observer_->Start(timeout_observation_ms, callback_);
+  }
+
   void CMemFileThreadPool::CleanupPoolThread()
   {
     for (;;)
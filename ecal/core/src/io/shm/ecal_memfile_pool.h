@@ -25,11 +25,16 @@
 
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <ecal/log.h>
 
 #include "ecal_event.h"
 #include "ecal_memfile.h"
+#include "ecal_memfile_ack.h"
 #include "ecal_memfile_header.h"
+#include "ecal_memfile_notify.h"
+#include "ecal_memfile_ring.h"
+#include "util/sample_pin.h"
 
 #include <atomic>
 #include <condition_variable>
@@ -39,15 +44,20 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace eCAL
 {
-  using MemFileDataCallbackT = std::function<size_t (const char *, size_t, long long, long long, long long, size_t)>;
+  // the replayed flag marks a sample replayed from the publisher history, the last parameter is the pin of a payload
+  // located in a ring memory file (nullptr if the payload is only valid during the call), returns true if the sample was applied
+  using MemFileDataCallbackT = std::function<bool (const char *, size_t, long long, long long, long long, size_t, bool, const std::shared_ptr<CSamplePin>&)>;
+
+  class CMemFileObserverWorker;
 
   ////////////////////////////////////////
   // CMemFileObserver
   ////////////////////////////////////////
-  class CMemFileObserver
+  class CMemFileObserver : public std::enable_shared_from_this<CMemFileObserver>
   {
   public:
     CMemFileObserver();
@@ -58,31 +68,101 @@ namespace eCAL
     CMemFileObserver(CMemFileObserver&& rhs) = delete;
     CMemFileObserver& operator=(CMemFileObserver&& rhs) = delete;
 
-    bool Create(const std::string& memfile_name_, const std::string& memfile_event_);
+    bool Create(const std::string& memfile_name_, const std::string& memfile_event_, int32_t process_id_);
     bool Destroy();
 
     bool Start(int timeout_, const MemFileDataCallbackT& callback_);
+    bool Start(int timeout_, const MemFileDataCallbackT& callback_, CMemFileObserverWorker& worker_);
     bool Stop();
     bool IsObserving() {return(m_is_observing);};
 
     bool ResetTimeout();
 
+    // the memory file writer signals updates via futex (so the observer can be shared by a worker)
+    bool HasFutexNotification() const;
+
   protected:
-    void Observe(int timeout_);
+    friend class CMemFileObserverWorker;
+
+    void Prepare(int timeout_, const MemFileDataCallbackT& callback_);
+    void Observe();
+    bool IsTimedOut() const;
+    bool ProcessUpdate(int access_timeout_);
     bool ReadFileHeader(SMemFileHeader& memfile_hdr);
+    void ReadRing();
+    bool WaitForUpdate(int timeout_);
+    bool CheckForUpdate();
+    std::uint32_t* GetNotifyAddress() const;
 
     std::atomic<bool>       m_created;
     std::atomic<bool>       m_do_stop;
     std::atomic<bool>       m_is_observing;
 
     std::atomic<std::chrono::steady_clock::time_point> m_time_of_last_life_signal;
+    int                     m_timeout;
 
     MemFileDataCallbackT    m_data_callback;
 
     std::thread             m_thread;
+    std::atomic<CMemFileObserverWorker*> m_worker;
     EventHandleT            m_event_snd;
     EventHandleT            m_event_ack;
     CMemoryFile             m_memfile;
+    std::shared_ptr<CMemoryFileRing> m_memfile_ring;   // shared with the pins of ring samples
+    CMemoryFileAck          m_memfile_ack;
+    int32_t                 m_process_id;
+
+    // read state, owned by the observing thread
+    uint64_t                m_last_sample_clock;
+    uint64_t                m_ring_read_count;
+    std::uint32_t           m_last_notify_seq;
+    bool                    m_has_unprocessed_data;  // the memory file has new data that we have NOT already accessed
+    std::vector<char>       m_receive_buffer;
+  };
+
+  ////////////////////////////////////////
+  // CMemFileObserverWorker
+  ////////////////////////////////////////
+  /**
+   * @brief Thread that observes many futex notified memory files at once.
+   *
+   * All notification words are waited for with one futex_waitv call, so the number
+   * of threads does not grow with the number of observed memory files. The data
+   * callbacks of all observers of a worker are called from the worker thread, without
+   * holding the observer list lock, so a callback may start or stop other observers.
+  **/
+  class CMemFileObserverWorker
+  {
+  public:
+    static constexpr size_t max_observers = memfile::notify::max_wait_any_words - 1;  //!< one word is used to wake up the worker itself
+
+    CMemFileObserverWorker();
+    ~CMemFileObserverWorker();
+
+    CMemFileObserverWorker(const CMemFileObserverWorker&) = delete;
+    CMemFileObserverWorker& operator=(const CMemFileObserverWorker&) = delete;
+    CMemFileObserverWorker(CMemFileObserverWorker&& rhs) = delete;
+    CMemFileObserverWorker& operator=(CMemFileObserverWorker&& rhs) = delete;
+
+    void Start(int cpu_);
+    void Stop();
+
+    bool Add(const std::shared_ptr<CMemFileObserver>& observer_);
+    void Remove(const CMemFileObserver* observer_);
+
+    size_t ObserverCount() const;
+
+  protected:
+    void Run();
+    void Wake();
+
+    std::atomic<bool>                               m_do_stop;
+    std::uint32_t                                   m_wake_word;
+    mutable std::mutex                              m_observers_sync;
+    std::vector<std::shared_ptr<CMemFileObserver>>  m_observers;
+    const CMemFileObserver*                         m_processing_observer;  // observer whose update is processed right now, guarded by m_observers_sync
+    std::condition_variable                         m_processing_cv;
+    std::thread                                     m_thread;
   };
 
   ////////////////////////////////////////
@@ -91,15 +171,22 @@ namespace eCAL
   class CMemFileThreadPool
   {
   public:
-    CMemFileThreadPool();
+    /**
+     * @param observer_thread_count_       Number of worker threads that share the observation of futex notified memory files
+     *                                     (0 == one thread per memory file). Memory files signaled via named events
+     *                                     cannot be waited for together, they always get a thread of their own.
+     * @param observer_cpu_affinity_mask_  CPUs the worker threads are distributed to (bit n == CPU n, 0 == no affinity, Linux only).
+    **/
+    CMemFileThreadPool(size_t observer_thread_count_ = 0, uint64_t observer_cpu_affinity_mask_ = 0);
     ~CMemFileThreadPool();
 
     void Start();
     void Stop();
 
-    bool ObserveFile(const std::string& memfile_name_, const std::string& memfile_event_, int timeout_observation_ms, const MemFileDataCallbackT& callback_);
+    bool ObserveFile(const std::string& memfile_name_, const std::string& memfile_event_, int32_t process_id_, int timeout_observation_ms, const MemFileDataCallbackT& callback_);
 
   protected:
+    void StartObserver(const std::shared_ptr<CMemFileObserver>& observer_, int timeout_observation_ms, const MemFileDataCallbackT& callback_);
     void CleanupPoolThread();
     void CleanupPool();
 
@@ -107,6 +194,10 @@ namespace eCAL
     std::mutex                                                m_observer_pool_sync;
     std::map<std::string, std::shared_ptr<CMemFileObserver>>  m_observer_pool;
 
+    size_t                                                    m_observer_thread_count;
+    uint64_t                                                  m_observer_cpu_affinity_mask;
+    std::vector<std::unique_ptr<CMemFileObserverWorker>>      m_observer_workers;
+
     std::atomic<bool>                                         m_do_cleanup;
     std::condition_variable                                   m_do_cleanup_cv;
     std::mutex                                                m_do_cleanup_mtx;
@@ -0,0 +1,609 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  lock-free multi slot memory file (ring buffer)
+**/
+
+#include "ecal_memfile_ring.h"
+#include "ecal_memfile_db.h"
+#include "ecal_memfile_os.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <new>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if ATOMIC_LLONG_LOCK_FREE != 2
+#error "The shared memory ring buffer requires lock-free 64 bit atomics."
+#endif
+
+namespace
+{
+  const std::uint32_t ring_magic        = 0x474E5245; // "ERNG"
+  const std::uint32_t ring_version      = 2;
+  const std::uint32_t ring_pin_magic    = 0x4E495045; // "EPIN"
+  const size_t        ring_slot_align   = 64;
+
+  size_t AlignUp(size_t value_, size_t alignment_)
+  {
+    return ((value_ + alignment_ - 1) / alignment_) * alignment_;
+  }
+}
+
+namespace eCAL
+{
+  CMemoryFileRing::CMemoryFileRing() :
+    m_created(false),
+    m_writer(false),
+    m_loaned(false),
+    m_slot_count(0),
+    m_slot_size(0),
+    m_slot_stride(0),
+    m_pin_slots(0),
+    m_block_count(0),
+    m_pin_header(nullptr),
+    m_pin_size(0)
+  {
+  }
+
+  CMemoryFileRing::~CMemoryFileRing()
+  {
+    Destroy(false);
+  }
+
+  bool CMemoryFileRing::Create(const std::string& name_, const bool create_, const size_t slot_count_, const size_t slot_size_, const SMemFileAllocation& allocation_, const size_t pin_slots_)
+  {
+    if (m_created) return false;
+    if (create_ && ((slot_count_ == 0) || (slot_size_ == 0))) return false;
+
+    const size_t ring_header_size = AlignUp(sizeof(SRingHeader), ring_slot_align);
+
+    m_memfile_info = std::make_shared<SMemFileInfo>();
+
+    if (create_)
+    {
+      m_memfile_info->allocation = allocation_;
+
+      const size_t slot_stride  = AlignUp(slot_size_, ring_slot_align);
+      const size_t memfile_size = ring_header_size + slot_count_ * SlotHeaderStride() + (slot_count_ + pin_slots_) * slot_stride;
+
+      if (!memfile::db::AddFile(name_, true, memfile_size, m_memfile_info) || (m_memfile_info->mem_address == nullptr))
+      {
+#ifndef NDEBUG
+        printf("Could not create ring memory file: %s.\n", name_.c_str());
+#endif
+        memfile::db::RemoveFile(name_, true);
+        m_memfile_info.reset();
+        return false;
+      }
+
+      // initialize ring header and slots, nobody is reading before the file name is registered
+      auto* ring_header = new (m_memfile_info->mem_address) SRingHeader();
+      ring_header->compat_header.int_hdr_size  = static_cast<std::uint16_t>(ring_header_size);
+      ring_header->compat_header.cur_data_size = 0;
+      ring_header->compat_header.max_data_size = 0;
+      ring_header->magic       = ring_magic;
+      ring_header->version     = ring_version;
+      ring_header->slot_count  = slot_count_;
+      ring_header->slot_size   = slot_size_;
+      ring_header->slot_stride = slot_stride;
+      ring_header->pin_slots   = pin_slots_;
+      ring_header->write_count.store(0, std::memory_order_relaxed);
+
+      m_slot_count  = slot_count_;
+      m_slot_size   = slot_size_;
+      m_slot_stride = slot_stride;
+      m_pin_slots   = pin_slots_;
+      m_block_count = slot_count_ + pin_slots_;
+
+      // every slot starts with its own block, the remaining blocks are spare
+      m_slot_blocks.resize(m_slot_count);
+      m_spare_blocks.clear();
+      for (size_t slot = 0; slot < m_slot_count; ++slot)
+      {
+        auto* slot_header = new (GetSlotHeader(slot)) SRingSlotHeader();
+        slot_header->sequence.store(0, std::memory_order_relaxed);
+        slot_header->block.store(slot, std::memory_order_relaxed);
+        m_slot_blocks[slot] = slot;
+      }
+      for (size_t block = m_slot_count; block < m_block_count; ++block)
+      {
+        m_spare_blocks.push_back(block);
+      }
+      std::atomic_thread_fence(std::memory_order_release);
+    }
+    else
+    {
+      // readers do not share the mapping via the memory file db, pinned samples
+      // keep it alive until they are released, even after eCAL has been finalized
+      if (!memfile::os::AllocFile(name_, false, *m_memfile_info))
+      {
+        m_memfile_info.reset();
+        return false;
+      }
+
+      // map the ring header only and check if this is a ring memory file at all
+      memfile::os::CheckFileSize(ring_header_size, false, *m_memfile_info);
+      if (m_memfile_info->mem_address == nullptr)
+      {
+        memfile::os::DeAllocFile(*m_memfile_info);
+        m_memfile_info.reset();
+        return false;
+      }
+
+      const auto* ring_header = GetRingHeader();
+      const bool is_ring = (ring_header->compat_header.max_data_size == 0)
+                        && (ring_header->magic == ring_magic)
+                        && (ring_header->version == ring_version)
+                        && (ring_header->slot_count > 0)
+                        && (ring_header->slot_stride >= ring_header->slot_size);
+      if (!is_ring)
+      {
+        memfile::os::UnMapFile(*m_memfile_info);
+        memfile::os::DeAllocFile(*m_memfile_info);
+        m_memfile_info.reset();
+        return false;
+      }
+
+      m_slot_count  = static_cast<size_t>(ring_header->slot_count);
+      m_slot_size   = static_cast<size_t>(ring_header->slot_size);
+      m_slot_stride = static_cast<size_t>(ring_header->slot_stride);
+      m_pin_slots   = static_cast<size_t>(ring_header->pin_slots);
+      m_block_count = m_slot_count + m_pin_slots;
+
+      // now map the complete ring
+      memfile::os::CheckFileSize(ring_header_size + m_slot_count * SlotHeaderStride() + m_block_count * m_slot_stride, false, *m_memfile_info);
+      if (m_memfile_info->mem_address == nullptr)
+      {
+        memfile::os::DeAllocFile(*m_memfile_info);
+        m_memfile_info.reset();
+        return false;
+      }
+    }
+
+    m_writer  = create_;
+    m_name    = name_;
+    m_created = true;
+
+    // without a pin segment readers always copy
+    if ((m_pin_slots > 0) && !CreatePinSegment(create_))
+    {
+#ifndef NDEBUG
+      printf("Could not %s pin segment of ring memory file: %s.\n", create_ ? "create" : "open", name_.c_str());
+#endif
+    }
+
+    return true;
+  }
+
+  bool CMemoryFileRing::Destroy(const bool remove_)
+  {
+    if (!m_created) return false;
+
+    DestroyPinSegment(remove_);
+
+    bool ret_state(true);
+    if (m_writer)
+    {
+      ret_state = memfile::db::RemoveFile(m_name, remove_);
+    }
+    else
+    {
+      memfile::os::UnMapFile(*m_memfile_info);
+      memfile::os::DeAllocFile(*m_memfile_info);
+    }
+
+    m_created     = false;
+    m_writer      = false;
+    m_loaned      = false;
+    m_slot_count  = 0;
+    m_slot_size   = 0;
+    m_slot_stride = 0;
+    m_pin_slots   = 0;
+    m_block_count = 0;
+    m_name.clear();
+    m_memfile_info.reset();
+    m_slot_blocks.clear();
+    m_spare_blocks.clear();
+
+    return ret_state;
+  }
+
+  bool CMemoryFileRing::Write(CPayloadWriter& payload_, const SMemFileHeader& header_)
+  {
+    const size_t data_size = static_cast<size_t>(header_.data_size);
+
+    char* payload_address = LoanSlot(data_size);
+    if (payload_address == nullptr) return false;
+
+    // a slot always contains a complete sample
+    // so we cannot apply partial (modified) writes here
+    bool written(true);
+    if (data_size > 0)
+    {
+      written = payload_.WriteFull(payload_address, data_size);
+    }
+
+    // the slot is published even if the payload writer failed, like in the classic memory file
+    return CommitSlot(header_) && written;
+  }
+
+  char* CMemoryFileRing::LoanSlot(const size_t len_)
+  {
+    if (!m_created || !m_writer) return nullptr;
+    if (len_ > m_slot_size)      return nullptr;
+
+    // we are the only writer, so nobody else modifies the write counter
+    const uint64_t write_count = GetRingHeader()->write_count.load(std::memory_order_relaxed);
+    const size_t   slot        = static_cast<size_t>(write_count % m_slot_count);
+    auto* slot_header = GetSlotHeader(slot);
+
+    // mark slot as being written (odd sequence), a loan that is never committed
+    // leaves the slot odd, so readers skip it like an overwritten one
+    // (sequentially consistent, a reader pinning the block afterwards sees the odd sequence)
+    slot_header->sequence.store(2 * write_count + 1, std::memory_order_seq_cst);
+
+    // the block of the overwritten sample is pinned, exchange it by a spare block
+    if (IsBlockPinned(m_slot_blocks[slot]))
+    {
+      auto spare = std::find_if(m_spare_blocks.begin(), m_spare_blocks.end(), [this](uint64_t block_) { return !IsBlockPinned(block_); });
+
+      // cannot happen, the pin slots limit the number of pinned blocks to the number of spare blocks
+      if (spare == m_spare_blocks.end()) return nullptr;
+
+      std::swap(*spare, m_slot_blocks[slot]);
+    }
+
+    m_loaned = true;
+    return GetBlockPayload(m_slot_blocks[slot]);
+  }
+
+  bool CMemoryFileRing::CommitSlot(const SMemFileHeader& header_)
+  {
+    if (!m_created || !m_loaned) return false;
+    m_loaned = false;
+
+    auto* ring_header = GetRingHeader();
+    const uint64_t write_count = ring_header->write_count.load(std::memory_order_relaxed);
+    const size_t   slot        = static_cast<size_t>(write_count % m_slot_count);
+    auto* slot_header = GetSlotHeader(slot);
+
+    memcpy(&slot_header->header, &header_, sizeof(SMemFileHeader));
+    slot_header->block.store(m_slot_blocks[slot], std::memory_order_relaxed);
+
+    // publish slot (even sequence) and advance write counter
+    slot_header->sequence.store(2 * write_count + 2, std::memory_order_release);
+    ring_header->write_count.store(write_count + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  bool CMemoryFileRing::Read(uint64_t& read_count_, SMemFileHeader& header_, std::vector<char>& buffer_, uint64_t& dropped_)
+  {
+    if (!m_created) return false;
+
+    const auto* ring_header = GetRingHeader();
+
+    for (;;)
+    {
+      const uint64_t write_count = ring_header->write_count.load(std::memory_order_acquire);
+
+      // nothing new (or the cursor is not valid for this file anymore)
+      if (read_count_ >= write_count)
+      {
+        read_count_ = write_count;
+        return false;
+      }
+
+      // the writer lapped us, skip the overwritten samples
+      if (write_count - read_count_ > m_slot_count)
+      {
+        dropped_   += write_count - read_count_ - m_slot_count;
+        read_count_ = write_count - m_slot_count;
+      }
+
+      const uint64_t index    = read_count_;
+      const uint64_t expected = 2 * index + 2;
+      const auto* slot_header = GetSlotHeader(index % m_slot_count);
+
+      const uint64_t seq_begin = slot_header->sequence.load(std::memory_order_acquire);
+      if (seq_begin != expected)
+      {
+        // slot is being rewritten or has already been overwritten
+        ++dropped_;
+        ++read_count_;
+        continue;
+      }
+
+      // copy header and payload
+      memcpy(&header_, &slot_header->header, sizeof(SMemFileHeader));
+      const uint64_t block   = slot_header->block.load(std::memory_order_relaxed);
+      const size_t data_size = std::min(static_cast<size_t>(header_.data_size), m_slot_size);
+      buffer_.resize(data_size);
+      if ((data_size > 0) && (block < m_block_count))
+      {
+        memcpy(buffer_.data(), GetBlockPayload(block), data_size);
+      }
+
+      // validate that the writer did not touch the slot while we were copying
+      std::atomic_thread_fence(std::memory_order_acquire);
+      const uint64_t seq_end = slot_header->sequence.load(std::memory_order_relaxed);
+
+      ++read_count_;
+      if ((seq_end != seq_begin) || (block >= m_block_count))
+      {
+        ++dropped_;
+        continue;
+      }
+
+      return true;
+    }
+  }
+
+  bool CMemoryFileRing::ReadPinned(uint64_t& read_count_, SMemFileHeader& header_, const char*& payload_, uint64_t& block_, uint64_t& dropped_)
+  {
+    if (!m_created || (m_pin_header == nullptr)) return false;
+
+    const auto* ring_header = GetRingHeader();
+
+    for (;;)
+    {
+      const uint64_t write_count = ring_header->write_count.load(std::memory_order_acquire);
+
+      // nothing new (or the cursor is not valid for this file anymore)
+      if (read_count_ >= write_count)
+      {
+        read_count_ = write_count;
+        return false;
+      }
+
+      // the writer lapped us, skip the overwritten samples
+      if (write_count - read_count_ > m_slot_count)
+      {
+        dropped_   += write_count - read_count_ - m_slot_count;
+        read_count_ = write_count - m_slot_count;
+      }
+
+      const uint64_t index    = read_count_;
+      const uint64_t expected = 2 * index + 2;
+      const auto* slot_header = GetSlotHeader(index % m_slot_count);
+
+      const uint64_t seq_begin = slot_header->sequence.load(std::memory_order_acquire);
+      if (seq_begin != expected)
+      {
+        // slot is being rewritten or has already been overwritten
+        ++dropped_;
+        ++read_count_;
+        continue;
+      }
+
+      // all pin slots in use, leave the sample to be copied
+      if (!AcquirePinSlot()) return false;
+
+      memcpy(&header_, &slot_header->header, sizeof(SMemFileHeader));
+      const uint64_t block = slot_header->block.load(std::memory_order_relaxed);
+      if (block >= m_block_count)
+      {
+        m_pin_header->budget.fetch_add(1, std::memory_order_release);
+        ++dropped_;
+        ++read_count_;
+        continue;
+      }
+
+      // pin the block and validate that the writer did not start to rewrite the slot before
+      // (sequentially consistent, either we see the odd sequence or the writer sees our pin)
+      GetPinCount(block)->pins.fetch_add(1, std::memory_order_seq_cst);
+      const uint64_t seq_end = slot_header->sequence.load(std::memory_order_seq_cst);
+
+      ++read_count_;
+      if (seq_end != seq_begin)
+      {
+        Unpin(block);
+        ++dropped_;
+        continue;
+      }
+
+      if (header_.data_size > m_slot_size) header_.data_size = m_slot_size;
+      payload_ = GetBlockPayload(block);
+      block_   = block;
+      return true;
+    }
+  }
+
+  void CMemoryFileRing::Unpin(const uint64_t block_)
+  {
+    if (!m_created || (m_pin_header == nullptr) || (block_ >= m_block_count)) return;
+
+    GetPinCount(block_)->pins.fetch_sub(1, std::memory_order_release);
+    m_pin_header->budget.fetch_add(1, std::memory_order_release);
+  }
+
+  uint64_t CMemoryFileRing::WriteCount() const
+  {
+    if (!m_created) return 0;
+    return GetRingHeader()->write_count.load(std::memory_order_acquire);
+  }
+
+  bool CMemoryFileRing::EnableFutexNotification()
+  {
+    if (!m_created || !m_writer) return false;
+    GetRingHeader()->compat_header.notify_futex = 1;
+    return true;
+  }
+
+  bool CMemoryFileRing::HasFutexNotification() const
+  {
+    if (!m_created) return false;
+    return GetRingHeader()->compat_header.notify_futex != 0;
+  }
+
+  std::uint32_t* CMemoryFileRing::GetNotifyAddress() const
+  {
+    if (!m_created) return nullptr;
+    return reinterpret_cast<std::uint32_t*>(static_cast<char*>(m_memfile_info->mem_address) + offsetof(CMemoryFile::SInternalHeader, notify_seq));
+  }
+
+  size_t CMemoryFileRing::SlotHeaderStride()
+  {
+    return AlignUp(sizeof(SRingSlotHeader), ring_slot_align);
+  }
+
+  CMemoryFileRing::SRingHeader* CMemoryFileRing::GetRingHeader() const
+  {
+    return static_cast<SRingHeader*>(m_memfile_info->mem_address);
+  }
+
+  CMemoryFileRing::SRingSlotHeader* CMemoryFileRing::GetSlotHeader(const uint64_t index_) const
+  {
+    char* slots_base = static_cast<char*>(m_memfile_info->mem_address) + AlignUp(sizeof(SRingHeader), ring_slot_align);
+    return reinterpret_cast<SRingSlotHeader*>(slots_base + static_cast<size_t>(index_) * SlotHeaderStride());
+  }
+
+  char* CMemoryFileRing::GetBlockPayload(const uint64_t block_) const
+  {
+    char* blocks_base = static_cast<char*>(m_memfile_info->mem_address) + AlignUp(sizeof(SRingHeader), ring_slot_align) + m_slot_count * SlotHeaderStride();
+    return blocks_base + static_cast<size_t>(block_) * m_slot_stride;
+  }
+
+  CMemoryFileRing::SRingPinCount* CMemoryFileRing::GetPinCount(const uint64_t block_) const
+  {
+    char* counts_base = reinterpret_cast<char*>(m_pin_header) + AlignUp(sizeof(SRingPinHeader), ring_slot_align);
+    return reinterpret_cast<SRingPinCount*>(counts_base) + block_;
+  }
+
+  bool CMemoryFileRing::IsBlockPinned(const uint64_t block_) const
+  {
+    if (m_pin_header == nullptr) return false;
+    return GetPinCount(block_)->pins.load(std::memory_order_seq_cst) != 0;
+  }
+
+  bool CMemoryFileRing::AcquirePinSlot()
+  {
+    uint64_t budget = m_pin_header->budget.load(std::memory_order_relaxed);
+    do
+    {
+      if (budget == 0) return false;
+    } while (!m_pin_header->budget.compare_exchange_weak(budget, budget - 1, std::memory_order_acquire, std::memory_order_relaxed));
+    return true;
+  }
+
+#if defined(__linux__)
+  bool CMemoryFileRing::CreatePinSegment(const bool create_)
+  {
+    // make memory file path compatible for all posix systems
+    std::string name = m_name + "_pin";
+    if (name[0] != '/') name = "/" + name;
+
+    const size_t size = AlignUp(sizeof(SRingPinHeader), ring_slot_align) + m_block_count * sizeof(SRingPinCount);
+
+    int fd(-1);
+    if (create_)
+    {
+      // set umask to nothing, so every reader can open the segment for writing
+      const mode_t previous_umask = umask(000);
+      fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+      umask(previous_umask);
+      if ((fd != -1) && (::ftruncate(fd, static_cast<off_t>(size)) != 0))
+      {
+        ::close(fd);
+        ::shm_unlink(name.c_str());
+        fd = -1;
+      }
+    }
+    else
+    {
+      fd = ::shm_open(name.c_str(), O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+      struct stat st;
+      if ((fd != -1) && ((::fstat(fd, &st) != 0) || (static_cast<size_t>(st.st_size) < size)))
+      {
+        ::close(fd);
+        fd = -1;
+      }
+    }
+    if (fd == -1) return false;
+
+    void* address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (address == MAP_FAILED)
+    {
+      if (create_) ::shm_unlink(name.c_str());
+      return false;
+    }
+
+    auto* pin_header = static_cast<SRingPinHeader*>(address);
+    if (create_)
+    {
+      // the segment is zero initialized by ftruncate, the magic is set last
+      new (pin_header) SRingPinHeader();
+      pin_header->block_count = static_cast<std::uint32_t>(m_block_count);
+      pin_header->budget.store(m_pin_slots, std::memory_order_relaxed);
+      m_pin_header = pin_header;
+      for (size_t block = 0; block < m_block_count; ++block)
+      {
+        new (GetPinCount(block)) SRingPinCount();
+        GetPinCount(block)->pins.store(0, std::memory_order_relaxed);
+      }
+      __atomic_store_n(&pin_header->magic, ring_pin_magic, __ATOMIC_RELEASE);
+    }
+    else if ((__atomic_load_n(&pin_header->magic, __ATOMIC_ACQUIRE) != ring_pin_magic) || (pin_header->block_count != m_block_count))
+    {
+      ::munmap(address, size);
+      return false;
+    }
+
+    m_pin_header = pin_header;
+    m_pin_size   = size;
+    return true;
+  }
+
+  void CMemoryFileRing::DestroyPinSegment(const bool remove_)
+  {
+    if (m_pin_header == nullptr) return;
+
+    ::munmap(m_pin_header, m_pin_size);
+    m_pin_header = nullptr;
+    m_pin_size   = 0;
+
+    if (m_writer && remove_)
+    {
+      std::string name = m_name + "_pin";
+      if (name[0] != '/') name = "/" + name;
+      ::shm_unlink(name.c_str());
+    }
+  }
+#else
+  bool CMemoryFileRing::CreatePinSegment(const bool /*create_*/)
+  {
+    return false;
+  }
+
+  void CMemoryFileRing::DestroyPinSegment(const bool /*remove_*/)
+  {
+  }
+#endif
+}
@@ -0,0 +1,243 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  lock-free multi slot memory file (ring buffer)
+**/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ecal/pubsub/payload_writer.h>
+
+#include "ecal_memfile.h"
+#include "ecal_memfile_header.h"
+#include "ecal_memfile_info.h"
+
+namespace eCAL
+{
+  /**
+   * @brief Shared memory ring buffer with a fixed number of equally sized slots.
+   *
+   * The memory file is owned by exactly one writer. Every slot carries a sequence
+   * number (seqlock), so the writer never waits for any reader and readers detect
+   * slots that have been overwritten while they were copying them.
+   *
+   * The payload of a slot is stored in a separate block. Readers may pin a block instead
+   * of copying it, the writer then writes the following samples into one of the spare
+   * blocks (pin slots). The pin counters are located in a small read/write segment next
+   * to the ring (linux only), the ring itself is mapped read only by the readers.
+   *
+   * The segment starts with a CMemoryFile::SInternalHeader that declares an empty
+   * payload, so readers that are not aware of the ring layout simply see no data.
+  **/
+  class CMemoryFileRing
+  {
+  public:
+    CMemoryFileRing();
+    ~CMemoryFileRing();
+
+    CMemoryFileRing(const CMemoryFileRing&) = delete;
+    CMemoryFileRing& operator=(const CMemoryFileRing&) = delete;
+    CMemoryFileRing(CMemoryFileRing&& rhs) = delete;
+    CMemoryFileRing& operator=(CMemoryFileRing&& rhs) = delete;
+
+    /**
+     * @brief Create (writer) or open (reader) a ring memory file.
+     *
+     * @param name_        Unique file name.
+     * @param create_      Create the file (writer side) or open an existing one (reader side).
+     * @param slot_count_  Number of ring slots (only if create_ == true).
+     * @param slot_size_   Maximum payload size of a single slot (only if create_ == true).
+     * @param allocation_  Page placement of the memory file (only if create_ == true).
+     * @param pin_slots_   Number of samples all readers can pin at once (only if create_ == true, 0 == readers always copy).
+     *
+     * @return  true if it succeeds, false if it fails or the file is not a ring memory file.
+    **/
+    bool Create(const std::string& name_, bool create_, size_t slot_count_ = 0, size_t slot_size_ = 0, const SMemFileAllocation& allocation_ = SMemFileAllocation(), size_t pin_slots_ = 0);
+
+    /**
+     * @brief Unmap the memory file and optionally remove it from the system.
+     *
+     * @param remove_  Remove file from system.
+     *
+     * @return  true if it succeeds, false if it fails.
+    **/
+    bool Destroy(bool remove_);
+
+    /**
+     * @brief Write header and payload into the next slot (writer side only, never blocks).
+     *
+     * @param payload_  The payload.
+     * @param header_   The memory file header (data_size has to match the payload size).
+     *
+     * @return  true if it succeeds, false if it fails.
+    **/
+    bool Write(CPayloadWriter& payload_, const SMemFileHeader& header_);
+
+    /**
+     * @brief Hand out the payload area of the next slot to construct a sample in place (writer side only).
+     *
+     * The slot is marked as being written until the sample is published by CommitSlot.
+     *
+     * @param len_  The payload size.
+     *
+     * @return  The payload address of the slot or nullptr if the payload does not fit into a slot.
+    **/
+    char* LoanSlot(size_t len_);
+
+    /**
+     * @brief Publish the slot handed out by LoanSlot (writer side only).
+     *
+     * @param header_  The memory file header (data_size has to match the loaned size).
+     *
+     * @return  true if it succeeds, false if there is no loaned slot.
+    **/
+    bool CommitSlot(const SMemFileHeader& header_);
+
+    /**
+     * @brief Read the next unread sample (reader side).
+     *
+     * @param read_count_  The reader cursor, it is advanced by every consumed or skipped slot.
+     * @param header_      The header of the read sample.
+     * @param buffer_      The buffer the payload is copied to.
+     * @param dropped_     Increased by the number of samples that were overwritten before they could be read.
+     *
+     * @return  true if a sample was read, false if there is no unread sample left.
+    **/
+    bool Read(uint64_t& read_count_, SMemFileHeader& header_, std::vector<char>& buffer_, uint64_t& dropped_);
+
+    /**
+     * @brief Pin the next unread sample in place instead of copying it (reader side).
+     *
+     * The writer does not reuse the payload block until it is unpinned. If all pin slots
+     * of the ring are in use (by any reader), the sample is left unread, so it can be copied
+     * by Read instead. Pins of a reader process that dies are not reclaimed.
+     *
+     * @param read_count_  The reader cursor, it is advanced by every consumed or skipped slot.
+     * @param header_      The header of the pinned sample.
+     * @param payload_     The payload address of the pinned sample.
+     * @param block_       The pinned block, to be passed to Unpin.
+     * @param dropped_     Increased by the number of samples that were overwritten before they could be read.
+     *
+     * @return  true if a sample was pinned, false if there is no unread sample left or no pin slot available.
+    **/
+    bool ReadPinned(uint64_t& read_count_, SMemFileHeader& header_, const char*& payload_, uint64_t& block_, uint64_t& dropped_);
+
+    /**
+     * @brief Release a block pinned by ReadPinned (reader side, any thread).
+    **/
+    void Unpin(uint64_t block_);
+
+    /**
+     * @brief Number of samples written into the ring so far.
+    **/
+    uint64_t WriteCount() const;
+
+    /**
+     * @brief Mark the ring to signal updates via the futex word of the header (writer side only).
+    **/
+    bool EnableFutexNotification();
+
+    /**
+     * @brief Check if the writer of the ring signals updates via futex.
+    **/
+    bool HasFutexNotification() const;
+
+    /**
+     * @brief Get the address of the futex word in the ring header.
+    **/
+    std::uint32_t* GetNotifyAddress() const;
+
+    size_t SlotCount()       const { return m_slot_count; };
+    size_t SlotSize()        const { return m_slot_size; };
+    size_t PinSlots()        const { return (m_pin_header != nullptr) ? m_pin_slots : 0; };
+
+    bool IsCreated()         const { return m_created; };
+    std::string Name()       const { return m_name; };
+
+  protected:
+    struct SRingHeader
+    {
+      CMemoryFile::SInternalHeader compat_header;      //!< legacy header, declares an empty memory file
+      std::uint32_t                magic       = 0;
+      std::uint32_t                version     = 0;
+      std::uint64_t                slot_count  = 0;
+      std::uint64_t                slot_size   = 0;    //!< maximum payload size of a slot
+      std::uint64_t                slot_stride = 0;    //!< distance between two payload blocks in bytes
+      std::uint64_t                pin_slots   = 0;    //!< number of spare payload blocks
+      alignas(64) std::atomic<std::uint64_t> write_count;
+    };
+
+    struct SRingSlotHeader
+    {
+      std::atomic<std::uint64_t>   sequence;           //!< odd while being written, 2 * (n + 1) after publishing sample n
+      SMemFileHeader               header;
+      std::atomic<std::uint64_t>   block;              //!< payload block of the slot
+    };
+
+    struct SRingPinHeader
+    {
+      std::uint32_t                magic       = 0;
+      std::uint32_t                block_count = 0;
+      alignas(64) std::atomic<std::uint64_t> budget; //!< number of free pin slots
+    };
+
+    struct SRingPinCount
+    {
+      alignas(64) std::atomic<std::uint64_t> pins;   //!< number of readers pinning the block
+    };
+
+    static size_t    SlotHeaderStride();
+    SRingHeader*     GetRingHeader() const;
+    SRingSlotHeader* GetSlotHeader(uint64_t index_) const;
+    char*            GetBlockPayload(uint64_t block_) const;
+    SRingPinCount*   GetPinCount(uint64_t block_) const;
+
+    bool             CreatePinSegment(bool create_);
+    void             DestroyPinSegment(bool remove_);
+    bool             IsBlockPinned(uint64_t block_) const;
+    bool             AcquirePinSlot();
+
+    bool                          m_created;
+    bool                          m_writer;
+    bool                          m_loaned;
+    std::string                   m_name;
+    size_t                        m_slot_count;
+    size_t                        m_slot_size;
+    size_t                        m_slot_stride;
+    size_t                        m_pin_slots;
+    size_t                        m_block_count;
+    std::shared_ptr<SMemFileInfo> m_memfile_info;
+
+    // pin segment (read/write for all readers)
+    SRingPinHeader*               m_pin_header;
+    size_t                        m_pin_size;
+
+    // payload blocks of the slots and the spare blocks, owned by the writer
+    std::vector<uint64_t>         m_slot_blocks;
+    std::vector<uint64_t>         m_spare_blocks;
+  };
+}
@@ -23,22 +23,29 @@
 
 #include <ecal/log.h>
 
+#include "ecal_def.h"
 #include "ecal_event.h"
 #include "ecal_memfile_header.h"
 #include "ecal_memfile_naming.h"
+#include "ecal_memfile_notify.h"
 #include "ecal_memfile_sync.h"
 
+#include <algorithm>
 #include <chrono>
 #include <mutex>
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace eCAL
 {
   CSyncMemoryFile::CSyncMemoryFile(const std::string& base_name_, size_t size_, SSyncMemoryFileAttr attr_) :
     m_attr(attr_),
-    m_created(false)
+    m_created(false),
+    m_notify_address(nullptr),
+    m_loaned(false),
+    m_reattach_pending(false)
   {
     Create(base_name_, size_);
   }
@@ -72,6 +79,9 @@ namespace eCAL
       gOpenNamedEvent(&event_pair.event_snd, event_snd_name, true);
       gOpenNamedEvent(&event_pair.event_ack, event_ack_name, true);
       m_event_handle_map.insert(std::pair<int32_t, SEventHandlePair>(process_id_, event_pair));
+
+      // assign an acknowledge slot, without one the subscriber acknowledges via its named event
+      m_memfile_ack.AddProcess(process_id_);
       return true;
     }
     else
@@ -86,6 +96,7 @@ namespace eCAL
 
       // Set the ack event to valid again, so we will wait for the subscriber
       iter->second.event_ack_is_invalid = false;
+      m_memfile_ack.AddProcess(process_id_);
 
       return true;
     }
@@ -115,6 +126,7 @@ namespace eCAL
       SEventHandlePair& event_pair = iter->second;
       // fire acknowledge events, to unlock blocking send function
       gSetEvent(event_pair.event_ack);
+      m_memfile_ack.ReleaseProcess(process_id_);
       // mark the event to be ignored by the send function.
       event_pair.event_ack_is_invalid = true;
       return true;
@@ -127,16 +139,27 @@ namespace eCAL
   {
     if (!m_created) return false;
 
-    // we recreate a memory file if the file size is too small
-    const bool file_to_small = m_memfile.MaxDataSize() < (sizeof(SMemFileHeader) + size_);
+    // we grow (or recreate) a memory file if the file size is too small
+    const bool file_to_small = MaxDataSize() < (sizeof(SMemFileHeader) + size_);
     if (file_to_small)
     {
-#ifndef NDEBUG
-      Logging::Log(Logging::log_level_debug4, m_base_name + "::CSyncMemoryFile::CheckSize - RECREATE");
-#endif
       // estimate size of memory file
       const size_t memfile_size = sizeof(SMemFileHeader) + size_ + static_cast<size_t>((static_cast<float>(m_attr.reserve) / 100.0f) * static_cast<float>(size_));
 
+      // extend the memory file in place, subscribers keep on reading it without a new registration
+      if (!IsRing() && m_memfile.Grow(memfile_size, static_cast<int>(m_attr.timeout_open_ms)))
+      {
+#ifndef NDEBUG
+        Logging::Log(Logging::log_level_debug4, m_base_name + "::CSyncMemoryFile::CheckSize - GROWN");
+#endif
+        // the mapping may have moved
+        if (m_notify_address != nullptr) m_notify_address = m_memfile.GetNotifyAddress();
+        return false;
+      }
+
+#ifndef NDEBUG
+      Logging::Log(Logging::log_level_debug4, m_base_name + "::CSyncMemoryFile::CheckSize - RECREATE");
+#endif
       // recreate the file
       if (!Recreate(memfile_size)) return false;
 
@@ -155,9 +178,11 @@ namespace eCAL
       return false;
     }
 
-    // store acknowledge timeout parameter
-    m_attr.timeout_ack_ms = data_.acknowledge_timeout_ms;
-    if (m_attr.timeout_ack_ms < 0) m_attr.timeout_ack_ms = 0;
+    if (m_loaned)
+    {
+      Logging::Log(Logging::log_level_error, m_base_name + "::CSyncMemoryFile::Write - FAILED (payload buffer is loaned)");
+      return false;
+    }
 
     // write header and payload into the memory file
 #ifndef NDEBUG
@@ -166,45 +191,29 @@ namespace eCAL
 
     // create user file header
     struct SMemFileHeader memfile_hdr;
-    // set data size
-    memfile_hdr.data_size         = static_cast<uint64_t>(data_.len);
-    // set header id
-    memfile_hdr.id                = static_cast<uint64_t>(data_.id);
-    // set header clock
-    memfile_hdr.clock             = static_cast<uint64_t>(data_.clock);
-    // set header time
-    memfile_hdr.time              = static_cast<int64_t>(data_.time);
-    // set header hash
-    memfile_hdr.hash              = static_cast<uint64_t>(data_.hash);
-    // set zero copy
-    memfile_hdr.options.zero_copy = static_cast<unsigned char>(data_.zero_copy);
-    // set acknowledge timeout
-    memfile_hdr.ack_timout_ms     = static_cast<int64_t>(data_.acknowledge_timeout_ms);
-
-    // acquire write access
-    bool write_access = m_memfile.GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms));
+    PrepareHeader(data_, memfile_hdr);
 
-    // maybe it's locked by a zombie or a crashed process
-    // so we try to recreate a new one
-    if (!write_access)
+    // lock-free ring buffer mode
+    if (IsRing())
     {
+      const bool written = m_memfile_ring.Write(payload_, memfile_hdr);
+      if (written)
+      {
+        SyncContent(memfile_hdr.clock, data_.skip_process_ids);
 #ifndef NDEBUG
-      Logging::Log(Logging::log_level_debug2, m_base_name + "::CSyncMemoryFile::Write::GetWriteAccess - FAILED");
+        Logging::Log(Logging::log_level_debug4, m_base_name + "::CSyncMemoryFile::Write - SUCCESS : " + std::to_string(data_.len) + " Bytes written (ring)");
 #endif
-
-      // try to recreate the memory file
-      if (!Recreate(m_memfile.MaxDataSize())) return false;
-
-      // then try to get access again
-      write_access = m_memfile.GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms));
-      // still no chance ? hell .... we give up
-      if (!write_access)
+      }
+      else
       {
-        Logging::Log(Logging::log_level_error, m_base_name + "::CSyncMemoryFile::Write::GetWriteAccess - FAILED FINALLY");
-        return false;
+        Logging::Log(Logging::log_level_error, m_base_name + "::CSyncMemoryFile::Write - FAILED (ring write failed)");
       }
+      return written;
     }
 
+    // acquire write access
+    if (!GetWriteAccess()) return false;
+
     // now write content
     bool written(true);
     size_t wbytes(0);
@@ -221,7 +230,7 @@ namespace eCAL
     m_memfile.ReleaseWriteAccess();
 
     // and fire the publish event for local subscriber
-    if (written) SyncContent();
+    if (written) SyncContent(memfile_hdr.clock, data_.skip_process_ids);
 
     if (written)
     {
@@ -238,6 +247,52 @@ namespace eCAL
     return written;
   }
 
+  void* CSyncMemoryFile::Loan(const size_t len_)
+  {
+    if (!m_created || m_loaned) return nullptr;
+
+    // only the lock-free ring buffer hands out its next slot, the mutex of a classic
+    // memory file is bound to the locking thread and must not be held by a pending loan
+    if (!IsRing()) return nullptr;
+
+    char* slot_address = m_memfile_ring.LoanSlot(len_);
+    m_loaned = (slot_address != nullptr);
+    return slot_address;
+  }
+
+  bool CSyncMemoryFile::CommitLoan(const SWriterAttr& data_)
+  {
+    if (!m_created || !m_loaned) return false;
+    m_loaned = false;
+
+    // create user file header
+    struct SMemFileHeader memfile_hdr;
+    PrepareHeader(data_, memfile_hdr);
+
+    const bool written = m_memfile_ring.CommitSlot(memfile_hdr);
+
+    // and fire the publish event for local subscriber
+    if (written)
+    {
+      SyncContent(memfile_hdr.clock, data_.skip_process_ids);
+#ifndef NDEBUG
+      Logging::Log(Logging::log_level_debug4, m_base_name + "::CSyncMemoryFile::CommitLoan - SUCCESS : " + std::to_string(data_.len) + " Bytes written");
+#endif
+    }
+    else
+    {
+      Logging::Log(Logging::log_level_error, m_base_name + "::CSyncMemoryFile::CommitLoan - FAILED");
+    }
+
+    return written;
+  }
+
+  void CSyncMemoryFile::ReturnLoan()
+  {
+    // an uncommitted ring slot is skipped by the readers, nothing to do here
+    m_loaned = false;
+  }
+
   std::string CSyncMemoryFile::GetName() const
   {
     return m_memfile_name;
@@ -262,8 +317,33 @@ namespace eCAL
     // check for minimal size
     if (memfile_size < m_attr.min_size) memfile_size = m_attr.min_size;
 
+    // create the lock-free ring memory file, every slot has the size of a classic memory file
+    if (IsRing())
+    {
+      if (!m_memfile_ring.Create(m_memfile_name, true, m_attr.ring_slots, memfile_size, m_attr.allocation, m_attr.ring_pin_slots))
+      {
+        Logging::Log(Logging::log_level_error, std::string("CSyncMemoryFile::Create FAILED : ") + m_memfile_name);
+        return false;
+      }
+
+#ifndef NDEBUG
+      Logging::Log(Logging::log_level_debug2, std::string("CSyncMemoryFile::Create SUCCESS : ") + m_memfile_name + " (ring with " + std::to_string(m_attr.ring_slots) + " slots)");
+#endif
+
+      // switch to futex notification before the file is announced to any subscriber
+      if (m_attr.futex_notification && memfile::notify::IsSupported() && m_memfile_ring.EnableFutexNotification())
+      {
+        m_notify_address = m_memfile_ring.GetNotifyAddress();
+      }
+
+      // it's created
+      m_created = true;
+
+      return true;
+    }
+
     // create the memory file
-    if (!m_memfile.Create(m_memfile_name.c_str(), true, memfile_size))
+    if (!m_memfile.Create(m_memfile_name.c_str(), true, memfile_size, false, m_attr.allocation))
     {
       Logging::Log(Logging::log_level_error, std::string("CSyncMemoryFile::Create FAILED : ") + m_memfile_name);
       return false;
@@ -279,6 +359,20 @@ namespace eCAL
     m_memfile.WriteBuffer(&memfile_hdr, memfile_hdr.hdr_size, 0);
     m_memfile.ReleaseWriteAccess();
 
+    // switch to futex notification before the file is announced to any subscriber
+    if (m_attr.futex_notification && memfile::notify::IsSupported() && m_memfile.EnableFutexNotification())
+    {
+      m_notify_address = m_memfile.GetNotifyAddress();
+
+      // subscribers acknowledge via one shared futex word too
+      if (!m_memfile_ack.Create(m_memfile_name, true))
+      {
+#ifndef NDEBUG
+        Logging::Log(Logging::log_level_debug2, std::string("CSyncMemoryFile::Create - acknowledge file FAILED : ") + m_memfile_name);
+#endif
+      }
+    }
+
     // it's created
     m_created = true;
 
@@ -289,15 +383,39 @@ namespace eCAL
   {
     if (!m_created) return false;
 
+    // give back a pending loan, its content is lost anyway
+    ReturnLoan();
+
     // state destruction in progress
     m_created = false;
 
-    // reset memory file name
+    // reset memory file name and notification word
     m_memfile_name.clear();
+    m_notify_address = nullptr;
 
     // disconnect all processes
     DisconnectAll();
 
+    // remove the acknowledge file
+    m_memfile_ack.Destroy();
+
+    // destroy the ring file
+    if (IsRing())
+    {
+      const std::string ring_name = m_memfile_ring.Name();
+      if (!m_memfile_ring.Destroy(true))
+      {
+#ifndef NDEBUG
+        Logging::Log(Logging::log_level_debug2, std::string(m_base_name + "::CSyncMemoryFile::Destroy - FAILED : ") + ring_name);
+#endif
+        return false;
+      }
+#ifndef NDEBUG
+      Logging::Log(Logging::log_level_debug2, std::string(m_base_name + "::CSyncMemoryFile::Destroy - SUCCESS : ") + ring_name);
+#endif
+      return true;
+    }
+
     // destroy the file
     if (!m_memfile.Destroy(true))
     {
@@ -337,13 +455,103 @@ namespace eCAL
       Connect(process_id);
     }
 
+    // the subscribers open the new file after its registration, samples written before would be lost
+    m_reattach_pending = !process_id_list.empty();
+
     return true;
   }
 
-  void CSyncMemoryFile::SyncContent()
+  void CSyncMemoryFile::PrepareHeader(const SWriterAttr& data_, SMemFileHeader& memfile_hdr_)
+  {
+    // store acknowledge timeout parameter
+    m_attr.timeout_ack_ms = data_.acknowledge_timeout_ms;
+    if (m_attr.timeout_ack_ms < 0) m_attr.timeout_ack_ms = 0;
+
+    // set data size
+    memfile_hdr_.data_size         = static_cast<uint64_t>(data_.len);
+    // set header id
+    memfile_hdr_.id                = static_cast<uint64_t>(data_.id);
+    // set header clock
+    memfile_hdr_.clock             = static_cast<uint64_t>(data_.clock);
+    // set header time
+    memfile_hdr_.time              = static_cast<int64_t>(data_.time);
+    // set header hash
+    memfile_hdr_.hash              = static_cast<uint64_t>(data_.hash);
+    // set zero copy
+    memfile_hdr_.options.zero_copy = static_cast<unsigned char>(data_.zero_copy);
+    // set replayed history sample
+    memfile_hdr_.options.replayed  = static_cast<unsigned char>(data_.replayed);
+    // set acknowledge timeout
+    memfile_hdr_.ack_timout_ms     = static_cast<int64_t>(data_.acknowledge_timeout_ms);
+
+    // lock-free ring buffer mode
+    // the writer never waits for a reader, so acknowledge timeouts are not supported
+    if (IsRing())
+    {
+      m_attr.timeout_ack_ms      = 0;
+      memfile_hdr_.ack_timout_ms = 0;
+    }
+
+    // the first sample of a recreated memory file (ring or classic) is acknowledged by the reattached subscribers,
+    // so the following samples are not written before they observe the new file
+    if (m_reattach_pending)
+    {
+      m_reattach_pending         = false;
+      m_attr.timeout_ack_ms      = std::max<int64_t>(m_attr.timeout_ack_ms, PUB_MEMFILE_RECREATE_ACK_TO);
+      memfile_hdr_.ack_timout_ms = m_attr.timeout_ack_ms;
+    }
+  }
+
+  bool CSyncMemoryFile::GetWriteAccess()
+  {
+    // acquire write access
+    bool write_access = m_memfile.GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms));
+
+    // maybe it's locked by a zombie or a crashed process
+    // so we try to recreate a new one
+    if (!write_access)
+    {
+#ifndef NDEBUG
+      Logging::Log(Logging::log_level_debug2, m_base_name + "::CSyncMemoryFile::Write::GetWriteAccess - FAILED");
+#endif
+
+      // try to recreate the memory file
+      if (!Recreate(m_memfile.MaxDataSize())) return false;
+
+      // then try to get access again
+      write_access = m_memfile.GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms));
+      // still no chance ? hell .... we give up
+      if (!write_access)
+      {
+        Logging::Log(Logging::log_level_error, m_base_name + "::CSyncMemoryFile::Write::GetWriteAccess - FAILED FINALLY");
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  size_t CSyncMemoryFile::MaxDataSize() const
+  {
+    if (IsRing()) return m_memfile_ring.SlotSize();
+    return m_memfile.MaxDataSize();
+  }
+
+  void CSyncMemoryFile::SyncContent(const uint64_t clock_, const std::vector<int32_t>* skip_process_ids_)
   {
     if (!m_created) return;
 
+    // futex notification without acknowledge handling
+    // one wake up for all connected subscribers, no need to touch the event map at all
+    if ((m_notify_address != nullptr) && (m_attr.timeout_ack_ms == 0))
+    {
+      memfile::notify::Signal(m_notify_address);
+#ifndef NDEBUG
+      Logging::Log(Logging::log_level_debug4, m_base_name + "::CSyncMemoryFile::SignalWritten (futex)");
+#endif
+      return;
+    }
+
     // fire the publisher events
     // connected subscribers will read the content from the memory file
 
@@ -356,59 +564,167 @@ namespace eCAL
       event_handle_map_snapshot = m_event_handle_map;
     }
 
+    // processes whose subscribers all filter this sample are neither signaled nor waited for
+    // (a futex wakes up all of them anyway, they just do not delay the acknowledge)
+    if (skip_process_ids_ != nullptr)
+    {
+      for (const auto& process_id : *skip_process_ids_)
+      {
+        event_handle_map_snapshot.erase(process_id);
+      }
+    }
+
     // "eat" old acknowledge events :)
+    // subscribers with an acknowledge slot are matched by the sample clock, so there is nothing to eat
     if (m_attr.timeout_ack_ms != 0)
     {
       for (const auto& event_handle : event_handle_map_snapshot)
       {
+        if (m_memfile_ack.HasProcess(event_handle.first)) continue;
         while (gWaitForEvent(event_handle.second.event_ack, 0)) {}
       }
     }
 
     // send sync (memory file update) event
-    for (const auto& event_handle : event_handle_map_snapshot)
+    if (m_notify_address != nullptr)
     {
-      // send sync event
-      gSetEvent(event_handle.second.event_snd);
+      memfile::notify::Signal(m_notify_address);
+    }
+    else
+    {
+      for (const auto& event_handle : event_handle_map_snapshot)
+      {
+        // send sync event
+        gSetEvent(event_handle.second.event_snd);
+      }
     }
 
     // wait for acknowledgment event from receiver side
     if (m_attr.timeout_ack_ms != 0)
     {
-      // take start time for all acknowledge timeouts
-      const auto start_time = std::chrono::steady_clock::now();
+      WaitForAcknowledge(event_handle_map_snapshot, clock_);
+    }
 
-      for (auto& event_handle : event_handle_map_snapshot)
-      {
-        const auto time_since_start = std::chrono::steady_clock::now() - start_time;
-        const auto time_to_wait     = std::chrono::milliseconds(m_attr.timeout_ack_ms)- time_since_start;
-        long       time_to_wait_ms  = static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(time_to_wait).count());
-        if (time_to_wait_ms <= 0) time_to_wait_ms = 0;
+#ifndef NDEBUG
+    Logging::Log(Logging::log_level_debug4, m_base_name + "::CSyncMemoryFile::SignalWritten");
+#endif
+  }
+
+  void CSyncMemoryFile::WaitForAcknowledge(const EventHandleMapT& event_handle_map_, const uint64_t clock_)
+  {
+    // take start time for all acknowledge timeouts
+    const auto start_time = std::chrono::steady_clock::now();
+    const auto deadline   = start_time + std::chrono::milliseconds(m_attr.timeout_ack_ms);
+
+    // split the live subscribers into the ones acknowledging via the shared acknowledge file
+    // and the ones acknowledging via their named event
+    std::vector<int32_t> pending_shared;
+    std::vector<int32_t> pending_event;
+    for (const auto& event_handle : event_handle_map_)
+    {
+      // The ack event has timeouted before. Thus, we don't wait for it
+      // anymore, until the subscriber notifies us via registration layer
+      // that it is still alive.
+      if (event_handle.second.event_ack_is_invalid) continue;
+
+      if (m_memfile_ack.HasProcess(event_handle.first)) pending_shared.push_back(event_handle.first);
+      else                                              pending_event.push_back(event_handle.first);
+    }
+
+    ProcessLatencyVecT   acknowledged;
+    std::vector<int32_t> timed_out;
 
-        if (event_handle.second.event_ack_is_invalid)
+    // all subscribers acknowledge via one futex word, so we are done
+    // as soon as the last live subscriber has processed this sample
+    while (!pending_shared.empty())
+    {
+      // load the counter before checking, so we cannot miss an acknowledge in between
+      const uint32_t ack_seq = m_memfile_ack.LoadSequence();
+
+      for (auto process_it = pending_shared.begin(); process_it != pending_shared.end();)
+      {
+        const uint64_t ack_clock = m_memfile_ack.AckClock(*process_it);
+        if (ack_clock == CMemoryFileAck::released_clock)
         {
-          // The ack event has timeouted before. Thus, we don't wait for it
-          // anymore, until the subscriber notifies us via registration layer
-          // that it is still alive.
-          continue;
+          // disconnected while we were waiting
+          process_it = pending_shared.erase(process_it);
         }
-
-        if (!gWaitForEvent(event_handle.second.event_ack, time_to_wait_ms))
+        else if (ack_clock >= clock_)
         {
-          // Remember that this event has timeouted. This will not cause the
-          // publisher to wait for it anymore, until the subscriber actively
-          // requests that via registration layer again.
-          event_handle.second.event_ack_is_invalid = true;
-#ifndef NDEBUG
-          Logging::Log(Logging::log_level_debug2, m_base_name + "::CSyncMemoryFile::SignalWritten - ACK event timeout");
-#endif
+          acknowledged.emplace_back(*process_it, std::chrono::steady_clock::now() - start_time);
+          process_it = pending_shared.erase(process_it);
+        }
+        else
+        {
+          ++process_it;
         }
       }
+      if (pending_shared.empty()) break;
+
+      const auto time_to_wait = deadline - std::chrono::steady_clock::now();
+      if (time_to_wait <= std::chrono::steady_clock::duration::zero()) break;
+
+      // round up, otherwise we would spin during the last millisecond
+      const auto time_to_wait_ms = std::chrono::duration_cast<std::chrono::milliseconds>(time_to_wait + std::chrono::milliseconds(1) - std::chrono::nanoseconds(1));
+      m_memfile_ack.WaitForAcknowledge(ack_seq, static_cast<int>(time_to_wait_ms.count()));
+    }
+    timed_out.insert(timed_out.end(), pending_shared.begin(), pending_shared.end());
+
+    // subscribers without acknowledge slot are waited for one after another
+    for (const auto& process_id : pending_event)
+    {
+      const auto time_to_wait    = deadline - std::chrono::steady_clock::now();
+      long       time_to_wait_ms = static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(time_to_wait).count());
+      if (time_to_wait_ms <= 0) time_to_wait_ms = 0;
+
+      if (gWaitForEvent(event_handle_map_.at(process_id).event_ack, time_to_wait_ms))
+      {
+        acknowledged.emplace_back(process_id, std::chrono::steady_clock::now() - start_time);
+      }
+      else
+      {
+        timed_out.push_back(process_id);
+      }
     }
 
+    if (!timed_out.empty())
+    {
+      // Remember that these events have timeouted. This will not cause the
+      // publisher to wait for them anymore, until the subscriber actively
+      // requests that via registration layer again.
+      const std::lock_guard<std::mutex> lock(m_event_handle_map_sync);
+      for (const auto& process_id : timed_out)
+      {
+        auto iter = m_event_handle_map.find(process_id);
+        if (iter != m_event_handle_map.end()) iter->second.event_ack_is_invalid = true;
+      }
 #ifndef NDEBUG
-    Logging::Log(Logging::log_level_debug4, m_base_name + "::CSyncMemoryFile::SignalWritten");
+      Logging::Log(Logging::log_level_debug2, m_base_name + "::CSyncMemoryFile::SignalWritten - ACK event timeout");
 #endif
+    }
+
+    UpdateAckStatistics(acknowledged, timed_out);
+  }
+
+  void CSyncMemoryFile::UpdateAckStatistics(const ProcessLatencyVecT& acknowledged_, const std::vector<int32_t>& timed_out_)
+  {
+    const std::lock_guard<std::mutex> lock(m_ack_statistics_sync);
+    for (const auto& process_latency : acknowledged_)
+    {
+      auto& statistics = m_ack_statistics[process_latency.first];
+      statistics.acknowledge_count++;
+      statistics.latency.AddSample(process_latency.second);
+    }
+    for (const auto& process_id : timed_out_)
+    {
+      m_ack_statistics[process_id].timeout_count++;
+    }
+  }
+
+  SyncMemoryFileAckStatisticsMapT CSyncMemoryFile::GetAckStatistics() const
+  {
+    const std::lock_guard<std::mutex> lock(m_ack_statistics_sync);
+    return m_ack_statistics;
   }
 
   /*
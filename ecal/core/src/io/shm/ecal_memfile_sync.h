@@ -30,10 +30,16 @@
 #include "readwrite/ecal_writer_data.h"
 #include "ecal_eventhandle.h"
 #include "ecal_memfile.h"
+#include "ecal_memfile_ack.h"
+#include "ecal_memfile_ring.h"
+#include "util/latency_histogram.h"
 
+#include <chrono>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace eCAL
 {
@@ -43,8 +49,20 @@ namespace eCAL
     size_t  reserve;            //!< dynamic file size reserve before recreating memory file if payload size changes [%]
     int64_t timeout_open_ms;    //!< timeout to open a memory file using mutex lock [ms]
     int64_t timeout_ack_ms;     //!< timeout for memory read acknowledge signal from data reader [ms]
+    size_t  ring_slots;         //!< number of lock-free ring buffer slots (0 = single slot memory file guarded by a named mutex)
+    size_t  ring_pin_slots;     //!< number of ring buffer samples all subscribers can pin at once
+    bool    futex_notification; //!< signal updates via one futex word in the memory file instead of one named event per subscriber (linux only)
+    SMemFileAllocation allocation; //!< page placement of the memory file (huge pages, prefault, numa node)
   };
 
+  struct SSyncMemoryFileAckStatistics
+  {
+    int64_t           acknowledge_count = 0;  //!< number of samples acknowledged in time
+    int64_t           timeout_count     = 0;  //!< number of acknowledge timeouts
+    CLatencyHistogram latency;                //!< latency between signaling the update and receiving the acknowledge
+  };
+  using SyncMemoryFileAckStatisticsMapT = std::unordered_map<int32_t, SSyncMemoryFileAckStatistics>;
+
   class CSyncMemoryFile
   {
   public:
@@ -57,23 +75,57 @@ namespace eCAL
     bool CheckSize(size_t size_);
     bool Write(CPayloadWriter& payload_, const SWriterAttr& data_, bool force_full_write_ = false);
 
+    /**
+     * @brief Hand out the payload area of the next ring slot to construct a sample in place.
+     *
+     * Only ring memory files can be loaned, the slot is not locked, so the loan may be committed
+     * or returned by any thread. A classic memory file is guarded by a named mutex that is owned
+     * by the locking thread, so it is never loaned (nullptr is returned).
+     *
+     * @param len_  The payload size.
+     *
+     * @return  The payload address or nullptr if it fails or the memory file is not a ring.
+    **/
+    void* Loan(size_t len_);
+
+    /**
+     * @brief Publish the loaned payload (data_.len has to match the loaned size).
+    **/
+    bool CommitLoan(const SWriterAttr& data_);
+
+    /**
+     * @brief Give back the loaned payload without publishing it.
+    **/
+    void ReturnLoan();
+
     std::string GetName() const;
     size_t GetSize() const;
     bool IsCreated() const { return m_created; };
+    bool IsRing() const { return m_attr.ring_slots > 0; };
+
+    SyncMemoryFileAckStatisticsMapT GetAckStatistics() const;
 
   protected:
     bool Create(const std::string& base_name_, size_t size_);
     bool Destroy();
     bool Recreate(size_t size_);
 
-    void SyncContent();
+    void PrepareHeader(const SWriterAttr& data_, SMemFileHeader& memfile_hdr_);
+    bool GetWriteAccess();
+
+    size_t MaxDataSize() const;
+    void SyncContent(uint64_t clock_, const std::vector<int32_t>* skip_process_ids_);
     void DisconnectAll();
 
     std::string         m_base_name;
     std::string         m_memfile_name;
     CMemoryFile         m_memfile;
+    CMemoryFileRing     m_memfile_ring;
     SSyncMemoryFileAttr m_attr;
     bool                m_created;
+    std::uint32_t*      m_notify_address;
+    bool                m_loaned;
+    bool                m_reattach_pending;   //!< the memory file has been recreated, the next sample waits for the subscribers to reattach
 
     struct SEventHandlePair
     {
@@ -84,5 +136,13 @@ namespace eCAL
     using EventHandleMapT = std::unordered_map<int32_t, SEventHandlePair>;
     std::mutex       m_event_handle_map_sync;
     EventHandleMapT  m_event_handle_map;
+
+    using ProcessLatencyVecT = std::vector<std::pair<int32_t, std::chrono::nanoseconds>>;
+    void WaitForAcknowledge(const EventHandleMapT& event_handle_map_, uint64_t clock_);
+    void UpdateAckStatistics(const ProcessLatencyVecT& acknowledged_, const std::vector<int32_t>& timed_out_);
+
+    CMemoryFileAck                  m_memfile_ack;
+    mutable std::mutex              m_ack_statistics_sync;
+    SyncMemoryFileAckStatisticsMapT m_ack_statistics;
   };
 }
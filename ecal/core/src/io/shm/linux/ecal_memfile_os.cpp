@@ -26,36 +26,168 @@
 #include <iostream>
 #include <string.h>
 
+#include <climits>
 #include <errno.h>
 #include <fcntl.h>
 #include <string>
 #include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/statfs.h>
+#include <sys/syscall.h>
 #include <sys/types.h>
 #include <unistd.h>
 
+#ifndef MADV_POPULATE_WRITE
+#define MADV_POPULATE_WRITE 23
+#endif
+
+#ifndef MPOL_BIND
+#define MPOL_BIND 2
+#endif
+
 namespace eCAL
 {
   namespace memfile
   {
     namespace os
     {
+      namespace
+      {
+        // files backed by huge pages live on the hugetlbfs mount under their shared memory name,
+        // readers look them up there if there is no regular shared memory file
+        const std::string huge_pages_mount = "/dev/hugepages";
+
+        std::string HugePagesFilePath(const std::string& name_)
+        {
+          return huge_pages_mount + name_;
+        }
+
+        size_t SystemPageSize()
+        {
+          return static_cast<size_t>(sysconf(_SC_PAGE_SIZE));
+        }
+
+        size_t FilePageSize(int memfile_, bool huge_pages_)
+        {
+          if (huge_pages_)
+          {
+            // the block size of a hugetlbfs mount is its huge page size
+            struct statfs fs_info = {};
+            if (::fstatfs(memfile_, &fs_info) == 0 && fs_info.f_bsize > 0) return static_cast<size_t>(fs_info.f_bsize);
+          }
+          return SystemPageSize();
+        }
+
+        int OpenSharedMemoryFile(const std::string& name_, const bool create_, bool& exists_)
+        {
+          if (!create_) return ::shm_open(name_.c_str(), O_RDONLY, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+
+          int memfile = ::shm_open(name_.c_str(), O_CREAT | O_RDWR | O_EXCL, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+          if (memfile == -1 && errno == EEXIST)
+          {
+            exists_ = true;
+            memfile = ::shm_open(name_.c_str(), O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+          }
+          return memfile;
+        }
+
+        int OpenHugePagesFile(const std::string& name_, const bool create_, bool& exists_)
+        {
+          const std::string path = HugePagesFilePath(name_);
+          if (!create_) return ::open(path.c_str(), O_RDONLY);
+
+          int memfile = ::open(path.c_str(), O_CREAT | O_RDWR | O_EXCL, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+          if (memfile == -1 && errno == EEXIST)
+          {
+            exists_ = true;
+            memfile = ::open(path.c_str(), O_RDWR);
+          }
+          return memfile;
+        }
+
+        // replace a huge pages file that could not be mapped by a regular shared memory file
+        bool FallbackToSharedMemory(SMemFileInfo& mem_file_info_)
+        {
+          ::close(mem_file_info_.memfile);
+          ::unlink(HugePagesFilePath(mem_file_info_.name).c_str());
+
+          const int previous_umask = umask(000);
+          bool exists(false);
+          const int memfile = OpenSharedMemoryFile(mem_file_info_.name, true, exists);
+          umask(previous_umask);
+
+          mem_file_info_.huge_pages = false;
+          mem_file_info_.exists     = exists;
+          mem_file_info_.page_size  = SystemPageSize();
+          mem_file_info_.memfile    = (memfile == -1) ? 0 : memfile;
+          return (memfile != -1);
+        }
+
+        void BindToNumaNode(const SMemFileInfo& mem_file_info_)
+        {
+          const int node = mem_file_info_.allocation.numa_node;
+          unsigned long node_mask[16] = {};
+          const int max_node = static_cast<int>(sizeof(node_mask) * CHAR_BIT);
+          if (node >= max_node)
+          {
+            std::cerr << "numa node out of range (memfile::os::MapFile): " << mem_file_info_.name << " node: " << node << std::endl;
+            return;
+          }
+          node_mask[node / (sizeof(unsigned long) * CHAR_BIT)] |= 1UL << (node % (sizeof(unsigned long) * CHAR_BIT));
+
+          // the policy is attached to the shared memory object, so it applies to all pages faulted in later on
+          if (::syscall(SYS_mbind, mem_file_info_.mem_address, mem_file_info_.size, MPOL_BIND, node_mask, max_node + 1, 0) != 0)
+          {
+            std::cerr << "mbind failed (memfile::os::MapFile): " << mem_file_info_.name << " errno: " << strerror(errno) << std::endl;
+          }
+        }
+
+        void Prefault(const SMemFileInfo& mem_file_info_)
+        {
+          if (::madvise(mem_file_info_.mem_address, mem_file_info_.size, MADV_POPULATE_WRITE) == 0) return;
+
+          // kernels before 5.14, touch every page (nobody else is using the file yet)
+          auto* address = static_cast<volatile char*>(mem_file_info_.mem_address);
+          for (size_t offset = 0; offset < mem_file_info_.size; offset += mem_file_info_.page_size)
+          {
+            address[offset] = address[offset];
+          }
+        }
+      }
 
       bool AllocFile(const std::string& name_, const bool create_, SMemFileInfo& mem_file_info_)
       {
         int previous_umask = umask(000);  // set umask to nothing, so we can create files with all possible permission bits
         mem_file_info_.name = name_.size() ? ((name_[0] != '/') ? "/" + name_ : name_) : name_; // make memory file path compatible for all posix systems
+        mem_file_info_.huge_pages = false;
         if(create_)
         {
-          mem_file_info_.memfile = ::shm_open(mem_file_info_.name.c_str(), O_CREAT | O_RDWR | O_EXCL, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
-          if(mem_file_info_.memfile == -1 && errno == EEXIST)
+          if (mem_file_info_.allocation.huge_pages)
           {
-            mem_file_info_.exists = true;
-            mem_file_info_.memfile = ::shm_open(mem_file_info_.name.c_str(), O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+            mem_file_info_.memfile = OpenHugePagesFile(mem_file_info_.name, true, mem_file_info_.exists);
+            if (mem_file_info_.memfile != -1)
+            {
+              mem_file_info_.huge_pages = true;
+            }
+            else
+            {
+              std::cerr << "open failed to CREATE huge pages file, using regular shared memory (memfile::os::AllocFile): " << HugePagesFilePath(mem_file_info_.name) << " errno: " << strerror(errno) << std::endl;
+            }
+          }
+          if (!mem_file_info_.huge_pages)
+          {
+            mem_file_info_.memfile = OpenSharedMemoryFile(mem_file_info_.name, true, mem_file_info_.exists);
           }
         }
         else {
-          mem_file_info_.memfile = ::shm_open(mem_file_info_.name.c_str(), O_RDONLY, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+          mem_file_info_.memfile = OpenSharedMemoryFile(mem_file_info_.name, false, mem_file_info_.exists);
+          if (mem_file_info_.memfile == -1 && errno == ENOENT)
+          {
+            // the writer may have placed the file on the hugetlbfs mount
+            mem_file_info_.memfile = OpenHugePagesFile(mem_file_info_.name, false, mem_file_info_.exists);
+            if (mem_file_info_.memfile != -1) mem_file_info_.huge_pages = true;
+            else                              errno = ENOENT;
+          }
           mem_file_info_.exists = true;
         }
         umask(previous_umask);            // reset umask to previous permissions
@@ -75,7 +207,8 @@ namespace eCAL
           return(false);
         }
 
-        mem_file_info_.size = 0;
+        mem_file_info_.size      = 0;
+        mem_file_info_.page_size = FilePageSize(mem_file_info_.memfile, mem_file_info_.huge_pages);
 
         return(true);
       }
@@ -96,7 +229,8 @@ namespace eCAL
 
       bool RemoveFile(const SMemFileInfo& mem_file_info_)
       {
-        ::shm_unlink(mem_file_info_.name.c_str());
+        if (mem_file_info_.huge_pages) ::unlink(HugePagesFilePath(mem_file_info_.name).c_str());
+        else                           ::shm_unlink(mem_file_info_.name.c_str());
         return(true);
       }
 
@@ -117,13 +251,22 @@ namespace eCAL
           int         prot = PROT_READ;
           if (create_) prot |= PROT_WRITE;
 
-          mem_file_info_.mem_address = ::mmap(nullptr, mem_file_info_.size, prot, MAP_SHARED, mem_file_info_.memfile, 0);
+          // pages can be faulted in by mmap directly if they do not have to be bound to a numa node before
+          const bool prefault   = create_ && mem_file_info_.allocation.prefault;
+          const bool numa_bind  = create_ && (mem_file_info_.allocation.numa_node >= 0);
+          int        flags      = MAP_SHARED;
+          if (prefault && !numa_bind) flags |= MAP_POPULATE;
+
+          mem_file_info_.mem_address = ::mmap(nullptr, mem_file_info_.size, prot, flags, mem_file_info_.memfile, 0);
           if (mem_file_info_.mem_address == MAP_FAILED)
           {
             mem_file_info_.mem_address = nullptr;
             std::cerr << "mmap failed (memfile::os::MapFile): " << mem_file_info_.name << " errno: " << strerror(errno) << std::endl;
             return(false);
           }
+
+          if (numa_bind) BindToNumaNode(mem_file_info_);
+          if (prefault && numa_bind) Prefault(mem_file_info_);
         }
 
         return(true);
@@ -145,44 +288,78 @@ namespace eCAL
       {
         if (mem_file_info_.memfile == 0) return(false);
 
+        // huge pages files can only be truncated and mapped in multiples of the huge page size
+        const size_t page_size = (mem_file_info_.page_size > 0) ? mem_file_info_.page_size : SystemPageSize();
         size_t len = len_;
-        if (len < (size_t)sysconf(_SC_PAGE_SIZE))
+        if (len < page_size)
         {
-          len = sysconf(_SC_PAGE_SIZE);
+          len = page_size;
+        }
+        else if (mem_file_info_.huge_pages)
+        {
+          len = ((len + page_size - 1) / page_size) * page_size;
         }
 
         if (mem_file_info_.mem_address == nullptr)
         {
+          // the file has never been mapped since AllocFile (and a failed grow leaves the size set)
+          const bool initial_mapping = (mem_file_info_.size == 0);
+
           // set file size
           mem_file_info_.size = len;
 
           // map memory file
-          MapFile(create_, mem_file_info_);
+          if (!MapFile(create_, mem_file_info_) && create_ && initial_mapping && mem_file_info_.huge_pages && !mem_file_info_.exists)
+          {
+            // not enough huge pages reserved for the file we just created, nobody can be attached to it yet,
+            // so we can still switch to regular shared memory
+            std::cerr << "mmap failed for huge pages file, using regular shared memory (memfile::os::CheckFileSize): " << mem_file_info_.name << std::endl;
+            if (FallbackToSharedMemory(mem_file_info_)) MapFile(create_, mem_file_info_);
+          }
         }
         else
         {
           // length changed ..
           if (len > mem_file_info_.size)
           {
-            // unmap memory file
-            UnMapFile(mem_file_info_);
-
-            // set new file size
-            mem_file_info_.size = len;
+            // the writer extends the file in place, the appended part is zero filled
+            if (create_ && (::ftruncate(mem_file_info_.memfile, len) != 0))
+            {
+              std::cerr << "ftruncate failed (memfile::os::CheckFileSize): " << mem_file_info_.name << " errno: " << strerror(errno) << std::endl;
+              return(false);
+            }
 
-            // and map memory file again
-            MapFile(create_, mem_file_info_);
+            // grow the mapping, the pages mapped so far stay mapped
+            void* mem_address = ::mremap(mem_file_info_.mem_address, mem_file_info_.size, len, MREMAP_MAYMOVE);
+            if (mem_address != MAP_FAILED)
+            {
+              mem_file_info_.mem_address = mem_address;
+              mem_file_info_.size        = len;
 
-            // reset content
-            if (create_ && mem_file_info_.mem_address)
+              if (create_ && (mem_file_info_.allocation.numa_node >= 0)) BindToNumaNode(mem_file_info_);
+              if (create_ && mem_file_info_.allocation.prefault)         Prefault(mem_file_info_);
+            }
+            else
             {
-              memset(mem_file_info_.mem_address, 0, len);
+              // e.g. huge pages mappings on older kernels, map the file again
+              // (readers are attached to this file, so it is never replaced by a regular shared memory file here)
+              UnMapFile(mem_file_info_);
+              mem_file_info_.size = len;
+              if (!MapFile(create_, mem_file_info_)) return(false);
             }
           }
         }
 
         return(true);
       }
+
+      bool GrowFile(const size_t len_, SMemFileInfo& mem_file_info_)
+      {
+        if (mem_file_info_.mem_address == nullptr) return(false);
+
+        CheckFileSize(len_, true, mem_file_info_);
+        return((mem_file_info_.mem_address != nullptr) && (mem_file_info_.size >= len_));
+      }
     }
   }
 }
@@ -82,6 +82,18 @@ namespace eCAL
             0,
             0,
             mem_file_info_.size);
+
+          // huge pages and numa binding are not supported, prefaulting is
+          if (create_ && mem_file_info_.allocation.prefault && (mem_file_info_.mem_address != nullptr))
+          {
+            SYSTEM_INFO system_info;
+            GetSystemInfo(&system_info);
+            auto* address = static_cast<volatile char*>(mem_file_info_.mem_address);
+            for (size_t offset = 0; offset < mem_file_info_.size; offset += system_info.dwPageSize)
+            {
+              address[offset] = address[offset];
+            }
+          }
         }
 
         return(mem_file_info_.mem_address != nullptr);
@@ -129,6 +141,12 @@ namespace eCAL
 
         return(mem_file_info_.mem_address != nullptr);
       }
+
+      bool GrowFile(const size_t /*len_*/, SMemFileInfo& /*mem_file_info_*/)
+      {
+        // file mappings backed by the paging file cannot be extended
+        return(false);
+      }
     }
   }
 }
@@ -0,0 +1,330 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  UDP forward error correction (XOR parity across interleaved block groups)
+**/
+
+#include "ecal_udp_fec.h"
+#include "ecal_def.h"
+
+#include <ecal_utils/portable_endian.h>
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+
+namespace
+{
+  const std::string                fec_sample_name_prefix("#fec#");
+  constexpr std::array<char, 4>    fec_packet_magic{ { 'E', 'F', 'E', 'C' } };
+
+  // ecaludp protocol version 5 header of a non fragmented datagram
+  constexpr size_t datagram_header_size = 24;
+
+  size_t DataBlockCount(size_t message_size_, size_t block_size_)
+  {
+    return std::max<size_t>((message_size_ + block_size_ - 1) / block_size_, 1);
+  }
+
+  size_t DataBlockSize(size_t message_size_, size_t block_size_, size_t block_index_)
+  {
+    const size_t offset = block_index_ * block_size_;
+    return std::min(block_size_, message_size_ - offset);
+  }
+
+  void XorBlock(char* target_, const char* source_, size_t size_)
+  {
+    for (size_t i = 0; i < size_; ++i) target_[i] ^= source_[i];
+  }
+}
+
+namespace eCAL
+{
+  namespace UDP
+  {
+    namespace FEC
+    {
+      bool IsFecSampleName(const std::string& sample_name_)
+      {
+        return sample_name_.compare(0, fec_sample_name_prefix.size(), fec_sample_name_prefix) == 0;
+      }
+
+      std::string ToFecSampleName(const std::string& sample_name_)
+      {
+        return fec_sample_name_prefix + sample_name_;
+      }
+
+      std::string FromFecSampleName(const std::string& fec_sample_name_)
+      {
+        return fec_sample_name_.substr(fec_sample_name_prefix.size());
+      }
+
+      size_t GetBlockSize(const std::string& fec_sample_name_)
+      {
+        //  2 Bytes sample name size, sample name incl. '\0', fec packet header
+        const size_t overhead = datagram_header_size + 2 + fec_sample_name_.size() + 1 + sizeof(SPacketHeader);
+        if (overhead + min_block_size > max_packet_datagram_size) return min_block_size;
+        return max_packet_datagram_size - overhead;
+      }
+
+      ////////////////
+      // ENCODER
+      ////////////////
+      CEncoder::CEncoder(unsigned int redundancy_percent_) :
+        m_redundancy_percent(redundancy_percent_)
+      {
+        // random sender id and message id start, so that receivers can distinguish the messages of restarted senders
+        std::random_device random_device;
+        m_sender_id  = random_device();
+        m_message_id = random_device();
+      }
+
+      bool CEncoder::Encode(const std::vector<char>& message_, size_t block_size_, const SendPacketCallbackT& send_packet_)
+      {
+        const size_t message_size = message_.size();
+        if ((block_size_ == 0) || (message_size > std::numeric_limits<uint32_t>::max())) return false;
+
+        // one parity block per group, the groups interleave the data blocks
+        const size_t data_blocks   = DataBlockCount(message_size, block_size_);
+        const size_t parity_blocks = std::min(data_blocks, std::max<size_t>((data_blocks * m_redundancy_percent + 99) / 100, 1));
+
+        SPacketHeader header{};
+        header.magic         = fec_packet_magic;
+        header.sender_id     = htole32(m_sender_id);
+        header.message_id    = htole32(m_message_id++);
+        header.message_size  = htole32(static_cast<uint32_t>(message_size));
+        header.block_size    = htole32(static_cast<uint32_t>(block_size_));
+        header.data_blocks   = htole32(static_cast<uint32_t>(data_blocks));
+        header.parity_blocks = htole32(static_cast<uint32_t>(parity_blocks));
+
+        auto send_block = [this, &header, &send_packet_](size_t block_index_, const char* block_, size_t block_size_in_packet_)
+        {
+          header.block_index = htole32(static_cast<uint32_t>(block_index_));
+          m_packet.resize(sizeof(SPacketHeader) + block_size_in_packet_);
+          memcpy(m_packet.data(), &header, sizeof(SPacketHeader));
+          if (block_size_in_packet_ > 0) memcpy(m_packet.data() + sizeof(SPacketHeader), block_, block_size_in_packet_);
+          return send_packet_(m_packet);
+        };
+
+        // send the data blocks and accumulate the parity of their groups
+        bool sent(true);
+        m_parity.assign(parity_blocks * block_size_, 0);
+        for (size_t block = 0; block < data_blocks; ++block)
+        {
+          const char*  data      = message_.data() + block * block_size_;
+          const size_t data_size = DataBlockSize(message_size, block_size_, block);
+          XorBlock(&m_parity[(block % parity_blocks) * block_size_], data, data_size);
+          sent &= send_block(block, data, data_size);
+        }
+
+        // send the parity blocks
+        for (size_t block = 0; block < parity_blocks; ++block)
+        {
+          sent &= send_block(data_blocks + block, &m_parity[block * block_size_], block_size_);
+        }
+
+        return sent;
+      }
+
+      ////////////////
+      // DECODER
+      ////////////////
+      CDecoder::CDecoder(const ApplySampleCallbackT& apply_message_callback_, const FecResultCallbackT& fec_result_callback_, size_t max_message_size_) :
+        m_apply_message_callback(apply_message_callback_),
+        m_fec_result_callback(fec_result_callback_),
+        m_max_message_size(max_message_size_),
+        m_last_cleanup(std::chrono::steady_clock::now())
+      {
+      }
+
+      void CDecoder::ApplyPacket(const std::string& sample_name_, const char* packet_, size_t packet_size_)
+      {
+        RemoveExpiredMessages();
+
+        // read and check the packet header
+        SPacketHeader header{};
+        if (packet_size_ < sizeof(SPacketHeader)) return;
+        memcpy(&header, packet_, sizeof(SPacketHeader));
+        if (header.magic != fec_packet_magic) return;
+
+        const uint32_t message_size  = le32toh(header.message_size);
+        const uint32_t block_size    = le32toh(header.block_size);
+        const uint32_t block_index   = le32toh(header.block_index);
+        const uint32_t data_blocks   = le32toh(header.data_blocks);
+        const uint32_t parity_blocks = le32toh(header.parity_blocks);
+
+        // the header is not trusted, the buffers allocated for a message are limited by the maximum message size
+        // (parity blocks <= data blocks) and the number of blocks by the minimum block size the encoder uses
+        if ((block_size < min_block_size) || (block_size > max_packet_datagram_size)
+          || (message_size > m_max_message_size)
+          || (data_blocks != DataBlockCount(message_size, block_size))
+          || (parity_blocks == 0) || (parity_blocks > data_blocks)
+          || (block_index >= data_blocks + parity_blocks))
+        {
+          std::cerr << "CSampleReceiver: Received damaged data. Wrong forward error correction header." << '\n';
+          return;
+        }
+
+        const char*  block      = packet_ + sizeof(SPacketHeader);
+        const size_t block_size_in_packet = packet_size_ - sizeof(SPacketHeader);
+        const bool   data_block = block_index < data_blocks;
+        if (block_size_in_packet != (data_block ? DataBlockSize(message_size, block_size, block_index) : block_size)) return;
+
+        // find or create the message, late packets of delivered messages are dropped
+        const MessageKeyT key(sample_name_, le32toh(header.sender_id), le32toh(header.message_id));
+        auto iter = m_messages.find(key);
+        if (iter == m_messages.end())
+        {
+          if (m_delivered.count(key) != 0) return;
+
+          // limit the memory held by incomplete messages, the oldest one is given up for the new one
+          if (m_messages.size() >= NET_UDP_MAX_PENDING_REASSEMBLIES) RemoveOldestMessage();
+
+          iter = m_messages.emplace(key, SMessage()).first;
+          SMessage& message = iter->second;
+          message.message_size  = message_size;
+          message.block_size    = block_size;
+          message.data_blocks   = data_blocks;
+          message.parity_blocks = parity_blocks;
+          message.data   = m_buffer_pool.Acquire(static_cast<size_t>(data_blocks) * block_size);
+          message.parity = m_buffer_pool.Acquire(static_cast<size_t>(parity_blocks) * block_size);
+          message.data.assign(static_cast<size_t>(data_blocks) * block_size, 0);
+          message.parity.assign(static_cast<size_t>(parity_blocks) * block_size, 0);
+          message.present.assign(data_blocks + parity_blocks, false);
+        }
+
+        SMessage& message = iter->second;
+        message.last_update = std::chrono::steady_clock::now();
+        if ((message.message_size != message_size) || (message.block_size != block_size) || (message.parity_blocks != parity_blocks)) return;
+        if (message.present[block_index]) return;
+
+        // store the block
+        message.present[block_index] = true;
+        if (data_block)
+        {
+          memcpy(&message.data[static_cast<size_t>(block_index) * block_size], block, block_size_in_packet);
+          message.data_blocks_present++;
+        }
+        else
+        {
+          memcpy(&message.parity[static_cast<size_t>(block_index - data_blocks) * block_size], block, block_size_in_packet);
+        }
+
+        // only the group of the new block can become recoverable
+        RecoverGroup(message, data_block ? block_index % parity_blocks : block_index - data_blocks);
+
+        if (message.data_blocks_present == message.data_blocks)
+        {
+          m_apply_message_callback(message.data.data(), message.message_size);
+          if (message.recovered && m_fec_result_callback) m_fec_result_callback(sample_name_, true);
+
+          // only the key is kept to drop the late packets of the message
+          ReleaseMessageBuffers(message);
+          m_messages.erase(iter);
+          AddDeliveredMessage(key);
+        }
+      }
+
+      void CDecoder::RecoverGroup(SMessage& message_, uint32_t group_)
+      {
+        if (!message_.present[message_.data_blocks + group_]) return;
+
+        // a single missing data block of the group can be restored
+        uint32_t missing_block(0);
+        uint32_t missing_count(0);
+        for (uint32_t block = group_; block < message_.data_blocks; block += message_.parity_blocks)
+        {
+          if (message_.present[block]) continue;
+          missing_block = block;
+          if (++missing_count > 1) return;
+        }
+        if (missing_count == 0) return;
+
+        // missing block = parity XOR all other data blocks of the group
+        const size_t block_size = message_.block_size;
+        char* target = &message_.data[missing_block * block_size];
+        memcpy(target, &message_.parity[group_ * block_size], block_size);
+        for (uint32_t block = group_; block < message_.data_blocks; block += message_.parity_blocks)
+        {
+          if (block != missing_block) XorBlock(target, &message_.data[block * block_size], block_size);
+        }
+
+        message_.present[missing_block] = true;
+        message_.data_blocks_present++;
+        message_.recovered = true;
+      }
+
+      void CDecoder::RemoveExpiredMessages()
+      {
+        const auto now     = std::chrono::steady_clock::now();
+        const auto timeout = std::chrono::milliseconds(NET_UDP_REASSEMBLY_TIMEOUT);
+        if (now - m_last_cleanup < timeout) return;
+        m_last_cleanup = now;
+
+        // incomplete messages could not be restored
+        for (auto iter = m_messages.begin(); iter != m_messages.end();)
+        {
+          if (now - iter->second.last_update > timeout)
+          {
+            if (m_fec_result_callback) m_fec_result_callback(std::get<0>(iter->first), false);
+            ReleaseMessageBuffers(iter->second);
+            iter = m_messages.erase(iter);
+          }
+          else
+          {
+            ++iter;
+          }
+        }
+      }
+
+      void CDecoder::RemoveOldestMessage()
+      {
+        auto oldest = std::min_element(m_messages.begin(), m_messages.end(),
+          [](const std::pair<const MessageKeyT, SMessage>& lhs_, const std::pair<const MessageKeyT, SMessage>& rhs_) { return lhs_.second.last_update < rhs_.second.last_update; });
+        if (oldest == m_messages.end()) return;
+
+        // the message could not be restored
+        if (m_fec_result_callback) m_fec_result_callback(std::get<0>(oldest->first), false);
+        ReleaseMessageBuffers(oldest->second);
+        m_messages.erase(oldest);
+      }
+
+      void CDecoder::AddDeliveredMessage(const MessageKeyT& key_)
+      {
+        if (m_delivered_order.size() >= NET_UDP_MAX_PENDING_REASSEMBLIES)
+        {
+          m_delivered.erase(m_delivered_order.front());
+          m_delivered_order.pop_front();
+        }
+        m_delivered.insert(key_);
+        m_delivered_order.push_back(key_);
+      }
+
+      void CDecoder::ReleaseMessageBuffers(SMessage& message_)
+      {
+        m_buffer_pool.Release(message_.data);
+        m_buffer_pool.Release(message_.parity);
+        std::vector<bool>().swap(message_.present);
+      }
+    }
+  }
+}
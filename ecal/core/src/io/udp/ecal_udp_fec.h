@@ -0,0 +1,144 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  UDP forward error correction (XOR parity across interleaved block groups)
+ *
+ * A message is split into K data blocks of equal size (the last one is zero padded).
+ * P parity blocks are added, parity block p is the XOR of all data blocks i with
+ * i % P == p. Every block is sent as a separate packet small enough for one ethernet
+ * frame, so a lost frame costs one block and not the whole IP fragmented datagram.
+ * A receiver restores up to one lost data block per parity group.
+ *
+ * The packets are sent with the sample name prefix "#fec#", receivers without
+ * forward error correction support do not know this sample name and drop them.
+**/
+
+#pragma once
+
+#include "io/udp/ecal_udp_receiver_attr.h"
+#include "util/buffer_pool.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace eCAL
+{
+  namespace UDP
+  {
+    namespace FEC
+    {
+#pragma pack(push, 1)
+      struct SPacketHeader
+      {
+        std::array<char, 4> magic;
+        uint32_t            sender_id;      // little endian, random per sender
+        uint32_t            message_id;     // little endian, identical for all blocks of one message
+        uint32_t            message_size;   // little endian
+        uint32_t            block_size;     // little endian
+        uint32_t            block_index;    // little endian, data blocks first, then parity blocks
+        uint32_t            data_blocks;    // little endian
+        uint32_t            parity_blocks;  // little endian
+      };
+#pragma pack(pop)
+
+      // packets should fit into one ethernet frame: 1500 - 20 /* IP header */ - 8 /* UDP header */
+      constexpr size_t max_packet_datagram_size = 1500 - 20 - 8;
+      constexpr size_t min_block_size           = 512;
+
+      bool        IsFecSampleName(const std::string& sample_name_);
+      std::string ToFecSampleName(const std::string& sample_name_);
+      std::string FromFecSampleName(const std::string& fec_sample_name_);
+
+      // block size for the given fec sample name, so that one packet fits into one datagram of max_packet_datagram_size
+      size_t GetBlockSize(const std::string& fec_sample_name_);
+
+      class CEncoder
+      {
+      public:
+        using SendPacketCallbackT = std::function<bool(const std::vector<char>& packet_)>;
+
+        // redundancy_percent_ is the size of the parity data in percent of the message data
+        explicit CEncoder(unsigned int redundancy_percent_);
+
+        bool Encode(const std::vector<char>& message_, size_t block_size_, const SendPacketCallbackT& send_packet_);
+
+      private:
+        unsigned int      m_redundancy_percent = 0;
+        uint32_t          m_sender_id          = 0;
+        uint32_t          m_message_id         = 0;
+
+        // reused for every message to avoid allocations on the send path
+        std::vector<char> m_packet;
+        std::vector<char> m_parity;
+      };
+
+      class CDecoder
+      {
+      public:
+        // messages announced larger than max_message_size_ are dropped before their buffers are allocated
+        CDecoder(const ApplySampleCallbackT& apply_message_callback_, const FecResultCallbackT& fec_result_callback_, size_t max_message_size_);
+
+        void ApplyPacket(const std::string& sample_name_, const char* packet_, size_t packet_size_);
+
+      private:
+        using MessageKeyT = std::tuple<std::string /*sample name*/, uint32_t /*sender id*/, uint32_t /*message id*/>;
+
+        struct SMessage
+        {
+          uint32_t                              message_size        = 0;
+          uint32_t                              block_size          = 0;
+          uint32_t                              data_blocks         = 0;
+          uint32_t                              parity_blocks       = 0;
+          uint32_t                              data_blocks_present = 0;
+          bool                                  recovered           = false;
+          std::vector<char>                     data;                          // data_blocks * block_size
+          std::vector<char>                     parity;                        // parity_blocks * block_size
+          std::vector<bool>                     present;                       // data_blocks + parity_blocks
+          std::chrono::steady_clock::time_point last_update;
+        };
+
+        void RecoverGroup(SMessage& message_, uint32_t group_);
+        void RemoveExpiredMessages();
+        void RemoveOldestMessage();
+        void AddDeliveredMessage(const MessageKeyT& key_);
+        void ReleaseMessageBuffers(SMessage& message_);
+
+        ApplySampleCallbackT                    m_apply_message_callback;
+        FecResultCallbackT                      m_fec_result_callback;
+        size_t                                  m_max_message_size = 0;
+
+        std::map<MessageKeyT, SMessage>         m_messages;          // incomplete messages, limited to NET_UDP_MAX_PENDING_REASSEMBLIES
+        std::set<MessageKeyT>                   m_delivered;         // the last delivered messages, to drop their late packets
+        std::deque<MessageKeyT>                 m_delivered_order;
+        Util::CBufferPool<>                     m_buffer_pool;   // data and parity buffers, reused across messages
+        std::chrono::steady_clock::time_point   m_last_cleanup;
+      };
+    }
+  }
+}
@@ -23,6 +23,9 @@
 
 #pragma once
 
+#include "ecal_def.h"
+
+#include <cstddef>
 #include <functional>
 #include <string>
 
@@ -37,9 +40,13 @@ namespace eCAL
       bool        broadcast = false;
       bool        loopback  = true;
       int         rcvbuf    = 1024 * 1024;
+      bool        mmsg      = false;        // receive with recvmmsg (linux only)
+      bool        mcast_all = true;         // receive the datagrams of all multicast groups joined on the host, not only the own ones (linux only)
+      size_t      max_message_size = NET_UDP_MAX_MESSAGE_SIZE; // larger messages announced by a datagram header are dropped
     };
 
     using HasSampleCallbackT   = std::function<bool(const std::string& sample_name_)>;
     using ApplySampleCallbackT = std::function<void(const char* serialized_sample_data_, size_t serialized_sample_size_)>;
+    using FecResultCallbackT   = std::function<void(const std::string& sample_name_, bool recovered_)>;
   }
 }
@@ -28,22 +28,32 @@
 #ifdef ECAL_CORE_NPCAP_SUPPORT
 #include "ecal_udp_sample_receiver_npcap.h"
 #endif
+#ifdef __linux__
+#include "linux/ecal_udp_sample_receiver_mmsg.h"
+#endif
 
 namespace eCAL
 {
   namespace UDP
   {
-    CSampleReceiver::CSampleReceiver(const SReceiverAttr& attr_, const HasSampleCallbackT& has_sample_callback_, const ApplySampleCallbackT& apply_sample_callback_)
+    CSampleReceiver::CSampleReceiver(const SReceiverAttr& attr_, const HasSampleCallbackT& has_sample_callback_, const ApplySampleCallbackT& apply_sample_callback_, const FecResultCallbackT& fec_result_callback_)
     {
 #ifdef ECAL_CORE_NPCAP_SUPPORT
       if (eCAL::UDP::IsNpcapEnabled())
       {
-        m_sample_receiver = std::make_unique<CSampleReceiverNpcap>(attr_, has_sample_callback_, apply_sample_callback_);
+        m_sample_receiver = std::make_unique<CSampleReceiverNpcap>(attr_, has_sample_callback_, apply_sample_callback_, fec_result_callback_);
+      }
+      else
+#endif
+#ifdef __linux__
+      if (attr_.mmsg)
+      {
+        m_sample_receiver = std::make_unique<CSampleReceiverMmsg>(attr_, has_sample_callback_, apply_sample_callback_, fec_result_callback_);
       }
       else
 #endif
       {
-        m_sample_receiver = std::make_unique<CSampleReceiverAsio>(attr_, has_sample_callback_, apply_sample_callback_);
+        m_sample_receiver = std::make_unique<CSampleReceiverAsio>(attr_, has_sample_callback_, apply_sample_callback_, fec_result_callback_);
       }
     }
 
@@ -35,8 +35,8 @@ namespace eCAL
 {
   namespace UDP
   {
-    CSampleReceiverAsio::CSampleReceiverAsio(const SReceiverAttr& attr_, const HasSampleCallbackT& has_sample_callback_, const ApplySampleCallbackT& apply_sample_callback_) :
-      CSampleReceiverBase(attr_, has_sample_callback_, apply_sample_callback_)
+    CSampleReceiverAsio::CSampleReceiverAsio(const SReceiverAttr& attr_, const HasSampleCallbackT& has_sample_callback_, const ApplySampleCallbackT& apply_sample_callback_, const FecResultCallbackT& fec_result_callback_) :
+      CSampleReceiverBase(attr_, has_sample_callback_, apply_sample_callback_, fec_result_callback_)
     {
       // initialize io context
       m_io_context = std::make_unique<asio::io_context>();
@@ -131,6 +131,14 @@ namespace eCAL
         }
       }
 
+#ifdef __linux__
+      // receive the own multicast groups only
+      if (!attr_.mcast_all)
+      {
+        IO::UDP::set_socket_mcast_all_option(m_socket->native_handle(), false);
+      }
+#endif
+
       // set loopback option
       {
         const asio::ip::multicast::enable_loopback loopback(attr_.loopback);
@@ -246,14 +254,14 @@ namespace eCAL
               std::cerr << "CSampleReceiverAsio: Received damaged data. Wrong payload buffer offset." << '\n';
               processed = false;
             }
-            else if (m_has_sample_callback(sample_name)) // if we are interested in the sample payload
+            else
             {
               // extract payload and its size
               const char* payload_buffer = receive_buffer + payload_offset;
               auto payload_buffer_size = buffer->size() - payload_offset;
 
-              // apply the sample payload
-              m_apply_sample_callback(payload_buffer, payload_buffer_size);
+              // apply the sample payload (if we are interested in it)
+              ProcessSample(sample_name, payload_buffer, payload_buffer_size);
             }
           }
 
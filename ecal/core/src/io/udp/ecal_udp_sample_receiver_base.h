@@ -23,8 +23,12 @@
 
 #pragma once
 
+#include "io/udp/ecal_udp_fec.h"
 #include "io/udp/ecal_udp_receiver_attr.h"
 
+#include <cstddef>
+#include <string>
+
 namespace eCAL
 {
   namespace UDP
@@ -44,14 +48,30 @@ namespace eCAL
       CSampleReceiverBase& operator=(CSampleReceiverBase&&) = delete;
 
     protected:
-      CSampleReceiverBase(const SReceiverAttr& attr_, const HasSampleCallbackT& has_sample_callback_, const ApplySampleCallbackT& apply_sample_callback_)
-        : m_has_sample_callback(has_sample_callback_), m_apply_sample_callback(apply_sample_callback_), m_broadcast(attr_.broadcast)
+      CSampleReceiverBase(const SReceiverAttr& attr_, const HasSampleCallbackT& has_sample_callback_, const ApplySampleCallbackT& apply_sample_callback_, const FecResultCallbackT& fec_result_callback_)
+        : m_has_sample_callback(has_sample_callback_), m_apply_sample_callback(apply_sample_callback_), m_broadcast(attr_.broadcast),
+          m_max_message_size(attr_.max_message_size), m_fec_decoder(apply_sample_callback_, fec_result_callback_, attr_.max_message_size)
       {
       }
 
+      // hand over a received sample, forward error correction packets are collected until their message is complete
+      void ProcessSample(const std::string& sample_name_, const char* payload_, size_t payload_size_)
+      {
+        if (FEC::IsFecSampleName(sample_name_))
+        {
+          const std::string sample_name = FEC::FromFecSampleName(sample_name_);
+          if (m_has_sample_callback(sample_name)) m_fec_decoder.ApplyPacket(sample_name, payload_, payload_size_);
+          return;
+        }
+
+        if (m_has_sample_callback(sample_name_)) m_apply_sample_callback(payload_, payload_size_);
+      }
+
       HasSampleCallbackT   m_has_sample_callback;
       ApplySampleCallbackT m_apply_sample_callback;
       bool                 m_broadcast = false;
+      size_t               m_max_message_size = 0;
+      FEC::CDecoder        m_fec_decoder;
     };
   }
 }
@@ -36,7 +36,7 @@ namespace eCAL
     class CSampleReceiverNpcap : public CSampleReceiverBase
     {
     public:
-      CSampleReceiverNpcap(const SReceiverAttr& attr_, const HasSampleCallbackT& has_sample_callback_, const ApplySampleCallbackT& apply_sample_callback_);
+      CSampleReceiverNpcap(const SReceiverAttr& attr_, const HasSampleCallbackT& has_sample_callback_, const ApplySampleCallbackT& apply_sample_callback_, const FecResultCallbackT& fec_result_callback_);
       ~CSampleReceiverNpcap() override;
 
       bool AddMultiCastGroup(const char* ipaddr_) override;
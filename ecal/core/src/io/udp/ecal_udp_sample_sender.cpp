@@ -24,6 +24,10 @@
 #include "ecal_udp_sample_sender.h"
 #include "io/udp/ecal_udp_configurations.h"
 
+#ifdef __linux__
+#include "linux/ecal_udp_sample_sender_mmsg.h"
+#endif
+
 #include <array>
 #include <iostream>
 #include <memory>
@@ -35,6 +39,21 @@ namespace eCAL
     CSampleSender::CSampleSender(const SSenderAttr& attr_) :
       m_destination_endpoint(asio::ip::make_address(attr_.address), static_cast<unsigned short>(attr_.port))
     {
+      // send every message as data and parity blocks
+      if (attr_.fec_redundancy_percent > 0)
+      {
+        m_fec_encoder = std::make_unique<FEC::CEncoder>(attr_.fec_redundancy_percent);
+      }
+
+#ifdef __linux__
+      // send all datagrams of a message with one sendmmsg call
+      if (attr_.mmsg)
+      {
+        m_mmsg_sender = std::make_unique<CSampleSenderMmsg>(attr_);
+        return;
+      }
+#endif
+
       m_io_context = std::make_unique<asio::io_context>();
 
       // create the socket and set all socket options
@@ -43,6 +62,8 @@ namespace eCAL
 
     CSampleSender::~CSampleSender()
     {
+      if (!m_socket) return;
+
       // close socket
       asio::error_code ec;
       m_socket->close(ec);
@@ -110,6 +131,29 @@ namespace eCAL
 
     size_t CSampleSender::Send(const std::string& sample_name_, const std::vector<char>& serialized_sample_)
     {
+      if (m_fec_encoder)
+      {
+        const std::string fec_sample_name = FEC::ToFecSampleName(sample_name_);
+        size_t sent_bytes = 0;
+        const bool sent = m_fec_encoder->Encode(serialized_sample_, FEC::GetBlockSize(fec_sample_name),
+          [this, &fec_sample_name, &sent_bytes](const std::vector<char>& packet_)
+          {
+            const size_t packet_sent = SendMessage(fec_sample_name, packet_);
+            sent_bytes += packet_sent;
+            return packet_sent > 0;
+          });
+        return sent ? sent_bytes : 0;
+      }
+
+      return SendMessage(sample_name_, serialized_sample_);
+    }
+
+    size_t CSampleSender::SendMessage(const std::string& sample_name_, const std::vector<char>& serialized_sample_)
+    {
+#ifdef __linux__
+      if (m_mmsg_sender) return m_mmsg_sender->Send(sample_name_, serialized_sample_);
+#endif
+
       // ------------------------------------------------
       // emulate old protocol
       // 
@@ -23,10 +23,12 @@
 
 #pragma once
 
+#include "io/udp/ecal_udp_fec.h"
 #include "io/udp/ecal_udp_sender_attr.h"
 
 #include <ecaludp/socket.h>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -34,6 +36,10 @@ namespace eCAL
 {
   namespace UDP
   {
+#ifdef __linux__
+    class CSampleSenderMmsg;
+#endif
+
     class CSampleSender
     {
     public:
@@ -43,11 +49,16 @@ namespace eCAL
       size_t Send(const std::string& sample_name_, const std::vector<char>& serialized_sample_);
 
     private:
-      void InitializeSocket(const SSenderAttr& attr_);
+      void   InitializeSocket(const SSenderAttr& attr_);
+      size_t SendMessage(const std::string& sample_name_, const std::vector<char>& serialized_sample_);
 
       std::unique_ptr<asio::io_context>       m_io_context;
       std::unique_ptr<ecaludp::Socket>        m_socket;
       asio::ip::udp::endpoint                 m_destination_endpoint;
+#ifdef __linux__
+      std::unique_ptr<CSampleSenderMmsg>      m_mmsg_sender;
+#endif
+      std::unique_ptr<FEC::CEncoder>          m_fec_encoder;
     };
   }
 }
@@ -37,6 +37,8 @@ namespace eCAL
       bool        broadcast = false;
       bool        loopback  = true;
       int         sndbuf    = 1024 * 1024;
+      bool        mmsg      = false;        // send with sendmmsg (linux only)
+      unsigned int fec_redundancy_percent = 0; // forward error correction parity in percent of the message size (0 == disabled)
     };
   }
 }
@@ -182,5 +182,21 @@ namespace eCAL
         return topic2mcast_hash(hash_v, mcast_base_, mcast_mask_);
       }
     }
+
+    /**
+     * @brief Get the receive shard of a multicast address.
+     *
+     * Consecutive multicast groups (as created by topic2mcast) are distributed round robin.
+     *
+     * @param  mcast_address_  The multicast address (e.g. "239.0.0.17").
+     * @param  shard_count_    Number of receive shards.
+     *
+     * @return  The shard index (0 .. shard_count_ - 1).
+    **/
+    inline size_t mcast2shard(const std::string& mcast_address_, size_t shard_count_)
+    {
+      if (shard_count_ <= 1) return 0;
+      return static_cast<size_t>(V2::parse_ipv4(mcast_address_)) % shard_count_;
+    }
   }
 }
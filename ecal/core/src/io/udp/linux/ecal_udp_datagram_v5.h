@@ -0,0 +1,100 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL UDP datagram format (protocol version 5, as written and read by ecaludp)
+ *
+ * A message that fits into one datagram is sent as non_fragmented_message.
+ * Larger messages are sent as one fragmented_message_info datagram (num = number
+ * of fragments, len = message size) followed by the fragment datagrams
+ * (num = fragment index, len = fragment size).
+**/
+
+#pragma once
+
+#include "io/udp/ecal_udp_configurations.h"
+
+#include <ecal_utils/portable_endian.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace eCAL
+{
+  namespace UDP
+  {
+    namespace Datagram
+    {
+      enum class eMessageType : uint32_t
+      {
+        unknown                 = 0,
+        fragmented_message_info = 1,
+        fragment                = 2,
+        non_fragmented_message  = 3,
+      };
+
+#pragma pack(push, 1)
+      struct SHeaderV5
+      {
+        std::array<char, 4> magic;
+        uint8_t             version;
+        uint8_t             reserved[3];
+        uint32_t            type;        // little endian
+        int32_t             id;          // little endian, identical for all datagrams of one message
+        uint32_t            num;         // little endian
+        uint32_t            len;         // little endian
+      };
+#pragma pack(pop)
+
+      // maximum size is imposed by the underlying IPv4 protocol (same limit as used for the ecaludp socket)
+      // 64*1024 - 20 /* IP header */ - 8 /* UDP header */ - 1
+      constexpr size_t max_datagram_size         = 64 * 1024 - 8 - 20 - 1;
+      constexpr size_t max_fragment_payload_size = max_datagram_size - sizeof(SHeaderV5);
+
+      inline SHeaderV5 CreateHeader(eMessageType type_, int32_t id_, uint32_t num_, uint32_t len_)
+      {
+        SHeaderV5 header{};
+        header.magic   = GeteCALDatagramHeader();
+        header.version = 5;
+        header.type    = htole32(static_cast<uint32_t>(type_));
+        header.id      = static_cast<int32_t>(htole32(static_cast<uint32_t>(id_)));
+        header.num     = htole32(num_);
+        header.len     = htole32(len_);
+        return header;
+      }
+
+      // read and check the header of a received datagram, the fields are returned in host byte order
+      inline bool ReadHeader(const char* data_, size_t size_, SHeaderV5& header_)
+      {
+        if (size_ < sizeof(SHeaderV5)) return false;
+        memcpy(&header_, data_, sizeof(SHeaderV5));
+        if (header_.magic != GeteCALDatagramHeader()) return false;
+        if (header_.version != 5)                     return false;
+
+        header_.type = le32toh(header_.type);
+        header_.id   = static_cast<int32_t>(le32toh(static_cast<uint32_t>(header_.id)));
+        header_.num  = le32toh(header_.num);
+        header_.len  = le32toh(header_.len);
+        return true;
+      }
+    }
+  }
+}
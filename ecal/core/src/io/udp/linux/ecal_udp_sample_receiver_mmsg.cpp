@@ -0,0 +1,399 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  UDP sample receiver receiving datagram batches with recvmmsg (linux only)
+**/
+
+#include "ecal_udp_sample_receiver_mmsg.h"
+#include "ecal_def.h"
+#include "io/udp/ecal_udp_configurations.h"
+#include "io/udp/linux/ecal_udp_datagram_v5.h"
+#include "io/udp/linux/socket_os.h"
+
+#include <arpa/inet.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace eCAL
+{
+  namespace UDP
+  {
+    CSampleReceiverMmsg::CSampleReceiverMmsg(const SReceiverAttr& attr_, const HasSampleCallbackT& has_sample_callback_, const ApplySampleCallbackT& apply_sample_callback_, const FecResultCallbackT& fec_result_callback_) :
+      CSampleReceiverBase(attr_, has_sample_callback_, apply_sample_callback_, fec_result_callback_),
+      m_last_reassembly_cleanup(std::chrono::steady_clock::now())
+    {
+      // prepare one receive buffer per datagram of a batch
+      const size_t batch_size = NET_UDP_MMSG_RECEIVE_BATCH_SIZE;
+      m_receive_buffer.resize(batch_size * Datagram::max_datagram_size);
+      m_iovecs.resize(batch_size);
+      m_sender_addresses.resize(batch_size);
+      m_messages.resize(batch_size);
+      for (size_t i = 0; i < batch_size; ++i)
+      {
+        m_iovecs[i].iov_base = &m_receive_buffer[i * Datagram::max_datagram_size];
+        m_iovecs[i].iov_len  = Datagram::max_datagram_size;
+
+        m_messages[i].msg_hdr             = msghdr{};
+        m_messages[i].msg_hdr.msg_name    = &m_sender_addresses[i];
+        m_messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+        m_messages[i].msg_hdr.msg_iov     = &m_iovecs[i];
+        m_messages[i].msg_hdr.msg_iovlen  = 1;
+      }
+
+      // create the socket and set all socket options
+      InitializeSocket(attr_);
+      if (m_socket < 0) return;
+
+      // join multicast group
+      AddMultiCastGroup(attr_.address.c_str());
+
+      // start receiving
+      m_receive_thread = std::thread(&CSampleReceiverMmsg::ReceiveThread, this);
+    }
+
+    CSampleReceiverMmsg::~CSampleReceiverMmsg()
+    {
+      if (m_socket < 0) return;
+
+      // shutting down the socket wakes up the blocking recvmmsg call
+      m_stop = true;
+      shutdown(m_socket, SHUT_RDWR);
+      if (m_receive_thread.joinable())
+        m_receive_thread.join();
+
+      if (close(m_socket) != 0)
+      {
+        std::cerr << "CSampleReceiverMmsg: Error closing socket: " << strerror(errno) << '\n';
+      }
+    }
+
+    bool CSampleReceiverMmsg::AddMultiCastGroup(const char* ipaddr_)
+    {
+      return SetMultiCastGroupOption(ipaddr_, true);
+    }
+
+    bool CSampleReceiverMmsg::RemMultiCastGroup(const char* ipaddr_)
+    {
+      return SetMultiCastGroupOption(ipaddr_, false);
+    }
+
+    void CSampleReceiverMmsg::InitializeSocket(const SReceiverAttr& attr_)
+    {
+      // create socket
+      m_socket = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, IPPROTO_UDP);
+      if (m_socket < 0)
+      {
+        std::cerr << "CSampleReceiverMmsg: Unable to open socket: " << strerror(errno) << '\n';
+        return;
+      }
+
+      // set socket reuse
+      const int reuse = 1;
+      if (setsockopt(m_socket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)) != 0)
+      {
+        std::cerr << "CSampleReceiverMmsg: Unable to set reuse-address option: " << strerror(errno) << '\n';
+      }
+
+      // receive the own multicast groups only
+      if (!attr_.mcast_all)
+      {
+        IO::UDP::set_socket_mcast_all_option(m_socket, false);
+      }
+
+      // set loopback option
+      const int loopback = attr_.loopback ? 1 : 0;
+      if (setsockopt(m_socket, IPPROTO_IP, IP_MULTICAST_LOOP, &loopback, sizeof(loopback)) != 0)
+      {
+        std::cerr << "CSampleReceiverMmsg: Unable to enable loopback: " << strerror(errno) << '\n';
+      }
+
+      // set receive buffer size (default = 1 MB)
+      int rcvbuf = 1024 * 1024;
+      if (attr_.rcvbuf > 0) rcvbuf = attr_.rcvbuf;
+      if (setsockopt(m_socket, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf)) != 0)
+      {
+        std::cerr << "CSampleReceiverMmsg: Unable to set receive buffer size: " << strerror(errno) << '\n';
+      }
+
+      // bind socket
+      sockaddr_in listen_address{};
+      listen_address.sin_family      = AF_INET;
+      listen_address.sin_port        = htons(static_cast<uint16_t>(attr_.port));
+      listen_address.sin_addr.s_addr = htonl(INADDR_ANY);
+      if (bind(m_socket, reinterpret_cast<sockaddr*>(&listen_address), sizeof(listen_address)) != 0)
+      {
+        std::cerr << "CSampleReceiverMmsg: Unable to bind socket to 0.0.0.0:" << attr_.port << ": " << strerror(errno) << '\n';
+        close(m_socket);
+        m_socket = -1;
+      }
+    }
+
+    bool CSampleReceiverMmsg::SetMultiCastGroupOption(const char* ipaddr_, bool join_)
+    {
+      if (m_broadcast || (m_socket < 0)) return(true);
+
+      if (eCAL::UDP::IsUdpMulticastJoinAllIfEnabled())
+      {
+        return IO::UDP::set_socket_mcast_group_option(m_socket, ipaddr_, join_ ? MCAST_JOIN_GROUP : MCAST_LEAVE_GROUP);
+      }
+
+      ip_mreq mreq{};
+      mreq.imr_multiaddr.s_addr = inet_addr(ipaddr_);
+      mreq.imr_interface.s_addr = htonl(INADDR_ANY);
+      if (setsockopt(m_socket, IPPROTO_IP, join_ ? IP_ADD_MEMBERSHIP : IP_DROP_MEMBERSHIP, &mreq, sizeof(mreq)) != 0)
+      {
+        std::cerr << "CSampleReceiverMmsg: Unable to " << (join_ ? "join" : "leave") << " multicast group: " << strerror(errno) << '\n';
+        return(false);
+      }
+      return(true);
+    }
+
+    void CSampleReceiverMmsg::ReceiveThread()
+    {
+      bool receive_error(false);
+      while (!m_stop)
+      {
+        for (auto& message : m_messages)
+        {
+          message.msg_hdr.msg_namelen = sizeof(sockaddr_in);
+          message.msg_hdr.msg_flags   = 0;
+        }
+
+        // block until the first datagram arrives, then take all datagrams already queued (up to the batch size)
+        const int received = recvmmsg(m_socket, m_messages.data(), static_cast<unsigned int>(m_messages.size()), MSG_WAITFORONE, nullptr);
+        if (m_stop) break;
+        if (received < 0)
+        {
+          const int error = errno;
+          if (error == EINTR) continue;
+
+          // the socket is gone, there is nothing to receive anymore
+          if ((error == EBADF) || (error == ENOTSOCK))
+          {
+            std::cerr << "CSampleReceiverMmsg: Error receiving: " << strerror(error) << '\n';
+            return;
+          }
+
+          // transient errors (e.g. ENOMEM, ICMP errors) must not end the reception,
+          // log the first one of a series only and give the system some time to recover
+          if (!receive_error)
+          {
+            std::cerr << "CSampleReceiverMmsg: Error receiving: " << strerror(error) << '\n';
+            receive_error = true;
+          }
+          std::this_thread::sleep_for(std::chrono::milliseconds(NET_UDP_RECEIVE_ERROR_BACKOFF));
+          continue;
+        }
+        receive_error = false;
+
+        for (int i = 0; i < received; ++i)
+        {
+          // the datagram did not fit into the receive buffer
+          if ((m_messages[i].msg_hdr.msg_flags & MSG_TRUNC) != 0) continue;
+
+          OnDatagram(m_sender_addresses[i], static_cast<const char*>(m_iovecs[i].iov_base), m_messages[i].msg_len);
+        }
+
+        RemoveExpiredReassemblies();
+      }
+    }
+
+    void CSampleReceiverMmsg::OnDatagram(const sockaddr_in& sender_address_, const char* datagram_, size_t datagram_size_)
+    {
+      Datagram::SHeaderV5 header{};
+      if (!Datagram::ReadHeader(datagram_, datagram_size_, header)) return;
+
+      const char*  data      = datagram_ + sizeof(Datagram::SHeaderV5);
+      const size_t data_size = datagram_size_ - sizeof(Datagram::SHeaderV5);
+      const auto   type      = static_cast<Datagram::eMessageType>(header.type);
+
+      // apply directly from the receive buffer
+      if (type == Datagram::eMessageType::non_fragmented_message)
+      {
+        if (header.len <= data_size) ApplyMessage(data, header.len);
+        return;
+      }
+
+      // the header is not trusted, messages larger than the configured maximum are dropped before any buffer is allocated
+      const size_t max_fragment_count = (m_max_message_size + Datagram::max_fragment_payload_size - 1) / Datagram::max_fragment_payload_size;
+
+      const ReassemblyKeyT key(sender_address_.sin_addr.s_addr, sender_address_.sin_port, header.id);
+      if (type == Datagram::eMessageType::fragmented_message_info)
+      {
+        if ((header.num == 0) || (header.len > static_cast<uint64_t>(header.num) * Datagram::max_fragment_payload_size)) return;
+        if ((header.len > m_max_message_size) || (header.num > max_fragment_count)) return;
+
+        SReassembly* reassembly_ptr = GetReassembly(key);
+        if (reassembly_ptr == nullptr) return;
+        SReassembly& reassembly = *reassembly_ptr;
+        if (reassembly.fragment_count > 0) return;
+        reassembly.fragment_count = header.num;
+        reassembly.message_size   = header.len;
+        reassembly.last_update    = std::chrono::steady_clock::now();
+
+        // move fragments received before the message info into a pooled buffer of the message size
+        std::vector<char> message = m_reassembly_buffer_pool.Acquire(header.len);
+        message.insert(message.end(), reassembly.message.begin(), reassembly.message.end());
+        m_reassembly_buffer_pool.Release(reassembly.message);
+        reassembly.message = std::move(message);
+
+        // append fragments received before the message info
+        OnFragment(reassembly, reassembly.next_fragment, nullptr, 0);
+      }
+      else if (type == Datagram::eMessageType::fragment)
+      {
+        if ((header.len > data_size) || (header.num >= max_fragment_count)) return;
+
+        SReassembly* reassembly = GetReassembly(key);
+        if (reassembly == nullptr) return;
+        reassembly->last_update = std::chrono::steady_clock::now();
+        OnFragment(*reassembly, header.num, data, header.len);
+      }
+      else
+      {
+        return;
+      }
+
+      // apply and remove completed messages
+      auto iter = m_reassemblies.find(key);
+      const SReassembly& reassembly = iter->second;
+      if ((reassembly.fragment_count > 0) && (reassembly.next_fragment == reassembly.fragment_count))
+      {
+        if (reassembly.message.size() == reassembly.message_size)
+        {
+          ApplyMessage(reassembly.message.data(), reassembly.message.size());
+        }
+        ReleaseReassembly(iter->second);
+        m_reassemblies.erase(iter);
+      }
+    }
+
+    CSampleReceiverMmsg::SReassembly* CSampleReceiverMmsg::GetReassembly(const ReassemblyKeyT& key_)
+    {
+      auto iter = m_reassemblies.find(key_);
+      if (iter != m_reassemblies.end()) return &iter->second;
+
+      // limit the memory held by incomplete messages, new messages are dropped until old ones are completed or timed out
+      if (m_reassemblies.size() >= NET_UDP_MAX_PENDING_REASSEMBLIES) return nullptr;
+      return &m_reassemblies[key_];
+    }
+
+    void CSampleReceiverMmsg::OnFragment(SReassembly& reassembly_, uint32_t fragment_, const char* data_, size_t size_)
+    {
+      // duplicated or out of range fragment
+      if (fragment_ < reassembly_.next_fragment) return;
+      if ((reassembly_.fragment_count > 0) && (fragment_ >= reassembly_.fragment_count)) return;
+
+      if (fragment_ != reassembly_.next_fragment)
+      {
+        // keep out of order fragments until the gap is closed
+        if (reassembly_.pending_fragments.count(fragment_) != 0) return;
+        if (reassembly_.message.size() + reassembly_.pending_size + size_ > m_max_message_size) return;
+        std::vector<char> fragment = m_reassembly_buffer_pool.Acquire(size_);
+        fragment.assign(data_, data_ + size_);
+        reassembly_.pending_size += size_;
+        reassembly_.pending_fragments.emplace(fragment_, std::move(fragment));
+        return;
+      }
+
+      if (data_ != nullptr)
+      {
+        reassembly_.message.insert(reassembly_.message.end(), data_, data_ + size_);
+        ++reassembly_.next_fragment;
+      }
+
+      // append the pending fragments that are in order now
+      auto iter = reassembly_.pending_fragments.find(reassembly_.next_fragment);
+      while (iter != reassembly_.pending_fragments.end())
+      {
+        reassembly_.message.insert(reassembly_.message.end(), iter->second.begin(), iter->second.end());
+        reassembly_.pending_size -= iter->second.size();
+        m_reassembly_buffer_pool.Release(iter->second);
+        reassembly_.pending_fragments.erase(iter);
+        ++reassembly_.next_fragment;
+        iter = reassembly_.pending_fragments.find(reassembly_.next_fragment);
+      }
+    }
+
+    void CSampleReceiverMmsg::ApplyMessage(const char* message_, size_t message_size_)
+    {
+      // read sample_name size
+      unsigned short sample_name_size = 0;
+      if (message_size_ < sizeof(sample_name_size)) return;
+      memcpy(&sample_name_size, message_, sizeof(sample_name_size));
+
+      // calculate payload offset
+      const size_t payload_offset = sizeof(sample_name_size) + sample_name_size;
+
+      // check for damaged data
+      if ((sample_name_size == 0) || (payload_offset > message_size_))
+      {
+        std::cerr << "CSampleReceiverMmsg: Received damaged data. Wrong sample name size." << '\n';
+        return;
+      }
+
+      // read sample_name (without the trailing '\0')
+      const std::string sample_name(message_ + sizeof(sample_name_size), sample_name_size - 1);
+
+      // apply the sample payload (if we are interested in it)
+      ProcessSample(sample_name, message_ + payload_offset, message_size_ - payload_offset);
+    }
+
+    void CSampleReceiverMmsg::RemoveExpiredReassemblies()
+    {
+      const auto now     = std::chrono::steady_clock::now();
+      const auto timeout = std::chrono::milliseconds(NET_UDP_REASSEMBLY_TIMEOUT);
+      if (now - m_last_reassembly_cleanup < timeout) return;
+      m_last_reassembly_cleanup = now;
+
+      // drop messages with lost fragments
+      for (auto iter = m_reassemblies.begin(); iter != m_reassemblies.end();)
+      {
+        if (now - iter->second.last_update > timeout)
+        {
+          ReleaseReassembly(iter->second);
+          iter = m_reassemblies.erase(iter);
+        }
+        else
+        {
+          ++iter;
+        }
+      }
+    }
+
+    void CSampleReceiverMmsg::ReleaseReassembly(SReassembly& reassembly_)
+    {
+      m_reassembly_buffer_pool.Release(reassembly_.message);
+      for (auto& pending_fragment : reassembly_.pending_fragments)
+      {
+        m_reassembly_buffer_pool.Release(pending_fragment.second);
+      }
+      reassembly_.pending_fragments.clear();
+      reassembly_.pending_size = 0;
+    }
+  }
+}
@@ -0,0 +1,100 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  UDP sample receiver receiving datagram batches with recvmmsg (linux only)
+**/
+
+#pragma once
+
+#include "io/udp/ecal_udp_sample_receiver_base.h"
+#include "util/buffer_pool.h"
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace eCAL
+{
+  namespace UDP
+  {
+    class CSampleReceiverMmsg : public CSampleReceiverBase
+    {
+    public:
+      CSampleReceiverMmsg(const SReceiverAttr& attr_, const HasSampleCallbackT& has_sample_callback_, const ApplySampleCallbackT& apply_sample_callback_, const FecResultCallbackT& fec_result_callback_);
+      ~CSampleReceiverMmsg() override;
+
+      bool AddMultiCastGroup(const char* ipaddr_) override;
+      bool RemMultiCastGroup(const char* ipaddr_) override;
+
+      // prevent copying and moving
+      CSampleReceiverMmsg(const CSampleReceiverMmsg&) = delete;
+      CSampleReceiverMmsg& operator=(const CSampleReceiverMmsg&) = delete;
+      CSampleReceiverMmsg(CSampleReceiverMmsg&&) = delete;
+      CSampleReceiverMmsg& operator=(CSampleReceiverMmsg&&) = delete;
+
+    private:
+      using ReassemblyKeyT = std::tuple<uint32_t /*sender address*/, uint16_t /*sender port*/, int32_t /*message id*/>;
+
+      // fragments of one message, in order fragments are appended directly
+      struct SReassembly
+      {
+        uint32_t                                 fragment_count = 0;
+        uint32_t                                 message_size   = 0;
+        uint32_t                                 next_fragment  = 0;
+        std::vector<char>                        message;
+        std::map<uint32_t, std::vector<char>>    pending_fragments;
+        size_t                                   pending_size   = 0;
+        std::chrono::steady_clock::time_point    last_update;
+      };
+
+      void InitializeSocket(const SReceiverAttr& attr_);
+      bool SetMultiCastGroupOption(const char* ipaddr_, bool join_);
+
+      void ReceiveThread();
+      void OnDatagram(const sockaddr_in& sender_address_, const char* datagram_, size_t datagram_size_);
+      SReassembly* GetReassembly(const ReassemblyKeyT& key_);
+      void OnFragment(SReassembly& reassembly_, uint32_t fragment_, const char* data_, size_t size_);
+      void ApplyMessage(const char* message_, size_t message_size_);
+      void RemoveExpiredReassemblies();
+      void ReleaseReassembly(SReassembly& reassembly_);
+
+      int                                        m_socket = -1;
+      std::atomic<bool>                          m_stop{ false };
+      std::thread                                m_receive_thread;
+
+      std::vector<char>                          m_receive_buffer;
+      std::vector<iovec>                         m_iovecs;
+      std::vector<sockaddr_in>                   m_sender_addresses;
+      std::vector<mmsghdr>                       m_messages;
+
+      std::map<ReassemblyKeyT, SReassembly>      m_reassemblies;
+      Util::CBufferPool<>                        m_reassembly_buffer_pool;   // message and fragment buffers, reused across messages
+      std::chrono::steady_clock::time_point      m_last_reassembly_cleanup;
+    };
+  }
+}
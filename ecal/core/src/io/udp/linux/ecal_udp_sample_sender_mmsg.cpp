@@ -0,0 +1,216 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  UDP sample sender sending all datagrams of a message with sendmmsg (linux only)
+**/
+
+#include "ecal_udp_sample_sender_mmsg.h"
+
+#include <arpa/inet.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+namespace
+{
+  // append the iovecs describing the range [offset_, offset_ + len_) of the message parts
+  void AppendMessageRange(const std::array<iovec, 3>& message_parts_, size_t offset_, size_t len_, std::vector<iovec>& iovecs_)
+  {
+    size_t part_begin = 0;
+    for (const auto& part : message_parts_)
+    {
+      const size_t part_end = part_begin + part.iov_len;
+      if ((len_ > 0) && (offset_ < part_end))
+      {
+        const size_t begin_in_part = offset_ - part_begin;
+        const size_t range_len     = std::min(len_, part.iov_len - begin_in_part);
+        iovecs_.push_back({ static_cast<char*>(part.iov_base) + begin_in_part, range_len });
+        offset_ += range_len;
+        len_    -= range_len;
+      }
+      part_begin = part_end;
+    }
+  }
+}
+
+namespace eCAL
+{
+  namespace UDP
+  {
+    CSampleSenderMmsg::CSampleSenderMmsg(const SSenderAttr& attr_)
+    {
+      m_destination_address.sin_family      = AF_INET;
+      m_destination_address.sin_port        = htons(static_cast<uint16_t>(attr_.port));
+      m_destination_address.sin_addr.s_addr = inet_addr(attr_.address.c_str());
+
+      // start with a random message id, so that receivers can distinguish the messages of restarted senders
+      std::random_device random_device;
+      m_message_id = random_device();
+
+      // create the socket and set all socket options
+      InitializeSocket(attr_);
+    }
+
+    CSampleSenderMmsg::~CSampleSenderMmsg()
+    {
+      if (m_socket >= 0)
+      {
+        if (close(m_socket) != 0)
+        {
+          std::cerr << "CSampleSenderMmsg: Error closing socket: " << strerror(errno) << '\n';
+        }
+      }
+    }
+
+    void CSampleSenderMmsg::InitializeSocket(const SSenderAttr& attr_)
+    {
+      // create socket
+      m_socket = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, IPPROTO_UDP);
+      if (m_socket < 0)
+      {
+        std::cerr << "CSampleSenderMmsg: Error opening socket: " << strerror(errno) << '\n';
+        return;
+      }
+
+      const int ttl = attr_.ttl;
+      if (attr_.broadcast)
+      {
+        // set unicast packet TTL
+        if (setsockopt(m_socket, IPPROTO_IP, IP_TTL, &ttl, sizeof(ttl)) != 0)
+          std::cerr << "CSampleSenderMmsg: Setting TTL failed: " << strerror(errno) << '\n';
+
+        const int broadcast = 1;
+        if (setsockopt(m_socket, SOL_SOCKET, SO_BROADCAST, &broadcast, sizeof(broadcast)) != 0)
+          std::cerr << "CSampleSenderMmsg: Setting broadcast mode failed: " << strerror(errno) << '\n';
+      }
+      else
+      {
+        // set multicast packet TTL
+        if (setsockopt(m_socket, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl)) != 0)
+          std::cerr << "CSampleSenderMmsg: Setting TTL failed: " << strerror(errno) << '\n';
+
+        // set loopback option
+        const int loopback = attr_.loopback ? 1 : 0;
+        if (setsockopt(m_socket, IPPROTO_IP, IP_MULTICAST_LOOP, &loopback, sizeof(loopback)) != 0)
+          std::cerr << "CSampleSenderMmsg: Error setting loopback option: " << strerror(errno) << '\n';
+      }
+
+      // set send buffer size, a whole fragmented message is handed over to the kernel at once
+      if (attr_.sndbuf > 0)
+      {
+        const int sndbuf = attr_.sndbuf;
+        if (setsockopt(m_socket, SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf)) != 0)
+          std::cerr << "CSampleSenderMmsg: Unable to set send buffer size: " << strerror(errno) << '\n';
+      }
+    }
+
+    size_t CSampleSenderMmsg::Send(const std::string& sample_name_, const std::vector<char>& serialized_sample_)
+    {
+      if (m_socket < 0) return 0;
+
+      // ------------------------------------------------
+      // message layout (identical to CSampleSender)
+      //
+      //  2 Bytes sample name size (unsigned short)
+      // s1 Bytes sample name
+      // s2 Bytes serialized sample
+      // ------------------------------------------------
+      unsigned short s1 = static_cast<unsigned short>(sample_name_.size()) + 1 /*'\0'*/;
+      const size_t   s2 = serialized_sample_.size();
+      const std::array<iovec, 3> message_parts{ {
+        { &s1, 2 },
+        { const_cast<char*>(sample_name_.c_str()), s1 },
+        { const_cast<char*>(serialized_sample_.data()), s2 }
+      } };
+      const size_t message_size = 2 + s1 + s2;
+
+      // split the message into datagrams
+      const int32_t  message_id     = static_cast<int32_t>(m_message_id++);
+      const size_t   fragment_count = (message_size + Datagram::max_fragment_payload_size - 1) / Datagram::max_fragment_payload_size;
+      const bool     fragmented     = fragment_count > 1;
+      const size_t   datagram_count = fragmented ? fragment_count + 1 : 1;
+
+      m_headers.clear();
+      m_headers.reserve(datagram_count);
+      m_iovecs.clear();
+      m_iovecs.reserve(datagram_count * (1 + message_parts.size()));
+      m_datagram_iovecs.clear();
+
+      if (!fragmented)
+      {
+        m_headers.push_back(Datagram::CreateHeader(Datagram::eMessageType::non_fragmented_message, message_id, 1, static_cast<uint32_t>(message_size)));
+        m_iovecs.push_back({ &m_headers.back(), sizeof(Datagram::SHeaderV5) });
+        AppendMessageRange(message_parts, 0, message_size, m_iovecs);
+        m_datagram_iovecs.emplace_back(0, m_iovecs.size());
+      }
+      else
+      {
+        m_headers.push_back(Datagram::CreateHeader(Datagram::eMessageType::fragmented_message_info, message_id, static_cast<uint32_t>(fragment_count), static_cast<uint32_t>(message_size)));
+        m_iovecs.push_back({ &m_headers.back(), sizeof(Datagram::SHeaderV5) });
+        m_datagram_iovecs.emplace_back(0, 1);
+
+        for (size_t fragment = 0; fragment < fragment_count; ++fragment)
+        {
+          const size_t offset       = fragment * Datagram::max_fragment_payload_size;
+          const size_t fragment_len = std::min(Datagram::max_fragment_payload_size, message_size - offset);
+          const size_t first_iovec  = m_iovecs.size();
+
+          m_headers.push_back(Datagram::CreateHeader(Datagram::eMessageType::fragment, message_id, static_cast<uint32_t>(fragment), static_cast<uint32_t>(fragment_len)));
+          m_iovecs.push_back({ &m_headers.back(), sizeof(Datagram::SHeaderV5) });
+          AppendMessageRange(message_parts, offset, fragment_len, m_iovecs);
+          m_datagram_iovecs.emplace_back(first_iovec, m_iovecs.size() - first_iovec);
+        }
+      }
+
+      m_messages.resize(datagram_count);
+      for (size_t datagram = 0; datagram < datagram_count; ++datagram)
+      {
+        msghdr& msg_hdr     = m_messages[datagram].msg_hdr;
+        msg_hdr             = msghdr{};
+        msg_hdr.msg_name    = &m_destination_address;
+        msg_hdr.msg_namelen = sizeof(m_destination_address);
+        msg_hdr.msg_iov     = &m_iovecs[m_datagram_iovecs[datagram].first];
+        msg_hdr.msg_iovlen  = m_datagram_iovecs[datagram].second;
+        m_messages[datagram].msg_len = 0;
+      }
+
+      // hand over all datagrams, sendmmsg may send less datagrams than requested
+      size_t datagrams_sent = 0;
+      while (datagrams_sent < datagram_count)
+      {
+        const int sent = sendmmsg(m_socket, &m_messages[datagrams_sent], static_cast<unsigned int>(datagram_count - datagrams_sent), 0);
+        if (sent < 0)
+        {
+          if (errno == EINTR) continue;
+          std::cout << "CSampleSenderMmsg::Send failed with: \'" << strerror(errno) << "\'" << '\n';
+          return 0;
+        }
+        datagrams_sent += static_cast<size_t>(sent);
+      }
+
+      return message_size;
+    }
+  }
+}
@@ -0,0 +1,70 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  UDP sample sender sending all datagrams of a message with sendmmsg (linux only)
+**/
+
+#pragma once
+
+#include "io/udp/ecal_udp_sender_attr.h"
+#include "io/udp/linux/ecal_udp_datagram_v5.h"
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace eCAL
+{
+  namespace UDP
+  {
+    class CSampleSenderMmsg
+    {
+    public:
+      explicit CSampleSenderMmsg(const SSenderAttr& attr_);
+      ~CSampleSenderMmsg();
+
+      size_t Send(const std::string& sample_name_, const std::vector<char>& serialized_sample_);
+
+      // prevent copying and moving
+      CSampleSenderMmsg(const CSampleSenderMmsg&) = delete;
+      CSampleSenderMmsg& operator=(const CSampleSenderMmsg&) = delete;
+      CSampleSenderMmsg(CSampleSenderMmsg&&) = delete;
+      CSampleSenderMmsg& operator=(CSampleSenderMmsg&&) = delete;
+
+    private:
+      void InitializeSocket(const SSenderAttr& attr_);
+
+      int                              m_socket = -1;
+      sockaddr_in                      m_destination_address{};
+      uint32_t                         m_message_id = 0;
+
+      // reused for every message to avoid allocations on the send path
+      std::vector<Datagram::SHeaderV5> m_headers;
+      std::vector<iovec>               m_iovecs;
+      std::vector<std::pair<size_t, size_t>> m_datagram_iovecs; // first iovec index, iovec count
+      std::vector<mmsghdr>             m_messages;
+    };
+  }
+}
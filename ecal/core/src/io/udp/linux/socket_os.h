@@ -84,5 +84,20 @@ namespace IO
 
       return(true);
     }
+
+    inline static bool set_socket_mcast_all_option(int socket, bool enable)
+    {
+      // disabled: only datagrams of the multicast groups joined by this socket are received,
+      // enabled (system default): datagrams of all multicast groups joined on the host are received
+      const int mcast_all = enable ? 1 : 0;
+      int rc = setsockopt(socket, IPPROTO_IP, IP_MULTICAST_ALL, &mcast_all, sizeof(mcast_all));
+      if (rc != 0)
+      {
+        std::cerr << "setsockopt failed. Unable to set multicast all option: " << strerror(errno) << std::endl;
+        return(false);
+      }
+
+      return(true);
+    }
   }
 }
@@ -60,6 +60,11 @@ namespace eCAL
     m_monitoring_impl->GetMonitoring(monitoring_, entities_);
   }
 
+  void CMonitoring::GetMonitoringChanges(eCAL::Monitoring::SMonitoringChanges& changes_, uint64_t generation_, unsigned int entities_)
+  {
+    m_monitoring_impl->GetMonitoringChanges(changes_, generation_, entities_);
+  }
+
   namespace Monitoring
   {
     ////////////////////////////////////////////////////////
@@ -87,5 +92,16 @@ namespace eCAL
       }
       return false;
     }
+
+    bool GetMonitoringChanges(SMonitoringChanges& changes_, uint64_t generation_, unsigned int entities_)
+    {
+      auto monitoring = g_monitoring();
+      if (monitoring)
+      {
+        monitoring->GetMonitoringChanges(changes_, generation_, entities_);
+        return true;
+      }
+      return false;
+    }
   }
 }
@@ -25,6 +25,7 @@
 
 #include <ecal/types/monitoring.h>
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -45,6 +46,7 @@ namespace eCAL
 
     void GetMonitoring(std::string& monitoring_, unsigned int entities_ = Monitoring::Entity::All);
     void GetMonitoring(eCAL::Monitoring::SMonitoring& monitoring_, unsigned int entities_ = Monitoring::Entity::All);
+    void GetMonitoringChanges(eCAL::Monitoring::SMonitoringChanges& changes_, uint64_t generation_, unsigned int entities_ = Monitoring::Entity::All);
 
   protected:
     std::unique_ptr<CMonitoringImpl> m_monitoring_impl;
@@ -26,13 +26,11 @@
 #include <ecal/types/monitoring.h>
 
 #include "ecal_def.h"
+#include "ecal_monitoring_store.h"
 
 #include "serialization/ecal_serialize_sample_registration.h"
 
-#include <memory>
-#include <map>
-#include <mutex>
-#include <set>
+#include <cstdint>
 #include <string>
 
 namespace eCAL
@@ -51,86 +49,14 @@ namespace eCAL
 
     void GetMonitoring(std::string& monitoring_, unsigned int entities_);
     void GetMonitoring(Monitoring::SMonitoring& monitoring_, unsigned int entities_);
+    void GetMonitoringChanges(Monitoring::SMonitoringChanges& changes_, uint64_t generation_, unsigned int entities_);
 
   protected:
     bool ApplySample(const Registration::Sample& ecal_sample_, eTLayerType /*layer_*/);
 
-    bool RegisterProcess(const Registration::Sample& sample_);
-    bool UnregisterProcess(const Registration::Sample& sample_);
-
-    bool RegisterServer(const Registration::Sample& sample_);
-    bool UnregisterServer(const Registration::Sample& sample_);
-
-    bool RegisterClient(const Registration::Sample& sample_);
-    bool UnregisterClient(const Registration::Sample& sample_);
-
-    enum ePubSub
-    {
-      publisher = 1,
-      subscriber = 2,
-    };
-
-    bool RegisterTopic(const Registration::Sample& sample_, enum ePubSub pubsub_type_);
-    bool UnregisterTopic(const Registration::Sample& sample_, enum ePubSub pubsub_type_);
-
-    using TopicMapT = std::map<EntityIdT, Monitoring::STopic>;
-    struct STopicMap
-    {
-      explicit STopicMap() :
-        map(std::make_unique<TopicMapT>())
-      {
-      };
-      std::mutex                  sync;
-      std::unique_ptr<TopicMapT>  map;
-    };
-
-    using ProcessMapT = std::map<EntityIdT, Monitoring::SProcess>;
-    struct SProcessMap
-    {
-      explicit SProcessMap() :
-        map(std::make_unique<ProcessMapT>())
-      {
-      };
-      std::mutex                    sync;
-      std::unique_ptr<ProcessMapT>  map;
-    };
-
-    using ServerMapT = std::map<EntityIdT, Monitoring::SServer>;
-    struct SServerMap
-    {
-      explicit SServerMap() :
-        map(std::make_unique<ServerMapT>())
-      {
-      };
-      std::mutex                      sync;
-      std::unique_ptr<ServerMapT>     map;
-    };
-
-    using ClientMapT = std::map<EntityIdT, Monitoring::SClient>;
-    struct SClientMap
-    {
-      explicit SClientMap() :
-        map(std::make_unique<ClientMapT>())
-      {
-      };
-      std::mutex                      sync;
-      std::unique_ptr<ClientMapT>     map;
-    };
-
-    STopicMap* GetMap(enum ePubSub pubsub_type_);
-
-    void MonitorProcs(Monitoring::SMonitoring& monitoring_);
-    void MonitorServer(Monitoring::SMonitoring& monitoring_);
-    void MonitorClients(Monitoring::SMonitoring& monitoring_);
-    void MonitorTopics(STopicMap& map_, Monitoring::SMonitoring& monitoring_, const std::string& direction_);
-
     bool                                         m_init;
 
-    // database
-    SProcessMap                               m_process_map;
-    STopicMap                                 m_publisher_map;
-    STopicMap                                 m_subscriber_map;
-    SServerMap                                m_server_map;
-    SClientMap                                m_client_map;
+    // database (sharded by entity type and id)
+    Monitoring::CMonitoringStore                 m_store;
   };
 }
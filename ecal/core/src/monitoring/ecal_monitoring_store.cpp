@@ -0,0 +1,448 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Monitoring entity store (sharded, generation tracked)
+**/
+
+#include "ecal_monitoring_store.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  using namespace eCAL::Monitoring;
+
+  // epoch of a new store instance (never 0), randomly seeded so that even generations of
+  // a former process do not match
+  uint64_t NextEpoch()
+  {
+    static std::atomic<uint64_t> last_epoch(std::random_device{}());
+    const uint64_t epoch_mask = (uint64_t(1) << (64 - CMonitoringStore::generation_bits)) - 1;
+
+    uint64_t epoch(0);
+    while (epoch == 0) epoch = ++last_epoch & epoch_mask;
+    return epoch;
+  }
+
+  template <typename T>
+  bool IsEqual(const T& lhs_, const T& rhs_)
+  {
+    return lhs_ == rhs_;
+  }
+
+  bool IsEqual(const STransportLayer& lhs_, const STransportLayer& rhs_)
+  {
+    return (lhs_.type == rhs_.type) && (lhs_.version == rhs_.version) && (lhs_.active == rhs_.active);
+  }
+
+  bool IsEqual(const SLatencyHistogram& lhs_, const SLatencyHistogram& rhs_)
+  {
+    return (lhs_.bucket_limits_us == rhs_.bucket_limits_us) && (lhs_.bucket_counts == rhs_.bucket_counts);
+  }
+
+  bool IsEqual(const SAcknowledgeStatistics& lhs_, const SAcknowledgeStatistics& rhs_)
+  {
+    return (lhs_.process_id == rhs_.process_id)
+      && (lhs_.acknowledge_count == rhs_.acknowledge_count)
+      && (lhs_.timeout_count == rhs_.timeout_count)
+      && IsEqual(lhs_.latency, rhs_.latency);
+  }
+
+  bool IsEqual(const SCallbackStatistics& lhs_, const SCallbackStatistics& rhs_)
+  {
+    return (lhs_.queue_size == rhs_.queue_size)
+      && (lhs_.queue_depth == rhs_.queue_depth)
+      && (lhs_.executed_count == rhs_.executed_count)
+      && (lhs_.drop_count == rhs_.drop_count)
+      && IsEqual(lhs_.latency, rhs_.latency);
+  }
+
+  bool IsEqual(const SLatencyStatistics& lhs_, const SLatencyStatistics& rhs_)
+  {
+    return (lhs_.publisher_id == rhs_.publisher_id)
+      && (lhs_.layer == rhs_.layer)
+      && IsEqual(lhs_.delivery_latency, rhs_.delivery_latency)
+      && IsEqual(lhs_.callback_latency, rhs_.callback_latency);
+  }
+
+  bool IsEqual(const SMethod& lhs_, const SMethod& rhs_)
+  {
+    return (lhs_.method_name == rhs_.method_name)
+      && (lhs_.request_datatype_information == rhs_.request_datatype_information)
+      && (lhs_.response_datatype_information == rhs_.response_datatype_information)
+      && (lhs_.call_count == rhs_.call_count);
+  }
+
+  template <typename T>
+  bool IsEqual(const std::vector<T>& lhs_, const std::vector<T>& rhs_)
+  {
+    return (lhs_.size() == rhs_.size())
+      && std::equal(lhs_.begin(), lhs_.end(), rhs_.begin(), [](const T& lhs, const T& rhs) { return IsEqual(lhs, rhs); });
+  }
+
+  // assigns value_ and flags the entity as changed if it differs from the current content
+  template <typename T>
+  void Assign(T& target_, T value_, bool& changed_)
+  {
+    if (IsEqual(target_, value_)) return;
+    target_  = std::move(value_);
+    changed_ = true;
+  }
+
+  void Assign(std::string& target_, const std::string& value_, bool& changed_)
+  {
+    if (target_ == value_) return;
+    target_  = value_;
+    changed_ = true;
+  }
+
+  void Assign(eCAL::SDataTypeInformation& target_, const eCAL::SDataTypeInformation& value_, bool& changed_)
+  {
+    if (target_ == value_) return;
+    target_  = value_;
+    changed_ = true;
+  }
+
+  SLatencyHistogram ToHistogram(const eCAL::Registration::LatencyHistogram& histogram_)
+  {
+    SLatencyHistogram histogram;
+    histogram.bucket_limits_us = histogram_.bucket_limits_us;
+    histogram.bucket_counts    = histogram_.bucket_counts;
+    return histogram;
+  }
+}
+
+namespace eCAL
+{
+  namespace Monitoring
+  {
+    CMonitoringStore::CMonitoringStore() :
+      m_epoch(NextEpoch()),
+      m_generation(0),
+      m_processes(m_generation),
+      m_publishers(m_generation),
+      m_subscribers(m_generation),
+      m_servers(m_generation),
+      m_clients(m_generation)
+    {
+    }
+
+    bool CMonitoringStore::ApplySample(const Registration::Sample& sample_)
+    {
+      const EntityIdT entity_id = sample_.identifier.entity_id;
+      switch (sample_.cmd_type)
+      {
+      case bct_none:
+      case bct_set_sample:
+        break;
+      case bct_reg_process:
+        RegisterProcess(sample_);
+        break;
+      case bct_unreg_process:
+        m_processes.Remove(entity_id);
+        break;
+      case bct_reg_service:
+        RegisterServer(sample_);
+        break;
+      case bct_unreg_service:
+        m_servers.Remove(entity_id);
+        break;
+      case bct_reg_client:
+        RegisterClient(sample_);
+        break;
+      case bct_unreg_client:
+        m_clients.Remove(entity_id);
+        break;
+      case bct_reg_publisher:
+        RegisterTopic(sample_, m_publishers, "publisher");
+        break;
+      case bct_unreg_publisher:
+        m_publishers.Remove(entity_id);
+        break;
+      case bct_reg_subscriber:
+        RegisterTopic(sample_, m_subscribers, "subscriber");
+        break;
+      case bct_unreg_subscriber:
+        m_subscribers.Remove(entity_id);
+        break;
+      default:
+        return false;
+      }
+      return true;
+    }
+
+    void CMonitoringStore::RegisterProcess(const Registration::Sample& sample_)
+    {
+      m_processes.Update(sample_.identifier.entity_id, [&sample_](SProcess& process_)
+        {
+          const auto& sample_process = sample_.process;
+          bool changed(false);
+
+          // the registration clock is a heart beat, not a change
+          process_.registration_clock++;
+
+          Assign(process_.host_name,             sample_.identifier.host_name,                               changed);
+          Assign(process_.shm_transport_domain,  sample_process.shm_transport_domain,                        changed);
+          Assign(process_.process_name,          sample_process.process_name,                                changed);
+          Assign(process_.unit_name,             sample_process.unit_name,                                   changed);
+          Assign(process_.process_id,            sample_.identifier.process_id,                              changed);
+          Assign(process_.process_parameter,     sample_process.process_parameter,                           changed);
+          Assign(process_.state_severity,        static_cast<int32_t>(sample_process.state.severity),        changed);
+          Assign(process_.state_severity_level,  static_cast<int32_t>(sample_process.state.severity_level),  changed);
+          Assign(process_.state_info,            sample_process.state.info,                                  changed);
+          Assign(process_.time_sync_state,       static_cast<int32_t>(sample_process.time_sync_state),       changed);
+          Assign(process_.time_sync_module_name, sample_process.time_sync_module_name,                       changed);
+          Assign(process_.component_init_state,  sample_process.component_init_state,                        changed);
+          Assign(process_.component_init_info,   sample_process.component_init_info,                         changed);
+          Assign(process_.ecal_runtime_version,  sample_process.ecal_runtime_version,                        changed);
+          Assign(process_.config_file_path,      sample_process.config_file_path,                            changed);
+          return changed;
+        });
+    }
+
+    void CMonitoringStore::RegisterTopic(const Registration::Sample& sample_, CEntityShards<STopic>& topics_, const char* direction_)
+    {
+      topics_.Update(sample_.identifier.entity_id, [&sample_, direction_](STopic& topic_)
+        {
+          const auto& sample_topic = sample_.topic;
+          bool changed(false);
+
+          // the registration clock is a heart beat, not a change
+          topic_.registration_clock++;
+
+          Assign(topic_.host_name,             sample_.identifier.host_name,       changed);
+          Assign(topic_.shm_transport_domain,  sample_topic.shm_transport_domain,  changed);
+          Assign(topic_.process_id,            sample_.identifier.process_id,      changed);
+          Assign(topic_.process_name,          sample_topic.process_name,          changed);
+          Assign(topic_.unit_name,             sample_topic.unit_name,             changed);
+          Assign(topic_.topic_name,            sample_topic.topic_name,            changed);
+          Assign(topic_.direction,             std::string(direction_),            changed);
+          Assign(topic_.topic_id,              sample_.identifier.entity_id,       changed);
+          Assign(topic_.datatype_information,  sample_topic.datatype_information,  changed);
+
+          // layer
+          bool topic_tlayer_ecal_udp(false);
+          bool topic_tlayer_ecal_shm(false);
+          bool topic_tlayer_ecal_tcp(false);
+          for (const auto& layer : sample_topic.transport_layer)
+          {
+            topic_tlayer_ecal_udp |= (layer.type == tl_ecal_udp) && layer.active;
+            topic_tlayer_ecal_shm |= (layer.type == tl_ecal_shm) && layer.active;
+            topic_tlayer_ecal_tcp |= (layer.type == tl_ecal_tcp) && layer.active;
+          }
+          std::vector<STransportLayer> transport_layer(3);
+          transport_layer[0].type   = eTransportLayerType::udp_mc;
+          transport_layer[0].active = topic_tlayer_ecal_udp;
+          transport_layer[1].type   = eTransportLayerType::shm;
+          transport_layer[1].active = topic_tlayer_ecal_shm;
+          transport_layer[2].type   = eTransportLayerType::tcp;
+          transport_layer[2].active = topic_tlayer_ecal_tcp;
+          Assign(topic_.transport_layer, std::move(transport_layer), changed);
+
+          Assign(topic_.topic_size,            sample_topic.topic_size,            changed);
+          Assign(topic_.connections_local,     sample_topic.connections_local,     changed);
+          Assign(topic_.connections_external,  sample_topic.connections_external,  changed);
+          Assign(topic_.data_id,               sample_topic.data_id,               changed);
+          Assign(topic_.data_clock,            sample_topic.data_clock,            changed);
+          Assign(topic_.message_drops,         sample_topic.message_drops,         changed);
+          Assign(topic_.data_frequency,        sample_topic.data_frequency,        changed);
+
+          // udp forward error correction statistics
+          Assign(topic_.fec_recovered_messages, sample_topic.fec_recovered_messages, changed);
+          Assign(topic_.fec_lost_messages,      sample_topic.fec_lost_messages,      changed);
+
+          // shm acknowledge statistics
+          std::vector<SAcknowledgeStatistics> acknowledge_statistics;
+          acknowledge_statistics.reserve(sample_topic.acknowledge_statistics.size());
+          for (const auto& statistics : sample_topic.acknowledge_statistics)
+          {
+            SAcknowledgeStatistics acknowledge;
+            acknowledge.process_id        = statistics.process_id;
+            acknowledge.acknowledge_count = statistics.acknowledge_count;
+            acknowledge.timeout_count     = statistics.timeout_count;
+            acknowledge.latency           = ToHistogram(statistics.latency);
+            acknowledge_statistics.push_back(std::move(acknowledge));
+          }
+          Assign(topic_.acknowledge_statistics, std::move(acknowledge_statistics), changed);
+
+          // asynchronous receive callback statistics
+          SCallbackStatistics callback_statistics;
+          callback_statistics.queue_size     = sample_topic.callback_statistics.queue_size;
+          callback_statistics.queue_depth    = sample_topic.callback_statistics.queue_depth;
+          callback_statistics.executed_count = sample_topic.callback_statistics.executed_count;
+          callback_statistics.drop_count     = sample_topic.callback_statistics.drop_count;
+          callback_statistics.latency        = ToHistogram(sample_topic.callback_statistics.latency);
+          Assign(topic_.callback_statistics, std::move(callback_statistics), changed);
+
+          // receive latency statistics
+          std::vector<SLatencyStatistics> latency_statistics;
+          latency_statistics.reserve(sample_topic.latency_statistics.size());
+          for (const auto& statistics : sample_topic.latency_statistics)
+          {
+            SLatencyStatistics latency;
+            latency.publisher_id     = statistics.publisher_id;
+            latency.layer            = static_cast<eTransportLayerType>(statistics.layer);
+            latency.delivery_latency = ToHistogram(statistics.delivery_latency);
+            latency.callback_latency = ToHistogram(statistics.callback_latency);
+            latency_statistics.push_back(std::move(latency));
+          }
+          Assign(topic_.latency_statistics, std::move(latency_statistics), changed);
+
+          return changed;
+        });
+    }
+
+    void CMonitoringStore::RegisterServer(const Registration::Sample& sample_)
+    {
+      m_servers.Update(sample_.identifier.entity_id, [&sample_](SServer& server_)
+        {
+          const auto& sample_service = sample_.service;
+          bool changed(false);
+
+          // the registration clock is a heart beat, not a change
+          server_.registration_clock++;
+
+          Assign(server_.host_name,    sample_.identifier.host_name,   changed);
+          Assign(server_.service_name, sample_service.service_name,    changed);
+          Assign(server_.service_id,   sample_.identifier.entity_id,   changed);
+          Assign(server_.process_name, sample_service.process_name,    changed);
+          Assign(server_.unit_name,    sample_service.unit_name,       changed);
+          Assign(server_.process_id,   sample_.identifier.process_id,  changed);
+          Assign(server_.tcp_port_v0,  sample_service.tcp_port_v0,     changed);
+          Assign(server_.tcp_port_v1,  sample_service.tcp_port_v1,     changed);
+
+          std::vector<SMethod> methods;
+          methods.reserve(sample_service.methods.size());
+          for (const auto& sample_service_method : sample_service.methods)
+          {
+            SMethod method;
+            method.method_name                   = sample_service_method.method_name;
+            method.request_datatype_information  = sample_service_method.request_datatype_information;
+            method.response_datatype_information = sample_service_method.response_datatype_information;
+            method.call_count                    = sample_service_method.call_count;
+            methods.push_back(std::move(method));
+          }
+          Assign(server_.methods, std::move(methods), changed);
+
+          return changed;
+        });
+    }
+
+    void CMonitoringStore::RegisterClient(const Registration::Sample& sample_)
+    {
+      m_clients.Update(sample_.identifier.entity_id, [&sample_](SClient& client_)
+        {
+          const auto& sample_client = sample_.client;
+          bool changed(false);
+
+          // the registration clock is a heart beat, not a change
+          client_.registration_clock++;
+
+          Assign(client_.host_name,    sample_.identifier.host_name,   changed);
+          Assign(client_.service_name, sample_client.service_name,     changed);
+          Assign(client_.service_id,   sample_.identifier.entity_id,   changed);
+          Assign(client_.process_name, sample_client.process_name,     changed);
+          Assign(client_.unit_name,    sample_client.unit_name,        changed);
+          Assign(client_.process_id,   sample_.identifier.process_id,  changed);
+
+          std::vector<SMethod> methods;
+          methods.reserve(sample_client.methods.size());
+          for (const auto& sample_client_method : sample_client.methods)
+          {
+            SMethod method;
+            method.method_name                   = sample_client_method.method_name;
+            method.request_datatype_information  = sample_client_method.request_datatype_information;
+            method.response_datatype_information = sample_client_method.response_datatype_information;
+            method.call_count                    = sample_client_method.call_count;
+            methods.push_back(std::move(method));
+          }
+          Assign(client_.methods, std::move(methods), changed);
+
+          return changed;
+        });
+    }
+
+    void CMonitoringStore::GetMonitoring(SMonitoring& monitoring_, unsigned int entities_) const
+    {
+      monitoring_.processes.clear();
+      if ((entities_ & Entity::Process) != 0u)    m_processes.GetEntities(monitoring_.processes);
+
+      monitoring_.publishers.clear();
+      if ((entities_ & Entity::Publisher) != 0u)  m_publishers.GetEntities(monitoring_.publishers);
+
+      monitoring_.subscribers.clear();
+      if ((entities_ & Entity::Subscriber) != 0u) m_subscribers.GetEntities(monitoring_.subscribers);
+
+      monitoring_.servers.clear();
+      if ((entities_ & Entity::Server) != 0u)     m_servers.GetEntities(monitoring_.servers);
+
+      monitoring_.clients.clear();
+      if ((entities_ & Entity::Client) != 0u)     m_clients.GetEntities(monitoring_.clients);
+    }
+
+    void CMonitoringStore::GetMonitoringChanges(SMonitoringChanges& changes_, uint64_t generation_, unsigned int entities_) const
+    {
+      // read before collecting, changes made while collecting are reported (again) by the next call
+      const uint64_t change_count = m_generation;
+      changes_.generation = MakeGeneration(change_count);
+
+      // generation 0, one of another store instance (other epoch) or one this store never handed out request the full state
+      const uint64_t change_count_of_reader = generation_ & generation_mask;
+      const bool known_generation = (generation_ != 0) && ((generation_ >> generation_bits) == m_epoch) && (change_count_of_reader <= change_count);
+      changes_.full_state = !known_generation || !CollectChanges(changes_, change_count_of_reader, entities_);
+      if (!changes_.full_state) return;
+
+      changes_.removed_processes.clear();
+      changes_.removed_publishers.clear();
+      changes_.removed_subscribers.clear();
+      changes_.removed_servers.clear();
+      changes_.removed_clients.clear();
+      GetMonitoring(changes_.monitoring, entities_);
+    }
+
+    bool CMonitoringStore::CollectChanges(SMonitoringChanges& changes_, uint64_t generation_, unsigned int entities_) const
+    {
+      auto& monitoring = changes_.monitoring;
+      monitoring.processes.clear();
+      monitoring.publishers.clear();
+      monitoring.subscribers.clear();
+      monitoring.servers.clear();
+      monitoring.clients.clear();
+      changes_.removed_processes.clear();
+      changes_.removed_publishers.clear();
+      changes_.removed_subscribers.clear();
+      changes_.removed_servers.clear();
+      changes_.removed_clients.clear();
+
+      if (((entities_ & Entity::Process) != 0u)    && !m_processes.GetChanges(generation_, monitoring.processes, changes_.removed_processes))       return false;
+      if (((entities_ & Entity::Publisher) != 0u)  && !m_publishers.GetChanges(generation_, monitoring.publishers, changes_.removed_publishers))    return false;
+      if (((entities_ & Entity::Subscriber) != 0u) && !m_subscribers.GetChanges(generation_, monitoring.subscribers, changes_.removed_subscribers)) return false;
+      if (((entities_ & Entity::Server) != 0u)     && !m_servers.GetChanges(generation_, monitoring.servers, changes_.removed_servers))             return false;
+      if (((entities_ & Entity::Client) != 0u)     && !m_clients.GetChanges(generation_, monitoring.clients, changes_.removed_clients))             return false;
+      return true;
+    }
+  }
+}
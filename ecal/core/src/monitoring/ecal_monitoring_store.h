@@ -0,0 +1,217 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Monitoring entity store (sharded, generation tracked)
+**/
+
+#pragma once
+
+#include <ecal/types/monitoring.h>
+
+#include "serialization/ecal_struct_sample_registration.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace eCAL
+{
+  namespace Monitoring
+  {
+    /**
+     * @brief Monitoring entities of one type, striped into shards by entity id.
+     *
+     * Every shard has its own lock, so registrations of different entities and running
+     * GetMonitoring calls rarely wait for each other. Every change of an entity is stamped
+     * with a generation of the owning store. Removed entities are remembered for a while,
+     * to report them to readers asking for the changes since a generation.
+     */
+    template <typename EntityT>
+    class CEntityShards
+    {
+    public:
+      static constexpr size_t shard_count          = 16;
+      static constexpr size_t removed_history_size = 256;   // removed entities remembered per shard
+
+      explicit CEntityShards(std::atomic<uint64_t>& generation_) : m_generation(generation_) {}
+
+      // update_ modifies the new or existing entity and returns true if its content changed
+      template <typename UpdateT>
+      void Update(EntityIdT entity_id_, const UpdateT& update_)
+      {
+        SShard& shard = m_shards[ShardIndex(entity_id_)];
+        const std::lock_guard<std::mutex> lock(shard.sync);
+
+        auto iter = shard.entities.find(entity_id_);
+        const bool created = (iter == shard.entities.end());
+        if (created)
+        {
+          iter = shard.entities.emplace(entity_id_, SEntry()).first;
+        }
+
+        const bool changed = update_(iter->second.entity);
+        if (created || changed)
+        {
+          iter->second.generation = ++m_generation;
+        }
+      }
+
+      void Remove(EntityIdT entity_id_)
+      {
+        SShard& shard = m_shards[ShardIndex(entity_id_)];
+        const std::lock_guard<std::mutex> lock(shard.sync);
+
+        if (shard.entities.erase(entity_id_) == 0) return;
+
+        shard.removed.emplace_back(++m_generation, entity_id_);
+        if (shard.removed.size() > removed_history_size)
+        {
+          shard.forgotten_generation = shard.removed.front().first;
+          shard.removed.pop_front();
+        }
+      }
+
+      void GetEntities(std::vector<EntityT>& entities_) const
+      {
+        entities_.reserve(entities_.size() + Size());
+        for (const auto& shard : m_shards)
+        {
+          const std::lock_guard<std::mutex> lock(shard.sync);
+          for (const auto& entity : shard.entities)
+          {
+            entities_.push_back(entity.second.entity);
+          }
+        }
+      }
+
+      // returns false if removals after generation_ are no longer remembered
+      bool GetChanges(uint64_t generation_, std::vector<EntityT>& changed_, std::vector<EntityIdT>& removed_) const
+      {
+        for (const auto& shard : m_shards)
+        {
+          const std::lock_guard<std::mutex> lock(shard.sync);
+          if (generation_ < shard.forgotten_generation) return false;
+
+          for (const auto& entity : shard.entities)
+          {
+            if (entity.second.generation > generation_)
+            {
+              changed_.push_back(entity.second.entity);
+            }
+          }
+          for (auto iter = shard.removed.rbegin(); (iter != shard.removed.rend()) && (iter->first > generation_); ++iter)
+          {
+            removed_.push_back(iter->second);
+          }
+        }
+        return true;
+      }
+
+      size_t Size() const
+      {
+        size_t size = 0;
+        for (const auto& shard : m_shards)
+        {
+          const std::lock_guard<std::mutex> lock(shard.sync);
+          size += shard.entities.size();
+        }
+        return size;
+      }
+
+    private:
+      static_assert(shard_count == 16, "ShardIndex takes the upper 4 bits of the hash");
+
+      // entity ids may be small sequential numbers (process ids), so they are mixed before striping
+      static size_t ShardIndex(EntityIdT entity_id_)
+      {
+        return static_cast<size_t>((entity_id_ * 0x9E3779B97F4A7C15ULL) >> 60U);
+      }
+
+      struct SEntry
+      {
+        EntityT  entity;
+        uint64_t generation = 0;    // generation of the last change
+      };
+
+      struct SShard
+      {
+        mutable std::mutex                              sync;
+        std::unordered_map<EntityIdT, SEntry>           entities;
+        std::deque<std::pair<uint64_t, EntityIdT>>      removed;                    // removal generation, entity id (ascending)
+        uint64_t                                        forgotten_generation = 0;   // latest removal that is no longer remembered
+      };
+
+      std::atomic<uint64_t>&               m_generation;
+      std::array<SShard, shard_count>      m_shards;
+    };
+
+    /**
+     * @brief Monitoring entities of all types, fed by registration samples.
+     *
+     * A changing registration clock alone does not count as change of an entity,
+     * so GetMonitoringChanges reports only entities whose content differs.
+     *
+     * The generations handed out to readers carry the epoch of the store instance in their
+     * upper bits, so a generation of another instance (e.g. before eCAL was finalized and
+     * initialized again) is never mistaken for one of this store.
+     */
+    class CMonitoringStore
+    {
+    public:
+      static constexpr unsigned int generation_bits = 40;   // lower bits of a generation count the changes, upper bits hold the epoch
+      static constexpr uint64_t     generation_mask = (uint64_t(1) << generation_bits) - 1;
+
+      CMonitoringStore();
+
+      // returns false for unknown sample types
+      bool ApplySample(const Registration::Sample& sample_);
+
+      void GetMonitoring(SMonitoring& monitoring_, unsigned int entities_) const;
+      void GetMonitoringChanges(SMonitoringChanges& changes_, uint64_t generation_, unsigned int entities_) const;
+
+      uint64_t GetGeneration() const { return MakeGeneration(m_generation); }
+      uint64_t GetChangeCount() const { return m_generation; }
+
+    private:
+      void RegisterProcess(const Registration::Sample& sample_);
+      void RegisterTopic(const Registration::Sample& sample_, CEntityShards<STopic>& topics_, const char* direction_);
+      void RegisterServer(const Registration::Sample& sample_);
+      void RegisterClient(const Registration::Sample& sample_);
+
+      bool CollectChanges(SMonitoringChanges& changes_, uint64_t generation_, unsigned int entities_) const;
+      uint64_t MakeGeneration(uint64_t change_count_) const { return (m_epoch << generation_bits) | (change_count_ & generation_mask); }
+
+      const uint64_t                m_epoch;
+      std::atomic<uint64_t>         m_generation;   // number of changes
+
+      CEntityShards<SProcess>       m_processes;
+      CEntityShards<STopic>         m_publishers;
+      CEntityShards<STopic>         m_subscribers;
+      CEntityShards<SServer>        m_servers;
+      CEntityShards<SClient>        m_clients;
+    };
+  }
+}
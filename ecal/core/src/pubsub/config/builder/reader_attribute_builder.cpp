@@ -34,6 +34,7 @@ namespace eCAL
     attributes.network_enabled            = config_.communication_mode == eCAL::eCommunicationMode::network;
     attributes.loopback                   = registration_config.loopback;
     attributes.drop_out_of_order_messages = subscriber_config.drop_out_of_order_messages;
+    attributes.latency_tracing            = subscriber_config.latency_tracing;
     attributes.registration_timeout_ms    = registration_config.registration_timeout;
     attributes.topic_name                 = topic_name_;
     attributes.host_name                  = Process::GetHostName();
@@ -42,10 +43,13 @@ namespace eCAL
     attributes.process_name               = Process::GetProcessName();
     attributes.unit_name                  = Process::GetUnitName();
 
-    attributes.udp.enable        = subscriber_config.layer.udp.enable;
-    attributes.udp.broadcast     = config_.communication_mode == eCAL::eCommunicationMode::local;
-    attributes.udp.port          = transport_layer_config.udp.port;
-    attributes.udp.receivebuffer = transport_layer_config.udp.receive_buffer;
+    attributes.udp.enable          = subscriber_config.layer.udp.enable;
+    attributes.udp.broadcast       = config_.communication_mode == eCAL::eCommunicationMode::local;
+    attributes.udp.port            = transport_layer_config.udp.port;
+    attributes.udp.receivebuffer   = transport_layer_config.udp.receive_buffer;
+    attributes.udp.mmsg            = transport_layer_config.udp.mmsg_enabled;
+    attributes.udp.receive_threads = transport_layer_config.udp.receive_threads;
+    attributes.udp.max_message_size = transport_layer_config.udp.max_message_size;
     
     switch (config_.communication_mode)
     {
@@ -63,7 +67,16 @@ namespace eCAL
     attributes.tcp.thread_pool_size          = transport_layer_config.tcp.number_executor_reader;
     attributes.tcp.max_reconnection_attempts = transport_layer_config.tcp.max_reconnections;
     
-    attributes.shm.enable = subscriber_config.layer.shm.enable;
+    attributes.shm.enable             = subscriber_config.layer.shm.enable;
+    attributes.shm.max_pinned_samples = subscriber_config.layer.shm.max_pinned_samples;
+
+    attributes.callback.executor         = subscriber_config.callback.executor;
+    attributes.callback.queue_policy     = subscriber_config.callback.queue_policy;
+    attributes.callback.queue_size       = subscriber_config.callback.queue_size;
+    attributes.callback.shared_pool_size = subscriber_config.callback.shared_pool_size;
+
+    attributes.filter.downsampling_factor = subscriber_config.filter.downsampling_factor;
+    attributes.filter.max_frequency       = subscriber_config.filter.max_frequency;
     
     return attributes;
   }
@@ -37,6 +37,9 @@ namespace eCAL
     attributes.layer_priority_local    = publisher_config.layer_priority_local;
     attributes.layer_priority_remote   = publisher_config.layer_priority_remote;
 
+    attributes.history.depth              = publisher_config.history.depth;
+    attributes.history.replay_interval_ms = registration_config.registration_refresh;
+
     attributes.host_name            = Process::GetHostName();
     attributes.shm_transport_domain = Process::GetShmTransportDomain();
     attributes.process_id           = Process::GetProcessID();
@@ -49,12 +52,23 @@ namespace eCAL
     attributes.shm.memfile_buffer_count    = publisher_config.layer.shm.memfile_buffer_count;
     attributes.shm.memfile_min_size_bytes  = publisher_config.layer.shm.memfile_min_size_bytes;
     attributes.shm.memfile_reserve_percent = publisher_config.layer.shm.memfile_reserve_percent;
+    attributes.shm.memfile_ring_slots      = publisher_config.layer.shm.memfile_ring_slots;
+    attributes.shm.futex_notification      = publisher_config.layer.shm.futex_notification;
+    attributes.shm.memfile_huge_pages      = publisher_config.layer.shm.memfile_huge_pages;
+    attributes.shm.memfile_prefault        = publisher_config.layer.shm.memfile_prefault;
+    attributes.shm.memfile_numa_node       = publisher_config.layer.shm.memfile_numa_node;
     attributes.shm.zero_copy_mode          = publisher_config.layer.shm.zero_copy_mode;
 
     attributes.udp.enable        = publisher_config.layer.udp.enable;
     attributes.udp.broadcast     = config_.communication_mode == eCAL::eCommunicationMode::local;
     attributes.udp.port          = transport_tlayer_config.udp.port;
     attributes.udp.send_buffer   = transport_tlayer_config.udp.send_buffer;
+    attributes.udp.mmsg          = transport_tlayer_config.udp.mmsg_enabled;
+    attributes.udp.fec_redundancy_percent = publisher_config.layer.udp.fec_redundancy_percent;
+
+    attributes.udp.batch.enable         = publisher_config.layer.udp.batching;
+    attributes.udp.batch.max_size_bytes = publisher_config.layer.udp.batch_max_size_bytes;
+    attributes.udp.batch.linger_time_us = publisher_config.layer.udp.batch_linger_time_us;
     
     switch (config_.communication_mode)
     {
@@ -73,6 +87,10 @@ namespace eCAL
     
     attributes.tcp.enable           = publisher_config.layer.tcp.enable;
     attributes.tcp.thread_pool_size = transport_tlayer_config.tcp.number_executor_writer;
+
+    attributes.tcp.batch.enable         = publisher_config.layer.tcp.batching;
+    attributes.tcp.batch.max_size_bytes = publisher_config.layer.tcp.batch_max_size_bytes;
+    attributes.tcp.batch.linger_time_us = publisher_config.layer.tcp.batch_linger_time_us;
     
     return attributes;
   }
@@ -0,0 +1,91 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL publisher payload loan
+**/
+
+#include <ecal/pubsub/payload_loan.h>
+
+#include "ecal_publisher_impl.h"
+
+#include <memory>
+#include <utility>
+
+namespace eCAL
+{
+  CPayloadLoan::CPayloadLoan() = default;
+
+  CPayloadLoan::CPayloadLoan(const std::shared_ptr<CPublisherImpl>& publisher_impl_, void* data_, size_t size_) :
+    m_publisher_impl(publisher_impl_),
+    m_data(data_),
+    m_size(size_),
+    m_valid(true)
+  {
+  }
+
+  CPayloadLoan::~CPayloadLoan()
+  {
+    Return();
+  }
+
+  CPayloadLoan::CPayloadLoan(CPayloadLoan&& rhs) noexcept :
+    m_publisher_impl(std::move(rhs.m_publisher_impl)),
+    m_data(rhs.m_data),
+    m_size(rhs.m_size),
+    m_valid(rhs.m_valid)
+  {
+    rhs.m_data  = nullptr;
+    rhs.m_size  = 0;
+    rhs.m_valid = false;
+  }
+
+  CPayloadLoan& CPayloadLoan::operator=(CPayloadLoan&& rhs) noexcept
+  {
+    if (this != &rhs)
+    {
+      // give back our own loan before taking over the other one
+      Return();
+
+      m_publisher_impl = std::move(rhs.m_publisher_impl);
+      m_data           = rhs.m_data;
+      m_size           = rhs.m_size;
+      m_valid          = rhs.m_valid;
+
+      rhs.m_data  = nullptr;
+      rhs.m_size  = 0;
+      rhs.m_valid = false;
+    }
+    return *this;
+  }
+
+  void CPayloadLoan::Return()
+  {
+    if (m_valid)
+    {
+      auto publisher_impl = m_publisher_impl.lock();
+      if (publisher_impl) publisher_impl->ReturnLoan();
+    }
+
+    m_publisher_impl.reset();
+    m_data  = nullptr;
+    m_size  = 0;
+    m_valid = false;
+  }
+}
@@ -99,20 +99,22 @@ namespace eCAL
   {
     auto publisher_impl = m_publisher_impl.lock();
     if (!publisher_impl) return false;
+
+    const long long write_time = (time_ == DEFAULT_TIME_ARGUMENT) ? eCAL::Time::GetMicroSeconds() : time_;
+
     // in an optimization case the
      // publisher can send an empty package
      // or we do not have any subscription at all
      // then the data writer will only do some statistics
-     // for the monitoring layer and return
+     // for the monitoring layer (and keep the history) and return
     if (GetSubscriberCount() == 0)
     {
-      publisher_impl->RefreshSendCounter();
+      publisher_impl->WriteUnsubscribed(payload_, write_time, 0);
       // we return false here to indicate that we did not really send something
       return false;
     }
 
     // send content via data writer layer
-    const long long write_time = (time_ == DEFAULT_TIME_ARGUMENT) ? eCAL::Time::GetMicroSeconds() : time_;
     return publisher_impl->Write(payload_, write_time, 0);
   }
 
@@ -121,6 +123,43 @@ namespace eCAL
     return(Send(payload_.data(), payload_.size(), time_));
   }
 
+  CPayloadLoan CPublisher::Loan(const size_t size_)
+  {
+    auto publisher_impl = m_publisher_impl.lock();
+    if (!publisher_impl) return CPayloadLoan();
+
+    void* loan_data = publisher_impl->Loan(size_);
+    if (loan_data == nullptr) return CPayloadLoan();
+
+    return CPayloadLoan(publisher_impl, loan_data, size_);
+  }
+
+  bool CPublisher::Publish(CPayloadLoan&& loan_, long long time_)
+  {
+    // take over the loan, whatever happens it is given back when leaving
+    CPayloadLoan loan(std::move(loan_));
+    if (!loan.IsValid()) return false;
+
+    auto publisher_impl = m_publisher_impl.lock();
+    if (!publisher_impl || (loan.m_publisher_impl.lock() != publisher_impl)) return false;
+
+    const long long write_time = (time_ == DEFAULT_TIME_ARGUMENT) ? eCAL::Time::GetMicroSeconds() : time_;
+
+    // see Send, nobody is listening (the loan is given back when leaving)
+    if (GetSubscriberCount() == 0)
+    {
+      CBufferPayloadWriter payload{ loan.GetData(), loan.GetSize() };
+      publisher_impl->WriteUnsubscribed(payload, write_time, 0);
+      return false;
+    }
+
+    // the loan is consumed by the publisher
+    loan.m_valid = false;
+
+    // send content via data writer layer
+    return publisher_impl->PublishLoan(write_time, 0);
+  }
+
   size_t CPublisher::GetSubscriberCount() const
   {
     auto publisher_impl = m_publisher_impl.lock();
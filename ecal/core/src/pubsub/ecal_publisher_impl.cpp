@@ -32,6 +32,7 @@
 #include "registration/ecal_registration_provider.h"
 #endif
 
+#include "ecal_def.h"
 #include "ecal_publisher_impl.h"
 #include "ecal_global_accessors.h"
 
@@ -45,6 +46,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <functional>
 #include <limits>
 #include <mutex>
@@ -120,6 +122,16 @@ namespace eCAL
     m_topic_id.topic_id.host_name = m_attributes.host_name;
     m_topic_id.topic_id.process_id = m_attributes.process_id;
 
+    // create the transient local history
+    if (m_attributes.history.depth > 0)
+    {
+      m_history = std::make_unique<Util::CSampleHistory>(m_attributes.history.depth);
+
+      // the history is replayed by an own thread, so neither the registration thread nor the writer waits for a subscriber
+      m_history_replay_thread = std::make_unique<CCallbackThread>([this]() { ReplayPendingHistory(); });
+      m_history_replay_thread->start(std::chrono::milliseconds(m_attributes.history.replay_interval_ms));
+    }
+
     // mark as created
     m_created = true;
   }
@@ -132,6 +144,9 @@ namespace eCAL
 
     if (!m_created) return;
 
+    // stop replaying the history before the layers are gone
+    if (m_history_replay_thread) m_history_replay_thread->stop();
+
     // stop all transport layer
     StopAllLayer();
 
@@ -150,6 +165,15 @@ namespace eCAL
 
   bool CPublisherImpl::Write(CPayloadWriter& payload_, long long time_, long long filter_id_)
   {
+    const auto write_lock = LockWrite();
+
+    // the memory file may be locked by a pending loan
+    if (m_loan.active)
+    {
+      Logging::Log(Logging::log_level_error, m_attributes.topic_name + "::CPublisherImpl::Write - FAILED (payload buffer is loaned)");
+      return false;
+    }
+
     // get payload buffer size (one time, to avoid multiple computations)
     const size_t payload_buf_size(payload_.GetSize());
 
@@ -158,24 +182,142 @@ namespace eCAL
 #if ECAL_CORE_TRANSPORT_SHM
     allow_zero_copy = m_attributes.shm.zero_copy_mode; // zero copy mode activated by user
 #endif
-#if ECAL_CORE_TRANSPORT_UDP
-    // udp is active -> no zero copy
-    allow_zero_copy &= !m_writer_udp;
-#endif
-#if ECAL_CORE_TRANSPORT_TCP
-    // tcp is active -> no zero copy
-    allow_zero_copy &= !m_writer_tcp;
+    allow_zero_copy &= IsShmOnlyLayer();
+    // the history needs a copy of the payload anyway
+    allow_zero_copy &= !m_history;
+
+    // we are the only active layer, and we support zero copy -> we do a zero copy write via payload
+    if (allow_zero_copy)
+    {
+      return WriteLayers(payload_, m_payload_buffer.data(), payload_buf_size, false, time_, filter_id_);
+    }
+
+    // multiple layer are active -> we create a payload copy for all layer
+    m_payload_buffer.resize(payload_buf_size);
+    payload_.WriteFull(m_payload_buffer.data(), m_payload_buffer.size());
+
+    // wrap the buffer into a payload object
+    CBufferPayloadWriter payload_buf(m_payload_buffer.data(), m_payload_buffer.size());
+    return WriteLayers(payload_buf, m_payload_buffer.data(), payload_buf_size, false, time_, filter_id_);
+  }
+
+  void CPublisherImpl::WriteUnsubscribed(CPayloadWriter& payload_, long long time_, long long filter_id_)
+  {
+    const auto write_lock = LockWrite();
+
+    // nobody is listening, we only count the sample
+    RefreshSendCounter();
+
+    // but keep it for late joining subscribers
+    if (m_history)
+    {
+      auto& sample = m_history->Push(payload_.GetSize(), filter_id_, m_clock, time_);
+      if (!sample.payload.empty()) payload_.WriteFull(sample.payload.data(), sample.payload.size());
+    }
+  }
+
+  void* CPublisherImpl::Loan(const size_t len_)
+  {
+    const auto write_lock = LockWrite();
+
+    if (m_loan.active)
+    {
+      Logging::Log(Logging::log_level_error, m_attributes.topic_name + "::CPublisherImpl::Loan - FAILED (payload buffer is loaned already)");
+      return nullptr;
+    }
+
+    void* loan_address(nullptr);
+    bool  loan_shm(false);
+
+#if ECAL_CORE_TRANSPORT_SHM
+    // shm is the only active layer -> hand out the next slot of a ring memory file
+    // (a classic memory file is locked by a thread bound mutex, so it can not be handed out)
+    if (m_writer_shm && IsShmOnlyLayer() && (m_attributes.shm.memfile_ring_slots > 0))
+    {
+      struct SWriterAttr wattr;
+      wattr.len = len_;
+
+      // the memory file has to be resized before its buffer is handed out
+      if (m_writer_shm->PrepareWrite(wattr))
+      {
+        // a new memory file was created, register new to update listening subscribers and rematch
+        Register();
+      }
+
+      loan_address = m_writer_shm->Loan(wattr);
+      loan_shm     = (loan_address != nullptr);
+    }
 #endif
 
-    // create a payload copy for all layer
-    if (!allow_zero_copy)
+    // otherwise we use the pooled payload buffer, it is copied into the layers by the publishing thread
+    if (loan_address == nullptr)
     {
-      m_payload_buffer.resize(payload_buf_size);
-      payload_.WriteFull(m_payload_buffer.data(), m_payload_buffer.size());
+      // keep the buffer address valid for zero sized loans
+      m_payload_buffer.resize(len_ > 0 ? len_ : 1);
+      loan_address = m_payload_buffer.data();
     }
 
+    m_loan.active = true;
+    m_loan.shm    = loan_shm;
+    m_loan.data   = loan_address;
+    m_loan.len    = len_;
+
+    return loan_address;
+  }
+
+  bool CPublisherImpl::PublishLoan(long long time_, long long filter_id_)
+  {
+    const auto write_lock = LockWrite();
+
+    if (!m_loan.active) return false;
+
+    const SLoan loan = m_loan;
+    m_loan = SLoan();
+
+    // the buffer already contains the payload, all layers read from it directly
+    CBufferPayloadWriter payload_buf(loan.data, loan.len);
+    return WriteLayers(payload_buf, loan.data, loan.len, loan.shm, time_, filter_id_);
+  }
+
+  void CPublisherImpl::ReturnLoan()
+  {
+    const auto write_lock = LockWrite();
+
+    if (!m_loan.active) return;
+
+#if ECAL_CORE_TRANSPORT_SHM
+    if (m_loan.shm && m_writer_shm) m_writer_shm->ReturnLoan();
+#endif
+
+    m_loan = SLoan();
+  }
+
+  std::unique_lock<std::mutex> CPublisherImpl::LockWrite()
+  {
+    // without a history there is no replay to synchronize with
+    if (!m_history) return std::unique_lock<std::mutex>(m_write_mutex, std::defer_lock);
+    return std::unique_lock<std::mutex>(m_write_mutex);
+  }
+
+  bool CPublisherImpl::WriteLayers(CPayloadWriter& payload_, const void* buf_, size_t len_, bool shm_loan_, long long time_, long long filter_id_)
+  {
     // prepare counter and internal states
-    const size_t snd_hash = PrepareWrite(filter_id_, payload_buf_size);
+    const size_t snd_hash = PrepareWrite(filter_id_, len_);
+
+    // keep the sample for late joining subscribers
+    if (m_history)
+    {
+      auto& sample = m_history->Push(len_, m_id, m_clock, time_);
+      if (len_ > 0) memcpy(sample.payload.data(), buf_, len_);
+    }
+
+    // apply the sample filters of the subscribers, so we can skip layers and processes nobody reads this sample on
+    SSampleFilterResult* filter_result(nullptr);
+    if (m_filtered_connection_count > 0)
+    {
+      ApplySampleFilters(time_, m_sample_filter_result);
+      filter_result = &m_sample_filter_result;
+    }
 
     // did we write anything
     bool written(false);
@@ -184,7 +326,8 @@ namespace eCAL
     // SHM
     ////////////////////////////////////////////////////////////////////////////
 #if ECAL_CORE_TRANSPORT_SHM
-    if (m_writer_shm)
+    // a loaned memory file has to be committed in any case to release it
+    if (m_writer_shm && ((filter_result == nullptr) || filter_result->shm || shm_loan_))
     {
 #ifndef NDEBUG
       Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::Write::SHM");
@@ -195,35 +338,32 @@ namespace eCAL
       {
         // fill writer data
         struct SWriterAttr wattr;
-        wattr.len = payload_buf_size;
+        wattr.len = len_;
         wattr.id = m_id;
         wattr.clock = m_clock;
         wattr.hash = snd_hash;
         wattr.time = time_;
         wattr.zero_copy = m_attributes.shm.zero_copy_mode;
         wattr.acknowledge_timeout_ms = m_attributes.shm.acknowledge_timeout_ms;
+        if (filter_result != nullptr) wattr.skip_process_ids = &filter_result->shm_skip_process_ids;
 
-        // prepare send
-        if (m_writer_shm->PrepareWrite(wattr))
+        // the payload has been constructed in the memory file already, we only publish it
+        if (shm_loan_)
         {
-          // register new to update listening subscribers and rematch
-          Register();
-          Process::SleepMS(5);
+          shm_sent = m_writer_shm->CommitLoan(wattr);
         }
-
-        // we are the only active layer, and we support zero copy -> we do a zero copy write via payload
-        if (allow_zero_copy)
-        {
-          // write to shm layer (write content into the opened memory file without additional copy)
-          shm_sent = m_writer_shm->Write(payload_, wattr);
-        }
-        // multiple layer are active -> we make a copy and use that one
         else
         {
-          // wrap the buffer into a payload object
-          CBufferPayloadWriter payload_buf(m_payload_buffer.data(), m_payload_buffer.size());
+          // prepare send (memory files grow in place, only a recreated one needs a new registration,
+          // its first sample waits until the subscribers have reattached)
+          if (m_writer_shm->PrepareWrite(wattr))
+          {
+            // register new to update listening subscribers and rematch
+            Register();
+          }
+
           // write to shm layer (write content into the opened memory file without additional copy)
-          shm_sent = m_writer_shm->Write(payload_buf, wattr);
+          shm_sent = m_writer_shm->Write(payload_, wattr);
         }
 
         m_layers.shm.active = true;
@@ -247,7 +387,7 @@ namespace eCAL
     // UDP (MC)
     ////////////////////////////////////////////////////////////////////////////
 #if ECAL_CORE_TRANSPORT_UDP
-    if (m_writer_udp)
+    if (m_writer_udp && ((filter_result == nullptr) || filter_result->udp))
     {
 #ifndef NDEBUG
       Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::Write::udp");
@@ -258,7 +398,7 @@ namespace eCAL
       {
         // fill writer data
         struct SWriterAttr wattr;
-        wattr.len = payload_buf_size;
+        wattr.len = len_;
         wattr.id = m_id;
         wattr.clock = m_clock;
         wattr.hash = snd_hash;
@@ -270,11 +410,10 @@ namespace eCAL
         {
           // register new to update listening subscribers and rematch
           Register();
-          Process::SleepMS(5);
         }
 
         // write to udp multicast layer
-        udp_sent = m_writer_udp->Write(m_payload_buffer.data(), wattr);
+        udp_sent = m_writer_udp->Write(buf_, wattr);
         m_layers.udp.active = true;
       }
       written |= udp_sent;
@@ -296,7 +435,7 @@ namespace eCAL
     // TCP
     ////////////////////////////////////////////////////////////////////////////
 #if ECAL_CORE_TRANSPORT_TCP
-    if (m_writer_tcp)
+    if (m_writer_tcp && ((filter_result == nullptr) || filter_result->tcp))
     {
 #ifndef NDEBUG
       Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::Send::TCP");
@@ -307,14 +446,14 @@ namespace eCAL
       {
         // fill writer data
         struct SWriterAttr wattr;
-        wattr.len = payload_buf_size;
+        wattr.len = len_;
         wattr.id = m_id;
         wattr.clock = m_clock;
         wattr.hash = snd_hash;
         wattr.time = time_;
 
         // write to tcp layer
-        tcp_sent = m_writer_tcp->Write(m_payload_buffer.data(), wattr);
+        tcp_sent = m_writer_tcp->Write(buf_, wattr);
         m_layers.tcp.active = true;
       }
       written |= tcp_sent;
@@ -332,10 +471,219 @@ namespace eCAL
     }
 #endif // ECAL_CORE_TRANSPORT_TCP
 
+    // a sample all subscribers filter is delivered successfully
+    if ((filter_result != nullptr) && !written) written = !(filter_result->udp || filter_result->shm || filter_result->tcp);
+
     // return success
     return written;
   }
 
+  void CPublisherImpl::ReplayPendingHistory()
+  {
+    // collect the connected subscribers still waiting for the history
+    std::vector<std::pair<SSubscriptionInfo, SLayerStates>> pending_subscriptions;
+    {
+      const std::lock_guard<std::mutex> lock(m_connection_map_mutex);
+      for (const auto& connection : m_connection_map)
+      {
+        if (connection.second.state && connection.second.history_pending)
+        {
+          pending_subscriptions.emplace_back(connection.first, connection.second.layer_states);
+        }
+      }
+    }
+
+    for (const auto& subscription : pending_subscriptions)
+    {
+      const eReplayResult result = ReplayHistory(subscription.first, subscription.second);
+
+      const std::lock_guard<std::mutex> lock(m_connection_map_mutex);
+      auto subscription_info_iter = m_connection_map.find(subscription.first);
+      if (subscription_info_iter == m_connection_map.end()) continue;
+
+      auto& connection = subscription_info_iter->second;
+      switch (result)
+      {
+      case eReplayResult::confirmed:
+        connection.history_pending = false;
+        break;
+      case eReplayResult::unconfirmed:
+        // the subscriber may have been attached to the layer after the replay, so we repeat it some times
+        // (it drops the samples it has received already as duplicates)
+        if (++connection.history_replays >= PUB_HISTORY_REPLAY_ATTEMPTS) connection.history_pending = false;
+        break;
+      default:
+        // we try again with the next cycle
+        break;
+      }
+    }
+  }
+
+  CPublisherImpl::eReplayResult CPublisherImpl::ReplayHistory(const SSubscriptionInfo& subscription_info_, const SLayerStates& sub_layer_states_)
+  {
+    // local subscribers of other processes are not signaled
+    std::vector<int32_t> skip_process_ids;
+    {
+      const std::lock_guard<std::mutex> lock(m_connection_map_mutex);
+      for (const auto& connection : m_connection_map)
+      {
+        if ((connection.first.host_name == m_attributes.host_name) && (connection.first.process_id != subscription_info_.process_id))
+        {
+          skip_process_ids.push_back(connection.first.process_id);
+        }
+      }
+    }
+
+    // we replay the samples that are in the history right now, the following ones are sent to the subscriber anyway
+    long long last_clock(0);
+    {
+      const auto write_lock = LockWrite();
+      if (m_history->Size() == 0) return eReplayResult::confirmed;
+      last_clock = (*m_history)[m_history->Size() - 1].clock;
+    }
+
+    // the write lock is held for one sample only, so the writer is never blocked by the whole replay
+    eReplayResult result(eReplayResult::confirmed);
+    long long     replayed_clock(std::numeric_limits<long long>::min());
+    while (m_created)
+    {
+      const auto write_lock = LockWrite();
+
+      // a pending loan may lock the memory file
+      if (m_loan.active) return eReplayResult::failed;
+
+      // find the oldest sample not replayed yet, the history may have been moved on in the meantime
+      const Util::CSampleHistory::SSample* sample(nullptr);
+      for (size_t i = 0; i < m_history->Size(); ++i)
+      {
+        if ((*m_history)[i].clock > replayed_clock)
+        {
+          sample = &(*m_history)[i];
+          break;
+        }
+      }
+      if ((sample == nullptr) || (sample->clock > last_clock)) break;
+      replayed_clock = sample->clock;
+
+      result = ReplaySample(*sample, subscription_info_, sub_layer_states_, skip_process_ids);
+      if (result == eReplayResult::failed) break;
+    }
+
+#ifndef NDEBUG
+    Logging::Log(Logging::log_level_debug2, m_attributes.topic_name + "::CPublisherImpl::ReplayHistory - " + std::string(result == eReplayResult::failed ? "FAILED" : "done"));
+#endif
+    return result;
+  }
+
+  CPublisherImpl::eReplayResult CPublisherImpl::ReplaySample(const Util::CSampleHistory::SSample& sample_, const SSubscriptionInfo& subscription_info_, const SLayerStates& sub_layer_states_, const std::vector<int32_t>& skip_process_ids_)
+  {
+    // the samples are replayed with their original clock, so other connected subscribers drop them as duplicates,
+    // they are marked as replayed, so a subscriber that has received newer live samples already does not drop them as out of order
+    struct SWriterAttr wattr;
+    wattr.len      = sample_.payload.size();
+    wattr.id       = sample_.id;
+    wattr.clock    = sample_.clock;
+    wattr.hash     = std::hash<SSndHash>()(SSndHash(m_publisher_id, sample_.clock));
+    wattr.time     = sample_.time;
+    wattr.replayed = true;
+
+#if ECAL_CORE_TRANSPORT_SHM
+    // local subscriber, replay via shared memory and signal its process only
+    if (m_writer_shm && sub_layer_states_.shm.read_enabled && (subscription_info_.host_name == m_attributes.host_name))
+    {
+      // a single slot memory file is overwritten by the next sample, so we wait until the subscriber has read it,
+      // its process acknowledges a replayed sample only if a subscriber applied it, so we take the acknowledge
+      // as delivery confirmation, a ring memory file is never acknowledged
+      const bool acknowledge = (m_attributes.shm.memfile_ring_slots == 0);
+
+      wattr.zero_copy              = m_attributes.shm.zero_copy_mode;
+      wattr.acknowledge_timeout_ms = acknowledge ? std::max<long long>(m_attributes.shm.acknowledge_timeout_ms, PUB_HISTORY_REPLAY_ACK_TO) : 0;
+      wattr.skip_process_ids       = &skip_process_ids_;
+
+      auto acknowledge_count = [this, &subscription_info_]() -> int64_t
+      {
+        const auto ack_statistics = m_writer_shm->GetAckStatistics();
+        const auto iter = ack_statistics.find(subscription_info_.process_id);
+        return (iter != ack_statistics.end()) ? iter->second.acknowledge_count : 0;
+      };
+      const int64_t acknowledge_count_before = acknowledge ? acknowledge_count() : 0;
+
+      if (m_writer_shm->PrepareWrite(wattr))
+      {
+        // register new to update listening subscribers and rematch
+        Register();
+      }
+
+      CBufferPayloadWriter payload_buf(sample_.payload.data(), sample_.payload.size());
+      if (!m_writer_shm->Write(payload_buf, wattr)) return eReplayResult::failed;
+
+      if (!acknowledge) return eReplayResult::unconfirmed;
+      return (acknowledge_count() > acknowledge_count_before) ? eReplayResult::confirmed : eReplayResult::failed;
+    }
+#endif // ECAL_CORE_TRANSPORT_SHM
+
+#if ECAL_CORE_TRANSPORT_TCP
+    // tcp is a broadcast to all sessions
+    if (m_writer_tcp && sub_layer_states_.tcp.read_enabled)
+    {
+      return m_writer_tcp->Write(sample_.payload.data(), wattr) ? eReplayResult::unconfirmed : eReplayResult::failed;
+    }
+#endif // ECAL_CORE_TRANSPORT_TCP
+
+#if ECAL_CORE_TRANSPORT_UDP
+    if (m_writer_udp && sub_layer_states_.udp.read_enabled)
+    {
+      wattr.loopback = m_attributes.loopback;
+
+      if (m_writer_udp->PrepareWrite(wattr))
+      {
+        // register new to update listening subscribers and rematch
+        Register();
+      }
+      return m_writer_udp->Write(sample_.payload.data(), wattr) ? eReplayResult::unconfirmed : eReplayResult::failed;
+    }
+#endif // ECAL_CORE_TRANSPORT_UDP
+
+    // no layer to replay on
+    return eReplayResult::confirmed;
+  }
+
+  void CPublisherImpl::ApplySampleFilters(long long time_, SSampleFilterResult& result_)
+  {
+    result_.udp = false;
+    result_.shm = false;
+    result_.tcp = false;
+    result_.shm_skip_process_ids.clear();
+    result_.shm_pass_process_ids.clear();
+
+    {
+      const std::lock_guard<std::mutex> lock(m_connection_map_mutex);
+      for (auto& connection : m_connection_map)
+      {
+        // every filter sees every sample exactly once, so it stays in sync with the subscriber side filter
+        const bool pass = connection.second.sample_filter.Pass(m_clock, time_);
+
+        // all local subscribers are connected to the memory files
+        if (connection.first.host_name == m_attributes.host_name)
+        {
+          if (pass) result_.shm_pass_process_ids.push_back(connection.first.process_id);
+          else      result_.shm_skip_process_ids.push_back(connection.first.process_id);
+        }
+
+        if (!pass) continue;
+        result_.udp |= connection.second.layer_states.udp.read_enabled;
+        result_.tcp |= connection.second.layer_states.tcp.read_enabled;
+      }
+    }
+
+    // a process is notified as soon as one of its subscribers accepts the sample
+    auto& skip_ids = result_.shm_skip_process_ids;
+    auto& pass_ids = result_.shm_pass_process_ids;
+    std::sort(pass_ids.begin(), pass_ids.end());
+    skip_ids.erase(std::remove_if(skip_ids.begin(), skip_ids.end(), [&pass_ids](int32_t process_id_) { return std::binary_search(pass_ids.begin(), pass_ids.end(), process_id_); }), skip_ids.end());
+    result_.shm = !pass_ids.empty();
+  }
+
   bool CPublisherImpl::SetDataTypeInformation(const SDataTypeInformation& topic_info_)
   {
     m_topic_info = topic_info_;
@@ -379,7 +727,7 @@ namespace eCAL
     return true;
   }
 
-  void CPublisherImpl::ApplySubscriberRegistration(const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_, const SLayerStates& sub_layer_states_, const std::string& reader_par_)
+  void CPublisherImpl::ApplySubscriberRegistration(const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_, const SLayerStates& sub_layer_states_, const Registration::SampleFilter& sample_filter_, const std::string& reader_par_)
   {
     // collect layer states
     std::vector<eTLayerType> pub_layers;
@@ -437,6 +785,7 @@ namespace eCAL
 
     // add key to connection map, including connection state
     bool is_new_connection = false;
+    bool replay_history    = false;
     {
       const std::lock_guard<std::mutex> lock(m_connection_map_mutex);
       auto subscription_info_iter = m_connection_map.find(subscription_info_);
@@ -444,7 +793,7 @@ namespace eCAL
       if (subscription_info_iter == m_connection_map.end())
       {
         // add subscriber to connection map, connection state false
-        m_connection_map[subscription_info_] = SConnection{ data_type_info_, sub_layer_states_, false };
+        m_connection_map[subscription_info_] = SConnection{ data_type_info_, sub_layer_states_, false, CSampleFilter(sample_filter_.downsampling_factor, sample_filter_.max_frequency), m_history != nullptr };
       }
       else
       {
@@ -458,15 +807,26 @@ namespace eCAL
           is_new_connection = true;
         }
 
+        // keep the filter state, otherwise every registration refresh would pass the next sample
+        CSampleFilter sample_filter = connection.sample_filter;
+        sample_filter.SetParameter(sample_filter_.downsampling_factor, sample_filter_.max_frequency);
+
         // update the data type, the layer states and set the state active
-        connection = SConnection{ data_type_info_, sub_layer_states_, true };
+        connection = SConnection{ data_type_info_, sub_layer_states_, true, sample_filter, connection.history_pending, connection.history_replays };
+
+        // the subscriber is connected now, so it is able to receive the history
+        replay_history = is_new_connection && connection.history_pending;
       }
 
       // update connection count
-      m_connection_count = GetConnectionCount();
+      m_connection_count          = GetConnectionCount();
+      m_filtered_connection_count = GetFilteredConnectionCount();
     }
 
 
+    // the replay thread sends the history, it retries on its own until the subscriber got it
+    if (replay_history) m_history_replay_thread->trigger();
+
     // handle these events outside the lock
     if (is_new_connection)
     {
@@ -499,7 +859,8 @@ namespace eCAL
       m_connection_map.erase(subscription_info_);
 
       // update connection count
-      m_connection_count = GetConnectionCount();
+      m_connection_count          = GetConnectionCount();
+      m_filtered_connection_count = GetFilteredConnectionCount();
     }
 
     // fire disconnect event
@@ -614,6 +975,16 @@ namespace eCAL
       shm_tlayer.active = m_layers.shm.active;
       shm_tlayer.par_layer.layer_par_shm = m_writer_shm->GetConnectionParameter().layer_par_shm;
       ecal_reg_sample_topic.transport_layer.push_back(shm_tlayer);
+
+      // acknowledge statistics per subscriber process (only if acknowledges are used)
+      for (const auto& ack_statistics : m_writer_shm->GetAckStatistics())
+      {
+        auto& reg_ack_statistics = ecal_reg_sample_topic.acknowledge_statistics.push_back();
+        reg_ack_statistics.process_id        = ack_statistics.first;
+        reg_ack_statistics.acknowledge_count = ack_statistics.second.acknowledge_count;
+        reg_ack_statistics.timeout_count     = ack_statistics.second.timeout_count;
+        ack_statistics.second.latency.Export(reg_ack_statistics.latency.bucket_limits_us, reg_ack_statistics.latency.bucket_counts);
+      }
     }
 #endif
 
@@ -716,6 +1087,20 @@ namespace eCAL
     return count;
   }
 
+  size_t CPublisherImpl::GetFilteredConnectionCount()
+  {
+    // no need to lock map here for now, map locked by caller
+    size_t count(0);
+    for (const auto& sub : m_connection_map)
+    {
+      if (sub.second.sample_filter.IsActive())
+      {
+        count++;
+      }
+    }
+    return count;
+  }
+
   bool CPublisherImpl::StartUdpLayer()
   {
 #if ECAL_CORE_TRANSPORT_UDP
@@ -821,6 +1206,20 @@ namespace eCAL
 #endif
   }
 
+  bool CPublisherImpl::IsShmOnlyLayer() const
+  {
+    bool shm_only(true);
+#if ECAL_CORE_TRANSPORT_UDP
+    // udp is active -> no zero copy
+    shm_only &= !m_writer_udp;
+#endif
+#if ECAL_CORE_TRANSPORT_TCP
+    // tcp is active -> no zero copy
+    shm_only &= !m_writer_tcp;
+#endif
+    return shm_only;
+  }
+
   size_t CPublisherImpl::PrepareWrite(long long id_, size_t len_)
   {
     // store id
@@ -29,7 +29,10 @@
 #include <ecal/v5/ecal_callback.h>
 
 #include "serialization/ecal_serialize_sample_registration.h"
+#include "util/ecal_thread.h"
 #include "util/frequency_calculator.h"
+#include "util/sample_filter.h"
+#include "util/sample_history.h"
 #include "readwrite/config/attributes/writer_attributes.h"
 
 #if ECAL_CORE_TRANSPORT_UDP
@@ -78,13 +81,18 @@ namespace eCAL
     ~CPublisherImpl();
 
     bool Write(CPayloadWriter& payload_, long long time_, long long filter_id_);
+    void WriteUnsubscribed(CPayloadWriter& payload_, long long time_, long long filter_id_);
+
+    void* Loan(size_t len_);
+    bool PublishLoan(long long time_, long long filter_id_);
+    void ReturnLoan();
 
     bool SetDataTypeInformation(const SDataTypeInformation& topic_info_);
 
     bool SetEventCallback(const PubEventCallbackT& callback_);
     bool RemoveEventCallback();
 
-    void ApplySubscriberRegistration(const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_, const SLayerStates& sub_layer_states_, const std::string& reader_par_);
+    void ApplySubscriberRegistration(const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_, const SLayerStates& sub_layer_states_, const Registration::SampleFilter& sample_filter_, const std::string& reader_par_);
     void ApplySubscriberUnregistration(const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_);
 
     void GetRegistration(Registration::Sample& sample);
@@ -119,6 +127,33 @@ namespace eCAL
     void FireDisconnectEvent(const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_);
 
     size_t GetConnectionCount();
+    size_t GetFilteredConnectionCount();
+
+    // result of the subscriber sample filters for one sample
+    struct SSampleFilterResult
+    {
+      bool                 udp = true;                // at least one udp subscriber accepts the sample
+      bool                 shm = true;                // at least one local subscriber accepts the sample
+      bool                 tcp = true;                // at least one tcp subscriber accepts the sample
+      std::vector<int32_t> shm_skip_process_ids;      // local processes whose subscribers all filter the sample
+      std::vector<int32_t> shm_pass_process_ids;      // local processes with at least one accepting subscriber
+    };
+    void ApplySampleFilters(long long time_, SSampleFilterResult& result_);
+
+    std::unique_lock<std::mutex> LockWrite();
+    bool WriteLayers(CPayloadWriter& payload_, const void* buf_, size_t len_, bool shm_loan_, long long time_, long long filter_id_);
+
+    // result of one history replay to a subscriber
+    enum class eReplayResult
+    {
+      confirmed,     // the subscriber acknowledged the replayed samples
+      unconfirmed,   // replayed on a layer without acknowledge
+      failed         // not delivered, needs to be replayed again
+    };
+    void          ReplayPendingHistory();
+    eReplayResult ReplayHistory(const SSubscriptionInfo& subscription_info_, const SLayerStates& sub_layer_states_);
+    eReplayResult ReplaySample(const Util::CSampleHistory::SSample& sample_, const SSubscriptionInfo& subscription_info_, const SLayerStates& sub_layer_states_, const std::vector<int32_t>& skip_process_ids_);
+    bool IsShmOnlyLayer() const;
 
     size_t PrepareWrite(long long id_, size_t len_);
 
@@ -134,16 +169,35 @@ namespace eCAL
 
     std::vector<char>                      m_payload_buffer;
 
+    // transient local history, writing is synchronized with the replay (replay thread) only if it exists
+    std::unique_ptr<Util::CSampleHistory>  m_history;
+    std::mutex                             m_write_mutex;
+    std::unique_ptr<CCallbackThread>       m_history_replay_thread;
+
+    struct SLoan
+    {
+      bool   active = false;
+      bool   shm    = false;    // buffer is located in the memory file
+      void*  data   = nullptr;
+      size_t len    = 0;
+    };
+    SLoan                                  m_loan;
+
     struct SConnection
     {
       SDataTypeInformation data_type_info;
       SLayerStates         layer_states;
       bool                 state = false;
+      CSampleFilter        sample_filter;   // kept on registration refresh
+      bool                 history_pending = false;   // the history still has to be replayed to this subscriber
+      unsigned int         history_replays = 0;       // unconfirmed replays to this subscriber
     };
     using SSubscriptionMapT = std::map<SSubscriptionInfo, SConnection>;
     mutable std::mutex                     m_connection_map_mutex;
     SSubscriptionMapT                      m_connection_map;
     std::atomic<size_t>                    m_connection_count{ 0 };
+    std::atomic<size_t>                    m_filtered_connection_count{ 0 };
+    SSampleFilterResult                    m_sample_filter_result;
 
     std::mutex                             m_event_id_callback_mutex;
     PubEventCallbackT                      m_event_id_callback;
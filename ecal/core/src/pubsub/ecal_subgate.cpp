@@ -27,10 +27,9 @@
 #include <algorithm>
 #include <atomic>
 #include <cstddef>
-#include <iterator>
+#include <functional>
 #include <memory>
 #include <mutex>
-#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -60,8 +59,10 @@ namespace eCAL
     if(!m_created) return;
 
     // stop & destroy all remaining subscriber
-    const std::unique_lock<std::shared_timed_mutex> lock(m_topic_name_subscriber_mutex);
-    m_topic_name_subscriber_map.clear();
+    {
+      const std::lock_guard<std::mutex> lock(m_dispatch_table_write_mutex);
+      m_dispatch_table.Update(std::unique_ptr<const DispatchTableT>(new DispatchTableT()));
+    }
 
     m_created = false;
   }
@@ -70,9 +71,24 @@ namespace eCAL
   {
     if(!m_created) return(false);
 
-    // register reader
-    const std::unique_lock<std::shared_timed_mutex> lock(m_topic_name_subscriber_mutex);
-    m_topic_name_subscriber_map.emplace(std::pair<std::string, std::shared_ptr<CSubscriberImpl>>(topic_name_, datareader_));
+    const size_t topic_hash = TopicHash(topic_name_);
+
+    // register reader in a copy of the dispatch table and publish it
+    const std::lock_guard<std::mutex> lock(m_dispatch_table_write_mutex);
+    std::unique_ptr<DispatchTableT> table(new DispatchTableT(m_dispatch_table.Current()));
+
+    auto iter = std::lower_bound(table->begin(), table->end(), topic_hash, [](const STopicReaders& topic_, size_t hash_) { return topic_.topic_hash < hash_; });
+    while ((iter != table->end()) && (iter->topic_hash == topic_hash) && (iter->topic_name != topic_name_)) ++iter;
+    if ((iter == table->end()) || (iter->topic_hash != topic_hash))
+    {
+      STopicReaders topic_readers;
+      topic_readers.topic_hash = topic_hash;
+      topic_readers.topic_name = topic_name_;
+      iter = table->insert(iter, std::move(topic_readers));
+    }
+    iter->readers.push_back(datareader_);
+
+    m_dispatch_table.Update(std::move(table));
 
     return(true);
   }
@@ -80,40 +96,57 @@ namespace eCAL
   bool CSubGate::Unregister(const std::string& topic_name_, const std::shared_ptr<CSubscriberImpl>& datareader_)
   {
     if(!m_created) return(false);
-    bool ret_state = false;
 
-    const std::unique_lock<std::shared_timed_mutex> lock(m_topic_name_subscriber_mutex);
-    auto res = m_topic_name_subscriber_map.equal_range(topic_name_);
-    for(auto iter = res.first; iter != res.second; ++iter)
-    {
-      if(iter->second == datareader_)
-      {
-        m_topic_name_subscriber_map.erase(iter);
-        ret_state = true;
-        break;
-      }
-    }
+    const size_t topic_hash = TopicHash(topic_name_);
+
+    const std::lock_guard<std::mutex> lock(m_dispatch_table_write_mutex);
+    const STopicReaders* topic_readers = FindTopic(m_dispatch_table.Current(), topic_hash, topic_name_);
+    if (topic_readers == nullptr) return(false);
+    if (std::find(topic_readers->readers.begin(), topic_readers->readers.end(), datareader_) == topic_readers->readers.end()) return(false);
+
+    // unregister reader in a copy of the dispatch table and publish it
+    std::unique_ptr<DispatchTableT> table(new DispatchTableT(m_dispatch_table.Current()));
+    auto iter = table->begin() + (topic_readers - m_dispatch_table.Current().data());
+    iter->readers.erase(std::find(iter->readers.begin(), iter->readers.end(), datareader_));
+    if (iter->readers.empty()) table->erase(iter);
+
+    m_dispatch_table.Update(std::move(table));
 
-    return(ret_state);
+    return(true);
   }
 
   bool CSubGate::HasSample(const std::string& sample_name_)
   {
-    const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_subscriber_mutex);
-    return(m_topic_name_subscriber_map.find(sample_name_) != m_topic_name_subscriber_map.end());
+    const RCU::CPointer<DispatchTableT>::CReadGuard table(m_dispatch_table);
+    return(FindTopic(*table, TopicHash(sample_name_), sample_name_) != nullptr);
+  }
+
+  void CSubGate::ApplyFecResult(const std::string& topic_name_, bool recovered_)
+  {
+    if (!m_created) return;
+
+    const RCU::CPointer<DispatchTableT>::CReadGuard table(m_dispatch_table);
+    const STopicReaders* topic_readers = FindTopic(*table, TopicHash(topic_name_), topic_name_);
+    if (topic_readers == nullptr) return;
+    for (const auto& reader : topic_readers->readers)
+    {
+      reader->ApplyFecResult(recovered_);
+    }
   }
 
   bool CSubGate::ApplySample(const char* serialized_sample_data_, size_t serialized_sample_size_, eTLayerType layer_)
   {
     if(!m_created) return false;
 
+    // the payload is not copied, it references the (reassembled) receive buffer until the readers have applied it
     Payload::Sample ecal_sample;
-    if (!DeserializeFromBuffer(serialized_sample_data_, serialized_sample_size_, ecal_sample)) return false;
+    if (!DeserializeFromBufferNoCopy(serialized_sample_data_, serialized_sample_size_, ecal_sample)) return false;
 
     size_t applied_size(0);
     switch (ecal_sample.cmd_type)
     {
     case bct_set_sample:
+    case bct_set_sample_replay:
     {
 #ifndef NDEBUG
       // check layer
@@ -124,50 +157,18 @@ namespace eCAL
       }
 #endif
 
-      // extract payload
-      const char* payload_addr = nullptr;
-      size_t      payload_size = 0;
-      switch (ecal_sample.content.payload.type)
-      {
-      case eCAL::Payload::pl_raw:
-        payload_addr = ecal_sample.content.payload.raw_addr;
-        payload_size = ecal_sample.content.payload.raw_size;
-        break;
-      case eCAL::Payload::pl_vec:
-        payload_addr = ecal_sample.content.payload.vec.data();
-        payload_size = ecal_sample.content.payload.vec.size();
-        break;
-      default:
-        break;
-      }
-
       // apply sample to data reader
-      std::vector<std::shared_ptr<CSubscriberImpl>> readers_to_apply;
-        
-      // Lock the sync map only while extracting the relevant shared pointers to the Datareaders.
-      // Apply the samples to the readers afterward.
-      {
-        // apply sample to data reader
-        const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_subscriber_mutex);
-        auto res = m_topic_name_subscriber_map.equal_range(ecal_sample.topic_info.topic_name);
-        std::transform(
-          res.first, res.second, std::back_inserter(readers_to_apply), [](const auto& match) { return match.second; }
-        );
-      }
-
-      const auto& ecal_sample_content = ecal_sample.content;
-      for (const auto& reader : readers_to_apply)
+      // a replayed history sample is older than the live samples and must not be dropped as out of order
+      applied_size = ApplyContentToReaders(TopicHash(ecal_sample.topic_info.topic_name), ecal_sample.topic_info, ecal_sample.content, layer_, ecal_sample.cmd_type == bct_set_sample_replay);
+    }
+    break;
+    case bct_set_sample_batch:
+    {
+      // apply all samples of the batch in their send order
+      const size_t topic_hash = TopicHash(ecal_sample.topic_info.topic_name);
+      for (const auto& ecal_sample_content : ecal_sample.batch)
       {
-        applied_size = reader->ApplySample(
-          ecal_sample.topic_info,
-          payload_addr,
-          payload_size,
-          ecal_sample_content.id,
-          ecal_sample_content.clock,
-          ecal_sample_content.time,
-          static_cast<size_t>(ecal_sample_content.hash),
-          layer_
-        );
+        applied_size += ApplyContentToReaders(topic_hash, ecal_sample.topic_info, ecal_sample_content, layer_, false);
       }
     }
     break;
@@ -178,31 +179,81 @@ namespace eCAL
     return (applied_size > 0);
   }
 
-  bool CSubGate::ApplySample(const Payload::TopicInfo& topic_info_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_)
+  bool CSubGate::ApplySample(const Payload::TopicInfo& topic_info_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_, bool replayed_, const std::shared_ptr<CSamplePin>& pin_)
+  {
+    return ApplySample(TopicHash(topic_info_.topic_name), topic_info_, buf_, len_, id_, clock_, time_, hash_, layer_, replayed_, pin_);
+  }
+
+  bool CSubGate::ApplySample(const size_t topic_hash_, const Payload::TopicInfo& topic_info_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_, bool replayed_, const std::shared_ptr<CSamplePin>& pin_)
   {
     if (!m_created) return false;
 
-    // apply sample to data reader
-    size_t applied_size(0);
-    std::vector<std::shared_ptr<CSubscriberImpl>> readers_to_apply;
+    return (ApplySampleToReaders(topic_hash_, topic_info_, buf_, len_, id_, clock_, time_, hash_, layer_, replayed_, pin_) > 0);
+  }
+
+  size_t CSubGate::TopicHash(const std::string& topic_name_)
+  {
+    return std::hash<std::string>()(topic_name_);
+  }
 
-    // Lock the sync map only while extracting the relevant shared pointers to the Datareaders.
-    // Apply the samples to the readers afterwards.
+  size_t CSubGate::ApplyContentToReaders(const size_t topic_hash_, const Payload::TopicInfo& topic_info_, const Payload::Content& content_, eTLayerType layer_, bool replayed_)
+  {
+    // extract payload
+    const char* payload_addr = nullptr;
+    size_t      payload_size = 0;
+    switch (content_.payload.type)
     {
-      const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_subscriber_mutex);
-      auto res = m_topic_name_subscriber_map.equal_range(topic_info_.topic_name);
-      std::transform(
-        res.first, res.second, std::back_inserter(readers_to_apply), [](const auto& match) { return match.second; }
-      );
+    case eCAL::Payload::pl_raw:
+      payload_addr = content_.payload.raw_addr;
+      payload_size = content_.payload.raw_size;
+      break;
+    case eCAL::Payload::pl_vec:
+      payload_addr = content_.payload.vec.data();
+      payload_size = content_.payload.vec.size();
+      break;
+    default:
+      break;
     }
 
+    return ApplySampleToReaders(
+      topic_hash_,
+      topic_info_,
+      payload_addr,
+      payload_size,
+      content_.id,
+      content_.clock,
+      content_.time,
+      static_cast<size_t>(content_.hash),
+      layer_,
+      replayed_,
+      nullptr
+    );
+  }
 
-    for (const auto& reader : readers_to_apply)
+  size_t CSubGate::ApplySampleToReaders(const size_t topic_hash_, const Payload::TopicInfo& topic_info_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_, bool replayed_, const std::shared_ptr<CSamplePin>& pin_)
+  {
+    // the dispatch table stays valid while the guard exists, no lock and no copy of the readers needed
+    const RCU::CPointer<DispatchTableT>::CReadGuard table(m_dispatch_table);
+    const STopicReaders* topic_readers = FindTopic(*table, topic_hash_, topic_info_.topic_name);
+    if (topic_readers == nullptr) return 0;
+
+    // the sample counts as applied if any reader applied it
+    size_t applied_size(0);
+    for (const auto& reader : topic_readers->readers)
     {
-      applied_size = reader->ApplySample(topic_info_, buf_, len_, id_, clock_, time_, hash_, layer_);
+      applied_size = (std::max)(applied_size, reader->ApplySample(topic_info_, buf_, len_, id_, clock_, time_, hash_, layer_, replayed_, pin_));
     }
+    return applied_size;
+  }
 
-    return (applied_size > 0);
+  const CSubGate::STopicReaders* CSubGate::FindTopic(const DispatchTableT& table_, const size_t topic_hash_, const std::string& topic_name_)
+  {
+    auto iter = std::lower_bound(table_.begin(), table_.end(), topic_hash_, [](const STopicReaders& topic_, size_t hash_) { return topic_.topic_hash < hash_; });
+    for (; (iter != table_.end()) && (iter->topic_hash == topic_hash_); ++iter)
+    {
+      if (iter->topic_name == topic_name_) return &(*iter);
+    }
+    return nullptr;
   }
 
   void CSubGate::ApplyPublisherRegistration(const Registration::Sample& ecal_sample_)
@@ -243,16 +294,17 @@ namespace eCAL
     }
 
     // register publisher
-    const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_subscriber_mutex);
-    auto res = m_topic_name_subscriber_map.equal_range(topic_name);
-    for (auto iter = res.first; iter != res.second; ++iter)
+    const RCU::CPointer<DispatchTableT>::CReadGuard table(m_dispatch_table);
+    const STopicReaders* topic_readers = FindTopic(*table, TopicHash(topic_name), topic_name);
+    if (topic_readers == nullptr) return;
+    for (const auto& reader : topic_readers->readers)
     {
       // apply layer specific parameter
       for (const auto& transport_layer : ecal_sample_.topic.transport_layer)
       {
-        iter->second->ApplyLayerParameter(publication_info, transport_layer.type, transport_layer.par_layer);
+        reader->ApplyLayerParameter(publication_info, transport_layer.type, transport_layer.par_layer);
       }
-      iter->second->ApplyPublisherRegistration(publication_info, topic_information, layer_states);
+      reader->ApplyPublisherRegistration(publication_info, topic_information, layer_states);
     }
   }
 
@@ -270,11 +322,12 @@ namespace eCAL
     const SDataTypeInformation& topic_information = ecal_topic.datatype_information;
 
     // unregister publisher
-    const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_subscriber_mutex);
-    auto res = m_topic_name_subscriber_map.equal_range(topic_name);
-    for (auto iter = res.first; iter != res.second; ++iter)
+    const RCU::CPointer<DispatchTableT>::CReadGuard table(m_dispatch_table);
+    const STopicReaders* topic_readers = FindTopic(*table, TopicHash(topic_name), topic_name);
+    if (topic_readers == nullptr) return;
+    for (const auto& reader : topic_readers->readers)
     {
-      iter->second->ApplyPublisherUnregistration(publication_info, topic_information);
+      reader->ApplyPublisherUnregistration(publication_info, topic_information);
     }
   }
 
@@ -283,10 +336,13 @@ namespace eCAL
     if (!m_created) return;
 
     // read reader registrations
-    const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_subscriber_mutex);
-    for (const auto& iter : m_topic_name_subscriber_map)
+    const RCU::CPointer<DispatchTableT>::CReadGuard table(m_dispatch_table);
+    for (const auto& topic_readers : *table)
     {
-      iter.second->GetRegistration(reg_sample_list_.push_back());
+      for (const auto& reader : topic_readers.readers)
+      {
+        reader->GetRegistration(reg_sample_list_.push_back());
+      }
     }
   }
 }
@@ -24,13 +24,15 @@
 #pragma once
 
 #include "pubsub/ecal_subscriber_impl.h"
+#include "util/rcu_pointer.h"
+#include "util/sample_pin.h"
 
 #include <atomic>
 #include <cstddef>
 #include <memory>
-#include <shared_mutex>
+#include <mutex>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 namespace eCAL
 {
@@ -49,7 +51,14 @@ namespace eCAL
     bool HasSample(const std::string& sample_name_);
 
     bool ApplySample(const char* serialized_sample_data_, size_t serialized_sample_size_, eTLayerType layer_);
-    bool ApplySample(const Payload::TopicInfo& topic_info_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_);
+    bool ApplySample(const Payload::TopicInfo& topic_info_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_, bool replayed_ = false, const std::shared_ptr<CSamplePin>& pin_ = nullptr);
+    bool ApplySample(size_t topic_hash_, const Payload::TopicInfo& topic_info_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_, bool replayed_ = false, const std::shared_ptr<CSamplePin>& pin_ = nullptr);
+
+    // dispatch key of a topic, transport layers with a fixed topic can compute it once
+    static size_t TopicHash(const std::string& topic_name_);
+
+    // udp forward error correction result of one message
+    void ApplyFecResult(const std::string& topic_name_, bool recovered_);
 
     void ApplyPublisherRegistration(const Registration::Sample& ecal_sample_);
     void ApplyPublisherUnregistration(const Registration::Sample& ecal_sample_);
@@ -59,8 +68,21 @@ namespace eCAL
   protected:
     static std::atomic<bool> m_created;
 
-    using TopicNameSubscriberMapT = std::unordered_multimap<std::string, std::shared_ptr<CSubscriberImpl>>;
-    std::shared_timed_mutex  m_topic_name_subscriber_mutex;
-    TopicNameSubscriberMapT  m_topic_name_subscriber_map;
+    size_t ApplyContentToReaders(size_t topic_hash_, const Payload::TopicInfo& topic_info_, const Payload::Content& content_, eTLayerType layer_, bool replayed_);
+    size_t ApplySampleToReaders(size_t topic_hash_, const Payload::TopicInfo& topic_info_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_, bool replayed_, const std::shared_ptr<CSamplePin>& pin_);
+
+    struct STopicReaders
+    {
+      size_t                                        topic_hash = 0;
+      std::string                                   topic_name;
+      std::vector<std::shared_ptr<CSubscriberImpl>> readers;
+    };
+    // immutable dispatch table sorted by topic hash, replaced as a whole on register / unregister
+    using DispatchTableT = std::vector<STopicReaders>;
+
+    static const STopicReaders* FindTopic(const DispatchTableT& table_, size_t topic_hash_, const std::string& topic_name_);
+
+    std::mutex                     m_dispatch_table_write_mutex;
+    RCU::CPointer<DispatchTableT>  m_dispatch_table;
   };
 }
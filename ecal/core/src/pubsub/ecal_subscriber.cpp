@@ -86,6 +86,12 @@ namespace eCAL
     if (subscriber_impl) static_cast<void>(subscriber_impl->SetReceiveCallback(callback_));
   }
 
+  void CSubscriber::SetReceiveSampleCallback(ReceiveSampleCallbackT callback_)
+  {
+    auto subscriber_impl = m_subscriber_impl.lock();
+    if (subscriber_impl) static_cast<void>(subscriber_impl->SetReceiveSampleCallback(callback_));
+  }
+
   void CSubscriber::RemoveReceiveCallback()
   {
     auto subscriber_impl = m_subscriber_impl.lock();
@@ -0,0 +1,237 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  asynchronous execution of subscriber receive callbacks
+**/
+
+#include "ecal_subscriber_executor.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace eCAL
+{
+  ////////////////////////////////////////
+  // CCallbackExecutor
+  ////////////////////////////////////////
+  CCallbackExecutor::CCallbackExecutor(size_t thread_count_) :
+    m_state(std::make_shared<SState>())
+  {
+    thread_count_ = std::max<size_t>(thread_count_, 1);
+    for (size_t i = 0; i < thread_count_; ++i)
+    {
+      const auto state = m_state;
+      m_threads.emplace_back([state]() { Run(state); });
+    }
+  }
+
+  CCallbackExecutor::~CCallbackExecutor()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_state->mutex);
+      m_state->stop = true;
+      m_state->ready_queues.clear();
+    }
+    m_state->cv.notify_all();
+
+    for (auto& thread : m_threads)
+    {
+      // the last reference may be released by a callback running on one of our threads
+      if (thread.get_id() == std::this_thread::get_id()) thread.detach();
+      else                                                thread.join();
+    }
+  }
+
+  std::shared_ptr<CCallbackExecutor> CCallbackExecutor::SharedPool(size_t thread_count_)
+  {
+    static std::mutex                       shared_pool_mutex;
+    static std::weak_ptr<CCallbackExecutor> shared_pool;
+
+    const std::lock_guard<std::mutex> lock(shared_pool_mutex);
+    auto pool = shared_pool.lock();
+    if (!pool)
+    {
+      pool = std::make_shared<CCallbackExecutor>(thread_count_);
+      shared_pool = pool;
+    }
+    return pool;
+  }
+
+  void CCallbackExecutor::Schedule(std::shared_ptr<CCallbackQueue> queue_)
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_state->mutex);
+      if (m_state->stop) return;
+      m_state->ready_queues.push_back(std::move(queue_));
+    }
+    m_state->cv.notify_one();
+  }
+
+  void CCallbackExecutor::Run(const std::shared_ptr<SState>& state_)
+  {
+    for (;;)
+    {
+      std::shared_ptr<CCallbackQueue> queue;
+      {
+        std::unique_lock<std::mutex> lock(state_->mutex);
+        state_->cv.wait(lock, [&state_]() { return state_->stop || !state_->ready_queues.empty(); });
+        if (state_->stop) return;
+
+        queue = std::move(state_->ready_queues.front());
+        state_->ready_queues.pop_front();
+      }
+
+      // one sample per turn, then the queue goes to the back of the line
+      if (queue->ExecuteNext())
+      {
+        const std::lock_guard<std::mutex> lock(state_->mutex);
+        if (state_->stop) return;
+        state_->ready_queues.push_back(std::move(queue));
+      }
+    }
+  }
+
+  ////////////////////////////////////////
+  // CCallbackQueue
+  ////////////////////////////////////////
+  CCallbackQueue::CCallbackQueue(Subscriber::Callback::eQueuePolicy queue_policy_, size_t queue_size_, std::shared_ptr<CCallbackExecutor> executor_) :
+    m_queue_policy(queue_policy_),
+    m_queue_size(std::max<size_t>(queue_size_, 1)),
+    m_executor(std::move(executor_))
+  {
+  }
+
+  bool CCallbackQueue::Push(TaskT task_)
+  {
+    SEntry dropped_entry;
+    bool   accepted(true);
+    bool   schedule(false);
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      if (m_stopped) return false;
+
+      if (m_queue.size() >= m_queue_size)
+      {
+        switch (m_queue_policy)
+        {
+        case Subscriber::Callback::eQueuePolicy::keep_latest:
+          // release the oldest sample outside the lock
+          dropped_entry = std::move(m_queue.front());
+          m_queue.pop_front();
+          ++m_drop_count;
+          break;
+        case Subscriber::Callback::eQueuePolicy::keep_all:
+          ++m_drop_count;
+          return false;
+        case Subscriber::Callback::eQueuePolicy::block_publisher:
+          m_cv.wait(lock, [this]() { return m_stopped || (m_queue.size() < m_queue_size); });
+          if (m_stopped) return false;
+          break;
+        }
+        accepted = (m_queue_policy != Subscriber::Callback::eQueuePolicy::keep_latest);
+      }
+
+      m_queue.push_back(SEntry{ std::move(task_), std::chrono::steady_clock::now() });
+
+      if (!m_scheduled)
+      {
+        m_scheduled = true;
+        schedule    = true;
+      }
+    }
+
+    // the executor may release its last reference to us as soon as it is scheduled
+    if (schedule)
+    {
+      const auto self = shared_from_this();
+      m_executor->Schedule(self);
+    }
+
+    // with keep_latest the new sample is queued, but another one got lost
+    return accepted;
+  }
+
+  bool CCallbackQueue::ExecuteNext()
+  {
+    SEntry entry;
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_stopped || m_queue.empty())
+      {
+        m_scheduled = false;
+        return false;
+      }
+
+      entry = std::move(m_queue.front());
+      m_queue.pop_front();
+      m_running        = true;
+      m_running_thread = std::this_thread::get_id();
+    }
+    // a blocked transport layer thread can queue its sample now
+    m_cv.notify_all();
+
+    entry.task();
+    // release the sample before it is accounted as executed
+    entry.task = nullptr;
+    const auto latency = std::chrono::steady_clock::now() - entry.receive_time;
+
+    bool more_samples(false);
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      m_running = false;
+      ++m_executed_count;
+      m_latency.AddSample(latency);
+
+      more_samples = !m_stopped && !m_queue.empty();
+      if (!more_samples) m_scheduled = false;
+    }
+    // Stop may wait for the end of this callback
+    m_cv.notify_all();
+
+    return more_samples;
+  }
+
+  void CCallbackQueue::Stop()
+  {
+    std::deque<SEntry> dropped_entries;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_stopped = true;
+      dropped_entries.swap(m_queue);
+      m_cv.notify_all();
+
+      // wait for a running callback, unless it is the one stopping us
+      m_cv.wait(lock, [this]() { return !m_running || (m_running_thread == std::this_thread::get_id()); });
+    }
+  }
+
+  CCallbackQueue::SStatistics CCallbackQueue::GetStatistics() const
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    SStatistics statistics;
+    statistics.queue_size     = m_queue_size;
+    statistics.queue_depth    = m_queue.size();
+    statistics.executed_count = m_executed_count;
+    statistics.drop_count     = m_drop_count;
+    statistics.latency        = m_latency;
+    return statistics;
+  }
+}
@@ -0,0 +1,138 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  asynchronous execution of subscriber receive callbacks
+**/
+
+#pragma once
+
+#include <ecal/config/subscriber.h>
+
+#include "util/latency_histogram.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eCAL
+{
+  class CCallbackQueue;
+
+  /*
+  * Threads executing the samples of callback queues. A queue is executed by one thread
+  * at a time, so the samples of one subscriber are delivered in order. Queues sharing an
+  * executor are served round robin, one sample per turn.
+  */
+  class CCallbackExecutor
+  {
+  public:
+    explicit CCallbackExecutor(size_t thread_count_);
+    ~CCallbackExecutor();
+
+    CCallbackExecutor(const CCallbackExecutor&) = delete;
+    CCallbackExecutor& operator=(const CCallbackExecutor&) = delete;
+
+    // process wide pool, the thread count of the call creating the pool is applied
+    static std::shared_ptr<CCallbackExecutor> SharedPool(size_t thread_count_);
+
+    void Schedule(std::shared_ptr<CCallbackQueue> queue_);
+
+  private:
+    // shared with the threads, so an executor can be destroyed by one of its own threads
+    struct SState
+    {
+      std::mutex                                  mutex;
+      std::condition_variable                     cv;
+      std::deque<std::shared_ptr<CCallbackQueue>> ready_queues;
+      bool                                        stop = false;
+    };
+
+    static void Run(const std::shared_ptr<SState>& state_);
+
+    std::shared_ptr<SState>  m_state;
+    std::vector<std::thread> m_threads;
+  };
+
+  /*
+  * Bounded sample queue of one subscriber. Samples are pushed by the transport layer
+  * threads and executed by the executor of the queue.
+  */
+  class CCallbackQueue : public std::enable_shared_from_this<CCallbackQueue>
+  {
+  public:
+    using TaskT = std::function<void()>;
+
+    struct SStatistics
+    {
+      size_t            queue_size     = 0;  // maximum number of queued samples
+      size_t            queue_depth    = 0;  // currently queued samples
+      int64_t           executed_count = 0;  // number of executed samples
+      int64_t           drop_count     = 0;  // number of dropped samples
+      CLatencyHistogram latency;             // latency from reception to callback return
+    };
+
+    CCallbackQueue(Subscriber::Callback::eQueuePolicy queue_policy_, size_t queue_size_, std::shared_ptr<CCallbackExecutor> executor_);
+
+    CCallbackQueue(const CCallbackQueue&) = delete;
+    CCallbackQueue& operator=(const CCallbackQueue&) = delete;
+
+    // queue a sample, returns false if it was dropped or the queue is stopped
+    // (block_publisher waits until a queued sample was taken for execution)
+    bool Push(TaskT task_);
+
+    // execute the oldest sample, returns true if further samples are waiting (executor only)
+    bool ExecuteNext();
+
+    // drop all queued samples and wait for a running callback (if not called by that callback)
+    void Stop();
+
+    SStatistics GetStatistics() const;
+
+  private:
+    struct SEntry
+    {
+      TaskT                                 task;
+      std::chrono::steady_clock::time_point receive_time;
+    };
+
+    const Subscriber::Callback::eQueuePolicy m_queue_policy;
+    const size_t                             m_queue_size;
+    const std::shared_ptr<CCallbackExecutor> m_executor;
+
+    mutable std::mutex                       m_mutex;
+    std::condition_variable                  m_cv;
+    std::deque<SEntry>                       m_queue;
+    bool                                     m_scheduled = false;
+    bool                                     m_running   = false;
+    std::thread::id                          m_running_thread;
+    bool                                     m_stopped   = false;
+
+    int64_t                                  m_executed_count = 0;
+    int64_t                                  m_drop_count     = 0;
+    CLatencyHistogram                        m_latency;
+  };
+}
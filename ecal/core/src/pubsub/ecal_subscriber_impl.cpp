@@ -64,6 +64,17 @@
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
+
+namespace
+{
+  // compares entries of a vector sorted by entity id with an entity id
+  struct EntityIdLess
+  {
+    template <typename EntryT>
+    bool operator()(const EntryT& entry_, eCAL::EntityIdT entity_id_) const { return entry_.first < entity_id_; }
+  };
+}
 
 namespace eCAL
 {
@@ -93,6 +104,19 @@ namespace eCAL
     m_topic_id.topic_id.host_name = m_attributes.host_name;
     m_topic_id.topic_id.process_id = m_attributes.process_id;
 
+    // create the callback queue for asynchronous callback execution
+    switch (m_attributes.callback.executor)
+    {
+    case Subscriber::Callback::eExecutor::dedicated_thread:
+      m_callback_queue = std::make_shared<CCallbackQueue>(m_attributes.callback.queue_policy, m_attributes.callback.queue_size, std::make_shared<CCallbackExecutor>(1));
+      break;
+    case Subscriber::Callback::eExecutor::shared_pool:
+      m_callback_queue = std::make_shared<CCallbackQueue>(m_attributes.callback.queue_policy, m_attributes.callback.queue_size, CCallbackExecutor::SharedPool(m_attributes.callback.shared_pool_size));
+      break;
+    default:
+      break;
+    }
+
     // start transport layers
     InitializeLayers();
     StartTransportLayer();
@@ -113,9 +137,13 @@ namespace eCAL
     // stop transport layers
     StopTransportLayer();
 
+    // drop queued samples and wait for a running asynchronous callback
+    if (m_callback_queue) m_callback_queue->Stop();
+
     // reset receive callback
     {
       const std::lock_guard<std::mutex> lock(m_receive_callback_mutex);
+      const std::lock_guard<std::mutex> execution_lock(m_callback_execution_mutex);
       m_receive_callback = nullptr;
     }
 
@@ -178,7 +206,28 @@ namespace eCAL
     // set receive callback
     {
       const std::lock_guard<std::mutex> lock(m_receive_callback_mutex);
-      m_receive_callback = callback_;
+      const std::lock_guard<std::mutex> execution_lock(m_callback_execution_mutex);
+      m_receive_callback        = callback_;
+      m_receive_sample_callback = nullptr;
+    }
+
+    return(true);
+  }
+
+  bool CSubscriberImpl::SetReceiveSampleCallback(const ReceiveSampleCallbackT& callback_)
+  {
+    if (!m_created) return(false);
+
+#ifndef NDEBUG
+    Logging::Log(Logging::log_level_debug2, m_attributes.topic_name + "::CSubscriberImpl::SetReceiveSampleCallback");
+#endif
+
+    // set receive sample callback
+    {
+      const std::lock_guard<std::mutex> lock(m_receive_callback_mutex);
+      const std::lock_guard<std::mutex> execution_lock(m_callback_execution_mutex);
+      m_receive_sample_callback = callback_;
+      m_receive_callback        = nullptr;
     }
 
     return(true);
@@ -195,7 +244,9 @@ namespace eCAL
     // remove receive callback
     {
       const std::lock_guard<std::mutex> lock(m_receive_callback_mutex);
-      m_receive_callback = nullptr;
+      const std::lock_guard<std::mutex> execution_lock(m_callback_execution_mutex);
+      m_receive_callback        = nullptr;
+      m_receive_sample_callback = nullptr;
     }
 
     return(true);
@@ -282,6 +333,9 @@ namespace eCAL
         connection = SConnection{ data_type_info_, pub_layer_states_, true };
       }
 
+      // update the publisher information of the receive path
+      UpdatePublisherInfo(publication_info_, data_type_info_);
+
       // update connection count
       m_connection_count = GetConnectionCount();
     }
@@ -305,6 +359,7 @@ namespace eCAL
       const std::lock_guard<std::mutex> lock(m_connection_map_mtx);
 
       m_connection_map.erase(publication_info_);
+      RemovePublisherInfo(publication_info_);
 
       // update connection count
       m_connection_count = GetConnectionCount();
@@ -371,10 +426,10 @@ namespace eCAL
 #endif
   }
 
-  size_t CSubscriberImpl::ApplySample(const Payload::TopicInfo& topic_info_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t /*hash_*/, eTLayerType layer_)
+  size_t CSubscriberImpl::ApplySample(const Payload::TopicInfo& topic_info_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t /*hash_*/, eTLayerType layer_, bool replayed_, const std::shared_ptr<CSamplePin>& pin_)
   {
     // ensure thread safety
-    const std::lock_guard<std::mutex> lock(m_receive_callback_mutex);
+    std::unique_lock<std::mutex> lock(m_receive_callback_mutex);
     if (!m_created) return(0);
 
     // We don't want to apply samples which are received on layers which are not activated for this subscriber
@@ -383,10 +438,12 @@ namespace eCAL
       return 0;
     }
 
-    auto publication_info = PublicationInfoFromTopicInfo(topic_info_);
+    // resolve the publisher identity (no allocation for known publishers)
+    const auto publisher_info = GetPublisherInfo(topic_info_);
+    const auto& publication_info = publisher_info->publication_info;
 
     // We do not want to apply duplicate / old samples
-    if (!ShouldApplySampleBasedOnClock(publication_info, clock_))
+    if (!ShouldApplySampleBasedOnClock(publication_info, clock_, replayed_))
     {
       // not clear why we are returning the size_ if we are not applying the sample, but why not...
       return size_;
@@ -398,6 +455,12 @@ namespace eCAL
       return 0;
     }
 
+    // Samples the publisher did not filter itself (older publisher, shared udp / shm notification)
+    if (publisher_info->sample_filter && !publisher_info->sample_filter->Pass(clock_, time_))
+    {
+      return size_;
+    }
+
     // store receive layer
     m_layers.udp.active |= layer_ == tl_ecal_udp;
     m_layers.shm.active |= layer_ == tl_ecal_shm;
@@ -411,7 +474,12 @@ namespace eCAL
     // increase read clock
     m_clock++;
 
-    TriggerMessageDropUdate(publication_info, clock_);
+    // remember the sample to drop it if it is received again
+    m_publisher_message_counter_map.SetCounter(publication_info, static_cast<std::size_t>(clock_));
+
+    // filtered samples are gaps in the publisher clock, but no drops,
+    // a replayed history sample is older than the live samples and no drop either
+    if (!publisher_info->sample_filter && !replayed_) TriggerMessageDropUdate(publication_info, clock_);
     TriggerFrequencyUpdate();
 
     // reset timeout
@@ -420,11 +488,48 @@ namespace eCAL
     // store size
     m_topic_size = size_;
 
+    // trace the delivery latency (send time stamp to reception)
+    SLatencyTrace::SLayerLatency* layer_latency = publisher_info->latency_trace ? publisher_info->latency_trace->GetLayer(layer_) : nullptr;
+    if (layer_latency != nullptr) layer_latency->delivery.AddSample(std::chrono::microseconds(Time::GetMicroSeconds() - time_));
+
     // execute callback
     bool processed = false;
     {
+      // queue the sample for the asynchronous callback executor
+      if (m_callback_queue && (m_receive_sample_callback || m_receive_callback))
+      {
+#ifndef NDEBUG
+        // log it
+        Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CSubscriberImpl::ApplySample::QueueSample");
+#endif
+        // queued samples are always copied, a pinned sample would keep its memory file slot
+        // locked for the queue time, block_publisher gets its backpressure from the blocking
+        // push instead (the transport layer acknowledges the sample only after it was queued)
+        CReceiveSample sample = CreateReceiveSample(payload_, size_, clock_, time_, nullptr);
+
+        // do not block the callback setters while waiting for queue space
+        lock.unlock();
+        m_callback_queue->Push([this, publisher_info, layer_, sample]() { ExecuteQueuedSample(*publisher_info, layer_, sample); });
+        return(size_);
+      }
+
+      const auto callback_start = (layer_latency != nullptr) ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+
+      // call user receive sample callback function
+      if(m_receive_sample_callback)
+      {
+#ifndef NDEBUG
+        // log it
+        Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CSubscriberImpl::ApplySample::ReceiveSampleCallback");
+#endif
+        // execute it
+        const CReceiveSample sample = CreateReceiveSample(payload_, size_, clock_, time_, pin_);
+        (m_receive_sample_callback)(publisher_info->topic_id, publisher_info->data_type_info, sample);
+        processed = true;
+      }
+
       // call user receive callback function
-      if(m_receive_callback)
+      else if(m_receive_callback)
       {
 #ifndef NDEBUG
         // log it
@@ -437,22 +542,13 @@ namespace eCAL
         cb_data.send_timestamp  = time_;
         cb_data.send_clock = clock_;
 
-        STopicId topic_id;
-        topic_id.topic_name          = topic_info_.topic_name;
-        topic_id.topic_id.host_name  = topic_info_.host_name;
-        topic_id.topic_id.entity_id  = topic_info_.topic_id;
-        topic_id.topic_id.process_id = topic_info_.process_id;
-
-        SPublicationInfo pub_info;
-        pub_info.entity_id  = topic_info_.topic_id;
-        pub_info.host_name  = topic_info_.host_name;
-        pub_info.process_id = topic_info_.process_id;
-
         // execute it
-        const std::lock_guard<std::mutex> exec_lock(m_connection_map_mtx);
-        (m_receive_callback)(topic_id, m_connection_map[pub_info].data_type_info, cb_data);
+        (m_receive_callback)(publisher_info->topic_id, publisher_info->data_type_info, cb_data);
         processed = true;
       }
+
+      // trace the callback execution time
+      if (processed && (layer_latency != nullptr)) layer_latency->callback.AddSample(std::chrono::steady_clock::now() - callback_start);
     }
 
     // if not consumed by user receive call
@@ -476,6 +572,67 @@ namespace eCAL
     return(size_);
   }
 
+  void CSubscriberImpl::ApplyFecResult(bool recovered_)
+  {
+    if (recovered_) m_fec_recovered_messages++;
+    else            m_fec_lost_messages++;
+  }
+
+  void CSubscriberImpl::ExecuteQueuedSample(const SPublisherInfo& publisher_info_, eTLayerType layer_, const CReceiveSample& sample_)
+  {
+    // callbacks are changed holding this lock too
+    const std::lock_guard<std::mutex> lock(m_callback_execution_mutex);
+
+    SLatencyTrace::SLayerLatency* layer_latency = publisher_info_.latency_trace ? publisher_info_.latency_trace->GetLayer(layer_) : nullptr;
+    const auto callback_start = (layer_latency != nullptr) ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+
+    // call user receive sample callback function
+    if (m_receive_sample_callback)
+    {
+      (m_receive_sample_callback)(publisher_info_.topic_id, publisher_info_.data_type_info, sample_);
+    }
+
+    // call user receive callback function
+    else if (m_receive_callback)
+    {
+      SReceiveCallbackData cb_data;
+      cb_data.buffer         = sample_.GetBuffer();
+      cb_data.buffer_size    = sample_.GetBufferSize();
+      cb_data.send_timestamp = sample_.GetSendTimestamp();
+      cb_data.send_clock     = sample_.GetSendClock();
+
+      (m_receive_callback)(publisher_info_.topic_id, publisher_info_.data_type_info, cb_data);
+    }
+    else
+    {
+      return;
+    }
+
+    // trace the callback execution time
+    if (layer_latency != nullptr) layer_latency->callback.AddSample(std::chrono::steady_clock::now() - callback_start);
+  }
+
+  CReceiveSample CSubscriberImpl::CreateReceiveSample(const char* payload_, size_t size_, long long clock_, long long time_, const std::shared_ptr<CSamplePin>& pin_)
+  {
+    // pin the transport layer buffer if the layer offers it and the pin limit is not reached
+    if (pin_ && (m_pinned_sample_count->fetch_add(1) < m_attributes.shm.max_pinned_samples))
+    {
+      // the transport layer buffer is released with the pin, by the last copy of the sample
+      auto pinned_sample_count = m_pinned_sample_count;
+      std::shared_ptr<const void> owner(payload_, [pin_, pinned_sample_count](const void*)
+        {
+          pinned_sample_count->fetch_sub(1);
+        });
+      return CReceiveSample(std::move(owner), payload_, size_, time_, clock_, true);
+    }
+    if (pin_) m_pinned_sample_count->fetch_sub(1);
+
+    // copy the payload otherwise
+    auto buffer = std::make_shared<std::vector<char>>(payload_, payload_ + size_);
+    const void* buffer_data = buffer->data();
+    return CReceiveSample(std::move(buffer), buffer_data, size_, time_, clock_, false);
+  }
+
   void CSubscriberImpl::Register()
   {
 #if ECAL_CORE_REGISTRATION
@@ -585,6 +742,54 @@ namespace eCAL
     ecal_reg_sample_topic.data_frequency = GetFrequency();
     ecal_reg_sample_topic.message_drops  = GetMessageDropsAndFireDroppedEvents();
 
+    // udp forward error correction
+    ecal_reg_sample_topic.fec_recovered_messages = m_fec_recovered_messages;
+    ecal_reg_sample_topic.fec_lost_messages      = m_fec_lost_messages;
+
+    // asynchronous callback execution
+    if (m_callback_queue)
+    {
+      const auto statistics = m_callback_queue->GetStatistics();
+      auto& reg_callback_statistics          = ecal_reg_sample_topic.callback_statistics;
+      reg_callback_statistics.queue_size     = static_cast<int32_t>(statistics.queue_size);
+      reg_callback_statistics.queue_depth    = static_cast<int32_t>(statistics.queue_depth);
+      reg_callback_statistics.executed_count = statistics.executed_count;
+      reg_callback_statistics.drop_count     = statistics.drop_count;
+      statistics.latency.Export(reg_callback_statistics.latency.bucket_limits_us, reg_callback_statistics.latency.bucket_counts);
+    }
+
+    // receive latency per publisher and transport layer
+    if (m_attributes.latency_tracing)
+    {
+      const std::lock_guard<std::mutex> lock(m_connection_map_mtx);
+      for (const auto& publisher_info : m_publisher_info_vec)
+      {
+        const auto& latency_trace = publisher_info.second->latency_trace;
+        if (!latency_trace) continue;
+
+        const std::pair<eTLayerType, const SLatencyTrace::SLayerLatency*> layer_latencies[] = {
+          { tl_ecal_udp, &latency_trace->udp },
+          { tl_ecal_shm, &latency_trace->shm },
+          { tl_ecal_tcp, &latency_trace->tcp }
+        };
+        for (const auto& layer_latency : layer_latencies)
+        {
+          // only layers the publisher has actually delivered samples on
+          if (layer_latency.second->delivery.SampleCount() == 0) continue;
+
+          auto& reg_latency_statistics = ecal_reg_sample_topic.latency_statistics.push_back();
+          reg_latency_statistics.publisher_id = publisher_info.first;
+          reg_latency_statistics.layer        = layer_latency.first;
+          layer_latency.second->delivery.Export(reg_latency_statistics.delivery_latency.bucket_limits_us, reg_latency_statistics.delivery_latency.bucket_counts);
+          layer_latency.second->callback.Export(reg_latency_statistics.callback_latency.bucket_limits_us, reg_latency_statistics.callback_latency.bucket_counts);
+        }
+      }
+    }
+
+    // sample filter, applied by the publishers
+    ecal_reg_sample_topic.sample_filter.downsampling_factor = SampleFilterDownsamplingFactor(m_attributes.filter.downsampling_factor);
+    ecal_reg_sample_topic.sample_filter.max_frequency       = SampleFilterFrequencyToMilliHertz(m_attributes.filter.max_frequency);
+
     // we do not know the number of connections ..
     ecal_reg_sample_topic.connections_local = 0;
     ecal_reg_sample_topic.connections_external = 0;
@@ -724,6 +929,80 @@ namespace eCAL
     return publication_info;
   }
 
+  std::shared_ptr<const CSubscriberImpl::SPublisherInfo> CSubscriberImpl::CreatePublisherInfo(const std::string& topic_name_, const SPublicationInfo& publication_info_, const SDataTypeInformation& data_type_info_, const std::shared_ptr<SLatencyTrace>& latency_trace_, const std::shared_ptr<CSampleFilter>& sample_filter_)
+  {
+    auto publisher_info = std::make_shared<SPublisherInfo>();
+    publisher_info->publication_info             = publication_info_;
+    publisher_info->topic_id.topic_name          = topic_name_;
+    publisher_info->topic_id.topic_id.host_name  = publication_info_.host_name;
+    publisher_info->topic_id.topic_id.entity_id  = publication_info_.entity_id;
+    publisher_info->topic_id.topic_id.process_id = publication_info_.process_id;
+    publisher_info->data_type_info               = data_type_info_;
+    publisher_info->latency_trace                = latency_trace_;
+    publisher_info->sample_filter                = sample_filter_;
+    return publisher_info;
+  }
+
+  std::shared_ptr<CSubscriberImpl::SLatencyTrace> CSubscriberImpl::CreateLatencyTrace() const
+  {
+    if (!m_attributes.latency_tracing) return nullptr;
+    return std::make_shared<SLatencyTrace>();
+  }
+
+  std::shared_ptr<CSampleFilter> CSubscriberImpl::CreateSampleFilter() const
+  {
+    auto sample_filter = std::make_shared<CSampleFilter>(SampleFilterDownsamplingFactor(m_attributes.filter.downsampling_factor), SampleFilterFrequencyToMilliHertz(m_attributes.filter.max_frequency));
+    if (!sample_filter->IsActive()) return nullptr;
+    return sample_filter;
+  }
+
+  std::shared_ptr<const CSubscriberImpl::SPublisherInfo> CSubscriberImpl::GetPublisherInfo(const Payload::TopicInfo& topic_info_)
+  {
+    const std::lock_guard<std::mutex> lock(m_connection_map_mtx);
+
+    auto iter = std::lower_bound(m_publisher_info_vec.begin(), m_publisher_info_vec.end(), topic_info_.topic_id, EntityIdLess());
+    if ((iter != m_publisher_info_vec.end()) && (iter->first == topic_info_.topic_id)) return iter->second;
+
+    // sample of a publisher that is not registered (yet) or already unregistered,
+    // the entry is not stored (it would never be removed), so it has no latency trace and no sample filter
+    const SPublicationInfo publication_info = PublicationInfoFromTopicInfo(topic_info_);
+    SDataTypeInformation data_type_info;
+    auto connection_iter = m_connection_map.find(publication_info);
+    if (connection_iter != m_connection_map.end()) data_type_info = connection_iter->second.data_type_info;
+
+    return CreatePublisherInfo(topic_info_.topic_name, publication_info, data_type_info, nullptr, nullptr);
+  }
+
+  void CSubscriberImpl::UpdatePublisherInfo(const SPublicationInfo& publication_info_, const SDataTypeInformation& data_type_info_)
+  {
+    // no need to lock here, vector locked by caller
+    auto iter = std::lower_bound(m_publisher_info_vec.begin(), m_publisher_info_vec.end(), publication_info_.entity_id, EntityIdLess());
+    if ((iter != m_publisher_info_vec.end()) && (iter->first == publication_info_.entity_id))
+    {
+      // registration refresh, keep the entry if nothing changed
+      const auto& publisher_info = *iter->second;
+      if ((publisher_info.data_type_info == data_type_info_)
+        && (publisher_info.publication_info.process_id == publication_info_.process_id)
+        && (publisher_info.publication_info.host_name == publication_info_.host_name))
+      {
+        return;
+      }
+      iter->second = CreatePublisherInfo(m_attributes.topic_name, publication_info_, data_type_info_, publisher_info.latency_trace, publisher_info.sample_filter);
+      return;
+    }
+    m_publisher_info_vec.emplace(iter, publication_info_.entity_id, CreatePublisherInfo(m_attributes.topic_name, publication_info_, data_type_info_, CreateLatencyTrace(), CreateSampleFilter()));
+  }
+
+  void CSubscriberImpl::RemovePublisherInfo(const SPublicationInfo& publication_info_)
+  {
+    // no need to lock here, vector locked by caller
+    auto iter = std::lower_bound(m_publisher_info_vec.begin(), m_publisher_info_vec.end(), publication_info_.entity_id, EntityIdLess());
+    if ((iter != m_publisher_info_vec.end()) && (iter->first == publication_info_.entity_id))
+    {
+      m_publisher_info_vec.erase(iter);
+    }
+  }
+
   size_t CSubscriberImpl::GetConnectionCount()
   {
     // no need to lock map here for now, map locked by caller
@@ -738,7 +1017,7 @@ namespace eCAL
     return count;
   }
 
-  bool CSubscriberImpl::ShouldApplySampleBasedOnClock(const SPublicationInfo& publication_info_, long long clock_) const
+  bool CSubscriberImpl::ShouldApplySampleBasedOnClock(const SPublicationInfo& publication_info_, long long clock_, bool replayed_) const
   {
     // If counter is already present (duplicate), or unsure if it was present, the sample is not applied
     if (m_publisher_message_counter_map.HasCounter(publication_info_, clock_) != CounterCacheMapT::CounterInCache::False)
@@ -751,6 +1030,10 @@ namespace eCAL
       return false;
     }
 
+    // A sample replayed from the publisher history is older than the live samples by design,
+    // it is applied as long as it was not received before.
+    if (replayed_) return true;
+
     // The sample counter is strictly monotonically increasing. If not so, we received an old message.
     // If it is applied or not depends on the configuration. Anyways, a message at low debug level is logged.
     if (!m_publisher_message_counter_map.IsMonotonic(publication_info_, clock_))
@@ -26,11 +26,15 @@
 #include <ecal/pubsub/types.h>
 #include <ecal/v5/ecal_callback.h>
 
+#include "ecal_subscriber_executor.h"
 #include "serialization/ecal_serialize_sample_payload.h"
 #include "serialization/ecal_serialize_sample_registration.h"
 #include "util/frequency_calculator.h"
 #include "util/message_drop_calculator.h"
 #include "util/counter_cache.h"
+#include "util/latency_histogram.h"
+#include "util/sample_pin.h"
+#include "util/sample_filter.h"
 #include "readwrite/config/attributes/reader_attributes.h"
 
 #include <atomic>
@@ -39,11 +43,14 @@
 #include <cstddef>
 #include <deque>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace eCAL
 {
@@ -66,6 +73,43 @@ namespace eCAL
 
     using SPublicationInfo = Registration::SampleIdentifier;
 
+    // receive latency of one publisher per transport layer (latency tracing only)
+    struct SLatencyTrace
+    {
+      struct SLayerLatency
+      {
+        CAtomicLatencyHistogram delivery;   // send time stamp to reception
+        CAtomicLatencyHistogram callback;   // receive callback execution time
+      };
+
+      SLayerLatency* GetLayer(eTLayerType layer_)
+      {
+        switch (layer_)
+        {
+        case tl_ecal_udp: return &udp;
+        case tl_ecal_shm: return &shm;
+        case tl_ecal_tcp: return &tcp;
+        default:          return nullptr;
+        }
+      }
+
+      SLayerLatency udp;
+      SLayerLatency shm;
+      SLayerLatency tcp;
+    };
+
+    // publisher identity as needed by the receive path, resolved once per connection
+    // (entries are immutable and replaced on change, so a sample can use them without holding the lock)
+    struct SPublisherInfo
+    {
+      SPublicationInfo               publication_info;
+      STopicId                       topic_id;
+      SDataTypeInformation           data_type_info;
+      std::shared_ptr<SLatencyTrace> latency_trace;   // nullptr if latency tracing is disabled, kept on replacement
+      std::shared_ptr<CSampleFilter> sample_filter;   // nullptr if no sample filter is configured, kept on replacement
+    };
+    using PublisherInfoVecT = std::vector<std::pair<EntityIdT, std::shared_ptr<const SPublisherInfo>>>;
+
     CSubscriberImpl(const SDataTypeInformation& topic_info_, const eCAL::eCALReader::SAttributes& attr_);
     ~CSubscriberImpl();
 
@@ -80,6 +124,7 @@ namespace eCAL
     bool Read(std::string& buf_, long long* time_ = nullptr, int rcv_timeout_ms_ = 0);
 
     bool SetReceiveCallback(const ReceiveCallbackT& callback_);
+    bool SetReceiveSampleCallback(const ReceiveSampleCallbackT& callback_);
     bool RemoveReceiveCallback();
 
     bool SetEventCallback(const SubEventCallbackT& callback_);
@@ -103,7 +148,8 @@ namespace eCAL
     const SDataTypeInformation& GetDataTypeInformation() const { return(m_topic_info); }
 
     void InitializeLayers();
-    size_t ApplySample(const Payload::TopicInfo& topic_info_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_);
+    size_t ApplySample(const Payload::TopicInfo& topic_info_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_, bool replayed_ = false, const std::shared_ptr<CSamplePin>& pin_ = nullptr);
+    void ApplyFecResult(bool recovered_);
 
   protected:
     void Register();
@@ -123,9 +169,20 @@ namespace eCAL
 
     static SPublicationInfo PublicationInfoFromTopicInfo(const Payload::TopicInfo& topic_info_);
 
+    static std::shared_ptr<const SPublisherInfo> CreatePublisherInfo(const std::string& topic_name_, const SPublicationInfo& publication_info_, const SDataTypeInformation& data_type_info_, const std::shared_ptr<SLatencyTrace>& latency_trace_, const std::shared_ptr<CSampleFilter>& sample_filter_);
+    std::shared_ptr<SLatencyTrace> CreateLatencyTrace() const;
+    std::shared_ptr<CSampleFilter> CreateSampleFilter() const;
+    std::shared_ptr<const SPublisherInfo> GetPublisherInfo(const Payload::TopicInfo& topic_info_);
+    void UpdatePublisherInfo(const SPublicationInfo& publication_info_, const SDataTypeInformation& data_type_info_);
+    void RemovePublisherInfo(const SPublicationInfo& publication_info_);
+
     size_t GetConnectionCount();
 
-    bool ShouldApplySampleBasedOnClock(const SPublicationInfo& publication_info_, long long clock_) const;
+    void ExecuteQueuedSample(const SPublisherInfo& publisher_info_, eTLayerType layer_, const CReceiveSample& sample_);
+
+    CReceiveSample CreateReceiveSample(const char* payload_, size_t size_, long long clock_, long long time_, const std::shared_ptr<CSamplePin>& pin_);
+
+    bool ShouldApplySampleBasedOnClock(const SPublicationInfo& publication_info_, long long clock_, bool replayed_) const;
     bool ShouldApplySampleBasedOnLayer(eTLayerType layer_) const;
     bool ShouldApplySampleBasedOnId(long long id_) const;
 
@@ -151,6 +208,8 @@ namespace eCAL
     ConnectionMapT                            m_connection_map;
     std::atomic<size_t>                       m_connection_count{ 0 };
 
+    PublisherInfoVecT                         m_publisher_info_vec;  // sorted by entity id, guarded by m_connection_map_mtx
+
     mutable std::mutex                        m_read_buf_mutex;
     std::condition_variable                   m_read_buf_cv;
     bool                                      m_read_buf_received = false;
@@ -159,6 +218,10 @@ namespace eCAL
 
     std::mutex                                m_receive_callback_mutex;
     ReceiveCallbackT                          m_receive_callback;
+    ReceiveSampleCallbackT                    m_receive_sample_callback;
+    std::shared_ptr<std::atomic<size_t>>      m_pinned_sample_count = std::make_shared<std::atomic<size_t>>(0);
+    std::mutex                                m_callback_execution_mutex;  // held by the executor while calling the callbacks
+    std::shared_ptr<CCallbackQueue>           m_callback_queue;            // asynchronous callback execution only
     std::atomic<int>                          m_receive_time;
 
     std::deque<size_t>                        m_sample_hash_queue;
@@ -174,6 +237,9 @@ namespace eCAL
     std::mutex                                m_message_drop_map_mutex;
     using MessageDropMapT = MessageDropCalculatorMap<SPublicationInfo>;
     MessageDropMapT                           m_message_drop_map;
+
+    std::atomic<int64_t>                      m_fec_recovered_messages{ 0 };
+    std::atomic<int64_t>                      m_fec_lost_messages{ 0 };
     
     using CounterCacheMapT = CounterCacheMap<SPublicationInfo>;
     CounterCacheMapT                          m_publisher_message_counter_map;
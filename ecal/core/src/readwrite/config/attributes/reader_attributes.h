@@ -34,6 +34,9 @@ namespace eCAL
       int         port;
       int         receivebuffer;
       std::string group;
+      bool        mmsg;
+      size_t      receive_threads;
+      size_t      max_message_size;
     };
 
     struct STCPAttributes
@@ -45,13 +48,29 @@ namespace eCAL
 
     struct SSHMAttributes
     {
-      bool enable;
+      bool   enable;
+      size_t max_pinned_samples;
+    };
+
+    struct SCallbackAttributes
+    {
+      Subscriber::Callback::eExecutor    executor;
+      Subscriber::Callback::eQueuePolicy queue_policy;
+      size_t                             queue_size;
+      size_t                             shared_pool_size;
+    };
+
+    struct SFilterAttributes
+    {
+      unsigned int downsampling_factor;
+      double       max_frequency;
     };
 
     struct SAttributes
     {
       bool         network_enabled;
       bool         drop_out_of_order_messages;
+      bool         latency_tracing;
       bool         loopback;
       unsigned int registration_timeout_ms;
 
@@ -59,6 +78,9 @@ namespace eCAL
       STCPAttributes tcp;
       SSHMAttributes shm;
 
+      SCallbackAttributes callback;
+      SFilterAttributes   filter;
+
       std::string topic_name;
       std::string host_name;
       std::string shm_transport_domain;
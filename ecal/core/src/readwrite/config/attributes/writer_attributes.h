@@ -26,6 +26,8 @@
 #include <ecal/config/configuration.h>
 #include <ecal/config/transport_layer.h>
 
+#include "writer_batch_attributes.h"
+
 namespace eCAL
 {
   namespace eCALWriter
@@ -38,12 +40,18 @@ namespace eCAL
       int         send_buffer;
       std::string group;
       int         ttl;
+      bool        mmsg;
+      unsigned int fec_redundancy_percent;
+
+      Batch::SAttributes batch;
     };
 
     struct STCPAttributes
     {
       bool   enable;
       size_t thread_pool_size;
+
+      Batch::SAttributes batch;
     };
 
     struct SSHMAttributes
@@ -54,6 +62,17 @@ namespace eCAL
       unsigned int memfile_buffer_count;
       unsigned int memfile_min_size_bytes;
       unsigned int memfile_reserve_percent;
+      unsigned int memfile_ring_slots;
+      bool         futex_notification;
+      bool         memfile_huge_pages;
+      bool         memfile_prefault;
+      int          memfile_numa_node;
+    };
+
+    struct SHistoryAttributes
+    {
+      unsigned int depth;
+      unsigned int replay_interval_ms;
     };
 
 
@@ -77,6 +96,8 @@ namespace eCAL
       SUDPAttributes       udp;
       STCPAttributes       tcp;
       SSHMAttributes       shm;
+
+      SHistoryAttributes   history;
     };
   }
 }
\ No newline at end of file
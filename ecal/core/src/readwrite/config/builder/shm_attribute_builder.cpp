@@ -44,6 +44,11 @@ namespace eCAL
       attributes.memfile_buffer_count    = attr_.shm.memfile_buffer_count;
       attributes.memfile_reserve_percent = attr_.shm.memfile_reserve_percent;
       attributes.memfile_min_size_bytes  = attr_.shm.memfile_min_size_bytes;
+      attributes.memfile_ring_slots      = attr_.shm.memfile_ring_slots;
+      attributes.futex_notification      = attr_.shm.futex_notification;
+      attributes.memfile_huge_pages      = attr_.shm.memfile_huge_pages;
+      attributes.memfile_prefault        = attr_.shm.memfile_prefault;
+      attributes.memfile_numa_node       = attr_.shm.memfile_numa_node;
 
       attributes.topic_name = attr_.topic_name;
       attributes.host_name  = attr_.host_name;
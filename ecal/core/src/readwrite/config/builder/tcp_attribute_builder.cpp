@@ -43,6 +43,7 @@ namespace eCAL
       attributes.topic_name = attr_.topic_name;
       attributes.topic_id   = topic_id_;
       attributes.thread_pool_size = attr_.tcp.thread_pool_size;
+      attributes.batch            = attr_.tcp.batch;
       
       return attributes;
     }
@@ -29,11 +29,14 @@ namespace eCAL
     {
       UDP::SAttributes attributes;
 
-      attributes.loopback       = true;
-      attributes.receive_buffer = attr_.udp.receivebuffer;
-      attributes.port           = attr_.udp.port;
-      attributes.broadcast      = attr_.udp.broadcast;
-      attributes.address        = attr_.udp.group;
+      attributes.loopback        = true;
+      attributes.receive_buffer  = attr_.udp.receivebuffer;
+      attributes.port            = attr_.udp.port;
+      attributes.broadcast       = attr_.udp.broadcast;
+      attributes.address         = attr_.udp.group;
+      attributes.mmsg            = attr_.udp.mmsg;
+      attributes.receive_threads = attr_.udp.receive_threads;
+      attributes.max_message_size = attr_.udp.max_message_size;
 
       return attributes;
     }    
@@ -54,7 +57,9 @@ namespace eCAL
       attributes.port        = attr_.udp.port;
       attributes.address     = attr_.udp.group;
       attributes.ttl         = attr_.udp.ttl;
-
+      attributes.mmsg        = attr_.udp.mmsg;
+      attributes.fec_redundancy_percent = attr_.udp.fec_redundancy_percent;
+      attributes.batch       = attr_.udp.batch;
 
       return attributes;
     }
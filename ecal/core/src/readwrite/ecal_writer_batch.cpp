@@ -0,0 +1,106 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  data writer sample batch
+**/
+
+#include "ecal_writer_batch.h"
+
+#include <chrono>
+#include <utility>
+
+namespace eCAL
+{
+  CWriterBatch::CWriterBatch(const eCALWriter::Batch::SAttributes& attr_, FlushCallbackT flush_callback_) :
+    m_attributes(attr_),
+    m_flush_callback(std::move(flush_callback_))
+  {
+    m_payloads.reserve(m_attributes.max_size_bytes);
+
+    // send the collected samples at the latest after the linger time (0 == full batches only)
+    if (m_attributes.linger_time_us > 0)
+    {
+      m_linger_thread = std::make_unique<CCallbackThread>([this]() { Flush(); });
+      m_linger_thread->start(std::chrono::microseconds(m_attributes.linger_time_us));
+    }
+  }
+
+  CWriterBatch::~CWriterBatch()
+  {
+    if (m_linger_thread) m_linger_thread->stop();
+
+    // send what is left
+    Flush();
+  }
+
+  bool CWriterBatch::Add(const void* const buf_, const SWriterAttr& attr_)
+  {
+    const std::lock_guard<std::mutex> lock(m_batch_mtx);
+
+    // the sample does not fit into the current batch anymore
+    bool sent(true);
+    if (!m_contents.empty() && (m_payloads.size() + attr_.len > m_attributes.max_size_bytes))
+    {
+      sent = FlushLocked();
+    }
+
+    // append header and payload
+    m_contents.emplace_back();
+    auto& content = m_contents.back();
+    content.id    = attr_.id;
+    content.clock = attr_.clock;
+    content.time  = attr_.time;
+    content.hash  = static_cast<int64_t>(attr_.hash);
+    content.size  = static_cast<int32_t>(attr_.len);
+
+    if (attr_.len > 0)
+    {
+      const auto* payload = static_cast<const char*>(buf_);
+      m_payloads.insert(m_payloads.end(), payload, payload + attr_.len);
+    }
+
+    // batch is full
+    if ((m_payloads.size() >= m_attributes.max_size_bytes) || (m_contents.size() >= max_batch_samples))
+    {
+      sent &= FlushLocked();
+    }
+
+    return sent;
+  }
+
+  bool CWriterBatch::Flush()
+  {
+    const std::lock_guard<std::mutex> lock(m_batch_mtx);
+    return FlushLocked();
+  }
+
+  bool CWriterBatch::FlushLocked()
+  {
+    if (m_contents.empty()) return true;
+
+    const bool sent = m_flush_callback(m_contents, m_payloads);
+
+    // keep the capacity for the next batch
+    m_contents.clear();
+    m_payloads.clear();
+
+    return sent;
+  }
+}
@@ -0,0 +1,90 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  data writer sample batch
+**/
+
+#pragma once
+
+#include "config/attributes/writer_batch_attributes.h"
+#include "readwrite/ecal_writer_data.h"
+#include "serialization/ecal_struct_sample_payload.h"
+#include "util/ecal_thread.h"
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace eCAL
+{
+  /**
+   * @brief Collects the samples of a data writer and hands them over as one batch, as soon as
+   *        the collected payload reaches the maximum batch size or the linger time expired.
+  **/
+  class CWriterBatch
+  {
+  public:
+    /**
+     * @brief Called with the collected sample contents and their payloads, stored one after another
+     *        in the order of the contents (the payload size of a content is stored in content.size).
+    **/
+    using FlushCallbackT = std::function<bool(const std::vector<Payload::Content>& contents_, const std::vector<char>& payloads_)>;
+
+    CWriterBatch(const eCALWriter::Batch::SAttributes& attr_, FlushCallbackT flush_callback_);
+    ~CWriterBatch();
+
+    CWriterBatch(const CWriterBatch&) = delete;
+    CWriterBatch& operator=(const CWriterBatch&) = delete;
+    CWriterBatch(CWriterBatch&&) = delete;
+    CWriterBatch& operator=(CWriterBatch&&) = delete;
+
+    /**
+     * @brief Store a sample in the current batch, the batch is sent if it is full.
+     *
+     * @return  true if the sample is queued, that does not mean it has been sent. false if a
+     *          batch that was sent by this call failed (that batch may not contain this sample).
+     *          Batches sent by the linger time are not reported.
+    **/
+    bool Add(const void* buf_, const SWriterAttr& attr_);
+
+    /**
+     * @brief Send the current batch.
+     *
+     * @return  true if the batch was sent or there was nothing to send.
+    **/
+    bool Flush();
+
+  private:
+    // limits the header size of a batch (the tcp frame header size field has 16 bit)
+    static constexpr size_t max_batch_samples = 1000;
+
+    bool FlushLocked();
+
+    eCALWriter::Batch::SAttributes   m_attributes;
+    FlushCallbackT                   m_flush_callback;
+
+    std::mutex                       m_batch_mtx;
+    std::vector<Payload::Content>    m_contents;
+    std::vector<char>                m_payloads;
+
+    std::unique_ptr<CCallbackThread> m_linger_thread;
+  };
+}
@@ -24,6 +24,8 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <vector>
 
 namespace eCAL
 {
@@ -37,5 +39,8 @@ namespace eCAL
     bool         loopback               = false;
     bool         zero_copy              = false;
     long long    acknowledge_timeout_ms = 0;
+    bool         replayed               = false;   // sample replayed from the publisher history (older clock than the last written sample)
+
+    const std::vector<int32_t>* skip_process_ids = nullptr;   // local processes not to notify (all their subscribers filter the sample)
   };
 }
@@ -33,6 +33,11 @@ namespace eCAL
         unsigned int memfile_buffer_count;
         unsigned int memfile_min_size_bytes;
         unsigned int memfile_reserve_percent;
+        unsigned int memfile_ring_slots;
+        bool         futex_notification;
+        bool         memfile_huge_pages;
+        bool         memfile_prefault;
+        int          memfile_numa_node;
 
         std::string host_name;
         std::string topic_name;
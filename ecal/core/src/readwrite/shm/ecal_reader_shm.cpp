@@ -61,25 +61,22 @@ namespace eCAL
         topic_info.topic_id   = par_.topic_id;
         topic_info.process_id = par_.process_id;
 
-        auto data_callback = [this, topic_info](const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_)->size_t
+        // the topic is fixed for a memory file, so its dispatch key is computed once
+        const size_t topic_hash = CSubGate::TopicHash(topic_info.topic_name);
+
+        auto data_callback = [this, topic_hash, topic_info](const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, bool replayed_, const std::shared_ptr<CSamplePin>& pin_)->bool
         {
-          return OnNewShmFileContent(topic_info, buf_, len_, id_, clock_, time_, hash_);
+          return OnNewShmFileContent(topic_hash, topic_info, buf_, len_, id_, clock_, time_, hash_, replayed_, pin_);
         };
-        memfile_pool->ObserveFile(memfile_name, memfile_event, m_attributes.registration_timeout_ms, data_callback);
+        memfile_pool->ObserveFile(memfile_name, memfile_event, m_attributes.process_id, m_attributes.registration_timeout_ms, data_callback);
       }
     }
   }
 
-  size_t CSHMReaderLayer::OnNewShmFileContent(const Payload::TopicInfo& topic_info_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_)
+  bool CSHMReaderLayer::OnNewShmFileContent(const size_t topic_hash_, const Payload::TopicInfo& topic_info_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, bool replayed_, const std::shared_ptr<CSamplePin>& pin_)
   {
     auto subgate = g_subgate();
-    if (subgate)
-    {
-      if (subgate->ApplySample(topic_info_, buf_, len_, id_, clock_, time_, hash_, tl_ecal_shm))
-      {
-        return len_;
-      }
-    }
-    return 0;
+    if (subgate) return subgate->ApplySample(topic_hash_, topic_info_, buf_, len_, id_, clock_, time_, hash_, tl_ecal_shm, replayed_, pin_);
+    return false;
   }
 }
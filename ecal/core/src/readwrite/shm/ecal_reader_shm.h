@@ -27,6 +27,7 @@
 #include "readwrite/ecal_reader_layer.h"
 #include "serialization/ecal_struct_sample_payload.h"
 #include "config/attributes/reader_shm_attributes.h"
+#include "util/sample_pin.h"
 
 #include <cstddef>
 #include <memory>
@@ -50,7 +51,7 @@ namespace eCAL
     void SetConnectionParameter(SReaderLayerPar& par_) override;
 
   private:
-    size_t OnNewShmFileContent(const Payload::TopicInfo& topic_info_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_);
+    bool OnNewShmFileContent(size_t topic_hash_, const Payload::TopicInfo& topic_info_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, bool replayed_, const std::shared_ptr<CSamplePin>& pin_);
 
     eCAL::eCALReader::SHM::SAttributes m_attributes;
   };
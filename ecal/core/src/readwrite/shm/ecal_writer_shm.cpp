@@ -37,6 +37,8 @@ namespace eCAL
   {
     // initialize memory file buffer
     if (m_attributes.memfile_buffer_count < 1) m_attributes.memfile_buffer_count = 1;
+    // a lock-free ring is one memory file with multiple slots
+    if (m_attributes.memfile_ring_slots > 0)   m_attributes.memfile_buffer_count = 1;
     SetBufferCount(m_attributes.memfile_buffer_count);
   }
 
@@ -83,6 +85,28 @@ namespace eCAL
     return sent;
   }
 
+  void* CDataWriterSHM::Loan(const SWriterAttr& attr_)
+  {
+    // PrepareWrite has already selected and sized the memory file
+    return m_memory_file_vec[m_write_idx]->Loan(attr_.len);
+  }
+
+  bool CDataWriterSHM::CommitLoan(const SWriterAttr& attr_)
+  {
+    const bool sent = m_memory_file_vec[m_write_idx]->CommitLoan(attr_);
+
+    // and increment file index
+    m_write_idx++;
+    m_write_idx %= m_memory_file_vec.size();
+
+    return sent;
+  }
+
+  void CDataWriterSHM::ReturnLoan()
+  {
+    m_memory_file_vec[m_write_idx]->ReturnLoan();
+  }
+
   void CDataWriterSHM::ApplySubscription(const std::string& host_name_, const int32_t process_id_, const EntityIdT& topic_id_, const std::string& /*conn_par_*/)
   {
     // we accept local connections only
@@ -159,6 +183,23 @@ namespace eCAL
     return connection_par;
   }
 
+  SyncMemoryFileAckStatisticsMapT CDataWriterSHM::GetAckStatistics() const
+  {
+    // merge the statistics of all memory files per subscriber process
+    SyncMemoryFileAckStatisticsMapT ack_statistics;
+    for (const auto& memory_file : m_memory_file_vec)
+    {
+      for (const auto& memfile_statistics : memory_file->GetAckStatistics())
+      {
+        auto& statistics = ack_statistics[memfile_statistics.first];
+        statistics.acknowledge_count += memfile_statistics.second.acknowledge_count;
+        statistics.timeout_count     += memfile_statistics.second.timeout_count;
+        statistics.latency.Add(memfile_statistics.second.latency);
+      }
+    }
+    return ack_statistics;
+  }
+
   bool CDataWriterSHM::SetBufferCount(size_t buffer_count_)
   {
     // no need to adapt anything
@@ -177,6 +218,12 @@ namespace eCAL
     memory_file_attr.reserve         = m_attributes.memfile_reserve_percent;
     memory_file_attr.timeout_open_ms = PUB_MEMFILE_OPEN_TO;
     memory_file_attr.timeout_ack_ms  = m_attributes.acknowledge_timeout_ms;
+    memory_file_attr.ring_slots         = m_attributes.memfile_ring_slots;
+    memory_file_attr.ring_pin_slots     = PUB_MEMFILE_RING_PIN_SLOTS;
+    memory_file_attr.futex_notification = m_attributes.futex_notification;
+    memory_file_attr.allocation.huge_pages = m_attributes.memfile_huge_pages;
+    memory_file_attr.allocation.prefault   = m_attributes.memfile_prefault;
+    memory_file_attr.allocation.numa_node  = m_attributes.memfile_numa_node;
 
     // retrieve the memory file size of existing files
     size_t memory_file_size(0);
@@ -49,11 +49,17 @@ namespace eCAL
 
     bool Write(CPayloadWriter& payload_, const SWriterAttr& attr_) override;
 
+    void* Loan(const SWriterAttr& attr_);
+    bool CommitLoan(const SWriterAttr& attr_);
+    void ReturnLoan();
+
     void ApplySubscription(const std::string& host_name_, int32_t process_id_, const EntityIdT& topic_id_, const std::string& conn_par_) override;
     void RemoveSubscription(const std::string& host_name_, int32_t process_id_, const EntityIdT& topic_id_) override;
 
     Registration::ConnectionPar GetConnectionParameter() override;
 
+    SyncMemoryFileAckStatisticsMapT GetAckStatistics() const;
+
   protected:
     bool SetBufferCount(size_t buffer_count_);
 
@@ -19,6 +19,8 @@
 
 #pragma once
 
+#include "readwrite/config/attributes/writer_batch_attributes.h"
+
 #include <cstddef>
 #include <cstdint>
 #include <string>
@@ -35,6 +37,8 @@ namespace eCAL
         uint64_t    topic_id;
 
         size_t thread_pool_size;
+
+        Batch::SAttributes batch;
       };
     }
   }
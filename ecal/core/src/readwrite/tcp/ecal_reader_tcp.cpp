@@ -109,11 +109,38 @@ namespace eCAL
     // extract data payload
     const char* data_payload   = header_payload + header_size;
 
-    // parse header
+    // parse header (the command type is not sent by every writer version)
+    m_ecal_header.cmd_type = bct_none;
     if (DeserializeFromBuffer(header_payload, header_size, m_ecal_header))
     {
       auto subgate = g_subgate();
-      if (subgate)
+      if (subgate && (m_ecal_header.cmd_type == bct_set_sample_batch))
+      {
+        // the payloads of the batch follow the header one after another
+        const auto& ecal_header_topic_info = m_ecal_header.topic_info;
+        const size_t      topic_hash       = CSubGate::TopicHash(ecal_header_topic_info.topic_name);
+        const char* const data_payload_end = data_.buffer_->data() + data_.buffer_->size();
+        const char*       content_payload  = data_payload;
+        for (const auto& ecal_header_content : m_ecal_header.batch)
+        {
+          const auto content_size = static_cast<size_t>(ecal_header_content.size);
+          if (content_size > static_cast<size_t>(data_payload_end - content_payload)) break;
+
+          subgate->ApplySample(
+            topic_hash,
+            ecal_header_topic_info,
+            content_payload,
+            content_size,
+            ecal_header_content.id,
+            ecal_header_content.clock,
+            ecal_header_content.time,
+            static_cast<size_t>(ecal_header_content.hash),
+            tl_ecal_tcp);
+
+          content_payload += content_size;
+        }
+      }
+      else if (subgate)
       {
         // use this intermediate variables as optimization
         const auto& ecal_header_topic_info = m_ecal_header.topic_info;
@@ -127,7 +154,8 @@ namespace eCAL
           ecal_header_content.clock,
           ecal_header_content.time,
           ecal_header_content.hash,
-          tl_ecal_tcp);
+          tl_ecal_tcp,
+          m_ecal_header.cmd_type == bct_set_sample_replay);
       }
     }
   }
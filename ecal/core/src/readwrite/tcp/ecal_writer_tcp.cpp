@@ -24,6 +24,7 @@
 #include <ecal/config.h>
 #include <ecal/process.h>
 
+#include "serialization/ecal_serialize_sample_header.h"
 #include "serialization/ecal_serialize_sample_payload.h"
 
 #include "ecal_writer_tcp.h"
@@ -52,6 +53,27 @@ namespace eCAL
     // create publisher
     m_publisher = std::make_shared<tcp_pubsub::Publisher>(g_tcp_writer_executor);
     m_port      = m_publisher->getPort();
+
+    // encode the frame header of a single sample once, a sample only patches its content fields
+    Payload::TopicInfo topic_info;
+    topic_info.topic_name = m_attributes.topic_name;
+    topic_info.topic_id   = m_attributes.topic_id;
+    const Payload::CFixedSampleHeader unpadded_sample_header(topic_info, false);
+    m_sample_header = Payload::CFixedSampleHeader(topic_info, false, FramePaddingSize(unpadded_sample_header.Size()));
+    CreateFrameHeader(m_sample_header.Data(), m_sample_header_buffer);
+    const Payload::CFixedSampleHeader unpadded_replay_header(topic_info, false, 0, eCmdType::bct_set_sample_replay);
+    m_replay_header = Payload::CFixedSampleHeader(topic_info, false, FramePaddingSize(unpadded_replay_header.Size()), eCmdType::bct_set_sample_replay);
+    CreateFrameHeader(m_replay_header.Data(), m_replay_header_buffer);
+
+    // collect samples and send them in one frame
+    if (m_attributes.batch.enable)
+    {
+      m_batch_header.cmd_type              = eCmdType::bct_set_sample_batch;
+      m_batch_header.topic_info.topic_name = m_attributes.topic_name;
+      m_batch_header.topic_info.topic_id   = m_attributes.topic_id;
+
+      m_batch = std::make_unique<CWriterBatch>(m_attributes.batch, [this](const std::vector<Payload::Content>& contents_, const std::vector<char>& payloads_) { return WriteBatch(contents_, payloads_); });
+    }
   }
 
   SWriterInfo CDataWriterTCP::GetInfo()
@@ -73,34 +95,34 @@ namespace eCAL
   {
     if (!m_publisher) return false;
 
-    // create new payload sample (header information only, no payload)
-    Payload::Sample proto_header;
-    auto& proto_header_topic = proto_header.topic_info;
-    proto_header_topic.topic_name = m_attributes.topic_name;
-    proto_header_topic.topic_id   = m_attributes.topic_id;
+    // a replayed history sample is sent on its own and marked, so subscribers accept its older clock
+    if (attr_.replayed) return WriteSingle(m_replay_header, m_replay_header_buffer, buf_, attr_);
 
-    // set payload content (without payload)
-    auto& proto_header_content = proto_header.content;
-    proto_header_content.id    = attr_.id;
-    proto_header_content.clock = attr_.clock;
-    proto_header_content.time  = attr_.time;
-    proto_header_content.hash  = static_cast<int64_t>(attr_.hash);
-    proto_header_content.size  = static_cast<int32_t>(attr_.len); // we use this size attribute for "header only"
+    // add sample to the current batch
+    if (m_batch) return m_batch->Add(buf_, attr_);
 
-    // Compute size of "ECAL" pre-header
-    constexpr size_t ecal_magic_size(4 * sizeof(char));
+    return WriteSingle(m_sample_header, m_sample_header_buffer, buf_, attr_);
+  }
 
-    // Serialize payload sample
-    std::vector<char> serialized_proto_header;
-    SerializeToBuffer(proto_header, serialized_proto_header);
+  bool CDataWriterTCP::WriteSingle(const Payload::CFixedSampleHeader& header_, std::vector<char>& header_buffer_, const void* const buf_, const SWriterAttr& attr_)
+  {
+    // patch the content fields of the pre-encoded header (header information only, no payload)
+    // we use the size attribute for "header only"
+    header_.PatchContent(header_buffer_.data() + frame_prefix_size, attr_.id, attr_.clock, attr_.time, static_cast<int64_t>(attr_.hash), static_cast<int32_t>(attr_.len));
 
-    // Get size of un-altered proto header size
-    auto proto_header_size = static_cast<uint16_t>(serialized_proto_header.size());
+    // send header and payload
+    return SendFrame(header_buffer_, static_cast<const char*>(buf_), attr_.len);
+  }
 
-    // Compute needed padding for aligning the payload
-    constexpr size_t alignment_bytes     = 8;
-    const     size_t minimal_header_size = ecal_magic_size +  sizeof(uint16_t)    +  proto_header_size;
-    const     size_t padding_size        = (alignment_bytes - (minimal_header_size % alignment_bytes)) % alignment_bytes;
+  bool CDataWriterTCP::WriteBatch(const std::vector<Payload::Content>& contents_, const std::vector<char>& payloads_)
+  {
+    // the batch header holds the contents only, the payloads follow the header one after another
+    m_batch_header.batch = contents_;
+    m_batch_header.padding.clear();
+
+    // Serialize payload sample
+    std::vector<char> serialized_proto_header;
+    SerializeToBuffer(m_batch_header, serialized_proto_header);
 
     // Add more bytes to the protobuf message to blow it up to the alignment
     // Aligning the user payload this way should be 100% compatible with previous
@@ -108,37 +130,59 @@ namespace eCAL
     // in a future eCAL version.
     // 
     // TODO: REMOVE ME FOR ECAL6
-    proto_header.padding.resize(padding_size);
+    m_batch_header.padding.resize(FramePaddingSize(serialized_proto_header.size()));
 
-    // Serialize payload sample again (now with padding) and reread size
+    // Serialize payload sample again (now with padding)
     serialized_proto_header.clear();
-    SerializeToBuffer(proto_header, serialized_proto_header);
-    proto_header_size = static_cast<uint16_t>(serialized_proto_header.size());
+    SerializeToBuffer(m_batch_header, serialized_proto_header);
+    CreateFrameHeader(serialized_proto_header, m_header_buffer);
+
+    // send header and payloads
+    return SendFrame(m_header_buffer, payloads_.data(), payloads_.size());
+  }
+
+  size_t CDataWriterTCP::FramePaddingSize(size_t proto_header_size_)
+  {
+    // Compute needed padding for aligning the payload
+    constexpr size_t alignment_bytes     = 8;
+    const     size_t minimal_header_size = frame_prefix_size + proto_header_size_;
+    return (alignment_bytes - (minimal_header_size % alignment_bytes)) % alignment_bytes;
+  }
+
+  void CDataWriterTCP::CreateFrameHeader(const std::vector<char>& serialized_proto_header_, std::vector<char>& header_buffer_)
+  {
+    // Compute size of "ECAL" pre-header
+    constexpr size_t ecal_magic_size(4 * sizeof(char));
+    const auto proto_header_size = static_cast<uint16_t>(serialized_proto_header_.size());
 
     // prepare the header buffer
-    //                    'ECAL'           + proto header size field  + proto header
-    m_header_buffer.resize(ecal_magic_size + sizeof(uint16_t)         + proto_header_size);
+    //                   'ECAL'           + proto header size field  + proto header
+    header_buffer_.resize(ecal_magic_size + sizeof(uint16_t)         + proto_header_size);
 
     // add magic ecal header :-)
-    m_header_buffer[0] = 'E';
-    m_header_buffer[1] = 'C';
-    m_header_buffer[2] = 'A';
-    m_header_buffer[3] = 'L';
+    header_buffer_[0] = 'E';
+    header_buffer_[1] = 'C';
+    header_buffer_[2] = 'A';
+    header_buffer_[3] = 'L';
 
     // set proto header size right after magic ecal header
-    *reinterpret_cast<uint16_t*>(&m_header_buffer[ecal_magic_size]) = htole16(proto_header_size);
+    const uint16_t proto_header_size_le = htole16(proto_header_size);
+    memcpy(&header_buffer_[ecal_magic_size], &proto_header_size_le, sizeof(uint16_t));
 
     // copy serialized proto header right after sample size field
-    memcpy((void*)(m_header_buffer.data() + ecal_magic_size + sizeof(uint16_t)), serialized_proto_header.data(), serialized_proto_header.size());
+    memcpy((void*)(header_buffer_.data() + frame_prefix_size), serialized_proto_header_.data(), serialized_proto_header_.size());
+  }
 
+  bool CDataWriterTCP::SendFrame(const std::vector<char>& header_buffer_, const char* payload_, size_t payload_len_)
+  {
     // create tcp send buffer
     std::vector<std::pair<const char* const, const size_t>> send_vec;
     send_vec.reserve(2);
 
     // push header data
-    send_vec.emplace_back(m_header_buffer.data(), m_header_buffer.size());
+    send_vec.emplace_back(header_buffer_.data(), header_buffer_.size());
     // push payload data
-    send_vec.emplace_back(static_cast<const char*>(buf_), attr_.len);
+    send_vec.emplace_back(payload_, payload_len_);
 
     // send it
     const bool success = m_publisher->send(send_vec);
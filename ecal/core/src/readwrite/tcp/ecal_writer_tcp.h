@@ -26,10 +26,14 @@
 #include "config/attributes/data_writer_tcp_attributes.h"
 
 #include "readwrite/ecal_writer_base.h"
+#include "readwrite/ecal_writer_batch.h"
+#include "serialization/ecal_serialize_sample_header.h"
 
 #include <tcp_pubsub/executor.h>
 #include <tcp_pubsub/publisher.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -49,14 +53,30 @@ namespace eCAL
     Registration::ConnectionPar GetConnectionParameter() override;
 
   private:
+    bool WriteSingle(const Payload::CFixedSampleHeader& header_, std::vector<char>& header_buffer_, const void* buf_, const SWriterAttr& attr_);
+    bool WriteBatch(const std::vector<Payload::Content>& contents_, const std::vector<char>& payloads_);
+    bool SendFrame(const std::vector<char>& header_buffer_, const char* payload_, size_t payload_len_);
+
+    // frame header: 'ECAL' + proto header size field + proto header (padded to align the payload)
+    static constexpr size_t frame_prefix_size = 4 * sizeof(char) + sizeof(uint16_t);
+    static size_t FramePaddingSize(size_t proto_header_size_);
+    static void   CreateFrameHeader(const std::vector<char>& serialized_proto_header_, std::vector<char>& header_buffer_);
+
     eCAL::eCALWriter::TCP::SAttributes           m_attributes;
 
     std::vector<char>                            m_header_buffer;
+    Payload::CFixedSampleHeader                  m_sample_header;
+    std::vector<char>                            m_sample_header_buffer;   // frame header of a single sample
+    Payload::CFixedSampleHeader                  m_replay_header;
+    std::vector<char>                            m_replay_header_buffer;   // frame header of a single replayed history sample
 
     static std::mutex                            g_tcp_writer_executor_mtx;
     static std::shared_ptr<tcp_pubsub::Executor> g_tcp_writer_executor;
 
     std::shared_ptr<tcp_pubsub::Publisher>       m_publisher;
     uint16_t                                     m_port = 0;
+
+    Payload::Sample                              m_batch_header;
+    std::unique_ptr<CWriterBatch>                m_batch;
   };
 }
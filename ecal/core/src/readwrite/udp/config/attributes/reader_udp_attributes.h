@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 namespace eCAL
@@ -34,6 +35,9 @@ namespace eCAL
         bool        broadcast;
         bool        loopback;
         int         receive_buffer;
+        bool        mmsg;
+        size_t      receive_threads;
+        size_t      max_message_size;
       };
     }
   }
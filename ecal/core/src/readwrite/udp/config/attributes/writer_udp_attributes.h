@@ -19,6 +19,8 @@
 
 #pragma once
 
+#include "readwrite/config/attributes/writer_batch_attributes.h"
+
 #include <cstdint>
 #include <string>
 
@@ -36,10 +38,14 @@ namespace eCAL
         bool        broadcast;
         bool        loopback;
         int         send_buffer;
+        bool        mmsg;
+        unsigned int fec_redundancy_percent;
 
         std::string host_name;
         std::string topic_name;
         uint64_t    topic_id;
+
+        Batch::SAttributes batch;
       };
     }
   }
@@ -34,6 +34,8 @@ namespace eCAL
         receiver_attr.rcvbuf    = attr_.receive_buffer;
         receiver_attr.port      = attr_.port;
         receiver_attr.address   = attr_.address;
+        receiver_attr.mmsg      = attr_.mmsg;
+        receiver_attr.max_message_size = attr_.max_message_size;
 
         return receiver_attr;
       }
@@ -54,6 +56,8 @@ namespace eCAL
         sender_attr.port      = attr_.port;
         sender_attr.address   = attr_.address;
         sender_attr.ttl       = attr_.ttl;
+        sender_attr.mmsg      = attr_.mmsg;
+        sender_attr.fec_redundancy_percent = attr_.fec_redundancy_percent;
 
         return sender_attr;
       }
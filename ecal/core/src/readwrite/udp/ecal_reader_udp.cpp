@@ -28,9 +28,11 @@
 #include "ecal_global_accessors.h"
 
 #include "io/udp/ecal_udp_configurations.h"
+#include "io/udp/ecal_udp_topic2mcast.h"
 #include "pubsub/ecal_subgate.h"
 #include "config/builder/udp_attribute_builder.h"
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <string>
@@ -41,28 +43,36 @@ namespace eCAL
   ////////////////
   // LAYER
   ////////////////
-  CUDPReaderLayer::CUDPReaderLayer() : m_started(false)
-  {}
+  CUDPReaderLayer::CUDPReaderLayer() = default;
 
   CUDPReaderLayer::~CUDPReaderLayer() = default;
 
   void CUDPReaderLayer::Initialize(const eCAL::eCALReader::UDP::SAttributes& attr_)
   {
      m_attributes = attr_;
+
+     // the layer is initialized by every subscriber, the receiver count is fixed by the first one
+     if (!m_payload_receivers.empty()) return;
+
+     // topics are distributed across multiple receivers by their multicast group,
+     // this needs the linux IP_MULTICAST_ALL socket option and is not possible in broadcast mode
+     size_t receiver_count = 1;
+#ifdef __linux__
+     if (!m_attributes.broadcast) receiver_count = std::max<size_t>(m_attributes.receive_threads, 1);
+#endif
+     m_payload_receivers.resize(receiver_count);
   }
 
   void CUDPReaderLayer::AddSubscription(const std::string& /*host_name_*/, const std::string& topic_name_, const EntityIdT& /*topic_id_*/)
   {
-    if (!m_started)
-    {      
-      // start payload sample receiver
-      m_payload_receiver = std::make_shared<UDP::CSampleReceiver>(
-        eCALReader::UDP::ConvertToIOUDPReceiverAttributes(m_attributes), 
-        std::bind(&CUDPReaderLayer::HasSample, this, std::placeholders::_1), 
-        std::bind(&CUDPReaderLayer::ApplySample, this, std::placeholders::_1, std::placeholders::_2)
-      );
-
-      m_started = true;
+    // a single receiver gets all multicast groups of the host
+    if (m_payload_receivers.size() == 1)
+    {
+      if (!m_payload_receivers[0])
+      {
+        // start payload sample receiver
+        m_payload_receivers[0] = CreatePayloadReceiver(m_attributes.address);
+      }
     }
 
     // we use udp broadcast in local mode
@@ -73,7 +83,17 @@ namespace eCAL
     if (m_topic_name_mcast_map.find(mcast_address) == m_topic_name_mcast_map.end())
     {
       m_topic_name_mcast_map.emplace(std::pair<std::string, int>(mcast_address, 0));
-      m_payload_receiver->AddMultiCastGroup(mcast_address.c_str());
+
+      auto& payload_receiver = m_payload_receivers[UDP::mcast2shard(mcast_address, m_payload_receivers.size())];
+      if (!payload_receiver)
+      {
+        // start the payload sample receiver of this shard, it joins the multicast group on creation
+        payload_receiver = CreatePayloadReceiver(mcast_address);
+      }
+      else
+      {
+        payload_receiver->AddMultiCastGroup(mcast_address.c_str());
+      }
     }
     m_topic_name_mcast_map[mcast_address]++;
   }
@@ -93,12 +113,28 @@ namespace eCAL
       m_topic_name_mcast_map[mcast_address]--;
       if (m_topic_name_mcast_map[mcast_address] == 0)
       {
-        m_payload_receiver->RemMultiCastGroup(mcast_address.c_str());
+        m_payload_receivers[UDP::mcast2shard(mcast_address, m_payload_receivers.size())]->RemMultiCastGroup(mcast_address.c_str());
         m_topic_name_mcast_map.erase(mcast_address);
       }
     }
   }
   
+  std::shared_ptr<UDP::CSampleReceiver> CUDPReaderLayer::CreatePayloadReceiver(const std::string& mcast_address_)
+  {
+    auto receiver_attr = eCALReader::UDP::ConvertToIOUDPReceiverAttributes(m_attributes);
+    receiver_attr.address   = mcast_address_;
+    // with multiple receivers every receiver gets the datagrams of its own multicast groups only,
+    // so sample reassembly and dispatching of a group stays on the thread of its receiver
+    receiver_attr.mcast_all = m_payload_receivers.size() == 1;
+
+    return std::make_shared<UDP::CSampleReceiver>(
+      receiver_attr,
+      std::bind(&CUDPReaderLayer::HasSample, this, std::placeholders::_1),
+      std::bind(&CUDPReaderLayer::ApplySample, this, std::placeholders::_1, std::placeholders::_2),
+      std::bind(&CUDPReaderLayer::ApplyFecResult, this, std::placeholders::_1, std::placeholders::_2)
+    );
+  }
+
   bool CUDPReaderLayer::HasSample(const std::string& sample_name_)
   {
     auto subgate = g_subgate();
@@ -112,4 +148,10 @@ namespace eCAL
     if (subgate) return subgate->ApplySample(serialized_sample_data_, serialized_sample_size_, tl_ecal_udp);
     return false;
   }
+
+  void CUDPReaderLayer::ApplyFecResult(const std::string& sample_name_, bool recovered_)
+  {
+    auto subgate = g_subgate();
+    if (subgate) subgate->ApplyFecResult(sample_name_, recovered_);
+  }
 }
@@ -31,6 +31,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace eCAL
 {
@@ -53,10 +54,13 @@ namespace eCAL
   private:
     bool HasSample(const std::string& sample_name_);
     bool ApplySample(const char* serialized_sample_data_, size_t serialized_sample_size_);
+    void ApplyFecResult(const std::string& sample_name_, bool recovered_);
 
-    bool                                   m_started;
-    std::shared_ptr<UDP::CSampleReceiver>  m_payload_receiver;
-    std::map<std::string, int>             m_topic_name_mcast_map;
+    std::shared_ptr<UDP::CSampleReceiver> CreatePayloadReceiver(const std::string& mcast_address_);
+
+    // one receiver (socket + receive thread) per shard, created on the first subscription of the shard
+    std::vector<std::shared_ptr<UDP::CSampleReceiver>> m_payload_receivers;
+    std::map<std::string, int>                         m_topic_name_mcast_map;
 
     eCAL::eCALReader::UDP::SAttributes     m_attributes;
   };
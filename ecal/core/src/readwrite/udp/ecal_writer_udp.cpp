@@ -30,6 +30,7 @@
 #include "config/builder/udp_attribute_builder.h"
 
 #include <cstddef>
+#include <cstring>
 
 namespace eCAL
 {
@@ -43,6 +44,28 @@ namespace eCAL
     // create udp/sample sender without activated loop-back
     m_attributes.loopback = false;
     m_sample_sender_no_loopback = std::make_shared<UDP::CSampleSender>(eCAL::eCALWriter::UDP::ConvertToIOUDPSenderAttributes(m_attributes));
+
+    // encode the topic information once, a single sample only patches its content fields
+    Payload::TopicInfo topic_info;
+    topic_info.host_name  = m_attributes.host_name;
+    topic_info.topic_name = m_attributes.topic_name;
+    topic_info.topic_id   = m_attributes.topic_id;
+    m_sample_header        = Payload::CFixedSampleHeader(topic_info, true);
+    m_sample_header_buffer = m_sample_header.Data();
+    m_replay_header        = Payload::CFixedSampleHeader(topic_info, true, 0, eCmdType::bct_set_sample_replay);
+    m_replay_header_buffer = m_replay_header.Data();
+
+    // collect samples and send them in one datagram
+    if (m_attributes.batch.enable)
+    {
+      m_batch_sample.cmd_type              = eCmdType::bct_set_sample_batch;
+      m_batch_sample.topic_info.host_name  = m_attributes.host_name;
+      m_batch_sample.topic_info.topic_name = m_attributes.topic_name;
+      m_batch_sample.topic_info.topic_id   = m_attributes.topic_id;
+      m_batch_loopback                     = attr_.loopback;
+
+      m_batch = std::make_unique<CWriterBatch>(m_attributes.batch, [this](const std::vector<Payload::Content>& contents_, const std::vector<char>& payloads_) { return WriteBatch(contents_, payloads_); });
+    }
   }
 
   SWriterInfo CDataWriterUdpMC::GetInfo()
@@ -62,43 +85,71 @@ namespace eCAL
 
   bool CDataWriterUdpMC::Write(const void* const buf_, const SWriterAttr& attr_)
   {
-    // create new sample
-    Payload::Sample ecal_sample;
-    ecal_sample.cmd_type = eCmdType::bct_set_sample;
-
-    // fill sample info
-    auto& ecal_sample_topic_info = ecal_sample.topic_info;
-    ecal_sample_topic_info.host_name  = m_attributes.host_name;
-    ecal_sample_topic_info.topic_name = m_attributes.topic_name;
-    ecal_sample_topic_info.topic_id   = m_attributes.topic_id;
-
-    // append content
-    auto& ecal_sample_content = ecal_sample.content;
-    ecal_sample_content.id               = attr_.id;
-    ecal_sample_content.clock            = attr_.clock;
-    ecal_sample_content.time             = attr_.time;
-    ecal_sample_content.hash             = attr_.hash;
-    ecal_sample_content.payload.type     = Payload::pl_raw;
-    ecal_sample_content.payload.raw_addr = static_cast<const char*>(buf_);
-    ecal_sample_content.payload.raw_size = attr_.len;
+    // a replayed history sample is sent on its own and marked, so subscribers accept its older clock
+    if (attr_.replayed) return WriteSingle(m_replay_header, m_replay_header_buffer, buf_, attr_);
+
+    // add sample to the current batch
+    if (m_batch) return m_batch->Add(buf_, attr_);
+
+    return WriteSingle(m_sample_header, m_sample_header_buffer, buf_, attr_);
+  }
+
+  bool CDataWriterUdpMC::WriteSingle(const Payload::CFixedSampleHeader& header_, std::vector<char>& header_buffer_, const void* const buf_, const SWriterAttr& attr_)
+  {
+    // patch the content fields of the pre-encoded header and append the payload
+    const size_t header_size = header_.Size();
+    header_buffer_.resize(header_size + attr_.len);
+    header_.PatchContent(header_buffer_.data(), attr_.id, attr_.clock, attr_.time, static_cast<int64_t>(attr_.hash), 0, attr_.len);
+    if (attr_.len > 0) memcpy(header_buffer_.data() + header_size, buf_, attr_.len);
+
+    // send it
+    return SendBuffer(header_buffer_, attr_.loopback);
+  }
+
+  bool CDataWriterUdpMC::WriteBatch(const std::vector<Payload::Content>& contents_, const std::vector<char>& payloads_)
+  {
+    // point the batch contents to their payloads
+    auto& batch = m_batch_sample.batch;
+    batch = contents_;
+
+    size_t payload_offset(0);
+    for (auto& content : batch)
+    {
+      content.payload.type     = Payload::pl_raw;
+      content.payload.raw_addr = payloads_.data() + payload_offset;
+      content.payload.raw_size = static_cast<size_t>(content.size);
+      payload_offset += content.payload.raw_size;
+    }
 
     // send it
+    return SendSample(m_batch_sample, m_batch_loopback);
+  }
+
+  bool CDataWriterUdpMC::SendSample(const Payload::Sample& ecal_sample_, bool loopback_)
+  {
+    if (!SerializeToBuffer(ecal_sample_, m_sample_buffer))
+    {
+      Logging::Log(Logging::log_level_fatal, "CDataWriterUDP::Send failed to send message !");
+      return false;
+    }
+    return SendBuffer(m_sample_buffer, loopback_);
+  }
+
+  bool CDataWriterUdpMC::SendBuffer(const std::vector<char>& sample_buffer_, bool loopback_)
+  {
     size_t sent = 0;
-    if (SerializeToBuffer(ecal_sample, m_sample_buffer))
+    if (loopback_)
     {
-      if (attr_.loopback)
+      if (m_sample_sender_loopback)
       {
-        if (m_sample_sender_loopback)
-        {
-          sent = m_sample_sender_loopback->Send(ecal_sample.topic_info.topic_name, m_sample_buffer);
-        }
+        sent = m_sample_sender_loopback->Send(m_attributes.topic_name, sample_buffer_);
       }
-      else
+    }
+    else
+    {
+      if (m_sample_sender_no_loopback)
       {
-        if (m_sample_sender_no_loopback)
-        {
-          sent = m_sample_sender_no_loopback->Send(ecal_sample.topic_info.topic_name, m_sample_buffer);
-        }
+        sent = m_sample_sender_no_loopback->Send(m_attributes.topic_name, sample_buffer_);
       }
     }
 
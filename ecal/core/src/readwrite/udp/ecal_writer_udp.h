@@ -25,7 +25,9 @@
 
 #include "io/udp/ecal_udp_sample_sender.h"
 #include "readwrite/ecal_writer_base.h"
+#include "readwrite/ecal_writer_batch.h"
 #include "config/attributes/writer_udp_attributes.h"
+#include "serialization/ecal_serialize_sample_header.h"
 
 #include <memory>
 #include <string>
@@ -43,10 +45,23 @@ namespace eCAL
     bool Write(const void* buf_, const SWriterAttr& attr_) override;
 
   protected:
+    bool WriteSingle(const Payload::CFixedSampleHeader& header_, std::vector<char>& header_buffer_, const void* buf_, const SWriterAttr& attr_);
+    bool WriteBatch(const std::vector<Payload::Content>& contents_, const std::vector<char>& payloads_);
+    bool SendSample(const Payload::Sample& ecal_sample_, bool loopback_);
+    bool SendBuffer(const std::vector<char>& sample_buffer_, bool loopback_);
+
     std::vector<char>                   m_sample_buffer;
+    Payload::CFixedSampleHeader         m_sample_header;
+    std::vector<char>                   m_sample_header_buffer;   // pre-encoded header followed by the payload
+    Payload::CFixedSampleHeader         m_replay_header;
+    std::vector<char>                   m_replay_header_buffer;   // pre-encoded header of a replayed history sample followed by the payload
     std::shared_ptr<UDP::CSampleSender> m_sample_sender_loopback;
     std::shared_ptr<UDP::CSampleSender> m_sample_sender_no_loopback;
 
     eCALWriter::UDP::SAttributes        m_attributes;
+
+    Payload::Sample                     m_batch_sample;
+    bool                                m_batch_loopback = false;
+    std::unique_ptr<CWriterBatch>       m_batch;
   };
 }
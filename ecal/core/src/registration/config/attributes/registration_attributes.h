@@ -50,6 +50,13 @@ namespace eCAL
       size_t         queue_size;
     };
 
+    struct SDeltaAttributes
+    {
+      bool           enable;
+      unsigned int   statistics_cycles;
+      bool           descriptor_hashing;
+    };
+
     struct SAttributes
     {
       std::chrono::milliseconds timeout;
@@ -63,6 +70,7 @@ namespace eCAL
 
       SUDPAttributes            udp;
       SSHMAttributes            shm;
+      SDeltaAttributes          delta;
     };
   }
 }
@@ -0,0 +1,112 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL delta registration
+**/
+
+#include "registration/ecal_registration_delta.h"
+
+#include <algorithm>
+
+namespace eCAL
+{
+  namespace Registration
+  {
+    namespace
+    {
+      void AssignMethodCallCounts(const Util::CExpandingVector<Service::Method>& source_, Util::CExpandingVector<Service::Method>& target_)
+      {
+        const size_t method_count = std::min(source_.size(), target_.size());
+        for (size_t i = 0; i < method_count; ++i)
+        {
+          target_[i].call_count = source_[i].call_count;
+        }
+      }
+    }
+
+    void AssignRegistrationClock(const Registration::Sample& source_, Registration::Sample& target_)
+    {
+      target_.process.registration_clock = source_.process.registration_clock;
+      target_.service.registration_clock = source_.service.registration_clock;
+      target_.client.registration_clock  = source_.client.registration_clock;
+      target_.topic.registration_clock   = source_.topic.registration_clock;
+    }
+
+    void AssignStatistics(const Registration::Sample& source_, Registration::Sample& target_)
+    {
+      const auto& source_topic = source_.topic;
+      auto&       target_topic = target_.topic;
+      target_topic.connections_local      = source_topic.connections_local;
+      target_topic.connections_external   = source_topic.connections_external;
+      target_topic.message_drops          = source_topic.message_drops;
+      target_topic.data_id                = source_topic.data_id;
+      target_topic.data_clock             = source_topic.data_clock;
+      target_topic.data_frequency         = source_topic.data_frequency;
+      target_topic.fec_recovered_messages = source_topic.fec_recovered_messages;
+      target_topic.fec_lost_messages      = source_topic.fec_lost_messages;
+      target_topic.acknowledge_statistics = source_topic.acknowledge_statistics;
+      target_topic.callback_statistics    = source_topic.callback_statistics;
+      target_topic.latency_statistics     = source_topic.latency_statistics;
+
+      AssignMethodCallCounts(source_.service.methods, target_.service.methods);
+      AssignMethodCallCounts(source_.client.methods, target_.client.methods);
+    }
+
+    bool IsSameStructure(const Registration::Sample& lhs_, const Registration::Sample& rhs_)
+    {
+      Registration::Sample lhs_structure = lhs_;
+      AssignRegistrationClock(rhs_, lhs_structure);
+      AssignStatistics(rhs_, lhs_structure);
+      return lhs_structure == rhs_;
+    }
+
+    void ConvertToHeartbeatSample(Registration::Sample& sample_, uint64_t generation_)
+    {
+      const SampleIdentifier identifier = sample_.identifier;
+      const int32_t protocol_version    = sample_.protocol_version;
+
+      sample_.clear();
+      sample_.cmd_type         = bct_reg_heartbeat;
+      sample_.identifier       = identifier;
+      sample_.protocol_version = protocol_version;
+      sample_.generation       = generation_;
+    }
+
+    Registration::Sample CreateRequestSample(const Registration::Sample& sample_)
+    {
+      Registration::Sample request_sample;
+      request_sample.cmd_type              = bct_reg_request;
+      request_sample.identifier.entity_id  = static_cast<uint64_t>(sample_.identifier.process_id);
+      request_sample.identifier.process_id = sample_.identifier.process_id;
+      request_sample.identifier.host_name  = sample_.identifier.host_name;
+      request_sample.protocol_version      = REGISTRATION_PROTOCOL_VERSION;
+      return request_sample;
+    }
+
+    bool IsEntityRegistration(const Registration::Sample& sample_)
+    {
+      return sample_.cmd_type == bct_reg_client ||
+        sample_.cmd_type == bct_reg_process ||
+        sample_.cmd_type == bct_reg_publisher ||
+        sample_.cmd_type == bct_reg_service ||
+        sample_.cmd_type == bct_reg_subscriber;
+    }
+  }
+}
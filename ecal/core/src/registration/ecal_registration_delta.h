@@ -0,0 +1,282 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief eCAL delta registration
+ *
+ * Instead of the complete registration state of all entities, the registration provider sends
+ * the full state of an entity only if it changed and a small heartbeat (entity id + state generation) otherwise.
+ *
+ * CDeltaProvider turns the collected registration samples of one refresh cycle into full states and heartbeats.
+ * CDeltaReceiver caches the last full state of every remote entity and resolves the heartbeats to it.
+ * If a heartbeat does not match the cached state (lost or not yet received full state), the receiver
+ * requests the full registration state of the sending process.
+ *
+ * Samples with protocol version 0 come from eCAL versions without delta registration support.
+ * As long as such processes are registered, the provider sends the full state every cycle.
+ *
+**/
+
+#pragma once
+
+#include <registration/ecal_registration_types.h>
+#include <registration/ecal_registration_timeout_provider.h>
+#include <util/ecal_expmap.h>
+#include <util/ecal_expmap_wheel.h>
+
+#include "ecal_def.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace eCAL
+{
+  namespace Registration
+  {
+    // Copies the registration clock (changing with every refresh cycle) of all entity types
+    void AssignRegistrationClock(const Registration::Sample& source_, Registration::Sample& target_);
+
+    // Copies the entity statistics (data clock, frequency, drops, connection counts, method call counts, ..)
+    void AssignStatistics(const Registration::Sample& source_, Registration::Sample& target_);
+
+    // Returns true if both samples only differ in their registration clock and statistics
+    bool IsSameStructure(const Registration::Sample& lhs_, const Registration::Sample& rhs_);
+
+    // Turns a registration sample into the heartbeat of its entity
+    void ConvertToHeartbeatSample(Registration::Sample& sample_, uint64_t generation_);
+
+    // Creates the request for the full registration state of the process that sent the sample
+    Registration::Sample CreateRequestSample(const Registration::Sample& sample_);
+
+    bool IsEntityRegistration(const Registration::Sample& sample_);
+
+
+    template <class ClockType = std::chrono::steady_clock>
+    class CDeltaProvider
+    {
+    public:
+      CDeltaProvider(bool enable_, unsigned int statistics_cycles_, const typename ClockType::duration& legacy_timeout_)
+        : m_enable(enable_)
+        , m_statistics_cycles(statistics_cycles_)
+        , m_legacy_timeout(legacy_timeout_)
+      {}
+
+      // Stamps the protocol state on all samples of one registration cycle and replaces the unchanged
+      // entity registrations by heartbeats. Samples are modified in place.
+      void ApplySampleList(SampleList& sample_list_)
+      {
+        if (!m_enable)
+        {
+          for (auto& sample : sample_list_) sample.protocol_version = REGISTRATION_PROTOCOL_VERSION;
+          return;
+        }
+
+        const bool full_state = m_full_state_requested.exchange(false) || IsLegacyPeerRegistered();
+
+        ++m_cycle;
+        for (auto& sample : sample_list_)
+        {
+          sample.protocol_version = REGISTRATION_PROTOCOL_VERSION;
+
+          if (IsEntityRegistration(sample))
+          {
+            ApplyEntityRegistration(sample, full_state);
+          }
+          else if (IsUnregistrationSample(sample))
+          {
+            m_entities.erase(sample.identifier.entity_id);
+          }
+        }
+
+        // entities that are not registered anymore
+        for (auto iter = m_entities.begin(); iter != m_entities.end();)
+        {
+          if (iter->second.cycle != m_cycle) iter = m_entities.erase(iter);
+          else                               ++iter;
+        }
+      }
+
+      // A remote process asked for the full registration state, all entities send it with the next cycle
+      void RequestFullState()
+      {
+        m_full_state_requested = true;
+      }
+
+      // A process without delta registration support has been registered
+      void RegisterLegacyPeer()
+      {
+        m_legacy_peer_time = ClockType::now().time_since_epoch().count();
+        m_legacy_peer_registered = true;
+      }
+
+    private:
+      bool IsLegacyPeerRegistered() const
+      {
+        if (!m_legacy_peer_registered) return false;
+        const typename ClockType::time_point legacy_peer_time{ typename ClockType::duration(m_legacy_peer_time.load()) };
+        return (ClockType::now() - legacy_peer_time) < m_legacy_timeout;
+      }
+
+      void ApplyEntityRegistration(Sample& sample_, bool full_state_)
+      {
+        SEntity& entity = m_entities[sample_.identifier.entity_id];
+        entity.cycle = m_cycle;
+
+        // the registration clock changes every cycle without changing the entity
+        const bool known = (entity.generation != 0);
+        if (known) AssignRegistrationClock(sample_, entity.state);
+        const bool changed = !known || !(entity.state == sample_);
+
+        // changed statistics only are sent every m_statistics_cycles cycles, everything else immediately
+        if (changed && (full_state_ || !known || (entity.cycles_since_full_state + 1 >= m_statistics_cycles) || !IsSameStructure(entity.state, sample_)))
+        {
+          entity.state = sample_;
+          ++entity.generation;
+        }
+        else if (!full_state_)
+        {
+          ++entity.cycles_since_full_state;
+          ConvertToHeartbeatSample(sample_, entity.generation);
+          return;
+        }
+
+        entity.cycles_since_full_state = 0;
+        sample_.generation = entity.generation;
+      }
+
+      struct SEntity
+      {
+        uint64_t     generation = 0;              // 0 == full state not sent yet
+        Sample       state;                       // last sent full state
+        unsigned int cycles_since_full_state = 0;
+        uint64_t     cycle = 0;                   // last registration cycle containing the entity
+      };
+
+      bool                                   m_enable;
+      unsigned int                           m_statistics_cycles;
+      typename ClockType::duration           m_legacy_timeout;
+
+      std::unordered_map<uint64_t, SEntity>  m_entities;
+      uint64_t                               m_cycle = 0;
+
+      std::atomic<bool>                              m_full_state_requested{ false };
+      std::atomic<bool>                              m_legacy_peer_registered{ false };
+      std::atomic<typename ClockType::duration::rep> m_legacy_peer_time{ 0 };
+    };
+
+
+    template <class ClockType = std::chrono::steady_clock>
+    class CDeltaReceiver
+    {
+    public:
+      // apply_sample_callback_   : forwards the (resolved) full registration states
+      // request_sample_callback_ : sends the request for the full registration state of a process
+      CDeltaReceiver(const typename ClockType::duration& timeout_, const typename ClockType::duration& request_interval_,
+                     const RegistrationApplySampleCallbackT& apply_sample_callback_, const RegistrationApplySampleCallbackT& request_sample_callback_)
+        : m_state_cache(timeout_)
+        , m_requests(request_interval_)
+        , m_apply_sample_callback(apply_sample_callback_)
+        , m_request_sample_callback(request_sample_callback_)
+      {}
+
+      bool ApplySample(const Sample& sample_)
+      {
+        if (sample_.cmd_type == bct_reg_heartbeat)
+        {
+          return ApplyHeartbeat(sample_);
+        }
+
+        if (IsUnregistrationSample(sample_))
+        {
+          const std::lock_guard<std::mutex> lock(m_state_cache_mutex);
+          m_state_cache.erase(sample_.identifier);
+        }
+        // full state of a delta registration provider
+        else if (sample_.generation != 0)
+        {
+          const std::lock_guard<std::mutex> lock(m_state_cache_mutex);
+          SState& state = m_state_cache[sample_.identifier];
+          state.generation = sample_.generation;
+          state.sample     = std::make_shared<const Sample>(sample_);
+        }
+
+        return m_apply_sample_callback(sample_);
+      }
+
+      // Removes the cached states of entities without registration within the timeout
+      void CheckForTimeouts()
+      {
+        const std::lock_guard<std::mutex> lock(m_state_cache_mutex);
+        m_state_cache.erase_expired([](const SampleIdentifier& /*identifier_*/, SState&& /*state_*/) {});
+      }
+
+    private:
+      bool ApplyHeartbeat(const Sample& heartbeat_)
+      {
+        std::shared_ptr<const Sample> state_sample;
+        {
+          const std::lock_guard<std::mutex> lock(m_state_cache_mutex);
+          if (m_state_cache.find(heartbeat_.identifier) != m_state_cache.end())
+          {
+            const SState& state = m_state_cache[heartbeat_.identifier];
+            if (state.generation == heartbeat_.generation) state_sample = state.sample;
+          }
+        }
+
+        // the entity is unchanged, apply its cached full state like a full refresh
+        if (state_sample)
+        {
+          return m_apply_sample_callback(*state_sample);
+        }
+
+        // we missed a change, request the full state of the process (once per request interval)
+        {
+          const std::lock_guard<std::mutex> lock(m_requests_mutex);
+          m_requests.erase_expired();
+          const auto process_key = std::make_pair(heartbeat_.identifier.host_name, heartbeat_.identifier.process_id);
+          if (m_requests.find(process_key) != m_requests.end()) return false;
+          m_requests[process_key] = true;
+        }
+        m_request_sample_callback(CreateRequestSample(heartbeat_));
+        return false;
+      }
+
+      struct SState
+      {
+        uint64_t                      generation = 0;
+        std::shared_ptr<const Sample> sample;
+      };
+
+      std::mutex                                                              m_state_cache_mutex;
+      Util::CTimerWheelExpirationMap<SampleIdentifier, SState, ClockType>     m_state_cache;
+
+      std::mutex                                                              m_requests_mutex;
+      Util::CExpirationMap<std::pair<std::string, int32_t>, bool, ClockType>  m_requests;
+
+      RegistrationApplySampleCallbackT                                        m_apply_sample_callback;
+      RegistrationApplySampleCallbackT                                        m_request_sample_callback;
+    };
+  }
+}
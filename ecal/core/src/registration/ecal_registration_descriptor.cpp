@@ -0,0 +1,63 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL registration of datatype descriptors by content hash
+**/
+
+#include "registration/ecal_registration_descriptor.h"
+
+namespace eCAL
+{
+  namespace Registration
+  {
+    void AssignDescriptorSample(Registration::Sample& sample_, uint64_t hash_, const std::string& descriptor_)
+    {
+      sample_.clear();
+      sample_.cmd_type                                = bct_reg_descriptor;
+      sample_.topic.datatype_descriptor_hash          = hash_;
+      sample_.topic.datatype_information.descriptor   = descriptor_;
+    }
+
+    Registration::Sample CreateDescriptorRequestSample(const Registration::Sample& sample_)
+    {
+      Registration::Sample request_sample;
+      request_sample.cmd_type                       = bct_reg_descriptor_request;
+      request_sample.identifier.entity_id           = static_cast<uint64_t>(sample_.identifier.process_id);
+      request_sample.identifier.process_id          = sample_.identifier.process_id;
+      request_sample.identifier.host_name           = sample_.identifier.host_name;
+      request_sample.topic.datatype_descriptor_hash = sample_.topic.datatype_descriptor_hash;
+      request_sample.protocol_version               = REGISTRATION_PROTOCOL_VERSION;
+      return request_sample;
+    }
+
+    bool IsTopicEntityRegistration(const Registration::Sample& sample_)
+    {
+      return sample_.cmd_type == bct_reg_publisher ||
+        sample_.cmd_type == bct_reg_subscriber;
+    }
+
+    bool HasUnresolvedDescriptor(const Registration::Sample& sample_)
+    {
+      return IsTopicEntityRegistration(sample_) &&
+        (sample_.topic.datatype_descriptor_hash != 0) &&
+        sample_.topic.datatype_information.descriptor.empty();
+    }
+  }
+}
@@ -0,0 +1,326 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief eCAL registration of datatype descriptors by content hash
+ *
+ * The datatype descriptor (e.g. a serialized protobuf FileDescriptorSet) is the largest part of most
+ * publisher / subscriber registrations and it is the same for all entities of one datatype.
+ *
+ * CDescriptorProvider replaces the descriptors of the topic registrations by their content hash and sends
+ * every descriptor once as bct_reg_descriptor sample (and again if a remote process requests it).
+ * CDescriptorReceiver caches the received descriptors and puts them back into the topic registrations.
+ * If the descriptor of a registration is not known yet, the registration is applied without descriptor
+ * and the receiver requests the descriptor from the sending process.
+ *
+ * Samples with a protocol version below REGISTRATION_PROTOCOL_VERSION_DESCRIPTOR come from eCAL versions
+ * without descriptor hashing. As long as such processes are registered, the provider sends the descriptors
+ * with every registration.
+ *
+**/
+
+#pragma once
+
+#include <registration/ecal_registration_types.h>
+#include <util/ecal_expmap.h>
+#include <util/ecal_expmap_wheel.h>
+#include <util/descriptor_hash.h>
+
+#include "ecal_def.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace eCAL
+{
+  namespace Registration
+  {
+    // Turns a sample into the announcement of a datatype descriptor
+    void AssignDescriptorSample(Registration::Sample& sample_, uint64_t hash_, const std::string& descriptor_);
+
+    // Creates the request for the datatype descriptor of a topic registration from the process that sent it
+    Registration::Sample CreateDescriptorRequestSample(const Registration::Sample& sample_);
+
+    bool IsTopicEntityRegistration(const Registration::Sample& sample_);
+
+    // Returns true for topic registrations carrying the descriptor hash instead of the descriptor
+    bool HasUnresolvedDescriptor(const Registration::Sample& sample_);
+
+
+    template <class ClockType = std::chrono::steady_clock>
+    class CDescriptorProvider
+    {
+    public:
+      CDescriptorProvider(bool enable_, const typename ClockType::duration& legacy_timeout_)
+        : m_enable(enable_)
+        , m_legacy_timeout(legacy_timeout_)
+      {}
+
+      // Replaces the descriptors of the topic registrations of one registration cycle by their hash.
+      // Descriptors that were not sent before are put in front of the list, requested descriptors are appended.
+      void ApplySampleList(SampleList& sample_list_)
+      {
+        if (!m_enable) return;
+
+        // processes of older eCAL versions need the descriptor in every registration,
+        // forget what has been announced so far, receivers may have dropped it in the meantime
+        if (IsLegacyPeerRegistered())
+        {
+          m_entities.clear();
+          m_descriptors.clear();
+          return;
+        }
+
+        ++m_cycle;
+        m_announcements.clear();
+
+        const size_t sample_count = sample_list_.size();
+        for (size_t i = 0; i < sample_count; ++i)
+        {
+          Sample& sample = sample_list_[i];
+          if (IsTopicEntityRegistration(sample) && !sample.topic.datatype_information.descriptor.empty())
+          {
+            ReplaceDescriptor(sample);
+          }
+        }
+
+        // new descriptors are sent in front of the registrations using them
+        for (const uint64_t hash : m_announcements)
+        {
+          AssignDescriptorSample(sample_list_.push_back(), hash, m_descriptors[hash].descriptor);
+        }
+        if (!m_announcements.empty())
+        {
+          std::rotate(sample_list_.begin(), sample_list_.begin() + static_cast<std::ptrdiff_t>(sample_count), sample_list_.end());
+        }
+
+        // descriptors requested by remote processes
+        {
+          const std::lock_guard<std::mutex> lock(m_requests_mutex);
+          for (const uint64_t hash : m_requests)
+          {
+            const auto iter = m_descriptors.find(hash);
+            if (iter != m_descriptors.end()) AssignDescriptorSample(sample_list_.push_back(), hash, iter->second.descriptor);
+          }
+          m_requests.clear();
+        }
+
+        // entities and descriptors that are not registered anymore
+        for (auto iter = m_entities.begin(); iter != m_entities.end();)
+        {
+          if (iter->second.cycle != m_cycle) iter = m_entities.erase(iter);
+          else                               ++iter;
+        }
+        for (auto iter = m_descriptors.begin(); iter != m_descriptors.end();)
+        {
+          if (iter->second.cycle != m_cycle) iter = m_descriptors.erase(iter);
+          else                               ++iter;
+        }
+      }
+
+      // A remote process asked for a descriptor, it is sent with the next cycle
+      void RequestDescriptor(uint64_t hash_)
+      {
+        const std::lock_guard<std::mutex> lock(m_requests_mutex);
+        if (std::find(m_requests.begin(), m_requests.end(), hash_) == m_requests.end()) m_requests.push_back(hash_);
+      }
+
+      // A process without descriptor hashing support has been registered
+      void RegisterLegacyPeer()
+      {
+        m_legacy_peer_time = ClockType::now().time_since_epoch().count();
+        m_legacy_peer_registered = true;
+      }
+
+    private:
+      bool IsLegacyPeerRegistered() const
+      {
+        if (!m_legacy_peer_registered) return false;
+        const typename ClockType::time_point legacy_peer_time{ typename ClockType::duration(m_legacy_peer_time.load()) };
+        return (ClockType::now() - legacy_peer_time) < m_legacy_timeout;
+      }
+
+      void ReplaceDescriptor(Sample& sample_)
+      {
+        std::string& descriptor = sample_.topic.datatype_information.descriptor;
+
+        // the descriptor of an entity does not change, so the hash is only computed for new entities
+        SEntity& entity = m_entities[sample_.identifier.entity_id];
+        entity.cycle = m_cycle;
+        auto descriptor_iter = m_descriptors.find(entity.hash);
+        if ((descriptor_iter == m_descriptors.end()) || (descriptor_iter->second.descriptor != descriptor))
+        {
+          entity.hash = Util::ComputeDescriptorHash(descriptor);
+          descriptor_iter = m_descriptors.find(entity.hash);
+          if (descriptor_iter == m_descriptors.end())
+          {
+            descriptor_iter = m_descriptors.emplace(entity.hash, SDescriptor{ descriptor, 0 }).first;
+            m_announcements.push_back(entity.hash);
+          }
+          // hash collision, keep the descriptor in the registration
+          else if (descriptor_iter->second.descriptor != descriptor)
+          {
+            entity.hash = 0;
+            return;
+          }
+        }
+
+        descriptor_iter->second.cycle = m_cycle;
+        sample_.topic.datatype_descriptor_hash = entity.hash;
+        descriptor.clear();
+      }
+
+      struct SEntity
+      {
+        uint64_t hash  = 0;
+        uint64_t cycle = 0;                       // last registration cycle containing the entity
+      };
+
+      struct SDescriptor
+      {
+        std::string descriptor;
+        uint64_t    cycle;                        // last registration cycle using the descriptor
+      };
+
+      bool                                       m_enable;
+      typename ClockType::duration               m_legacy_timeout;
+
+      std::unordered_map<uint64_t, SEntity>      m_entities;
+      std::unordered_map<uint64_t, SDescriptor>  m_descriptors;
+      std::vector<uint64_t>                      m_announcements;
+      uint64_t                                   m_cycle = 0;
+
+      std::mutex                                 m_requests_mutex;
+      std::vector<uint64_t>                      m_requests;
+
+      std::atomic<bool>                              m_legacy_peer_registered{ false };
+      std::atomic<typename ClockType::duration::rep> m_legacy_peer_time{ 0 };
+    };
+
+
+    template <class ClockType = std::chrono::steady_clock>
+    class CDescriptorReceiver
+    {
+    public:
+      // timeout_                 : descriptors that are not used by any registration within the timeout are removed
+      // apply_sample_callback_   : forwards the registrations with resolved descriptors
+      // request_sample_callback_ : sends the request for a descriptor to a process
+      CDescriptorReceiver(const typename ClockType::duration& timeout_, const typename ClockType::duration& request_interval_,
+                          const RegistrationApplySampleCallbackT& apply_sample_callback_, const RegistrationApplySampleCallbackT& request_sample_callback_)
+        : m_descriptors(timeout_)
+        , m_requests(request_interval_)
+        , m_apply_sample_callback(apply_sample_callback_)
+        , m_request_sample_callback(request_sample_callback_)
+      {}
+
+      bool ApplySample(const Sample& sample_)
+      {
+        if (sample_.cmd_type == bct_reg_descriptor)
+        {
+          return ApplyDescriptor(sample_);
+        }
+
+        if (!HasUnresolvedDescriptor(sample_))
+        {
+          return m_apply_sample_callback(sample_);
+        }
+
+        std::shared_ptr<const std::string> descriptor;
+        {
+          const std::lock_guard<std::mutex> lock(m_descriptors_mutex);
+          auto iter = m_descriptors.find(sample_.topic.datatype_descriptor_hash);
+          if (iter != m_descriptors.end())
+          {
+            m_descriptors.update(iter);
+            descriptor = (*iter).second;
+          }
+        }
+
+        if (descriptor)
+        {
+          Sample resolved_sample(sample_);
+          resolved_sample.topic.datatype_information.descriptor = *descriptor;
+          return m_apply_sample_callback(resolved_sample);
+        }
+
+        // the registration is applied without descriptor, it is completed by the next registration after the descriptor arrived
+        RequestDescriptor(sample_);
+        return m_apply_sample_callback(sample_);
+      }
+
+      // Removes the descriptors that have not been used within the timeout
+      void CheckForTimeouts()
+      {
+        const std::lock_guard<std::mutex> lock(m_descriptors_mutex);
+        m_descriptors.erase_expired([](const uint64_t& /*hash_*/, std::shared_ptr<const std::string>&& /*descriptor_*/) {});
+      }
+
+    private:
+      bool ApplyDescriptor(const Sample& sample_)
+      {
+        const uint64_t hash = sample_.topic.datatype_descriptor_hash;
+        {
+          const std::lock_guard<std::mutex> lock(m_descriptors_mutex);
+          auto iter = m_descriptors.find(hash);
+          if (iter != m_descriptors.end())
+          {
+            m_descriptors.update(iter);
+            return true;
+          }
+        }
+
+        // never cache a descriptor under a wrong hash
+        if ((hash == 0) || (Util::ComputeDescriptorHash(sample_.topic.datatype_information.descriptor) != hash)) return false;
+
+        auto descriptor = std::make_shared<const std::string>(sample_.topic.datatype_information.descriptor);
+        const std::lock_guard<std::mutex> lock(m_descriptors_mutex);
+        m_descriptors[hash] = std::move(descriptor);
+        return true;
+      }
+
+      void RequestDescriptor(const Sample& sample_)
+      {
+        // request a descriptor once per request interval
+        {
+          const std::lock_guard<std::mutex> lock(m_requests_mutex);
+          m_requests.erase_expired();
+          if (m_requests.find(sample_.topic.datatype_descriptor_hash) != m_requests.end()) return;
+          m_requests[sample_.topic.datatype_descriptor_hash] = true;
+        }
+        m_request_sample_callback(CreateDescriptorRequestSample(sample_));
+      }
+
+      std::mutex                                                                          m_descriptors_mutex;
+      Util::CTimerWheelExpirationMap<uint64_t, std::shared_ptr<const std::string>, ClockType> m_descriptors;
+
+      std::mutex                                                                          m_requests_mutex;
+      Util::CExpirationMap<uint64_t, bool, ClockType>                                     m_requests;
+
+      RegistrationApplySampleCallbackT                                                    m_apply_sample_callback;
+      RegistrationApplySampleCallbackT                                                    m_request_sample_callback;
+    };
+  }
+}
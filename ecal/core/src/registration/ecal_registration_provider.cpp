@@ -54,6 +54,8 @@ namespace eCAL
   std::atomic<bool> CRegistrationProvider::m_created;
 
   CRegistrationProvider::CRegistrationProvider(const Registration::SAttributes& attr_) :
+                    m_descriptor_provider(attr_.delta.descriptor_hashing, std::chrono::milliseconds(attr_.timeout)),
+                    m_delta_provider(attr_.delta.enable, attr_.delta.statistics_cycles, std::chrono::milliseconds(attr_.timeout)),
                     m_attributes(attr_)
   {
   }
@@ -134,6 +136,22 @@ namespace eCAL
     return(true);
   }
 
+  void CRegistrationProvider::RequestFullState()
+  {
+    m_delta_provider.RequestFullState();
+  }
+
+  void CRegistrationProvider::RequestDescriptor(uint64_t hash_)
+  {
+    m_descriptor_provider.RequestDescriptor(hash_);
+  }
+
+  void CRegistrationProvider::RegisterLegacyPeer(int32_t protocol_version_)
+  {
+    if (protocol_version_ < REGISTRATION_PROTOCOL_VERSION_DELTA)      m_delta_provider.RegisterLegacyPeer();
+    if (protocol_version_ < REGISTRATION_PROTOCOL_VERSION_DESCRIPTOR) m_descriptor_provider.RegisterLegacyPeer();
+  }
+
   void CRegistrationProvider::AddSingleSample(const Registration::Sample& sample_)
   {
     const std::lock_guard<std::mutex> lock(m_applied_sample_list_mtx);
@@ -180,6 +198,12 @@ namespace eCAL
         m_applied_sample_list.clear();
       }
 
+      // replace the datatype descriptors of topic registrations by their hash
+      m_descriptor_provider.ApplySampleList(m_send_thread_sample_list);
+
+      // replace unchanged entity registrations by heartbeats
+      m_delta_provider.ApplySampleList(m_send_thread_sample_list);
+
       // send collected registration sample list
       m_reg_sender->SendSampleList(m_send_thread_sample_list);
     }
@@ -23,12 +23,16 @@
  * All process internal publisher/subscriber, server/clients register here with all their attributes.
  *
  * These information will be send cyclic (registration refresh) via UDP to external eCAL processes.
+ * With delta registration enabled unchanged entities are sent as heartbeats only (see ecal_registration_delta.h).
+ * With descriptor hashing enabled topic registrations carry the hash of their datatype descriptor only (see ecal_registration_descriptor.h).
  *
 **/
 
 #pragma once
 
 
+#include "registration/ecal_registration_delta.h"
+#include "registration/ecal_registration_descriptor.h"
 #include "registration/ecal_registration_sender.h"
 #include "util/ecal_thread.h"
 #include "config/attributes/registration_attributes.h"
@@ -53,6 +57,11 @@ namespace eCAL
     bool RegisterSample(const Registration::Sample& sample_);
     bool UnregisterSample(const Registration::Sample& sample_);
 
+    // delta registration and descriptor hashing, called by the registration receiver
+    void RequestFullState();
+    void RequestDescriptor(uint64_t hash_);
+    void RegisterLegacyPeer(int32_t protocol_version_);
+
   protected:
     void AddSingleSample(const Registration::Sample& sample_);
     void RegisterSendThread();
@@ -66,6 +75,8 @@ namespace eCAL
     Registration::SampleList             m_applied_sample_list;
 
     Registration::SampleList             m_send_thread_sample_list;
+    Registration::CDescriptorProvider<>  m_descriptor_provider;
+    Registration::CDeltaProvider<>       m_delta_provider;
 
     Registration::SAttributes                  m_attributes;
   };
@@ -27,7 +27,11 @@
 
 #include "registration/ecal_registration_receiver.h"
 
+#include "registration/ecal_registration_delta.h"
+#include "registration/ecal_registration_descriptor.h"
+#include "registration/ecal_registration_provider.h"
 #include "registration/ecal_registration_timeout_provider.h"
+#include "ecal_global_accessors.h"
 #include "util/ecal_thread.h"
 
 #include "registration/udp/ecal_registration_receiver_udp.h"
@@ -55,6 +59,8 @@ namespace eCAL
   CRegistrationReceiver::CRegistrationReceiver(const Registration::SAttributes& attr_)
     : m_timeout_provider(nullptr)
     , m_timeout_provider_thread(nullptr)
+    , m_delta_receiver(nullptr)
+    , m_descriptor_receiver(nullptr)
     , m_registration_receiver_udp(nullptr)
     , m_registration_receiver_shm(nullptr)   
     , m_sample_applier(Registration::SampleApplier::BuildSampleApplierAttributes(attr_))
@@ -90,18 +96,48 @@ namespace eCAL
       {
         m_timeout_provider->ApplySample(sample_);
       });
-    m_timeout_provider_thread = std::make_unique<CCallbackThread>([this]() {m_timeout_provider->CheckForTimeouts(); });
+    // request a descriptor at most once per two registration cycles
+    m_descriptor_receiver = std::make_unique<Registration::CDescriptorReceiver<std::chrono::steady_clock>>(
+      m_attributes.timeout,
+      std::chrono::milliseconds(2 * m_attributes.refresh),
+      [this](const Registration::Sample& sample_)
+      {
+        return m_sample_applier.ApplySample(sample_);
+      },
+      [](const Registration::Sample& sample_)
+      {
+        auto registration_provider = g_registration_provider();
+        return registration_provider ? registration_provider->RegisterSample(sample_) : false;
+      }
+      );
+    // request the full state of a process at most once per two registration cycles
+    // (the cached full states still carry the descriptor hashes, they are resolved afterwards)
+    m_delta_receiver = std::make_unique<Registration::CDeltaReceiver<std::chrono::steady_clock>>(
+      m_attributes.timeout,
+      std::chrono::milliseconds(2 * m_attributes.refresh),
+      [this](const Registration::Sample& sample_)
+      {
+        return m_descriptor_receiver->ApplySample(sample_);
+      },
+      [](const Registration::Sample& sample_)
+      {
+        auto registration_provider = g_registration_provider();
+        return registration_provider ? registration_provider->RegisterSample(sample_) : false;
+      }
+      );
+
+    m_timeout_provider_thread = std::make_unique<CCallbackThread>([this]() {m_timeout_provider->CheckForTimeouts(); m_delta_receiver->CheckForTimeouts(); m_descriptor_receiver->CheckForTimeouts(); });
     m_timeout_provider_thread->start(std::chrono::milliseconds(100));
 
 #if ECAL_CORE_REGISTRATION_SHM
     if (m_attributes.transport_mode == Registration::eTransportMode::shm)
     {
-      m_registration_receiver_shm = std::make_unique<CRegistrationReceiverSHM>([this](const Registration::Sample& sample_) {return m_sample_applier.ApplySample(sample_); }, Registration::BuildSHMAttributes(m_attributes));
+      m_registration_receiver_shm = std::make_unique<CRegistrationReceiverSHM>([this](const Registration::Sample& sample_) {return ApplyReceivedSample(sample_); }, Registration::BuildSHMAttributes(m_attributes));
     } else
 #endif
     if (m_attributes.transport_mode == Registration::eTransportMode::udp)    
     {
-      m_registration_receiver_udp = std::make_unique<CRegistrationReceiverUDP>([this](const Registration::Sample& sample_) {return m_sample_applier.ApplySample(sample_);}, Registration::BuildUDPReceiverAttributes(m_attributes));
+      m_registration_receiver_udp = std::make_unique<CRegistrationReceiverUDP>([this](const Registration::Sample& sample_) {return ApplyReceivedSample(sample_);}, Registration::BuildUDPReceiverAttributes(m_attributes));
     }
     else
     {
@@ -125,10 +161,45 @@ namespace eCAL
     m_timeout_provider_thread.reset();
     m_sample_applier.RemCustomApplySampleCallback("timeout");
     m_timeout_provider.reset();
+    m_delta_receiver.reset();
+    m_descriptor_receiver.reset();
 
     m_created = false;
   }
 
+  bool CRegistrationReceiver::ApplyReceivedSample(const Registration::Sample& sample_)
+  {
+    // samples of older eCAL versions, they need the full state every cycle (no delta registration)
+    // or the datatype descriptors with every registration (no descriptor hashing)
+    if (sample_.protocol_version < REGISTRATION_PROTOCOL_VERSION_DESCRIPTOR)
+    {
+      auto registration_provider = g_registration_provider();
+      if (registration_provider) registration_provider->RegisterLegacyPeer(sample_.protocol_version);
+    }
+
+    // full state requests are not forwarded, we only check if they are addressed to this process
+    if (sample_.cmd_type == bct_reg_request)
+    {
+      if ((sample_.identifier.process_id != Process::GetProcessID()) || (sample_.identifier.host_name != Process::GetHostName())) return false;
+
+      auto registration_provider = g_registration_provider();
+      if (registration_provider) registration_provider->RequestFullState();
+      return true;
+    }
+
+    // descriptor requests are handled the same way
+    if (sample_.cmd_type == bct_reg_descriptor_request)
+    {
+      if ((sample_.identifier.process_id != Process::GetProcessID()) || (sample_.identifier.host_name != Process::GetHostName())) return false;
+
+      auto registration_provider = g_registration_provider();
+      if (registration_provider) registration_provider->RequestDescriptor(sample_.topic.datatype_descriptor_hash);
+      return true;
+    }
+
+    return m_delta_receiver->ApplySample(sample_);
+  }
+
   void CRegistrationReceiver::SetCustomApplySampleCallback(const std::string& customer_, const ApplySampleCallbackT& callback_)
   {
     m_sample_applier.SetCustomApplySampleCallback(customer_, callback_);
@@ -52,6 +52,12 @@ namespace eCAL
   {
     template<typename T>
     class CTimeoutProvider;
+
+    template<typename T>
+    class CDeltaReceiver;
+
+    template<typename T>
+    class CDescriptorReceiver;
   }
   class CCallbackThread;
 
@@ -71,6 +77,9 @@ namespace eCAL
     void RemCustomApplySampleCallback(const std::string& customer_);
 
   private:
+    // resolves delta registration heartbeats, datatype descriptor hashes and requests before applying the samples
+    bool ApplyReceivedSample(const Registration::Sample& sample_);
+
     // why is this a static variable? can someone explain?
     static std::atomic<bool>              m_created;
 
@@ -78,6 +87,12 @@ namespace eCAL
     std::unique_ptr<Registration::CTimeoutProvider<std::chrono::steady_clock>> m_timeout_provider;
     std::unique_ptr<CCallbackThread>                                           m_timeout_provider_thread;
 
+    // this class caches the full states of delta registration providers and resolves their heartbeats
+    std::unique_ptr<Registration::CDeltaReceiver<std::chrono::steady_clock>>   m_delta_receiver;
+
+    // this class caches the datatype descriptors sent by content hash and puts them back into the topic registrations
+    std::unique_ptr<Registration::CDescriptorReceiver<std::chrono::steady_clock>> m_descriptor_receiver;
+
     std::unique_ptr<CRegistrationReceiverUDP> m_registration_receiver_udp;
 #if ECAL_CORE_REGISTRATION_SHM
     std::unique_ptr<CRegistrationReceiverSHM> m_registration_receiver_shm;
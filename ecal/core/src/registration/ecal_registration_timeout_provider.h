@@ -30,9 +30,10 @@
 #pragma once
 
 #include <registration/ecal_registration_types.h>
-#include <util/ecal_expmap.h>
+#include <util/ecal_expmap_wheel.h>
 
 #include <mutex>
+#include <vector>
 
 namespace eCAL
 {
@@ -79,16 +80,19 @@ namespace eCAL
       // It then applies unregistration samples for all internally expired samples.
       void CheckForTimeouts()
       {
-        std::map<Registration::SampleIdentifier, Registration::Sample> expired_samples;
+        std::vector<Registration::Sample> expired_samples;
 
         {
           std::lock_guard<std::mutex> lock(sample_tracker_mutex);
-          expired_samples = sample_tracker.erase_expired();
+          sample_tracker.erase_expired([&expired_samples](const Registration::SampleIdentifier& /*identifier_*/, Registration::Sample&& sample_)
+            {
+              expired_samples.push_back(std::move(sample_));
+            });
         }
 
         for (const auto& registration_sample : expired_samples)
         {
-          apply_sample_callback(registration_sample.second);
+          apply_sample_callback(registration_sample);
         }
       }
 
@@ -115,7 +119,7 @@ namespace eCAL
         }
       }
 
-      using SampleTrackerMap = Util::CExpirationMap<Registration::SampleIdentifier, Registration::Sample, ClockType>;
+      using SampleTrackerMap = Util::CTimerWheelExpirationMap<Registration::SampleIdentifier, Registration::Sample, ClockType>;
       SampleTrackerMap                 sample_tracker;
       std::mutex                       sample_tracker_mutex;
 
@@ -27,7 +27,7 @@
 **/
 
 #include "registration/shm/ecal_registration_sender_shm.h"
-#include "serialization/ecal_serialize_sample_registration.h"
+#include "serialization/ecal_serialize_sample_registration_cache.h"
 
 
 eCAL::CRegistrationSenderSHM::CRegistrationSenderSHM(const Registration::SHM::SAttributes& attr_)
@@ -53,15 +53,12 @@ bool eCAL::CRegistrationSenderSHM::SendSample(const Registration::Sample& sample
 bool eCAL::CRegistrationSenderSHM::SendSampleList(const Registration::SampleList& sample_list)
 {
   bool return_value{true};
-  // serialize whole sample list
-  m_sample_list_buffer.clear();
-  if (SerializeToBuffer(sample_list, m_sample_list_buffer))
+  // serialize whole sample list, entities only encode their changed counters
+  m_sample_encoding_cache.EncodeSampleList(sample_list, m_sample_list_buffer);
+  if (!m_sample_list_buffer.empty())
   {
-    if (!m_sample_list_buffer.empty())
-    {
-      // broadcast sample list over shm
-      return_value &= m_memfile_broadcast_writer.Write(m_sample_list_buffer.data(), m_sample_list_buffer.size());
-    }
+    // broadcast sample list over shm
+    return_value &= m_memfile_broadcast_writer.Write(m_sample_list_buffer.data(), m_sample_list_buffer.size());
   }
   return return_value;
 }
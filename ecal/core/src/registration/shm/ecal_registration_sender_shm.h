@@ -34,6 +34,7 @@
 #include "registration/shm/ecal_memfile_broadcast_writer.h"
 
 #include "config/attributes/registration_shm_attributes.h"
+#include "serialization/ecal_serialize_sample_registration_cache.h"
 
 #include <vector>
 
@@ -58,5 +59,6 @@ namespace eCAL
     CMemoryFileBroadcast                m_memfile_broadcast;
     CMemoryFileBroadcastWriter          m_memfile_broadcast_writer;
     std::vector<char>                   m_sample_list_buffer;
+    Registration::CSampleEncodingCache  m_sample_encoding_cache;
   };
 }
\ No newline at end of file
@@ -28,7 +28,7 @@
 
 #include "registration/udp/ecal_registration_sender_udp.h"
 
-#include "serialization/ecal_serialize_sample_registration.h"
+#include "serialization/ecal_serialize_sample_registration_cache.h"
 #include "io/udp/ecal_udp_configurations.h"
 #include <ecal/config.h>
 
@@ -45,14 +45,11 @@ namespace eCAL
 
   bool CRegistrationSenderUDP::SendSample(const Registration::Sample& sample_)
   {
-    // serialize single sample
-    std::vector<char> sample_buffer;
-    if (SerializeToBuffer(sample_, sample_buffer))
-    {
-      // send single sample over udp
-      return m_reg_sample_snd.Send("reg_sample", sample_buffer) != 0;
-    }
-    return false;
+    // serialize single sample, entities only encode their changed counters
+    const std::vector<char>& sample_buffer = m_sample_encoding_cache.Encode(sample_);
+
+    // send single sample over udp
+    return m_reg_sample_snd.Send("reg_sample", sample_buffer) != 0;
   }
 
   bool CRegistrationSenderUDP::SendSampleList(const Registration::SampleList& sample_list)
@@ -62,6 +59,7 @@ namespace eCAL
     {
       return_value &= SendSample(sample);
     }
+    m_sample_encoding_cache.RemoveUnused();
     return return_value;
   }
 }
\ No newline at end of file
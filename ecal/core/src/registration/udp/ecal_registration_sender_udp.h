@@ -29,6 +29,7 @@
 #include "registration/ecal_registration_sender.h"
 
 #include "io/udp/ecal_udp_sample_sender.h"
+#include "serialization/ecal_serialize_sample_registration_cache.h"
 #include "registration/udp/config/attributes/registration_sender_udp_attributes.h"
 
 namespace eCAL
@@ -50,6 +51,7 @@ namespace eCAL
   private:
     bool SendSample(const Registration::Sample& sample_);
 
-    UDP::CSampleSender m_reg_sample_snd;
+    UDP::CSampleSender                     m_reg_sample_snd;
+    Registration::CSampleEncodingCache     m_sample_encoding_cache;
   };
 }
\ No newline at end of file
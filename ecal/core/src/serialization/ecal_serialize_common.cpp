@@ -180,6 +180,62 @@ namespace eCAL
       pb_callback.arg = &vec;
     }
 
+    ///////////////////////////////////////////////
+    // list<int64>
+    ///////////////////////////////////////////////
+    bool encode_int64_vector_field(pb_ostream_t* stream, const pb_field_iter_t* field, void* const* arg)
+    {
+      if (arg == nullptr)  return false;
+      if (*arg == nullptr) return false;
+
+      auto* int_vec = static_cast<std::vector<int64_t>*>(*arg);
+      if (int_vec->empty()) return true;
+
+      // packed encoding (proto3 default), so we need the payload size first
+      pb_ostream_t sizing_stream = PB_OSTREAM_SIZING;
+      for (const auto& value : *int_vec)
+      {
+        if (!pb_encode_varint(&sizing_stream, static_cast<uint64_t>(value))) return false;
+      }
+
+      if (!pb_encode_tag(stream, PB_WT_STRING, field->tag))        return false;
+      if (!pb_encode_varint(stream, sizing_stream.bytes_written)) return false;
+
+      for (const auto& value : *int_vec)
+      {
+        if (!pb_encode_varint(stream, static_cast<uint64_t>(value))) return false;
+      }
+
+      return true;
+    }
+
+    void encode_int64_vector(pb_callback_t& pb_callback, const std::vector<int64_t>& int_vec)
+    {
+      pb_callback.funcs.encode = &encode_int64_vector_field; // NOLINT(*-pro-type-union-access)
+      pb_callback.arg = (void*)(&int_vec);
+    }
+
+    bool decode_int64_vector_field(pb_istream_t* stream, const pb_field_iter_t* /*field*/, void** arg)
+    {
+      if (arg == nullptr)  return false;
+      if (*arg == nullptr) return false;
+
+      // nanopb calls us once per element for packed and for unpacked fields
+      uint64_t value(0);
+      if (!pb_decode_varint(stream, &value)) return false;
+
+      auto* tgt_vector = static_cast<std::vector<int64_t>*>(*arg);
+      tgt_vector->push_back(static_cast<int64_t>(value));
+
+      return true;
+    }
+
+    void decode_int64_vector(pb_callback_t& pb_callback, std::vector<int64_t>& int_vec)
+    {
+      pb_callback.funcs.decode = &decode_int64_vector_field; // NOLINT(*-pro-type-union-access)
+      pb_callback.arg = &int_vec;
+    }
+
     ///////////////////////////////////////////////
     // list<string>
     ///////////////////////////////////////////////
@@ -404,6 +460,156 @@ namespace eCAL
       pb_callback.funcs.decode = &decode_service_methods_field; // NOLINT(*-pro-type-union-access)
       pb_callback.arg = &method_vec;
     }
+
+    ///////////////////////////////////////////////
+    // acknowledge_statistics
+    ///////////////////////////////////////////////
+    bool encode_acknowledge_statistics_field(pb_ostream_t* stream, const pb_field_iter_t* field, void* const* arg)
+    {
+      if (arg == nullptr)  return false;
+      if (*arg == nullptr) return false;
+
+      auto* statistics_vec = static_cast<Util::CExpandingVector<eCAL::Registration::AcknowledgeStatistics>*>(*arg);
+
+      for (const auto& statistics : *statistics_vec)
+      {
+        if (!pb_encode_tag_for_field(stream, field))
+        {
+          return false;
+        }
+
+        eCAL_pb_AcknowledgeStatistics pb_statistics = eCAL_pb_AcknowledgeStatistics_init_default;
+        pb_statistics.process_id        = statistics.process_id;
+        pb_statistics.acknowledge_count = statistics.acknowledge_count;
+        pb_statistics.timeout_count     = statistics.timeout_count;
+
+        pb_statistics.has_latency = true;
+        encode_int64_vector(pb_statistics.latency.bucket_limits_us, statistics.latency.bucket_limits_us);
+        encode_int64_vector(pb_statistics.latency.bucket_counts, statistics.latency.bucket_counts);
+
+        if (!pb_encode_submessage(stream, eCAL_pb_AcknowledgeStatistics_fields, &pb_statistics))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    void encode_acknowledge_statistics(pb_callback_t& pb_callback, const Util::CExpandingVector<eCAL::Registration::AcknowledgeStatistics>& statistics_vec)
+    {
+      pb_callback.funcs.encode = &encode_acknowledge_statistics_field; // NOLINT(*-pro-type-union-access)
+      pb_callback.arg = (void*)(&statistics_vec);
+    }
+
+    bool decode_acknowledge_statistics_field(pb_istream_t* stream, const pb_field_iter_t* /*field*/, void** arg)
+    {
+      if (arg == nullptr)  return false;
+      if (*arg == nullptr) return false;
+
+      eCAL_pb_AcknowledgeStatistics pb_statistics = eCAL_pb_AcknowledgeStatistics_init_default;
+      auto* tgt_vector = static_cast<Util::CExpandingVector<eCAL::Registration::AcknowledgeStatistics>*>(*arg);
+      auto& statistics = tgt_vector->push_back();
+
+      // decode latency histogram
+      decode_int64_vector(pb_statistics.latency.bucket_limits_us, statistics.latency.bucket_limits_us);
+      decode_int64_vector(pb_statistics.latency.bucket_counts, statistics.latency.bucket_counts);
+
+      if (!pb_decode(stream, eCAL_pb_AcknowledgeStatistics_fields, &pb_statistics))
+      {
+        return false;
+      }
+
+      // apply statistics values
+      statistics.process_id        = pb_statistics.process_id;
+      statistics.acknowledge_count = pb_statistics.acknowledge_count;
+      statistics.timeout_count     = pb_statistics.timeout_count;
+
+      return true;
+    }
+
+    void decode_acknowledge_statistics(pb_callback_t& pb_callback, Util::CExpandingVector<eCAL::Registration::AcknowledgeStatistics>& statistics_vec)
+    {
+      pb_callback.funcs.decode = &decode_acknowledge_statistics_field; // NOLINT(*-pro-type-union-access)
+      pb_callback.arg = &statistics_vec;
+    }
+
+    ///////////////////////////////////////////////
+    // latency_statistics
+    ///////////////////////////////////////////////
+    bool encode_latency_statistics_field(pb_ostream_t* stream, const pb_field_iter_t* field, void* const* arg)
+    {
+      if (arg == nullptr)  return false;
+      if (*arg == nullptr) return false;
+
+      auto* statistics_vec = static_cast<Util::CExpandingVector<eCAL::Registration::LatencyStatistics>*>(*arg);
+
+      for (const auto& statistics : *statistics_vec)
+      {
+        if (!pb_encode_tag_for_field(stream, field))
+        {
+          return false;
+        }
+
+        eCAL_pb_LatencyStatistics pb_statistics = eCAL_pb_LatencyStatistics_init_default;
+        encode_int_to_string(pb_statistics.publisher_id, statistics.publisher_id);
+        pb_statistics.layer = static_cast<eCAL_pb_eTransportLayerType>(statistics.layer);
+
+        pb_statistics.has_delivery_latency = true;
+        encode_int64_vector(pb_statistics.delivery_latency.bucket_limits_us, statistics.delivery_latency.bucket_limits_us);
+        encode_int64_vector(pb_statistics.delivery_latency.bucket_counts, statistics.delivery_latency.bucket_counts);
+
+        pb_statistics.has_callback_latency = true;
+        encode_int64_vector(pb_statistics.callback_latency.bucket_limits_us, statistics.callback_latency.bucket_limits_us);
+        encode_int64_vector(pb_statistics.callback_latency.bucket_counts, statistics.callback_latency.bucket_counts);
+
+        if (!pb_encode_submessage(stream, eCAL_pb_LatencyStatistics_fields, &pb_statistics))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    void encode_latency_statistics(pb_callback_t& pb_callback, const Util::CExpandingVector<eCAL::Registration::LatencyStatistics>& statistics_vec)
+    {
+      pb_callback.funcs.encode = &encode_latency_statistics_field; // NOLINT(*-pro-type-union-access)
+      pb_callback.arg = (void*)(&statistics_vec);
+    }
+
+    bool decode_latency_statistics_field(pb_istream_t* stream, const pb_field_iter_t* /*field*/, void** arg)
+    {
+      if (arg == nullptr)  return false;
+      if (*arg == nullptr) return false;
+
+      eCAL_pb_LatencyStatistics pb_statistics = eCAL_pb_LatencyStatistics_init_default;
+      auto* tgt_vector = static_cast<Util::CExpandingVector<eCAL::Registration::LatencyStatistics>*>(*arg);
+      auto& statistics = tgt_vector->push_back();
+
+      // decode publisher id and latency histograms
+      decode_int_from_string(pb_statistics.publisher_id, statistics.publisher_id);
+      decode_int64_vector(pb_statistics.delivery_latency.bucket_limits_us, statistics.delivery_latency.bucket_limits_us);
+      decode_int64_vector(pb_statistics.delivery_latency.bucket_counts, statistics.delivery_latency.bucket_counts);
+      decode_int64_vector(pb_statistics.callback_latency.bucket_limits_us, statistics.callback_latency.bucket_limits_us);
+      decode_int64_vector(pb_statistics.callback_latency.bucket_counts, statistics.callback_latency.bucket_counts);
+
+      if (!pb_decode(stream, eCAL_pb_LatencyStatistics_fields, &pb_statistics))
+      {
+        return false;
+      }
+
+      // apply statistics values
+      statistics.layer = static_cast<eCAL::eTLayerType>(pb_statistics.layer);
+
+      return true;
+    }
+
+    void decode_latency_statistics(pb_callback_t& pb_callback, Util::CExpandingVector<eCAL::Registration::LatencyStatistics>& statistics_vec)
+    {
+      pb_callback.funcs.decode = &decode_latency_statistics_field; // NOLINT(*-pro-type-union-access)
+      pb_callback.arg = &statistics_vec;
+    }
   }
 }
 
@@ -57,6 +57,9 @@ namespace eCAL
     void encode_bytes(pb_callback_t& pb_callback, const std::vector<char>& vec);
     void decode_bytes(pb_callback_t& pb_callback, std::vector<char>& vec);
 
+    void encode_int64_vector(pb_callback_t& pb_callback, const std::vector<int64_t>& int_vec);
+    void decode_int64_vector(pb_callback_t& pb_callback, std::vector<int64_t>& int_vec);
+
     void encode_map(pb_callback_t& pb_callback, const std::map<std::string, std::string>& str_map);
     void decode_map(pb_callback_t& pb_callback, std::map<std::string, std::string>& str_map);
 
@@ -65,6 +68,12 @@ namespace eCAL
 
     void encode_service_methods(pb_callback_t& pb_callback, const Util::CExpandingVector<eCAL::Service::Method>& method_vec);
     void decode_service_methods(pb_callback_t& pb_callback, Util::CExpandingVector<eCAL::Service::Method>& method_vec);
+
+    void encode_acknowledge_statistics(pb_callback_t& pb_callback, const Util::CExpandingVector<eCAL::Registration::AcknowledgeStatistics>& statistics_vec);
+    void decode_acknowledge_statistics(pb_callback_t& pb_callback, Util::CExpandingVector<eCAL::Registration::AcknowledgeStatistics>& statistics_vec);
+
+    void encode_latency_statistics(pb_callback_t& pb_callback, const Util::CExpandingVector<eCAL::Registration::LatencyStatistics>& statistics_vec);
+    void decode_latency_statistics(pb_callback_t& pb_callback, Util::CExpandingVector<eCAL::Registration::LatencyStatistics>& statistics_vec);
   }
 }
 
@@ -106,6 +115,18 @@ namespace eCAL
       return true;
     }
 
+    // writes value_ as varint of exactly size_ bytes (padded with continuation bytes), so it can be patched in place
+    inline char* WriteFixedVarint(char* target_, uint64_t value_, size_t size_)
+    {
+      for (size_t i = 0; i + 1 < size_; ++i)
+      {
+        *target_++ = static_cast<char>((value_ & 0x7FU) | 0x80U);
+        value_ >>= 7U;
+      }
+      *target_++ = static_cast<char>(value_ & 0x7FU);
+      return target_;
+    }
+
     void LogDeserializationException(const std::exception& exception, const std::string& context);
   }
 }
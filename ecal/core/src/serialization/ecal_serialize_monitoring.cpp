@@ -146,6 +146,85 @@ namespace
     pb_callback.arg = (void*)(&layer_vec);
   }
 
+  bool encode_mon_acknowledge_statistics_field(pb_ostream_t* stream, const pb_field_iter_t* field, void* const* arg)
+  {
+    if (arg == nullptr)  return false;
+    if (*arg == nullptr) return false;
+
+    auto* statistics_vec = static_cast<std::vector<eCAL::Monitoring::SAcknowledgeStatistics>*>(*arg);
+
+    for (const auto& statistics : *statistics_vec)
+    {
+      if (!pb_encode_tag_for_field(stream, field))
+      {
+        return false;
+      }
+
+      eCAL_pb_AcknowledgeStatistics pb_statistics = eCAL_pb_AcknowledgeStatistics_init_default;
+      pb_statistics.process_id        = statistics.process_id;
+      pb_statistics.acknowledge_count = statistics.acknowledge_count;
+      pb_statistics.timeout_count     = statistics.timeout_count;
+
+      pb_statistics.has_latency = true;
+      eCAL::nanopb::encode_int64_vector(pb_statistics.latency.bucket_limits_us, statistics.latency.bucket_limits_us);
+      eCAL::nanopb::encode_int64_vector(pb_statistics.latency.bucket_counts, statistics.latency.bucket_counts);
+
+      if (!pb_encode_submessage(stream, eCAL_pb_AcknowledgeStatistics_fields, &pb_statistics))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  void encode_mon_acknowledge_statistics(pb_callback_t& pb_callback, const std::vector<eCAL::Monitoring::SAcknowledgeStatistics>& statistics_vec)
+  {
+    pb_callback.funcs.encode = &encode_mon_acknowledge_statistics_field; // NOLINT(*-pro-type-union-access)
+    pb_callback.arg = (void*)(&statistics_vec);
+  }
+
+  bool encode_mon_latency_statistics_field(pb_ostream_t* stream, const pb_field_iter_t* field, void* const* arg)
+  {
+    if (arg == nullptr)  return false;
+    if (*arg == nullptr) return false;
+
+    auto* statistics_vec = static_cast<std::vector<eCAL::Monitoring::SLatencyStatistics>*>(*arg);
+
+    for (const auto& statistics : *statistics_vec)
+    {
+      if (!pb_encode_tag_for_field(stream, field))
+      {
+        return false;
+      }
+
+      eCAL_pb_LatencyStatistics pb_statistics = eCAL_pb_LatencyStatistics_init_default;
+      eCAL::nanopb::encode_int_to_string(pb_statistics.publisher_id, statistics.publisher_id);
+      pb_statistics.layer = static_cast<eCAL_pb_eTransportLayerType>(statistics.layer);
+
+      pb_statistics.has_delivery_latency = true;
+      eCAL::nanopb::encode_int64_vector(pb_statistics.delivery_latency.bucket_limits_us, statistics.delivery_latency.bucket_limits_us);
+      eCAL::nanopb::encode_int64_vector(pb_statistics.delivery_latency.bucket_counts, statistics.delivery_latency.bucket_counts);
+
+      pb_statistics.has_callback_latency = true;
+      eCAL::nanopb::encode_int64_vector(pb_statistics.callback_latency.bucket_limits_us, statistics.callback_latency.bucket_limits_us);
+      eCAL::nanopb::encode_int64_vector(pb_statistics.callback_latency.bucket_counts, statistics.callback_latency.bucket_counts);
+
+      if (!pb_encode_submessage(stream, eCAL_pb_LatencyStatistics_fields, &pb_statistics))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  void encode_mon_latency_statistics(pb_callback_t& pb_callback, const std::vector<eCAL::Monitoring::SLatencyStatistics>& statistics_vec)
+  {
+    pb_callback.funcs.encode = &encode_mon_latency_statistics_field; // NOLINT(*-pro-type-union-access)
+    pb_callback.arg = (void*)(&statistics_vec);
+  }
+
   void PrepareEncoding(const eCAL::Monitoring::STopic& topic_, eCAL_pb_Topic& pb_topic_)
   {
     // registration_clock
@@ -188,8 +267,25 @@ namespace
     pb_topic_.data_clock = topic_.data_clock;
     // data_frequency
     pb_topic_.data_frequency = topic_.data_frequency;
+    // fec_recovered_messages
+    pb_topic_.fec_recovered_messages = topic_.fec_recovered_messages;
+    // fec_lost_messages
+    pb_topic_.fec_lost_messages = topic_.fec_lost_messages;
     // transport_layer
     encode_mon_registration_layer(pb_topic_.transport_layer, topic_.transport_layer);
+    // acknowledge_statistics
+    encode_mon_acknowledge_statistics(pb_topic_.acknowledge_statistics, topic_.acknowledge_statistics);
+    // callback_statistics
+    pb_topic_.has_callback_statistics = true;
+    pb_topic_.callback_statistics.queue_size     = topic_.callback_statistics.queue_size;
+    pb_topic_.callback_statistics.queue_depth    = topic_.callback_statistics.queue_depth;
+    pb_topic_.callback_statistics.executed_count = topic_.callback_statistics.executed_count;
+    pb_topic_.callback_statistics.drop_count     = topic_.callback_statistics.drop_count;
+    pb_topic_.callback_statistics.has_latency = true;
+    eCAL::nanopb::encode_int64_vector(pb_topic_.callback_statistics.latency.bucket_limits_us, topic_.callback_statistics.latency.bucket_limits_us);
+    eCAL::nanopb::encode_int64_vector(pb_topic_.callback_statistics.latency.bucket_counts, topic_.callback_statistics.latency.bucket_counts);
+    // latency_statistics
+    encode_mon_latency_statistics(pb_topic_.latency_statistics, topic_.latency_statistics);
   }
 
   bool encode_mon_message_topics_field(pb_ostream_t* stream, const pb_field_iter_t* field, void* const* arg)
@@ -597,6 +693,77 @@ namespace
     pb_callback.arg = &layer_vec;
   }
 
+  bool decode_mon_acknowledge_statistics_field(pb_istream_t* stream, const pb_field_iter_t* /*field*/, void** arg)
+  {
+    if (arg == nullptr)  return false;
+    if (*arg == nullptr) return false;
+
+    eCAL_pb_AcknowledgeStatistics            pb_statistics = eCAL_pb_AcknowledgeStatistics_init_default;
+    eCAL::Monitoring::SAcknowledgeStatistics statistics{};
+
+    // decode latency histogram
+    eCAL::nanopb::decode_int64_vector(pb_statistics.latency.bucket_limits_us, statistics.latency.bucket_limits_us);
+    eCAL::nanopb::decode_int64_vector(pb_statistics.latency.bucket_counts, statistics.latency.bucket_counts);
+
+    if (!pb_decode(stream, eCAL_pb_AcknowledgeStatistics_fields, &pb_statistics))
+    {
+      return false;
+    }
+
+    // apply statistics values
+    statistics.process_id        = pb_statistics.process_id;
+    statistics.acknowledge_count = pb_statistics.acknowledge_count;
+    statistics.timeout_count     = pb_statistics.timeout_count;
+
+    // add statistics
+    auto* tgt_vector = static_cast<std::vector<eCAL::Monitoring::SAcknowledgeStatistics>*>(*arg);
+    tgt_vector->push_back(statistics);
+
+    return true;
+  }
+
+  void decode_mon_acknowledge_statistics(pb_callback_t& pb_callback, std::vector<eCAL::Monitoring::SAcknowledgeStatistics>& statistics_vec)
+  {
+    pb_callback.funcs.decode = &decode_mon_acknowledge_statistics_field; // NOLINT(*-pro-type-union-access)
+    pb_callback.arg = &statistics_vec;
+  }
+
+  bool decode_mon_latency_statistics_field(pb_istream_t* stream, const pb_field_iter_t* /*field*/, void** arg)
+  {
+    if (arg == nullptr)  return false;
+    if (*arg == nullptr) return false;
+
+    eCAL_pb_LatencyStatistics            pb_statistics = eCAL_pb_LatencyStatistics_init_default;
+    eCAL::Monitoring::SLatencyStatistics statistics{};
+
+    // decode publisher id and latency histograms
+    eCAL::nanopb::decode_int_from_string(pb_statistics.publisher_id, statistics.publisher_id);
+    eCAL::nanopb::decode_int64_vector(pb_statistics.delivery_latency.bucket_limits_us, statistics.delivery_latency.bucket_limits_us);
+    eCAL::nanopb::decode_int64_vector(pb_statistics.delivery_latency.bucket_counts, statistics.delivery_latency.bucket_counts);
+    eCAL::nanopb::decode_int64_vector(pb_statistics.callback_latency.bucket_limits_us, statistics.callback_latency.bucket_limits_us);
+    eCAL::nanopb::decode_int64_vector(pb_statistics.callback_latency.bucket_counts, statistics.callback_latency.bucket_counts);
+
+    if (!pb_decode(stream, eCAL_pb_LatencyStatistics_fields, &pb_statistics))
+    {
+      return false;
+    }
+
+    // apply statistics values
+    statistics.layer = static_cast<eCAL::Monitoring::eTransportLayerType>(pb_statistics.layer);
+
+    // add statistics
+    auto* tgt_vector = static_cast<std::vector<eCAL::Monitoring::SLatencyStatistics>*>(*arg);
+    tgt_vector->push_back(statistics);
+
+    return true;
+  }
+
+  void decode_mon_latency_statistics(pb_callback_t& pb_callback, std::vector<eCAL::Monitoring::SLatencyStatistics>& statistics_vec)
+  {
+    pb_callback.funcs.decode = &decode_mon_latency_statistics_field; // NOLINT(*-pro-type-union-access)
+    pb_callback.arg = &statistics_vec;
+  }
+
   void PrepareDecoding(eCAL_pb_Topic& pb_topic_, eCAL::Monitoring::STopic& topic_)
   {
     // initialize
@@ -627,6 +794,13 @@ namespace
     eCAL::nanopb::decode_string(pb_topic_.datatype_information.descriptor_information, topic_.datatype_information.descriptor);
     // transport_layer
     decode_mon_registration_layer(pb_topic_.transport_layer, topic_.transport_layer);
+    // acknowledge_statistics
+    decode_mon_acknowledge_statistics(pb_topic_.acknowledge_statistics, topic_.acknowledge_statistics);
+    // callback_statistics.latency
+    eCAL::nanopb::decode_int64_vector(pb_topic_.callback_statistics.latency.bucket_limits_us, topic_.callback_statistics.latency.bucket_limits_us);
+    eCAL::nanopb::decode_int64_vector(pb_topic_.callback_statistics.latency.bucket_counts, topic_.callback_statistics.latency.bucket_counts);
+    // latency_statistics
+    decode_mon_latency_statistics(pb_topic_.latency_statistics, topic_.latency_statistics);
   }
 
   void AssignValues(const eCAL_pb_Topic& pb_topic_, eCAL::Monitoring::STopic& topic_)
@@ -652,6 +826,15 @@ namespace
     topic_.data_clock = pb_topic_.data_clock;
     // data_frequency
     topic_.data_frequency = pb_topic_.data_frequency;
+    // fec_recovered_messages
+    topic_.fec_recovered_messages = pb_topic_.fec_recovered_messages;
+    // fec_lost_messages
+    topic_.fec_lost_messages = pb_topic_.fec_lost_messages;
+    // callback_statistics
+    topic_.callback_statistics.queue_size     = pb_topic_.callback_statistics.queue_size;
+    topic_.callback_statistics.queue_depth    = pb_topic_.callback_statistics.queue_depth;
+    topic_.callback_statistics.executed_count = pb_topic_.callback_statistics.executed_count;
+    topic_.callback_statistics.drop_count     = pb_topic_.callback_statistics.drop_count;
   }
 
   bool decode_topics_field(pb_istream_t* stream, const pb_field_iter_t* /*field*/, void** arg)
@@ -1080,6 +1263,143 @@ namespace{
     }
   }
 
+  template <typename Writer>
+  void SerializeAcknowledgeStatistics(Writer& writer_, const eCAL::Monitoring::SAcknowledgeStatistics& source_sample_)
+  {
+    writer_.add_int32(+eCAL::pb::AcknowledgeStatistics::optional_int32_process_id, source_sample_.process_id);
+    writer_.add_int64(+eCAL::pb::AcknowledgeStatistics::optional_int64_acknowledge_count, source_sample_.acknowledge_count);
+    writer_.add_int64(+eCAL::pb::AcknowledgeStatistics::optional_int64_timeout_count, source_sample_.timeout_count);
+    {
+      Writer latency_writer{ writer_, +eCAL::pb::AcknowledgeStatistics::optional_message_latency };
+      latency_writer.add_packed_int64(+eCAL::pb::LatencyHistogram::repeated_int64_bucket_limits_us, source_sample_.latency.bucket_limits_us.begin(), source_sample_.latency.bucket_limits_us.end());
+      latency_writer.add_packed_int64(+eCAL::pb::LatencyHistogram::repeated_int64_bucket_counts, source_sample_.latency.bucket_counts.begin(), source_sample_.latency.bucket_counts.end());
+    }
+  }
+
+  void DeserializeLatencyHistogram(protozero::pbf_reader& reader_, eCAL::Monitoring::SLatencyHistogram& target_sample_)
+  {
+    while (reader_.next())
+    {
+      switch (reader_.tag())
+      {
+      case +eCAL::pb::LatencyHistogram::repeated_int64_bucket_limits_us:
+        AddRepeatedInt64(reader_, target_sample_.bucket_limits_us);
+        break;
+      case +eCAL::pb::LatencyHistogram::repeated_int64_bucket_counts:
+        AddRepeatedInt64(reader_, target_sample_.bucket_counts);
+        break;
+      default:
+        reader_.skip();
+      }
+    }
+  }
+
+  void DeserializeAcknowledgeStatistics(protozero::pbf_reader& reader_, eCAL::Monitoring::SAcknowledgeStatistics& target_sample_)
+  {
+    while (reader_.next())
+    {
+      switch (reader_.tag())
+      {
+      case +eCAL::pb::AcknowledgeStatistics::optional_int32_process_id:
+        target_sample_.process_id = reader_.get_int32();
+        break;
+      case +eCAL::pb::AcknowledgeStatistics::optional_int64_acknowledge_count:
+        target_sample_.acknowledge_count = reader_.get_int64();
+        break;
+      case +eCAL::pb::AcknowledgeStatistics::optional_int64_timeout_count:
+        target_sample_.timeout_count = reader_.get_int64();
+        break;
+      case +eCAL::pb::AcknowledgeStatistics::optional_message_latency:
+        AssignMessage(reader_, target_sample_.latency, DeserializeLatencyHistogram);
+        break;
+      default:
+        reader_.skip();
+      }
+    }
+  }
+
+  template <typename Writer>
+  void SerializeCallbackStatistics(Writer& writer_, const eCAL::Monitoring::SCallbackStatistics& source_sample_)
+  {
+    writer_.add_int32(+eCAL::pb::CallbackStatistics::optional_int32_queue_size, source_sample_.queue_size);
+    writer_.add_int32(+eCAL::pb::CallbackStatistics::optional_int32_queue_depth, source_sample_.queue_depth);
+    writer_.add_int64(+eCAL::pb::CallbackStatistics::optional_int64_executed_count, source_sample_.executed_count);
+    writer_.add_int64(+eCAL::pb::CallbackStatistics::optional_int64_drop_count, source_sample_.drop_count);
+    {
+      Writer latency_writer{ writer_, +eCAL::pb::CallbackStatistics::optional_message_latency };
+      latency_writer.add_packed_int64(+eCAL::pb::LatencyHistogram::repeated_int64_bucket_limits_us, source_sample_.latency.bucket_limits_us.begin(), source_sample_.latency.bucket_limits_us.end());
+      latency_writer.add_packed_int64(+eCAL::pb::LatencyHistogram::repeated_int64_bucket_counts, source_sample_.latency.bucket_counts.begin(), source_sample_.latency.bucket_counts.end());
+    }
+  }
+
+  void DeserializeCallbackStatistics(protozero::pbf_reader& reader_, eCAL::Monitoring::SCallbackStatistics& target_sample_)
+  {
+    while (reader_.next())
+    {
+      switch (reader_.tag())
+      {
+      case +eCAL::pb::CallbackStatistics::optional_int32_queue_size:
+        target_sample_.queue_size = reader_.get_int32();
+        break;
+      case +eCAL::pb::CallbackStatistics::optional_int32_queue_depth:
+        target_sample_.queue_depth = reader_.get_int32();
+        break;
+      case +eCAL::pb::CallbackStatistics::optional_int64_executed_count:
+        target_sample_.executed_count = reader_.get_int64();
+        break;
+      case +eCAL::pb::CallbackStatistics::optional_int64_drop_count:
+        target_sample_.drop_count = reader_.get_int64();
+        break;
+      case +eCAL::pb::CallbackStatistics::optional_message_latency:
+        AssignMessage(reader_, target_sample_.latency, DeserializeLatencyHistogram);
+        break;
+      default:
+        reader_.skip();
+      }
+    }
+  }
+
+  template <typename Writer>
+  void SerializeLatencyHistogram(Writer& writer_, protozero::pbf_tag_type tag_, const eCAL::Monitoring::SLatencyHistogram& source_sample_)
+  {
+    Writer latency_writer{ writer_, tag_ };
+    latency_writer.add_packed_int64(+eCAL::pb::LatencyHistogram::repeated_int64_bucket_limits_us, source_sample_.bucket_limits_us.begin(), source_sample_.bucket_limits_us.end());
+    latency_writer.add_packed_int64(+eCAL::pb::LatencyHistogram::repeated_int64_bucket_counts, source_sample_.bucket_counts.begin(), source_sample_.bucket_counts.end());
+  }
+
+  template <typename Writer>
+  void SerializeLatencyStatistics(Writer& writer_, const eCAL::Monitoring::SLatencyStatistics& source_sample_)
+  {
+    writer_.add_string(+eCAL::pb::LatencyStatistics::optional_string_publisher_id, std::to_string(source_sample_.publisher_id));
+    writer_.add_enum(+eCAL::pb::LatencyStatistics::optional_enum_layer, static_cast<int>(source_sample_.layer));
+    SerializeLatencyHistogram(writer_, +eCAL::pb::LatencyStatistics::optional_message_delivery_latency, source_sample_.delivery_latency);
+    SerializeLatencyHistogram(writer_, +eCAL::pb::LatencyStatistics::optional_message_callback_latency, source_sample_.callback_latency);
+  }
+
+  void DeserializeLatencyStatistics(protozero::pbf_reader& reader_, eCAL::Monitoring::SLatencyStatistics& target_sample_)
+  {
+    while (reader_.next())
+    {
+      switch (reader_.tag())
+      {
+      case +eCAL::pb::LatencyStatistics::optional_string_publisher_id:
+        target_sample_.publisher_id = std::stoull(reader_.get_string());
+        break;
+      case +eCAL::pb::LatencyStatistics::optional_enum_layer:
+        target_sample_.layer = static_cast<eCAL::Monitoring::eTransportLayerType>(reader_.get_enum());
+        break;
+      case +eCAL::pb::LatencyStatistics::optional_message_delivery_latency:
+        AssignMessage(reader_, target_sample_.delivery_latency, DeserializeLatencyHistogram);
+        break;
+      case +eCAL::pb::LatencyStatistics::optional_message_callback_latency:
+        AssignMessage(reader_, target_sample_.callback_latency, DeserializeLatencyHistogram);
+        break;
+      default:
+        reader_.skip();
+      }
+    }
+  }
+
   template <typename Writer>
   void SerializeTopic(Writer& writer_, const eCAL::Monitoring::STopic& source_sample_)
   {
@@ -1108,6 +1428,22 @@ namespace{
     writer_.add_int64(+eCAL::pb::Topic::optional_int64_data_id, source_sample_.data_id);
     writer_.add_int64(+eCAL::pb::Topic::optional_int64_data_clock, source_sample_.data_clock);
     writer_.add_int32(+eCAL::pb::Topic::optional_int32_data_frequency, source_sample_.data_frequency);
+    writer_.add_int64(+eCAL::pb::Topic::optional_int64_fec_recovered_messages, source_sample_.fec_recovered_messages);
+    writer_.add_int64(+eCAL::pb::Topic::optional_int64_fec_lost_messages, source_sample_.fec_lost_messages);
+    for (const auto& statistics : source_sample_.acknowledge_statistics)
+    {
+      Writer statistics_writer{ writer_, +eCAL::pb::Topic::repeated_message_acknowledge_statistics };
+      SerializeAcknowledgeStatistics(statistics_writer, statistics);
+    }
+    {
+      Writer statistics_writer{ writer_, +eCAL::pb::Topic::optional_message_callback_statistics };
+      SerializeCallbackStatistics(statistics_writer, source_sample_.callback_statistics);
+    }
+    for (const auto& statistics : source_sample_.latency_statistics)
+    {
+      Writer statistics_writer{ writer_, +eCAL::pb::Topic::repeated_message_latency_statistics };
+      SerializeLatencyStatistics(statistics_writer, statistics);
+    }
   }
 
   void DeserializeTopic(protozero::pbf_reader& reader_, eCAL::Monitoring::STopic& target_sample_)
@@ -1170,6 +1506,21 @@ namespace{
       case +eCAL::pb::Topic::optional_int32_data_frequency:
         target_sample_.data_frequency = reader_.get_int32();  
         break;
+      case +eCAL::pb::Topic::optional_int64_fec_recovered_messages:
+        target_sample_.fec_recovered_messages = reader_.get_int64();
+        break;
+      case +eCAL::pb::Topic::optional_int64_fec_lost_messages:
+        target_sample_.fec_lost_messages = reader_.get_int64();
+        break;
+      case +eCAL::pb::Topic::repeated_message_acknowledge_statistics:
+        AddRepeatedMessage(reader_, target_sample_.acknowledge_statistics, DeserializeAcknowledgeStatistics);
+        break;
+      case +eCAL::pb::Topic::optional_message_callback_statistics:
+        AssignMessage(reader_, target_sample_.callback_statistics, DeserializeCallbackStatistics);
+        break;
+      case +eCAL::pb::Topic::repeated_message_latency_statistics:
+        AddRepeatedMessage(reader_, target_sample_.latency_statistics, DeserializeLatencyStatistics);
+        break;
       default:
         reader_.skip();
       }
@@ -0,0 +1,112 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @file   ecal_serialize_sample_header.cpp
+ * @brief  eCAL payload sample header with a fixed, pre-encoded layout
+**/
+
+#include "ecal_serialize_sample_header.h"
+#include "ecal_serialize_common.h"
+
+#include <ecal/core/pb/ecal.pbftags.h>
+#include <ecal/core/pb/topic.pbftags.h>
+#include <protozero/pbf_writer.hpp>
+#include <protozero/buffer_vector.hpp>
+
+#include <string>
+
+namespace
+{
+  // protobuf accepts varints with redundant continuation bytes, so every value
+  // of a field can be written with the same width
+  constexpr size_t int_varint_size    = 10;   // any (sign extended) 64 bit value
+  constexpr size_t length_varint_size = 5;    // lengths up to 2^35 - 1
+
+  // tag and fixed width varint of the content fields id, clock, time, size, hash
+  constexpr size_t content_int_fields = 5;
+  constexpr size_t content_ints_size  = content_int_fields * (1 + int_varint_size);
+
+  constexpr char Key(uint32_t field_, protozero::pbf_wire_type wire_type_)
+  {
+    return static_cast<char>((field_ << 3U) | static_cast<uint32_t>(wire_type_));
+  }
+
+  inline char* WriteIntField(char* target_, char key_, int64_t value_)
+  {
+    *target_++ = key_;
+    return eCAL::WriteFixedVarint(target_, static_cast<uint64_t>(value_), int_varint_size);
+  }
+}
+
+namespace eCAL
+{
+  namespace Payload
+  {
+    CFixedSampleHeader::CFixedSampleHeader(const TopicInfo& topic_info_, bool payload_field_, size_t padding_size_, eCmdType cmd_type_) :
+      m_payload_field(payload_field_)
+    {
+      // invariant part, encoded like the regular payload sample serialization
+      {
+        ::protozero::basic_pbf_writer<std::vector<char>> writer{ m_header };
+        writer.add_enum(+eCAL::pb::Sample::optional_enum_cmd_type, cmd_type_);
+        {
+          ::protozero::basic_pbf_writer<std::vector<char>> topic_writer{ writer, +eCAL::pb::Sample::optional_message_topic };
+          topic_writer.add_string(+eCAL::pb::Topic::optional_string_topic_name, topic_info_.topic_name);
+          topic_writer.add_string(+eCAL::pb::Topic::optional_string_topic_id, std::to_string(topic_info_.topic_id));
+          topic_writer.add_int32(+eCAL::pb::Topic::optional_int32_process_id, topic_info_.process_id);
+          topic_writer.add_string(+eCAL::pb::Topic::optional_string_host_name, topic_info_.host_name);
+        }
+        const std::vector<char> padding(padding_size_, 0);
+        writer.add_bytes(+eCAL::pb::Sample::optional_bytes_padding, padding.data(), padding.size());
+      }
+
+      // content message with fixed width fields, always the last field of the header
+      m_header.push_back(Key(+eCAL::pb::Sample::optional_message_content, ::protozero::pbf_wire_type::length_delimited));
+      m_content_offset = m_header.size();
+      m_header.resize(m_content_offset + length_varint_size + content_ints_size + (m_payload_field ? 1 + length_varint_size : 0));
+
+      SetContent(0, 0, 0, 0, 0, 0);
+    }
+
+    void CFixedSampleHeader::SetContent(int64_t id_, int64_t clock_, int64_t time_, int64_t hash_, int32_t size_, size_t payload_size_)
+    {
+      PatchContent(m_header.data(), id_, clock_, time_, hash_, size_, payload_size_);
+    }
+
+    void CFixedSampleHeader::PatchContent(char* header_, int64_t id_, int64_t clock_, int64_t time_, int64_t hash_, int32_t size_, size_t payload_size_) const
+    {
+      size_t content_size = content_ints_size;
+      if (m_payload_field) content_size += 1 + length_varint_size + payload_size_;
+
+      char* target = header_ + m_content_offset;
+      target = WriteFixedVarint(target, content_size, length_varint_size);
+      target = WriteIntField(target, Key(+eCAL::pb::Content::optional_int64_id,    ::protozero::pbf_wire_type::varint), id_);
+      target = WriteIntField(target, Key(+eCAL::pb::Content::optional_int64_clock, ::protozero::pbf_wire_type::varint), clock_);
+      target = WriteIntField(target, Key(+eCAL::pb::Content::optional_int64_time,  ::protozero::pbf_wire_type::varint), time_);
+      target = WriteIntField(target, Key(+eCAL::pb::Content::optional_int32_size,  ::protozero::pbf_wire_type::varint), size_);
+      target = WriteIntField(target, Key(+eCAL::pb::Content::optional_int64_hash,  ::protozero::pbf_wire_type::varint), hash_);
+      if (m_payload_field)
+      {
+        *target++ = Key(+eCAL::pb::Content::optional_bytes_payload, ::protozero::pbf_wire_type::length_delimited);
+        WriteFixedVarint(target, payload_size_, length_varint_size);
+      }
+    }
+  }
+}
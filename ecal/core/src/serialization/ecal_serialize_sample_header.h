@@ -0,0 +1,71 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @file   ecal_serialize_sample_header.h
+ * @brief  eCAL payload sample header with a fixed, pre-encoded layout
+**/
+
+#pragma once
+
+#include "ecal_struct_sample_payload.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace eCAL
+{
+  namespace Payload
+  {
+    /**
+     * @brief Pre-encoded header of a payload sample (bct_set_sample or bct_set_sample_replay).
+     *
+     * The command type, the topic information and the padding never change for a writer,
+     * so they are encoded once. The content fields (id, clock, time, size, hash) and the
+     * payload length are encoded as fixed width varints at the end of the header, a new
+     * message only patches them in place.
+     *
+     * The header is a valid serialized eCAL::pb::Sample. With payload_field_ == true it
+     * ends with the tag and the length of the content payload, the payload bytes have to
+     * follow the header directly.
+     */
+    class CFixedSampleHeader
+    {
+    public:
+      CFixedSampleHeader() = default;
+      CFixedSampleHeader(const TopicInfo& topic_info_, bool payload_field_, size_t padding_size_ = 0, eCmdType cmd_type_ = bct_set_sample);
+
+      // encoded header including the content fields of the last SetContent call
+      const std::vector<char>& Data() const { return m_header; }
+      size_t                   Size() const { return m_header.size(); }
+
+      // patch the content fields of the internal header
+      void SetContent(int64_t id_, int64_t clock_, int64_t time_, int64_t hash_, int32_t size_, size_t payload_size_ = 0);
+
+      // patch the content fields of a buffer that starts with a copy of this header
+      void PatchContent(char* header_, int64_t id_, int64_t clock_, int64_t time_, int64_t hash_, int32_t size_, size_t payload_size_ = 0) const;
+
+    private:
+      std::vector<char> m_header;
+      size_t            m_content_offset = 0;       // offset of the length of the content message
+      bool              m_payload_field  = false;
+    };
+  }
+}
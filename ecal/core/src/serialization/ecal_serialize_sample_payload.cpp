@@ -37,21 +37,21 @@
 
 namespace
 {
-  void CreatePayloadStruct(const eCAL::Payload::Sample& payload_, eCAL::nanopb::SNanoBytes& nano_bytes_)
+  void CreatePayloadStruct(const eCAL::Payload::Payload& payload_, eCAL::nanopb::SNanoBytes& nano_bytes_)
   {
     // extract payload
     // payload may be stored as std::vector<char> or raw pointer + size
     const char* payload_addr = nullptr;
     size_t      payload_size = 0;
-    switch (payload_.content.payload.type)
+    switch (payload_.type)
     {
     case eCAL::Payload::pl_raw:
-      payload_addr = payload_.content.payload.raw_addr;
-      payload_size = payload_.content.payload.raw_size;
+      payload_addr = payload_.raw_addr;
+      payload_size = payload_.raw_size;
       break;
     case eCAL::Payload::pl_vec:
-      payload_addr = payload_.content.payload.vec.data();
-      payload_size = payload_.content.payload.vec.size();
+      payload_addr = payload_.vec.data();
+      payload_size = payload_.vec.size();
       break;
     default:
       break;
@@ -64,7 +64,71 @@ namespace
       nano_bytes_.length  = payload_size;
     }
   }
-    
+
+  ///////////////////////////////////////////////
+  // batch
+  ///////////////////////////////////////////////
+  bool encode_batch_field(pb_ostream_t* stream, const pb_field_iter_t* field, void* const* arg)
+  {
+    if (arg == nullptr)  return false;
+    if (*arg == nullptr) return false;
+
+    auto* batch = static_cast<std::vector<eCAL::Payload::Content>*>(*arg);
+
+    for (const auto& content : *batch)
+    {
+      if (!pb_encode_tag_for_field(stream, field))
+      {
+        return false;
+      }
+
+      eCAL::nanopb::SNanoBytes nano_bytes;
+      CreatePayloadStruct(content.payload, nano_bytes);
+
+      eCAL_pb_Content pb_content = eCAL_pb_Content_init_default;
+      pb_content.id    = content.id;
+      pb_content.clock = content.clock;
+      pb_content.time  = content.time;
+      pb_content.hash  = content.hash;
+      pb_content.size  = content.size;
+      eCAL::nanopb::encode_bytes(pb_content.payload, nano_bytes);
+
+      if (!pb_encode_submessage(stream, eCAL_pb_Content_fields, &pb_content))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  bool decode_batch_field(pb_istream_t* stream, const pb_field_iter_t* /*field*/, void** arg)
+  {
+    if (arg == nullptr)  return false;
+    if (*arg == nullptr) return false;
+
+    auto* batch = static_cast<std::vector<eCAL::Payload::Content>*>(*arg);
+    batch->emplace_back();
+    auto& content = batch->back();
+
+    eCAL_pb_Content pb_content = eCAL_pb_Content_init_default;
+    content.payload.type = eCAL::Payload::pl_vec;
+    eCAL::nanopb::decode_bytes(pb_content.payload, content.payload.vec);
+
+    if (!pb_decode(stream, eCAL_pb_Content_fields, &pb_content))
+    {
+      return false;
+    }
+
+    content.id    = pb_content.id;
+    content.clock = pb_content.clock;
+    content.time  = pb_content.time;
+    content.hash  = pb_content.hash;
+    content.size  = pb_content.size;
+
+    return true;
+  }
+
   // TODO: The size must be a multiple of 8.
   size_t PayloadStruct2PbSample(const eCAL::Payload::Sample& payload_, const eCAL::nanopb::SNanoBytes& nano_bytes_, eCAL_pb_Sample& pb_sample_)
   {
@@ -96,6 +160,13 @@ namespace
     // padding
     eCAL::nanopb::encode_bytes(pb_sample_.padding, payload_.padding);
 
+    // batch
+    if (!payload_.batch.empty())
+    {
+      pb_sample_.batch.funcs.encode = &encode_batch_field; // NOLINT(*-pro-type-union-access)
+      pb_sample_.batch.arg = (void*)(&payload_.batch);
+    }
+
     ///////////////////////////////////////////////
     // evaluate byte size
     ///////////////////////////////////////////////
@@ -113,7 +184,7 @@ namespace
 
     // create payload helper struct
     eCAL::nanopb::SNanoBytes nano_bytes;
-    CreatePayloadStruct(payload_, nano_bytes);
+    CreatePayloadStruct(payload_.content.payload, nano_bytes);
 
     ///////////////////////////////////////////////
     // prepare sample for encoding
@@ -163,6 +234,11 @@ namespace
     // padding
     eCAL::nanopb::decode_bytes(pb_sample.padding, payload_.padding);
 
+    // batch
+    payload_.batch.clear();
+    pb_sample.batch.funcs.decode = &decode_batch_field; // NOLINT(*-pro-type-union-access)
+    pb_sample.batch.arg = &payload_.batch;
+
     ///////////////////////////////////////////////
     // decode it
     ///////////////////////////////////////////////
@@ -251,6 +327,17 @@ namespace
     }
   }
 
+  template<typename Writer>
+  void SerializeContent(Writer& content_writer, const ::eCAL::Payload::Content& content)
+  {
+    content_writer.add_int64(+eCAL::pb::Content::optional_int64_id, content.id);
+    content_writer.add_int64(+eCAL::pb::Content::optional_int64_clock, content.clock);
+    content_writer.add_int64(+eCAL::pb::Content::optional_int64_time,  content.time);
+    content_writer.add_int32(+eCAL::pb::Content::optional_int32_size, content.size);
+    SerializePayload(content_writer, content.payload);
+    content_writer.add_int64(+eCAL::pb::Content::optional_int64_hash,  content.hash);
+  }
+
   template<typename Writer>
   void SerializePayloadSample(Writer& writer, const ::eCAL::Payload::Sample& sample)
   {
@@ -266,14 +353,14 @@ namespace
     }
     {
       Writer content_writer{ writer, +eCAL::pb::Sample::optional_message_content };
-      content_writer.add_int64(+eCAL::pb::Content::optional_int64_id, sample.content.id);
-      content_writer.add_int64(+eCAL::pb::Content::optional_int64_clock, sample.content.clock);
-      content_writer.add_int64(+eCAL::pb::Content::optional_int64_time,  sample.content.time);
-      content_writer.add_int32(+eCAL::pb::Content::optional_int32_size, sample.content.size);
-      SerializePayload(content_writer, sample.content.payload);
-      content_writer.add_int64(+eCAL::pb::Content::optional_int64_hash,  sample.content.hash);
+      SerializeContent(content_writer, sample.content);
     }
     writer.add_bytes(+eCAL::pb::Sample::optional_bytes_padding, sample.padding.data(), sample.padding.size());
+    for (const auto& content : sample.batch)
+    {
+      Writer content_writer{ writer, +eCAL::pb::Sample::repeated_message_batch };
+      SerializeContent(content_writer, content);
+    }
   }
 
   void DeserializeTopicInfo(protozero::pbf_reader& reader, ::eCAL::Payload::TopicInfo& topic_info)
@@ -305,10 +392,11 @@ namespace
     }
   }
 
-  void DeserializeContent(::protozero::pbf_reader& reader, ::eCAL::Payload::Content& content)
+  // with copy_payload == false the payload is not copied, but references the serialized buffer (pl_raw)
+  void DeserializeContent(::protozero::pbf_reader& reader, ::eCAL::Payload::Content& content, bool copy_payload)
   {
     // We always need to set it (at least for the current testcases...)
-    content.payload.type = eCAL::Payload::pl_vec;
+    content.payload.type = copy_payload ? eCAL::Payload::pl_vec : eCAL::Payload::pl_raw;
     
     while (reader.next())
     {
@@ -327,7 +415,16 @@ namespace
         content.size = reader.get_int32();
         break;
       case +eCAL::pb::Content::optional_bytes_payload:
-        AssignBytes(reader, content.payload.vec);
+        if (copy_payload)
+        {
+          AssignBytes(reader, content.payload.vec);
+        }
+        else
+        {
+          const ::protozero::data_view payload_view = reader.get_view();
+          content.payload.raw_addr = payload_view.data();
+          content.payload.raw_size = payload_view.size();
+        }
         break;
       case +eCAL::pb::Content::optional_int64_hash:
         content.hash = reader.get_int64();
@@ -339,8 +436,13 @@ namespace
     }
   }
 
-  void DeserializePayloadSample(::protozero::pbf_reader& reader, ::eCAL::Payload::Sample& sample)
+  void DeserializePayloadSample(::protozero::pbf_reader& reader, ::eCAL::Payload::Sample& sample, bool copy_payload)
   {
+    auto deserialize_content = [copy_payload](::protozero::pbf_reader& content_reader, ::eCAL::Payload::Content& content)
+    {
+      DeserializeContent(content_reader, content, copy_payload);
+    };
+
     while (reader.next())
     {
       switch (reader.tag())
@@ -352,11 +454,14 @@ namespace
         AssignMessage(reader, sample.topic_info, DeserializeTopicInfo);
         break;
       case +eCAL::pb::Sample::optional_message_content:
-        AssignMessage(reader, sample.content, DeserializeContent);
+        AssignMessage(reader, sample.content, deserialize_content);
         break;
       case +eCAL::pb::Sample::optional_bytes_padding:
         AssignBytes(reader, sample.padding);
         break;
+      case +eCAL::pb::Sample::repeated_message_batch:
+        AddRepeatedMessage(reader, sample.batch, deserialize_content);
+        break;
       default:
         reader.skip();
       }
@@ -392,7 +497,24 @@ namespace eCAL
         // @todo we clear the target sample before deserialization, but Payload::Sample doesn't have a clear function
         // we should check this;
         ::protozero::pbf_reader message{ data_, size_ };
-        DeserializePayloadSample(message, target_sample_);
+        target_sample_.batch.clear();
+        DeserializePayloadSample(message, target_sample_, true);
+        return true;
+      }
+      catch (const std::exception& exception)
+      {
+        LogDeserializationException(exception, "eCAL::Payload::Sample");
+        return false;
+      }
+    }
+
+    bool DeserializeFromBufferNoCopy(const char* data_, size_t size_, Payload::Sample& target_sample_)
+    {
+      try
+      {
+        ::protozero::pbf_reader message{ data_, size_ };
+        target_sample_.batch.clear();
+        DeserializePayloadSample(message, target_sample_, false);
         return true;
       }
       catch (const std::exception& exception)
@@ -47,5 +47,9 @@ namespace eCAL
     bool SerializeToBuffer     (const Payload::Sample& source_sample_, std::vector<char>& target_buffer_);
     bool SerializeToBuffer     (const Payload::Sample& source_sample_, std::string& target_buffer_);
     bool DeserializeFromBuffer (const char* data_, size_t size_, Payload::Sample& target_sample_);   
+
+    // payload sample - deserialize without copying the payload
+    // the payload content is of type pl_raw and points into data_, so data_ has to outlive target_sample_
+    bool DeserializeFromBufferNoCopy(const char* data_, size_t size_, Payload::Sample& target_sample_);
   }
 }
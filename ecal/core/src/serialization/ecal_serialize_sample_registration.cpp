@@ -191,8 +191,31 @@ namespace
     pb_topic_.data_clock = registration_topic_.data_clock;
     // data_frequency
     pb_topic_.data_frequency = registration_topic_.data_frequency;
+    // fec_recovered_messages
+    pb_topic_.fec_recovered_messages = registration_topic_.fec_recovered_messages;
+    // fec_lost_messages
+    pb_topic_.fec_lost_messages = registration_topic_.fec_lost_messages;
     // transport_layer
     eCAL::nanopb::encode_registration_layer(pb_topic_.transport_layer, registration_topic_.transport_layer);
+    // acknowledge_statistics
+    eCAL::nanopb::encode_acknowledge_statistics(pb_topic_.acknowledge_statistics, registration_topic_.acknowledge_statistics);
+    // callback_statistics
+    pb_topic_.has_callback_statistics = true;
+    pb_topic_.callback_statistics.queue_size     = registration_topic_.callback_statistics.queue_size;
+    pb_topic_.callback_statistics.queue_depth    = registration_topic_.callback_statistics.queue_depth;
+    pb_topic_.callback_statistics.executed_count = registration_topic_.callback_statistics.executed_count;
+    pb_topic_.callback_statistics.drop_count     = registration_topic_.callback_statistics.drop_count;
+    pb_topic_.callback_statistics.has_latency = true;
+    eCAL::nanopb::encode_int64_vector(pb_topic_.callback_statistics.latency.bucket_limits_us, registration_topic_.callback_statistics.latency.bucket_limits_us);
+    eCAL::nanopb::encode_int64_vector(pb_topic_.callback_statistics.latency.bucket_counts, registration_topic_.callback_statistics.latency.bucket_counts);
+    // latency_statistics
+    eCAL::nanopb::encode_latency_statistics(pb_topic_.latency_statistics, registration_topic_.latency_statistics);
+    // sample_filter
+    pb_topic_.has_sample_filter = true;
+    pb_topic_.sample_filter.downsampling_factor = registration_topic_.sample_filter.downsampling_factor;
+    pb_topic_.sample_filter.max_frequency       = registration_topic_.sample_filter.max_frequency;
+    // datatype_descriptor_hash
+    pb_topic_.datatype_descriptor_hash = registration_topic_.datatype_descriptor_hash;
   }
 
   /////////////////////////////////////////////////////////////////////////////////
@@ -244,6 +267,30 @@ namespace
     default:
       break;
     }
+
+    ///////////////////////////////////////////////
+    // registration state
+    ///////////////////////////////////////////////
+    // samples of senders without delta registration support do not have a registration state
+    pb_sample_.has_registration_state = (registration_.protocol_version > 0);
+    pb_sample_.registration_state.protocol_version = registration_.protocol_version;
+    pb_sample_.registration_state.generation       = registration_.generation;
+    // heartbeats and requests do not carry an entity message, so they need to transport the identifier here
+    if ((registration_.cmd_type == eCAL::bct_reg_heartbeat) || (registration_.cmd_type == eCAL::bct_reg_request) || (registration_.cmd_type == eCAL::bct_reg_descriptor_request))
+    {
+      pb_sample_.registration_state.entity_id  = registration_.identifier.entity_id;
+      pb_sample_.registration_state.process_id = registration_.identifier.process_id;
+      eCAL::nanopb::encode_string(pb_sample_.registration_state.host_name, registration_.identifier.host_name);
+    }
+    // datatype descriptors and their requests
+    if ((registration_.cmd_type == eCAL::bct_reg_descriptor) || (registration_.cmd_type == eCAL::bct_reg_descriptor_request))
+    {
+      pb_sample_.registration_state.descriptor_hash = registration_.topic.datatype_descriptor_hash;
+    }
+    if (registration_.cmd_type == eCAL::bct_reg_descriptor)
+    {
+      eCAL::nanopb::encode_string(pb_sample_.registration_state.descriptor, registration_.topic.datatype_information.descriptor);
+    }
   }
 
   size_t RegistrationStruct2PbSample(const eCAL::Registration::Sample& registration_, eCAL_pb_Sample& pb_sample_)
@@ -382,6 +429,21 @@ namespace
     eCAL::nanopb::decode_string(pb_sample_.topic.datatype_information.descriptor_information, registration_.topic.datatype_information.descriptor);
     // transport_layer
     eCAL::nanopb::decode_registration_layer(pb_sample_.topic.transport_layer, registration_.topic.transport_layer);
+    // acknowledge_statistics
+    eCAL::nanopb::decode_acknowledge_statistics(pb_sample_.topic.acknowledge_statistics, registration_.topic.acknowledge_statistics);
+    // callback_statistics.latency
+    eCAL::nanopb::decode_int64_vector(pb_sample_.topic.callback_statistics.latency.bucket_limits_us, registration_.topic.callback_statistics.latency.bucket_limits_us);
+    eCAL::nanopb::decode_int64_vector(pb_sample_.topic.callback_statistics.latency.bucket_counts, registration_.topic.callback_statistics.latency.bucket_counts);
+    // latency_statistics
+    eCAL::nanopb::decode_latency_statistics(pb_sample_.topic.latency_statistics, registration_.topic.latency_statistics);
+
+    ///////////////////////////////////////////////
+    // registration state
+    ///////////////////////////////////////////////
+    // host_name (heartbeat / request only)
+    eCAL::nanopb::decode_string(pb_sample_.registration_state.host_name, registration_.identifier.host_name);
+    // descriptor (descriptor only)
+    eCAL::nanopb::decode_string(pb_sample_.registration_state.descriptor, registration_.topic.datatype_information.descriptor);
   }
 
   void AssignValues(const eCAL_pb_Sample& pb_sample_, eCAL::Registration::Sample& registration_)
@@ -454,10 +516,47 @@ namespace
       registration_.topic.data_clock = pb_sample_.topic.data_clock;
       // data_frequency
       registration_.topic.data_frequency = pb_sample_.topic.data_frequency;
+      // fec_recovered_messages
+      registration_.topic.fec_recovered_messages = pb_sample_.topic.fec_recovered_messages;
+      // fec_lost_messages
+      registration_.topic.fec_lost_messages = pb_sample_.topic.fec_lost_messages;
+      // callback_statistics
+      registration_.topic.callback_statistics.queue_size     = pb_sample_.topic.callback_statistics.queue_size;
+      registration_.topic.callback_statistics.queue_depth    = pb_sample_.topic.callback_statistics.queue_depth;
+      registration_.topic.callback_statistics.executed_count = pb_sample_.topic.callback_statistics.executed_count;
+      registration_.topic.callback_statistics.drop_count     = pb_sample_.topic.callback_statistics.drop_count;
+      // sample_filter
+      registration_.topic.sample_filter.downsampling_factor = pb_sample_.topic.sample_filter.downsampling_factor;
+      registration_.topic.sample_filter.max_frequency       = pb_sample_.topic.sample_filter.max_frequency;
+      // datatype_descriptor_hash
+      registration_.topic.datatype_descriptor_hash = pb_sample_.topic.datatype_descriptor_hash;
+      break;
+    case eCAL::bct_reg_heartbeat:
+    case eCAL::bct_reg_request:
+      // entity_id
+      registration_.identifier.entity_id = pb_sample_.registration_state.entity_id;
+      // process_id
+      registration_.identifier.process_id = pb_sample_.registration_state.process_id;
+      break;
+    case eCAL::bct_reg_descriptor_request:
+      // entity_id
+      registration_.identifier.entity_id = pb_sample_.registration_state.entity_id;
+      // process_id
+      registration_.identifier.process_id = pb_sample_.registration_state.process_id;
+      // descriptor_hash
+      registration_.topic.datatype_descriptor_hash = pb_sample_.registration_state.descriptor_hash;
+      break;
+    case eCAL::bct_reg_descriptor:
+      // descriptor_hash
+      registration_.topic.datatype_descriptor_hash = pb_sample_.registration_state.descriptor_hash;
       break;
     default:
     break;
     }
+
+    // registration state
+    registration_.protocol_version = pb_sample_.registration_state.protocol_version;
+    registration_.generation       = pb_sample_.registration_state.generation;
   }
 
   bool Buffer2RegistrationStruct(const char* data_, size_t size_, eCAL::Registration::Sample& registration_)
@@ -829,6 +928,172 @@ namespace
     }
   }
 
+  template <typename Writer>
+  void SerializeAcknowledgeStatistics(Writer& writer, const eCAL::Registration::AcknowledgeStatistics& statistics)
+  {
+    writer.add_int32(+eCAL::pb::AcknowledgeStatistics::optional_int32_process_id, statistics.process_id);
+    writer.add_int64(+eCAL::pb::AcknowledgeStatistics::optional_int64_acknowledge_count, statistics.acknowledge_count);
+    writer.add_int64(+eCAL::pb::AcknowledgeStatistics::optional_int64_timeout_count, statistics.timeout_count);
+    {
+      Writer latency_writer{ writer, +eCAL::pb::AcknowledgeStatistics::optional_message_latency };
+      latency_writer.add_packed_int64(+eCAL::pb::LatencyHistogram::repeated_int64_bucket_limits_us, statistics.latency.bucket_limits_us.begin(), statistics.latency.bucket_limits_us.end());
+      latency_writer.add_packed_int64(+eCAL::pb::LatencyHistogram::repeated_int64_bucket_counts, statistics.latency.bucket_counts.begin(), statistics.latency.bucket_counts.end());
+    }
+  }
+
+  void DeserializeLatencyHistogram(::protozero::pbf_reader& reader, eCAL::Registration::LatencyHistogram& histogram)
+  {
+    while (reader.next())
+    {
+      switch (reader.tag())
+      {
+      case +eCAL::pb::LatencyHistogram::repeated_int64_bucket_limits_us:
+        AddRepeatedInt64(reader, histogram.bucket_limits_us);
+        break;
+      case +eCAL::pb::LatencyHistogram::repeated_int64_bucket_counts:
+        AddRepeatedInt64(reader, histogram.bucket_counts);
+        break;
+      default:
+        reader.skip();
+      }
+    }
+  }
+
+  void DeserializeAcknowledgeStatistics(::protozero::pbf_reader& reader, eCAL::Registration::AcknowledgeStatistics& statistics)
+  {
+    while (reader.next())
+    {
+      switch (reader.tag())
+      {
+      case +eCAL::pb::AcknowledgeStatistics::optional_int32_process_id:
+        statistics.process_id = reader.get_int32();
+        break;
+      case +eCAL::pb::AcknowledgeStatistics::optional_int64_acknowledge_count:
+        statistics.acknowledge_count = reader.get_int64();
+        break;
+      case +eCAL::pb::AcknowledgeStatistics::optional_int64_timeout_count:
+        statistics.timeout_count = reader.get_int64();
+        break;
+      case +eCAL::pb::AcknowledgeStatistics::optional_message_latency:
+        AssignMessage(reader, statistics.latency, DeserializeLatencyHistogram);
+        break;
+      default:
+        reader.skip();
+      }
+    }
+  }
+
+  template <typename Writer>
+  void SerializeCallbackStatistics(Writer& writer, const eCAL::Registration::CallbackStatistics& statistics)
+  {
+    writer.add_int32(+eCAL::pb::CallbackStatistics::optional_int32_queue_size, statistics.queue_size);
+    writer.add_int32(+eCAL::pb::CallbackStatistics::optional_int32_queue_depth, statistics.queue_depth);
+    writer.add_int64(+eCAL::pb::CallbackStatistics::optional_int64_executed_count, statistics.executed_count);
+    writer.add_int64(+eCAL::pb::CallbackStatistics::optional_int64_drop_count, statistics.drop_count);
+    {
+      Writer latency_writer{ writer, +eCAL::pb::CallbackStatistics::optional_message_latency };
+      latency_writer.add_packed_int64(+eCAL::pb::LatencyHistogram::repeated_int64_bucket_limits_us, statistics.latency.bucket_limits_us.begin(), statistics.latency.bucket_limits_us.end());
+      latency_writer.add_packed_int64(+eCAL::pb::LatencyHistogram::repeated_int64_bucket_counts, statistics.latency.bucket_counts.begin(), statistics.latency.bucket_counts.end());
+    }
+  }
+
+  void DeserializeCallbackStatistics(::protozero::pbf_reader& reader, eCAL::Registration::CallbackStatistics& statistics)
+  {
+    while (reader.next())
+    {
+      switch (reader.tag())
+      {
+      case +eCAL::pb::CallbackStatistics::optional_int32_queue_size:
+        statistics.queue_size = reader.get_int32();
+        break;
+      case +eCAL::pb::CallbackStatistics::optional_int32_queue_depth:
+        statistics.queue_depth = reader.get_int32();
+        break;
+      case +eCAL::pb::CallbackStatistics::optional_int64_executed_count:
+        statistics.executed_count = reader.get_int64();
+        break;
+      case +eCAL::pb::CallbackStatistics::optional_int64_drop_count:
+        statistics.drop_count = reader.get_int64();
+        break;
+      case +eCAL::pb::CallbackStatistics::optional_message_latency:
+        AssignMessage(reader, statistics.latency, DeserializeLatencyHistogram);
+        break;
+      default:
+        reader.skip();
+      }
+    }
+  }
+
+  template <typename Writer>
+  void SerializeLatencyHistogram(Writer& writer, ::protozero::pbf_tag_type tag, const eCAL::Registration::LatencyHistogram& histogram)
+  {
+    Writer latency_writer{ writer, tag };
+    latency_writer.add_packed_int64(+eCAL::pb::LatencyHistogram::repeated_int64_bucket_limits_us, histogram.bucket_limits_us.begin(), histogram.bucket_limits_us.end());
+    latency_writer.add_packed_int64(+eCAL::pb::LatencyHistogram::repeated_int64_bucket_counts, histogram.bucket_counts.begin(), histogram.bucket_counts.end());
+  }
+
+  template <typename Writer>
+  void SerializeLatencyStatistics(Writer& writer, const eCAL::Registration::LatencyStatistics& statistics)
+  {
+    writer.add_string(+eCAL::pb::LatencyStatistics::optional_string_publisher_id, std::to_string(statistics.publisher_id));
+    writer.add_enum(+eCAL::pb::LatencyStatistics::optional_enum_layer, static_cast<int>(statistics.layer));
+    SerializeLatencyHistogram(writer, +eCAL::pb::LatencyStatistics::optional_message_delivery_latency, statistics.delivery_latency);
+    SerializeLatencyHistogram(writer, +eCAL::pb::LatencyStatistics::optional_message_callback_latency, statistics.callback_latency);
+  }
+
+  void DeserializeLatencyStatistics(::protozero::pbf_reader& reader, eCAL::Registration::LatencyStatistics& statistics)
+  {
+    while (reader.next())
+    {
+      switch (reader.tag())
+      {
+      case +eCAL::pb::LatencyStatistics::optional_string_publisher_id:
+        {
+          static thread_local std::string publisher_id_string;
+          AssignString(reader, publisher_id_string);
+          statistics.publisher_id = std::stoull(publisher_id_string);
+        }
+        break;
+      case +eCAL::pb::LatencyStatistics::optional_enum_layer:
+        statistics.layer = static_cast<eCAL::eTLayerType>(reader.get_enum());
+        break;
+      case +eCAL::pb::LatencyStatistics::optional_message_delivery_latency:
+        AssignMessage(reader, statistics.delivery_latency, DeserializeLatencyHistogram);
+        break;
+      case +eCAL::pb::LatencyStatistics::optional_message_callback_latency:
+        AssignMessage(reader, statistics.callback_latency, DeserializeLatencyHistogram);
+        break;
+      default:
+        reader.skip();
+      }
+    }
+  }
+
+  template <typename Writer>
+  void SerializeSampleFilter(Writer& writer, const eCAL::Registration::SampleFilter& sample_filter)
+  {
+    writer.add_int32(+eCAL::pb::SampleFilter::optional_int32_downsampling_factor, sample_filter.downsampling_factor);
+    writer.add_int32(+eCAL::pb::SampleFilter::optional_int32_max_frequency, sample_filter.max_frequency);
+  }
+
+  void DeserializeSampleFilter(::protozero::pbf_reader& reader, eCAL::Registration::SampleFilter& sample_filter)
+  {
+    while (reader.next())
+    {
+      switch (reader.tag())
+      {
+      case +eCAL::pb::SampleFilter::optional_int32_downsampling_factor:
+        sample_filter.downsampling_factor = reader.get_int32();
+        break;
+      case +eCAL::pb::SampleFilter::optional_int32_max_frequency:
+        sample_filter.max_frequency = reader.get_int32();
+        break;
+      default:
+        reader.skip();
+      }
+    }
+  }
+
   template <typename Writer>
   void SerializeTopicSample(Writer& writer, const eCAL::Registration::Sample& sample)
   {
@@ -875,6 +1140,35 @@ namespace
       topic_writer.add_int64(+eCAL::pb::Topic::optional_int64_data_id, sample.topic.data_id);
       topic_writer.add_int64(+eCAL::pb::Topic::optional_int64_data_clock, sample.topic.data_clock);
       topic_writer.add_int32(+eCAL::pb::Topic::optional_int32_data_frequency, sample.topic.data_frequency);
+      topic_writer.add_int64(+eCAL::pb::Topic::optional_int64_fec_recovered_messages, sample.topic.fec_recovered_messages);
+      topic_writer.add_int64(+eCAL::pb::Topic::optional_int64_fec_lost_messages, sample.topic.fec_lost_messages);
+
+      for (const auto& statistics : sample.topic.acknowledge_statistics)
+      {
+        Writer statistics_writer{ topic_writer, +eCAL::pb::Topic::repeated_message_acknowledge_statistics };
+        SerializeAcknowledgeStatistics(statistics_writer, statistics);
+      }
+
+      {
+        Writer statistics_writer{ topic_writer, +eCAL::pb::Topic::optional_message_callback_statistics };
+        SerializeCallbackStatistics(statistics_writer, sample.topic.callback_statistics);
+      }
+
+      for (const auto& statistics : sample.topic.latency_statistics)
+      {
+        Writer statistics_writer{ topic_writer, +eCAL::pb::Topic::repeated_message_latency_statistics };
+        SerializeLatencyStatistics(statistics_writer, statistics);
+      }
+
+      {
+        Writer sample_filter_writer{ topic_writer, +eCAL::pb::Topic::optional_message_sample_filter };
+        SerializeSampleFilter(sample_filter_writer, sample.topic.sample_filter);
+      }
+
+      if (sample.topic.datatype_descriptor_hash != 0)
+      {
+        topic_writer.add_uint64(+eCAL::pb::Topic::optional_uint64_datatype_descriptor_hash, sample.topic.datatype_descriptor_hash);
+      }
     }
   }
 
@@ -944,6 +1238,27 @@ namespace
       case +eCAL::pb::Topic::optional_int32_data_frequency:
         sample.topic.data_frequency = reader.get_int32();
         break;
+      case +eCAL::pb::Topic::optional_int64_fec_recovered_messages:
+        sample.topic.fec_recovered_messages = reader.get_int64();
+        break;
+      case +eCAL::pb::Topic::optional_int64_fec_lost_messages:
+        sample.topic.fec_lost_messages = reader.get_int64();
+        break;
+      case +eCAL::pb::Topic::repeated_message_acknowledge_statistics:
+        AddRepeatedMessage(reader, sample.topic.acknowledge_statistics, DeserializeAcknowledgeStatistics);
+        break;
+      case +eCAL::pb::Topic::optional_message_callback_statistics:
+        AssignMessage(reader, sample.topic.callback_statistics, DeserializeCallbackStatistics);
+        break;
+      case +eCAL::pb::Topic::repeated_message_latency_statistics:
+        AddRepeatedMessage(reader, sample.topic.latency_statistics, DeserializeLatencyStatistics);
+        break;
+      case +eCAL::pb::Topic::optional_message_sample_filter:
+        AssignMessage(reader, sample.topic.sample_filter, DeserializeSampleFilter);
+        break;
+      case +eCAL::pb::Topic::optional_uint64_datatype_descriptor_hash:
+        sample.topic.datatype_descriptor_hash = reader.get_uint64();
+        break;
       default:
         reader.skip();
       }
@@ -1283,6 +1598,65 @@ namespace
     }
   }
 
+  template<typename Writer>
+  void SerializeRegistrationState(Writer& writer, const ::eCAL::Registration::Sample& sample)
+  {
+    Writer state_writer{ writer, +eCAL::pb::Sample::optional_message_registration_state };
+    state_writer.add_int32(+eCAL::pb::RegistrationState::optional_int32_protocol_version, sample.protocol_version);
+    state_writer.add_uint64(+eCAL::pb::RegistrationState::optional_uint64_generation, sample.generation);
+
+    // heartbeats and requests do not carry an entity message, so they need to transport the identifier here
+    if ((sample.cmd_type == eCAL::bct_reg_heartbeat) || (sample.cmd_type == eCAL::bct_reg_request) || (sample.cmd_type == eCAL::bct_reg_descriptor_request))
+    {
+      state_writer.add_uint64(+eCAL::pb::RegistrationState::optional_uint64_entity_id, sample.identifier.entity_id);
+      state_writer.add_int32(+eCAL::pb::RegistrationState::optional_int32_process_id, sample.identifier.process_id);
+      state_writer.add_string(+eCAL::pb::RegistrationState::optional_string_host_name, sample.identifier.host_name);
+    }
+
+    // datatype descriptors and their requests
+    if ((sample.cmd_type == eCAL::bct_reg_descriptor) || (sample.cmd_type == eCAL::bct_reg_descriptor_request))
+    {
+      state_writer.add_uint64(+eCAL::pb::RegistrationState::optional_uint64_descriptor_hash, sample.topic.datatype_descriptor_hash);
+    }
+    if (sample.cmd_type == eCAL::bct_reg_descriptor)
+    {
+      state_writer.add_bytes(+eCAL::pb::RegistrationState::optional_bytes_descriptor, sample.topic.datatype_information.descriptor);
+    }
+  }
+
+  void DeserializeRegistrationState(::protozero::pbf_reader& reader, ::eCAL::Registration::Sample& sample)
+  {
+    while (reader.next())
+    {
+      switch (reader.tag())
+      {
+      case +eCAL::pb::RegistrationState::optional_int32_protocol_version:
+        sample.protocol_version = reader.get_int32();
+        break;
+      case +eCAL::pb::RegistrationState::optional_uint64_generation:
+        sample.generation = reader.get_uint64();
+        break;
+      case +eCAL::pb::RegistrationState::optional_uint64_entity_id:
+        sample.identifier.entity_id = reader.get_uint64();
+        break;
+      case +eCAL::pb::RegistrationState::optional_int32_process_id:
+        sample.identifier.process_id = reader.get_int32();
+        break;
+      case +eCAL::pb::RegistrationState::optional_string_host_name:
+        AssignString(reader, sample.identifier.host_name);
+        break;
+      case +eCAL::pb::RegistrationState::optional_uint64_descriptor_hash:
+        sample.topic.datatype_descriptor_hash = reader.get_uint64();
+        break;
+      case +eCAL::pb::RegistrationState::optional_bytes_descriptor:
+        AssignBytes(reader, sample.topic.datatype_information.descriptor);
+        break;
+      default:
+        reader.skip();
+      }
+    }
+  }
+
   template<typename Writer>
   void SerializeRegistrationSample(Writer& writer, const ::eCAL::Registration::Sample& sample)
   {
@@ -1295,19 +1669,35 @@ namespace
     case eCAL::eCmdType::bct_reg_subscriber:
     case eCAL::eCmdType::bct_unreg_publisher:
     case eCAL::eCmdType::bct_unreg_subscriber:
-      return SerializeTopicSample(writer, sample);
+      SerializeTopicSample(writer, sample);
+      break;
     case eCAL::eCmdType::bct_reg_process:
     case eCAL::eCmdType::bct_unreg_process:
-      return SerializeProcessSample(writer, sample);
+      SerializeProcessSample(writer, sample);
+      break;
     case eCAL::eCmdType::bct_reg_service:
     case eCAL::eCmdType::bct_unreg_service:
-      return SerializeServiceSample(writer, sample);
+      SerializeServiceSample(writer, sample);
+      break;
     case eCAL::eCmdType::bct_reg_client:
     case eCAL::eCmdType::bct_unreg_client:
-      return SerializeClientSample(writer, sample);
+      SerializeClientSample(writer, sample);
+      break;
+    case eCAL::eCmdType::bct_reg_heartbeat:
+    case eCAL::eCmdType::bct_reg_request:
+    case eCAL::eCmdType::bct_reg_descriptor:
+    case eCAL::eCmdType::bct_reg_descriptor_request:
+      writer.add_enum(+eCAL::pb::Sample::optional_enum_cmd_type, static_cast<int>(sample.cmd_type));
+      break;
     default:
       return;
     }
+
+    // samples of senders without delta registration support do not have a registration state
+    if (sample.protocol_version > 0)
+    {
+      SerializeRegistrationState(writer, sample);
+    }
   }
 
   void DeserializeRegistrationSample(::protozero::pbf_reader& reader, ::eCAL::Registration::Sample& sample)
@@ -1336,6 +1726,9 @@ namespace
       case +eCAL::pb::Sample::optional_message_client:
         AssignMessage(reader, sample, DeserializeClientSample);
         break;
+      case +eCAL::pb::Sample::optional_message_registration_state:
+        AssignMessage(reader, sample, DeserializeRegistrationState);
+        break;
       default:
         reader.skip();
         break;
@@ -0,0 +1,206 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @file   ecal_serialize_sample_registration_cache.cpp
+ * @brief  eCAL registration sample serialization with cached per entity encoding
+**/
+
+#include "ecal_serialize_sample_registration_cache.h"
+#include "ecal_serialize_sample_registration.h"
+#include "ecal_serialize_common.h"
+
+#include <ecal/core/pb/ecal.pbftags.h>
+#include <ecal/core/pb/process.pbftags.h>
+#include <ecal/core/pb/service.pbftags.h>
+#include <ecal/core/pb/topic.pbftags.h>
+#include <protozero/pbf_writer.hpp>
+#include <protozero/buffer_vector.hpp>
+#include <protozero/varint.hpp>
+
+#include <array>
+#include <utility>
+
+namespace
+{
+  // protobuf accepts varints with redundant continuation bytes, so every counter
+  // value can be written with the same width (any sign extended 64 bit value)
+  constexpr size_t int_varint_size = 10;
+
+  // counters of one entity message, written behind the cached sample
+  struct SCounterRegion
+  {
+    uint32_t message_field = 0;
+    size_t   count         = 0;
+    std::array<std::pair<uint32_t, int64_t>, 10> counters;
+
+    void Add(uint32_t field_, int64_t value_)
+    {
+      counters[count++] = std::make_pair(field_, value_);
+    }
+  };
+
+  uint64_t Key(uint32_t field_, protozero::pbf_wire_type wire_type_)
+  {
+    return (static_cast<uint64_t>(field_) << 3U) | static_cast<uint64_t>(wire_type_);
+  }
+
+  // only entity registrations are cached
+  bool GetCounterRegion(const eCAL::Registration::Sample& sample_, SCounterRegion& region_)
+  {
+    switch (sample_.cmd_type)
+    {
+    case eCAL::bct_reg_publisher:
+    case eCAL::bct_reg_subscriber:
+    {
+      const auto& topic = sample_.topic;
+      region_.message_field = +eCAL::pb::Sample::optional_message_topic;
+      region_.Add(+eCAL::pb::Topic::optional_int32_registration_clock,     topic.registration_clock);
+      region_.Add(+eCAL::pb::Topic::optional_int32_topic_size,             topic.topic_size);
+      region_.Add(+eCAL::pb::Topic::optional_int32_connections_local,      topic.connections_local);
+      region_.Add(+eCAL::pb::Topic::optional_int32_connections_external,   topic.connections_external);
+      region_.Add(+eCAL::pb::Topic::optional_int32_message_drops,          topic.message_drops);
+      region_.Add(+eCAL::pb::Topic::optional_int64_data_id,                topic.data_id);
+      region_.Add(+eCAL::pb::Topic::optional_int64_data_clock,             topic.data_clock);
+      region_.Add(+eCAL::pb::Topic::optional_int32_data_frequency,         topic.data_frequency);
+      region_.Add(+eCAL::pb::Topic::optional_int64_fec_recovered_messages, topic.fec_recovered_messages);
+      region_.Add(+eCAL::pb::Topic::optional_int64_fec_lost_messages,      topic.fec_lost_messages);
+      return true;
+    }
+    case eCAL::bct_reg_process:
+      region_.message_field = +eCAL::pb::Sample::optional_message_process;
+      region_.Add(+eCAL::pb::Process::optional_int32_registration_clock, sample_.process.registration_clock);
+      return true;
+    case eCAL::bct_reg_service:
+      region_.message_field = +eCAL::pb::Sample::optional_message_service;
+      region_.Add(+eCAL::pb::Service::optional_int32_registration_clock, sample_.service.registration_clock);
+      return true;
+    case eCAL::bct_reg_client:
+      region_.message_field = +eCAL::pb::Sample::optional_message_client;
+      region_.Add(+eCAL::pb::Client::optional_int32_registration_clock, sample_.client.registration_clock);
+      return true;
+    default:
+      return false;
+    }
+  }
+
+  // copies all values of the counter region, must match GetCounterRegion
+  void AssignCounters(const eCAL::Registration::Sample& source_, eCAL::Registration::Sample& target_)
+  {
+    auto&       target_topic = target_.topic;
+    const auto& source_topic = source_.topic;
+    target_topic.registration_clock     = source_topic.registration_clock;
+    target_topic.topic_size             = source_topic.topic_size;
+    target_topic.connections_local      = source_topic.connections_local;
+    target_topic.connections_external   = source_topic.connections_external;
+    target_topic.message_drops          = source_topic.message_drops;
+    target_topic.data_id                = source_topic.data_id;
+    target_topic.data_clock             = source_topic.data_clock;
+    target_topic.data_frequency         = source_topic.data_frequency;
+    target_topic.fec_recovered_messages = source_topic.fec_recovered_messages;
+    target_topic.fec_lost_messages      = source_topic.fec_lost_messages;
+
+    target_.process.registration_clock = source_.process.registration_clock;
+    target_.service.registration_clock = source_.service.registration_clock;
+    target_.client.registration_clock  = source_.client.registration_clock;
+  }
+
+  // (re)writes the counter region starting at offset_, its size only depends on the entity type
+  void WriteCounterRegion(std::vector<char>& buffer_, size_t offset_, const SCounterRegion& region_)
+  {
+    size_t content_size = 0;
+    for (size_t i = 0; i < region_.count; ++i)
+    {
+      content_size += static_cast<size_t>(protozero::length_of_varint(Key(region_.counters[i].first, protozero::pbf_wire_type::varint))) + int_varint_size;
+    }
+    const uint64_t message_key = Key(region_.message_field, protozero::pbf_wire_type::length_delimited);
+    const size_t region_size = static_cast<size_t>(protozero::length_of_varint(message_key) + protozero::length_of_varint(content_size)) + content_size;
+    buffer_.resize(offset_ + region_size);
+
+    char* target = buffer_.data() + offset_;
+    target += protozero::write_varint(target, message_key);
+    target += protozero::write_varint(target, content_size);
+    for (size_t i = 0; i < region_.count; ++i)
+    {
+      target += protozero::write_varint(target, Key(region_.counters[i].first, protozero::pbf_wire_type::varint));
+      target = eCAL::WriteFixedVarint(target, static_cast<uint64_t>(region_.counters[i].second), int_varint_size);
+    }
+  }
+}
+
+namespace eCAL
+{
+  namespace Registration
+  {
+    const std::vector<char>& CSampleEncodingCache::Encode(const Sample& sample_)
+    {
+      SCounterRegion counter_region;
+      if (!GetCounterRegion(sample_, counter_region))
+      {
+        SerializeToBuffer(sample_, m_buffer);
+        return m_buffer;
+      }
+
+      SEntity& entity = m_entities[sample_.identifier.entity_id];
+      entity.used = true;
+
+      // everything but the counters has to match the last encoded sample
+      AssignCounters(sample_, entity.sample);
+      if (entity.buffer.empty() || !(entity.sample == sample_))
+      {
+        entity.sample = sample_;
+        SerializeToBuffer(entity.sample, entity.buffer);
+        entity.counter_offset = entity.buffer.size();
+      }
+
+      WriteCounterRegion(entity.buffer, entity.counter_offset, counter_region);
+      return entity.buffer;
+    }
+
+    void CSampleEncodingCache::EncodeSampleList(const SampleList& sample_list_, std::vector<char>& target_buffer_)
+    {
+      target_buffer_.clear();
+      {
+        ::protozero::basic_pbf_writer<std::vector<char>> writer{ target_buffer_ };
+        for (const auto& sample : sample_list_)
+        {
+          const std::vector<char>& sample_buffer = Encode(sample);
+          writer.add_bytes(+eCAL::pb::SampleList::repeated_message_samples, sample_buffer.data(), sample_buffer.size());
+        }
+      }
+      RemoveUnused();
+    }
+
+    void CSampleEncodingCache::RemoveUnused()
+    {
+      for (auto iter = m_entities.begin(); iter != m_entities.end();)
+      {
+        if (!iter->second.used)
+        {
+          iter = m_entities.erase(iter);
+        }
+        else
+        {
+          iter->second.used = false;
+          ++iter;
+        }
+      }
+    }
+  }
+}
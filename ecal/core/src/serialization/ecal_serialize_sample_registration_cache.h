@@ -0,0 +1,77 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @file   ecal_serialize_sample_registration_cache.h
+ * @brief  eCAL registration sample serialization with cached per entity encoding
+**/
+
+#pragma once
+
+#include "ecal_struct_sample_registration.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace eCAL
+{
+  namespace Registration
+  {
+    /**
+     * @brief Serialized registration samples of the entities of one process.
+     *
+     * Between two registration cycles an entity usually changes only its counters (registration clock,
+     * data clock, frequency, connection counts, ..). The serialized sample of every entity is cached,
+     * followed by a second occurrence of the entity message that contains the counters as fixed width varints.
+     * As long as nothing else changes, only this counter region is encoded again.
+     *
+     * The repeated entity message is merged by every protobuf decoder, so the result is still a valid
+     * serialized eCAL::pb::Sample.
+     *
+     * Samples that are no entity registrations (unregistrations, heartbeats, ..) are serialized as usual.
+     */
+    class CSampleEncodingCache
+    {
+    public:
+      // serialized sample, valid until the next call
+      const std::vector<char>& Encode(const Sample& sample_);
+
+      // serialized sample list (eCAL::pb::SampleList), removes all entities that are not part of the list
+      void EncodeSampleList(const SampleList& sample_list_, std::vector<char>& target_buffer_);
+
+      // removes the entities that were not encoded since the last call
+      void RemoveUnused();
+
+      size_t GetCachedEntityCount() const { return m_entities.size(); }
+
+    private:
+      struct SEntity
+      {
+        Sample            sample;               // last encoded sample
+        std::vector<char> buffer;               // serialized sample followed by the counter region
+        size_t            counter_offset = 0;   // start of the counter region
+        bool              used = false;
+      };
+
+      std::unordered_map<uint64_t, SEntity> m_entities;
+      std::vector<char>                     m_buffer;
+    };
+  }
+}
@@ -39,7 +39,13 @@ namespace eCAL
     bct_unreg_subscriber = 13,
     bct_unreg_process    = 14,
     bct_unreg_service    = 15, // TODO: should be named server!
-    bct_unreg_client     = 16
+    bct_unreg_client     = 16,
+    bct_set_sample_batch = 17,
+    bct_reg_heartbeat    = 18,
+    bct_reg_request      = 19,
+    bct_reg_descriptor   = 20,
+    bct_reg_descriptor_request = 21,
+    bct_set_sample_replay = 22
   };
 
   enum eTLayerType
@@ -79,6 +79,7 @@ namespace eCAL
       TopicInfo                           topic_info;                   // topic information
       Content                             content;                      // topic content
       std::vector<char>                   padding;                      // padding to artificially increase the size of the message. This is a workaround for TCP topics, to get the actual user-payload 8-byte-aligned. REMOVE ME IN ECAL6
+      std::vector<Content>                batch;                        // topic contents of a sample batch (bct_set_sample_batch only)
     };
   }
 }
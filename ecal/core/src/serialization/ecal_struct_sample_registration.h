@@ -192,6 +192,117 @@ namespace eCAL
       }
     };
 
+    // Latency histogram
+    struct LatencyHistogram
+    {
+      std::vector<int64_t>                bucket_limits_us;             // upper bucket limits [us], one more bucket counts all greater latencies
+      std::vector<int64_t>                bucket_counts;                // number of samples per bucket
+
+      bool operator==(const LatencyHistogram& other) const {
+        return bucket_limits_us == other.bucket_limits_us &&
+          bucket_counts == other.bucket_counts;
+      }
+
+      void clear()
+      {
+        bucket_limits_us.clear();
+        bucket_counts.clear();
+      }
+    };
+
+    // Shm acknowledge statistics of a local subscriber process
+    struct AcknowledgeStatistics
+    {
+      int32_t                             process_id = 0;               // subscriber process id
+      int64_t                             acknowledge_count = 0;        // number of samples acknowledged in time
+      int64_t                             timeout_count = 0;            // number of acknowledge timeouts
+      LatencyHistogram                    latency;                      // acknowledge latency
+
+      bool operator==(const AcknowledgeStatistics& other) const {
+        return process_id == other.process_id &&
+          acknowledge_count == other.acknowledge_count &&
+          timeout_count == other.timeout_count &&
+          latency == other.latency;
+      }
+
+      void clear()
+      {
+        process_id = 0;
+        acknowledge_count = 0;
+        timeout_count = 0;
+        latency.clear();
+      }
+    };
+
+    // Asynchronous receive callback statistics of a subscriber
+    struct CallbackStatistics
+    {
+      int32_t                             queue_size = 0;               // maximum number of queued samples (0 == synchronous callbacks)
+      int32_t                             queue_depth = 0;              // currently queued samples
+      int64_t                             executed_count = 0;           // number of executed samples
+      int64_t                             drop_count = 0;               // number of samples dropped by the queue policy
+      LatencyHistogram                    latency;                      // latency from reception to callback return
+
+      bool operator==(const CallbackStatistics& other) const {
+        return queue_size == other.queue_size &&
+          queue_depth == other.queue_depth &&
+          executed_count == other.executed_count &&
+          drop_count == other.drop_count &&
+          latency == other.latency;
+      }
+
+      void clear()
+      {
+        queue_size = 0;
+        queue_depth = 0;
+        executed_count = 0;
+        drop_count = 0;
+        latency.clear();
+      }
+    };
+
+    // Receive latency statistics of a subscriber for one publisher and transport layer
+    struct LatencyStatistics
+    {
+      uint64_t                            publisher_id = 0;             // publisher entity id
+      eTLayerType                         layer = tl_none;              // receiving transport layer
+      LatencyHistogram                    delivery_latency;             // latency from the send time stamp to the reception
+      LatencyHistogram                    callback_latency;             // execution time of the receive callback
+
+      bool operator==(const LatencyStatistics& other) const {
+        return publisher_id == other.publisher_id &&
+          layer == other.layer &&
+          delivery_latency == other.delivery_latency &&
+          callback_latency == other.callback_latency;
+      }
+
+      void clear()
+      {
+        publisher_id = 0;
+        layer = tl_none;
+        delivery_latency.clear();
+        callback_latency.clear();
+      }
+    };
+
+    // Sample filter of a subscriber, applied by the publisher
+    struct SampleFilter
+    {
+      int32_t                             downsampling_factor = 0;      // pass only every Nth sample (0, 1 == every sample)
+      int32_t                             max_frequency = 0;            // maximum sample frequency [mHz] (0 == unlimited)
+
+      bool operator==(const SampleFilter& other) const {
+        return downsampling_factor == other.downsampling_factor &&
+          max_frequency == other.max_frequency;
+      }
+
+      void clear()
+      {
+        downsampling_factor = 0;
+        max_frequency = 0;
+      }
+    };
+
     // Process information
     struct Process
     {
@@ -262,6 +373,14 @@ namespace eCAL
       int64_t                             data_clock = 0;               // data clock (send / receive action)
       int32_t                             data_frequency  = 0;                   // data frequency (send / receive registrations per second) [mHz]
 
+      int64_t                             fec_recovered_messages = 0;   // udp messages restored from forward error correction parity (subscriber only)
+      int64_t                             fec_lost_messages      = 0;   // udp messages that could not be restored from forward error correction parity (subscriber only)
+
+      Util::CExpandingVector<AcknowledgeStatistics> acknowledge_statistics; // shm acknowledge statistics per subscriber process (publisher only)
+      CallbackStatistics                  callback_statistics;          // asynchronous receive callback statistics (subscriber only)
+      Util::CExpandingVector<LatencyStatistics> latency_statistics;     // receive latency per publisher and transport layer (subscriber only, latency tracing enabled)
+      SampleFilter                        sample_filter;                // sample filter applied by the publishers (subscriber only)
+      uint64_t                            datatype_descriptor_hash = 0; // content hash of the datatype descriptor, the descriptor itself is sent with bct_reg_descriptor (0 == descriptor in datatype_information)
 
       bool operator==(const Topic& other) const {
         return registration_clock == other.registration_clock &&
@@ -278,7 +397,14 @@ namespace eCAL
           message_drops == other.message_drops &&
           data_id == other.data_id &&
           data_clock == other.data_clock &&
-          data_frequency == other.data_frequency;
+          data_frequency == other.data_frequency &&
+          fec_recovered_messages == other.fec_recovered_messages &&
+          fec_lost_messages == other.fec_lost_messages &&
+          acknowledge_statistics == other.acknowledge_statistics &&
+          callback_statistics == other.callback_statistics &&
+          latency_statistics == other.latency_statistics &&
+          sample_filter == other.sample_filter &&
+          datatype_descriptor_hash == other.datatype_descriptor_hash;
       }
 
       void clear()
@@ -301,6 +427,15 @@ namespace eCAL
         data_id = 0;
         data_clock = 0;
         data_frequency = 0;
+
+        fec_recovered_messages = 0;
+        fec_lost_messages = 0;
+
+        acknowledge_statistics.clear();
+        callback_statistics.clear();
+        latency_statistics.clear();
+        sample_filter.clear();
+        datatype_descriptor_hash = 0;
       }
     };
 
@@ -337,6 +472,8 @@ namespace eCAL
       Service::Service                    service;                      // service information
       Service::Client                     client ;                      // client information
       Topic                               topic;                        // topic information
+      int32_t                             protocol_version = 0;         // registration protocol version of the sender (0 == full state every refresh cycle)
+      uint64_t                            generation = 0;               // state generation of the entity, increased with every changed full state (protocol version >= 1)
 
       bool operator==(const Sample& other) const {
         return identifier == other.identifier &&
@@ -344,7 +481,9 @@ namespace eCAL
           process == other.process &&
           service == other.service &&
           client == other.client &&
-          topic == other.topic;
+          topic == other.topic &&
+          protocol_version == other.protocol_version &&
+          generation == other.generation;
       }
 
       void clear()
@@ -355,6 +494,8 @@ namespace eCAL
         service.clear();
         client.clear();
         topic.clear();
+        protocol_version = 0;
+        generation = 0;
       }
     };
 
@@ -9,6 +9,9 @@
 PB_BIND(eCAL_pb_Content, eCAL_pb_Content, AUTO)
 
 
+PB_BIND(eCAL_pb_RegistrationState, eCAL_pb_RegistrationState, AUTO)
+
+
 PB_BIND(eCAL_pb_Sample, eCAL_pb_Sample, 2)
 
 
@@ -27,7 +27,13 @@ typedef enum _eCAL_pb_eCmdType { /* Reserved fields in enums are not supported i
     eCAL_pb_eCmdType_bct_unreg_subscriber = 13, /* unregister subscriber */
     eCAL_pb_eCmdType_bct_unreg_process = 14, /* unregister process */
     eCAL_pb_eCmdType_bct_unreg_service = 15, /* unregister service */
-    eCAL_pb_eCmdType_bct_unreg_client = 16 /* unregister client */
+    eCAL_pb_eCmdType_bct_unreg_client = 16, /* unregister client */
+    eCAL_pb_eCmdType_bct_set_sample_batch = 17, /* set multiple sample contents of one topic (batch) */
+    eCAL_pb_eCmdType_bct_reg_heartbeat = 18, /* registration heartbeat of an unchanged entity (entity id + generation) */
+    eCAL_pb_eCmdType_bct_reg_request = 19, /* request the full registration state of a process */
+    eCAL_pb_eCmdType_bct_reg_descriptor = 20, /* datatype descriptor keyed by its content hash */
+    eCAL_pb_eCmdType_bct_reg_descriptor_request = 21, /* request a datatype descriptor by its content hash from a process */
+    eCAL_pb_eCmdType_bct_set_sample_replay = 22 /* set sample content replayed from the publisher history (accepted out of order) */
 } eCAL_pb_eCmdType;
 
 /* Struct definitions */
@@ -41,6 +47,16 @@ typedef struct _eCAL_pb_Content { /* Reserved fields in enums are not supported
     int64_t hash; /* unique hash for that sample */
 } eCAL_pb_Content;
 
+typedef struct _eCAL_pb_RegistrationState { /* delta registration protocol state */
+    int32_t protocol_version; /* registration protocol version of the sender (0 == full state every refresh cycle) */
+    uint64_t generation; /* state generation of the entity, increased with every changed full state */
+    uint64_t entity_id; /* entity id (bct_reg_heartbeat / bct_reg_request / bct_reg_descriptor_request only) */
+    int32_t process_id; /* process id (bct_reg_heartbeat / bct_reg_request / bct_reg_descriptor_request only) */
+    pb_callback_t host_name; /* host name (bct_reg_heartbeat / bct_reg_request / bct_reg_descriptor_request only) */
+    uint64_t descriptor_hash; /* datatype descriptor content hash (bct_reg_descriptor / bct_reg_descriptor_request only) */
+    pb_callback_t descriptor; /* datatype descriptor (bct_reg_descriptor only) */
+} eCAL_pb_RegistrationState;
+
 typedef struct _eCAL_pb_Sample {
     eCAL_pb_eCmdType cmd_type; /* sample command type */
     bool has_host;
@@ -56,6 +72,9 @@ typedef struct _eCAL_pb_Sample {
     bool has_client;
     eCAL_pb_Client client; /* client information */
     pb_callback_t padding; /* padding to artificially increase the size of the message. This is a workaround for TCP topics, to get the actual user-payload 8-byte-aligned. REMOVE ME IN ECAL6 */
+    pb_callback_t batch; /* topic contents of a sample batch (bct_set_sample_batch only) */
+    bool has_registration_state;
+    eCAL_pb_RegistrationState registration_state; /* delta registration protocol state (registration samples only) */
 } eCAL_pb_Sample;
 
 typedef struct _eCAL_pb_SampleList {
@@ -69,8 +88,8 @@ extern "C" {
 
 /* Helper constants for enums */
 #define _eCAL_pb_eCmdType_MIN eCAL_pb_eCmdType_bct_none
-#define _eCAL_pb_eCmdType_MAX eCAL_pb_eCmdType_bct_unreg_client
-#define _eCAL_pb_eCmdType_ARRAYSIZE ((eCAL_pb_eCmdType)(eCAL_pb_eCmdType_bct_unreg_client+1))
+#define _eCAL_pb_eCmdType_MAX eCAL_pb_eCmdType_bct_set_sample_replay
+#define _eCAL_pb_eCmdType_ARRAYSIZE ((eCAL_pb_eCmdType)(eCAL_pb_eCmdType_bct_set_sample_replay+1))
 
 
 #define eCAL_pb_Sample_cmd_type_ENUMTYPE eCAL_pb_eCmdType
@@ -79,10 +98,12 @@ extern "C" {
 
 /* Initializer values for message structs */
 #define eCAL_pb_Content_init_default             {0, 0, 0, {{NULL}, NULL}, 0, 0}
-#define eCAL_pb_Sample_init_default              {_eCAL_pb_eCmdType_MIN, false, eCAL_pb_Host_init_default, false, eCAL_pb_Process_init_default, false, eCAL_pb_Service_init_default, false, eCAL_pb_Topic_init_default, false, eCAL_pb_Content_init_default, false, eCAL_pb_Client_init_default, {{NULL}, NULL}}
+#define eCAL_pb_RegistrationState_init_default   {0, 0, 0, 0, {{NULL}, NULL}, 0, {{NULL}, NULL}}
+#define eCAL_pb_Sample_init_default              {_eCAL_pb_eCmdType_MIN, false, eCAL_pb_Host_init_default, false, eCAL_pb_Process_init_default, false, eCAL_pb_Service_init_default, false, eCAL_pb_Topic_init_default, false, eCAL_pb_Content_init_default, false, eCAL_pb_Client_init_default, {{NULL}, NULL}, {{NULL}, NULL}, false, eCAL_pb_RegistrationState_init_default}
 #define eCAL_pb_SampleList_init_default          {{{NULL}, NULL}}
 #define eCAL_pb_Content_init_zero                {0, 0, 0, {{NULL}, NULL}, 0, 0}
-#define eCAL_pb_Sample_init_zero                 {_eCAL_pb_eCmdType_MIN, false, eCAL_pb_Host_init_zero, false, eCAL_pb_Process_init_zero, false, eCAL_pb_Service_init_zero, false, eCAL_pb_Topic_init_zero, false, eCAL_pb_Content_init_zero, false, eCAL_pb_Client_init_zero, {{NULL}, NULL}}
+#define eCAL_pb_RegistrationState_init_zero      {0, 0, 0, 0, {{NULL}, NULL}, 0, {{NULL}, NULL}}
+#define eCAL_pb_Sample_init_zero                 {_eCAL_pb_eCmdType_MIN, false, eCAL_pb_Host_init_zero, false, eCAL_pb_Process_init_zero, false, eCAL_pb_Service_init_zero, false, eCAL_pb_Topic_init_zero, false, eCAL_pb_Content_init_zero, false, eCAL_pb_Client_init_zero, {{NULL}, NULL}, {{NULL}, NULL}, false, eCAL_pb_RegistrationState_init_zero}
 #define eCAL_pb_SampleList_init_zero             {{{NULL}, NULL}}
 
 /* Field tags (for use in manual encoding/decoding) */
@@ -92,6 +113,13 @@ extern "C" {
 #define eCAL_pb_Content_payload_tag              4
 #define eCAL_pb_Content_size_tag                 6
 #define eCAL_pb_Content_hash_tag                 7
+#define eCAL_pb_RegistrationState_protocol_version_tag 1
+#define eCAL_pb_RegistrationState_generation_tag 2
+#define eCAL_pb_RegistrationState_entity_id_tag  3
+#define eCAL_pb_RegistrationState_process_id_tag 4
+#define eCAL_pb_RegistrationState_host_name_tag  5
+#define eCAL_pb_RegistrationState_descriptor_hash_tag 6
+#define eCAL_pb_RegistrationState_descriptor_tag 7
 #define eCAL_pb_Sample_cmd_type_tag              1
 #define eCAL_pb_Sample_host_tag                  2
 #define eCAL_pb_Sample_process_tag               3
@@ -100,6 +128,8 @@ extern "C" {
 #define eCAL_pb_Sample_content_tag               6
 #define eCAL_pb_Sample_client_tag                7
 #define eCAL_pb_Sample_padding_tag               8
+#define eCAL_pb_Sample_batch_tag                 9
+#define eCAL_pb_Sample_registration_state_tag    10
 #define eCAL_pb_SampleList_samples_tag           1
 
 /* Struct field encoding specification for nanopb */
@@ -113,6 +143,17 @@ X(a, STATIC,   SINGULAR, INT64,    hash,              7)
 #define eCAL_pb_Content_CALLBACK pb_default_field_callback
 #define eCAL_pb_Content_DEFAULT NULL
 
+#define eCAL_pb_RegistrationState_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, INT32,    protocol_version,  1) \
+X(a, STATIC,   SINGULAR, UINT64,   generation,        2) \
+X(a, STATIC,   SINGULAR, UINT64,   entity_id,         3) \
+X(a, STATIC,   SINGULAR, INT32,    process_id,        4) \
+X(a, CALLBACK, SINGULAR, STRING,   host_name,         5) \
+X(a, STATIC,   SINGULAR, UINT64,   descriptor_hash,   6) \
+X(a, CALLBACK, SINGULAR, BYTES,    descriptor,        7)
+#define eCAL_pb_RegistrationState_CALLBACK pb_default_field_callback
+#define eCAL_pb_RegistrationState_DEFAULT NULL
+
 #define eCAL_pb_Sample_FIELDLIST(X, a) \
 X(a, STATIC,   SINGULAR, UENUM,    cmd_type,          1) \
 X(a, STATIC,   OPTIONAL, MESSAGE,  host,              2) \
@@ -121,7 +162,9 @@ X(a, STATIC,   OPTIONAL, MESSAGE,  service,           4) \
 X(a, STATIC,   OPTIONAL, MESSAGE,  topic,             5) \
 X(a, STATIC,   OPTIONAL, MESSAGE,  content,           6) \
 X(a, STATIC,   OPTIONAL, MESSAGE,  client,            7) \
-X(a, CALLBACK, SINGULAR, BYTES,    padding,           8)
+X(a, CALLBACK, SINGULAR, BYTES,    padding,           8) \
+X(a, CALLBACK, REPEATED, MESSAGE,  batch,             9) \
+X(a, STATIC,   OPTIONAL, MESSAGE,  registration_state, 10)
 #define eCAL_pb_Sample_CALLBACK pb_default_field_callback
 #define eCAL_pb_Sample_DEFAULT NULL
 #define eCAL_pb_Sample_host_MSGTYPE eCAL_pb_Host
@@ -130,6 +173,8 @@ X(a, CALLBACK, SINGULAR, BYTES,    padding,           8)
 #define eCAL_pb_Sample_topic_MSGTYPE eCAL_pb_Topic
 #define eCAL_pb_Sample_content_MSGTYPE eCAL_pb_Content
 #define eCAL_pb_Sample_client_MSGTYPE eCAL_pb_Client
+#define eCAL_pb_Sample_batch_MSGTYPE eCAL_pb_Content
+#define eCAL_pb_Sample_registration_state_MSGTYPE eCAL_pb_RegistrationState
 
 #define eCAL_pb_SampleList_FIELDLIST(X, a) \
 X(a, CALLBACK, REPEATED, MESSAGE,  samples,           1)
@@ -138,16 +183,19 @@ X(a, CALLBACK, REPEATED, MESSAGE,  samples,           1)
 #define eCAL_pb_SampleList_samples_MSGTYPE eCAL_pb_Sample
 
 extern const pb_msgdesc_t eCAL_pb_Content_msg;
+extern const pb_msgdesc_t eCAL_pb_RegistrationState_msg;
 extern const pb_msgdesc_t eCAL_pb_Sample_msg;
 extern const pb_msgdesc_t eCAL_pb_SampleList_msg;
 
 /* Defines for backwards compatibility with code written before nanopb-0.4.0 */
 #define eCAL_pb_Content_fields &eCAL_pb_Content_msg
+#define eCAL_pb_RegistrationState_fields &eCAL_pb_RegistrationState_msg
 #define eCAL_pb_Sample_fields &eCAL_pb_Sample_msg
 #define eCAL_pb_SampleList_fields &eCAL_pb_SampleList_msg
 
 /* Maximum encoded size of messages (where known) */
 /* eCAL_pb_Content_size depends on runtime parameters */
+/* eCAL_pb_RegistrationState_size depends on runtime parameters */
 /* eCAL_pb_Sample_size depends on runtime parameters */
 /* eCAL_pb_SampleList_size depends on runtime parameters */
 
@@ -6,7 +6,22 @@
 #error Regenerate this file with the current version of nanopb generator.
 #endif
 
-PB_BIND(eCAL_pb_Topic, eCAL_pb_Topic, AUTO)
+PB_BIND(eCAL_pb_LatencyHistogram, eCAL_pb_LatencyHistogram, AUTO)
+
+
+PB_BIND(eCAL_pb_AcknowledgeStatistics, eCAL_pb_AcknowledgeStatistics, AUTO)
+
+
+PB_BIND(eCAL_pb_CallbackStatistics, eCAL_pb_CallbackStatistics, AUTO)
+
+
+PB_BIND(eCAL_pb_LatencyStatistics, eCAL_pb_LatencyStatistics, AUTO)
+
+
+PB_BIND(eCAL_pb_SampleFilter, eCAL_pb_SampleFilter, AUTO)
+
+
+PB_BIND(eCAL_pb_Topic, eCAL_pb_Topic, 2)
 
 
 
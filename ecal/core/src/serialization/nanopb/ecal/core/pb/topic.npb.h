@@ -12,6 +12,42 @@
 #endif
 
 /* Struct definitions */
+typedef struct _eCAL_pb_LatencyHistogram { /* latency histogram */
+    pb_callback_t bucket_limits_us; /* upper bucket limits [us], one more bucket counts all greater latencies */
+    pb_callback_t bucket_counts; /* number of samples per bucket */
+} eCAL_pb_LatencyHistogram;
+
+typedef struct _eCAL_pb_AcknowledgeStatistics { /* shm acknowledge statistics of a local subscriber process */
+    int32_t process_id; /* subscriber process id */
+    int64_t acknowledge_count; /* number of samples acknowledged in time */
+    int64_t timeout_count; /* number of acknowledge timeouts */
+    bool has_latency;
+    eCAL_pb_LatencyHistogram latency; /* acknowledge latency */
+} eCAL_pb_AcknowledgeStatistics;
+
+typedef struct _eCAL_pb_CallbackStatistics { /* asynchronous receive callback statistics of a subscriber */
+    int32_t queue_size; /* maximum number of queued samples (0 == synchronous callbacks) */
+    int32_t queue_depth; /* currently queued samples */
+    int64_t executed_count; /* number of executed samples */
+    int64_t drop_count; /* number of samples dropped by the queue policy */
+    bool has_latency;
+    eCAL_pb_LatencyHistogram latency; /* latency from reception to callback return */
+} eCAL_pb_CallbackStatistics;
+
+typedef struct _eCAL_pb_LatencyStatistics { /* receive latency statistics of a subscriber for one publisher and transport layer */
+    pb_callback_t publisher_id; /* publisher entity id */
+    eCAL_pb_eTransportLayerType layer; /* receiving transport layer */
+    bool has_delivery_latency;
+    eCAL_pb_LatencyHistogram delivery_latency; /* latency from the send time stamp to the reception */
+    bool has_callback_latency;
+    eCAL_pb_LatencyHistogram callback_latency; /* execution time of the receive callback */
+} eCAL_pb_LatencyStatistics;
+
+typedef struct _eCAL_pb_SampleFilter { /* sample filter of a subscriber, applied by the publisher */
+    int32_t downsampling_factor; /* pass only every Nth sample (0, 1 == every sample) */
+    int32_t max_frequency; /* maximum sample frequency [mHz] (0 == unlimited) */
+} eCAL_pb_SampleFilter;
+
 typedef struct _eCAL_pb_Topic { /* Reserved fields in enums are not supported in protobuf 3.0
  reserved 9, 10, 11, 14, 15, 22 to 26, 29; */
     int32_t registration_clock; /* registration clock (heart beat) */
@@ -35,6 +71,15 @@ typedef struct _eCAL_pb_Topic { /* Reserved fields in enums are not supported in
  10 = topic description (protocol descriptor) (deprecated) */
     bool has_datatype_information;
     eCAL_pb_DataTypeInformation datatype_information; /* topic datatype information (encoding & type & description) */
+    pb_callback_t acknowledge_statistics; /* shm acknowledge statistics per subscriber process (publisher only) */
+    bool has_callback_statistics;
+    eCAL_pb_CallbackStatistics callback_statistics; /* asynchronous receive callback statistics (subscriber only) */
+    pb_callback_t latency_statistics; /* receive latency per publisher and transport layer (subscriber only, latency tracing enabled) */
+    int64_t fec_recovered_messages; /* udp messages restored from forward error correction parity (subscriber only) */
+    int64_t fec_lost_messages; /* udp messages that could not be restored from forward error correction parity (subscriber only) */
+    bool has_sample_filter;
+    eCAL_pb_SampleFilter sample_filter; /* sample filter applied by the publishers (subscriber only) */
+    uint64_t datatype_descriptor_hash; /* content hash of the datatype descriptor, the descriptor itself is sent with bct_reg_descriptor (0 == descriptor in datatype_information) */
 } eCAL_pb_Topic;
 
 
@@ -42,11 +87,46 @@ typedef struct _eCAL_pb_Topic { /* Reserved fields in enums are not supported in
 extern "C" {
 #endif
 
+
+
+
+
+#define eCAL_pb_LatencyStatistics_layer_ENUMTYPE eCAL_pb_eTransportLayerType
+
+
+
 /* Initializer values for message structs */
-#define eCAL_pb_Topic_init_default               {0, {{NULL}, NULL}, 0, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, 0, 0, 0, 0, 0, 0, 0, {{NULL}, NULL}, false, eCAL_pb_DataTypeInformation_init_default}
-#define eCAL_pb_Topic_init_zero                  {0, {{NULL}, NULL}, 0, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, 0, 0, 0, 0, 0, 0, 0, {{NULL}, NULL}, false, eCAL_pb_DataTypeInformation_init_zero}
+#define eCAL_pb_LatencyHistogram_init_default    {{{NULL}, NULL}, {{NULL}, NULL}}
+#define eCAL_pb_AcknowledgeStatistics_init_default {0, 0, 0, false, eCAL_pb_LatencyHistogram_init_default}
+#define eCAL_pb_CallbackStatistics_init_default {0, 0, 0, 0, false, eCAL_pb_LatencyHistogram_init_default}
+#define eCAL_pb_LatencyStatistics_init_default {{{NULL}, NULL}, _eCAL_pb_eTransportLayerType_MIN, false, eCAL_pb_LatencyHistogram_init_default, false, eCAL_pb_LatencyHistogram_init_default}
+#define eCAL_pb_SampleFilter_init_default    {0, 0}
+#define eCAL_pb_Topic_init_default               {0, {{NULL}, NULL}, 0, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, 0, 0, 0, 0, 0, 0, 0, {{NULL}, NULL}, false, eCAL_pb_DataTypeInformation_init_default, {{NULL}, NULL}, false, eCAL_pb_CallbackStatistics_init_default, {{NULL}, NULL}, 0, 0, false, eCAL_pb_SampleFilter_init_default, 0}
+#define eCAL_pb_LatencyHistogram_init_zero       {{{NULL}, NULL}, {{NULL}, NULL}}
+#define eCAL_pb_AcknowledgeStatistics_init_zero  {0, 0, 0, false, eCAL_pb_LatencyHistogram_init_zero}
+#define eCAL_pb_CallbackStatistics_init_zero {0, 0, 0, 0, false, eCAL_pb_LatencyHistogram_init_zero}
+#define eCAL_pb_LatencyStatistics_init_zero {{{NULL}, NULL}, _eCAL_pb_eTransportLayerType_MIN, false, eCAL_pb_LatencyHistogram_init_zero, false, eCAL_pb_LatencyHistogram_init_zero}
+#define eCAL_pb_SampleFilter_init_zero       {0, 0}
+#define eCAL_pb_Topic_init_zero                  {0, {{NULL}, NULL}, 0, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, 0, 0, 0, 0, 0, 0, 0, {{NULL}, NULL}, false, eCAL_pb_DataTypeInformation_init_zero, {{NULL}, NULL}, false, eCAL_pb_CallbackStatistics_init_zero, {{NULL}, NULL}, 0, 0, false, eCAL_pb_SampleFilter_init_zero, 0}
 
 /* Field tags (for use in manual encoding/decoding) */
+#define eCAL_pb_LatencyHistogram_bucket_limits_us_tag 1
+#define eCAL_pb_LatencyHistogram_bucket_counts_tag 2
+#define eCAL_pb_AcknowledgeStatistics_process_id_tag 1
+#define eCAL_pb_AcknowledgeStatistics_acknowledge_count_tag 2
+#define eCAL_pb_AcknowledgeStatistics_timeout_count_tag 3
+#define eCAL_pb_AcknowledgeStatistics_latency_tag 4
+#define eCAL_pb_CallbackStatistics_queue_size_tag 1
+#define eCAL_pb_CallbackStatistics_queue_depth_tag 2
+#define eCAL_pb_CallbackStatistics_executed_count_tag 3
+#define eCAL_pb_CallbackStatistics_drop_count_tag 4
+#define eCAL_pb_CallbackStatistics_latency_tag   5
+#define eCAL_pb_LatencyStatistics_publisher_id_tag 1
+#define eCAL_pb_LatencyStatistics_layer_tag      2
+#define eCAL_pb_LatencyStatistics_delivery_latency_tag 3
+#define eCAL_pb_LatencyStatistics_callback_latency_tag 4
+#define eCAL_pb_SampleFilter_downsampling_factor_tag 1
+#define eCAL_pb_SampleFilter_max_frequency_tag   2
 #define eCAL_pb_Topic_registration_clock_tag     1
 #define eCAL_pb_Topic_host_name_tag              2
 #define eCAL_pb_Topic_process_id_tag             3
@@ -65,8 +145,56 @@ extern "C" {
 #define eCAL_pb_Topic_data_frequency_tag         21
 #define eCAL_pb_Topic_shm_transport_domain_tag   28
 #define eCAL_pb_Topic_datatype_information_tag   30
+#define eCAL_pb_Topic_acknowledge_statistics_tag 31
+#define eCAL_pb_Topic_callback_statistics_tag    32
+#define eCAL_pb_Topic_latency_statistics_tag     33
+#define eCAL_pb_Topic_fec_recovered_messages_tag 34
+#define eCAL_pb_Topic_fec_lost_messages_tag      35
+#define eCAL_pb_Topic_sample_filter_tag          36
+#define eCAL_pb_Topic_datatype_descriptor_hash_tag 37
 
 /* Struct field encoding specification for nanopb */
+#define eCAL_pb_LatencyHistogram_FIELDLIST(X, a) \
+X(a, CALLBACK, REPEATED, INT64,    bucket_limits_us,   1) \
+X(a, CALLBACK, REPEATED, INT64,    bucket_counts,     2)
+#define eCAL_pb_LatencyHistogram_CALLBACK pb_default_field_callback
+#define eCAL_pb_LatencyHistogram_DEFAULT NULL
+
+#define eCAL_pb_AcknowledgeStatistics_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, INT32,    process_id,        1) \
+X(a, STATIC,   SINGULAR, INT64,    acknowledge_count,   2) \
+X(a, STATIC,   SINGULAR, INT64,    timeout_count,     3) \
+X(a, STATIC,   OPTIONAL, MESSAGE,  latency,           4)
+#define eCAL_pb_AcknowledgeStatistics_CALLBACK NULL
+#define eCAL_pb_AcknowledgeStatistics_DEFAULT NULL
+#define eCAL_pb_AcknowledgeStatistics_latency_MSGTYPE eCAL_pb_LatencyHistogram
+
+#define eCAL_pb_CallbackStatistics_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, INT32,    queue_size,        1) \
+X(a, STATIC,   SINGULAR, INT32,    queue_depth,       2) \
+X(a, STATIC,   SINGULAR, INT64,    executed_count,    3) \
+X(a, STATIC,   SINGULAR, INT64,    drop_count,        4) \
+X(a, STATIC,   OPTIONAL, MESSAGE,  latency,           5)
+#define eCAL_pb_CallbackStatistics_CALLBACK NULL
+#define eCAL_pb_CallbackStatistics_DEFAULT NULL
+#define eCAL_pb_CallbackStatistics_latency_MSGTYPE eCAL_pb_LatencyHistogram
+
+#define eCAL_pb_LatencyStatistics_FIELDLIST(X, a) \
+X(a, CALLBACK, SINGULAR, STRING,   publisher_id,      1) \
+X(a, STATIC,   SINGULAR, UENUM,    layer,             2) \
+X(a, STATIC,   OPTIONAL, MESSAGE,  delivery_latency,   3) \
+X(a, STATIC,   OPTIONAL, MESSAGE,  callback_latency,   4)
+#define eCAL_pb_LatencyStatistics_CALLBACK pb_default_field_callback
+#define eCAL_pb_LatencyStatistics_DEFAULT NULL
+#define eCAL_pb_LatencyStatistics_delivery_latency_MSGTYPE eCAL_pb_LatencyHistogram
+#define eCAL_pb_LatencyStatistics_callback_latency_MSGTYPE eCAL_pb_LatencyHistogram
+
+#define eCAL_pb_SampleFilter_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, INT32,    downsampling_factor,   1) \
+X(a, STATIC,   SINGULAR, INT32,    max_frequency,     2)
+#define eCAL_pb_SampleFilter_CALLBACK NULL
+#define eCAL_pb_SampleFilter_DEFAULT NULL
+
 #define eCAL_pb_Topic_FIELDLIST(X, a) \
 X(a, STATIC,   SINGULAR, INT32,    registration_clock,   1) \
 X(a, CALLBACK, SINGULAR, STRING,   host_name,         2) \
@@ -85,19 +213,46 @@ X(a, STATIC,   SINGULAR, INT64,    data_id,          19) \
 X(a, STATIC,   SINGULAR, INT64,    data_clock,       20) \
 X(a, STATIC,   SINGULAR, INT32,    data_frequency,   21) \
 X(a, CALLBACK, SINGULAR, STRING,   shm_transport_domain,  28) \
-X(a, STATIC,   OPTIONAL, MESSAGE,  datatype_information,  30)
+X(a, STATIC,   OPTIONAL, MESSAGE,  datatype_information,  30) \
+X(a, CALLBACK, REPEATED, MESSAGE,  acknowledge_statistics,  31) \
+X(a, STATIC,   OPTIONAL, MESSAGE,  callback_statistics,  32) \
+X(a, CALLBACK, REPEATED, MESSAGE,  latency_statistics,  33) \
+X(a, STATIC,   SINGULAR, INT64,    fec_recovered_messages,  34) \
+X(a, STATIC,   SINGULAR, INT64,    fec_lost_messages,  35) \
+X(a, STATIC,   OPTIONAL, MESSAGE,  sample_filter,    36) \
+X(a, STATIC,   SINGULAR, UINT64,   datatype_descriptor_hash,  37)
 #define eCAL_pb_Topic_CALLBACK pb_default_field_callback
 #define eCAL_pb_Topic_DEFAULT NULL
 #define eCAL_pb_Topic_transport_layer_MSGTYPE eCAL_pb_TransportLayer
 #define eCAL_pb_Topic_datatype_information_MSGTYPE eCAL_pb_DataTypeInformation
+#define eCAL_pb_Topic_acknowledge_statistics_MSGTYPE eCAL_pb_AcknowledgeStatistics
+#define eCAL_pb_Topic_callback_statistics_MSGTYPE eCAL_pb_CallbackStatistics
+#define eCAL_pb_Topic_latency_statistics_MSGTYPE eCAL_pb_LatencyStatistics
+#define eCAL_pb_Topic_sample_filter_MSGTYPE eCAL_pb_SampleFilter
 
+extern const pb_msgdesc_t eCAL_pb_LatencyHistogram_msg;
+extern const pb_msgdesc_t eCAL_pb_AcknowledgeStatistics_msg;
+extern const pb_msgdesc_t eCAL_pb_CallbackStatistics_msg;
+extern const pb_msgdesc_t eCAL_pb_LatencyStatistics_msg;
+extern const pb_msgdesc_t eCAL_pb_SampleFilter_msg;
 extern const pb_msgdesc_t eCAL_pb_Topic_msg;
 
 /* Defines for backwards compatibility with code written before nanopb-0.4.0 */
+#define eCAL_pb_LatencyHistogram_fields &eCAL_pb_LatencyHistogram_msg
+#define eCAL_pb_AcknowledgeStatistics_fields &eCAL_pb_AcknowledgeStatistics_msg
+#define eCAL_pb_CallbackStatistics_fields &eCAL_pb_CallbackStatistics_msg
+#define eCAL_pb_LatencyStatistics_fields &eCAL_pb_LatencyStatistics_msg
+#define eCAL_pb_SampleFilter_fields &eCAL_pb_SampleFilter_msg
 #define eCAL_pb_Topic_fields &eCAL_pb_Topic_msg
 
 /* Maximum encoded size of messages (where known) */
+/* eCAL_pb_LatencyHistogram_size depends on runtime parameters */
+/* eCAL_pb_AcknowledgeStatistics_size depends on runtime parameters */
+/* eCAL_pb_CallbackStatistics_size depends on runtime parameters */
+/* eCAL_pb_LatencyStatistics_size depends on runtime parameters */
 /* eCAL_pb_Topic_size depends on runtime parameters */
+#define ECAL_PB_TOPIC_NPB_H_MAX_SIZE             eCAL_pb_SampleFilter_size
+#define eCAL_pb_SampleFilter_size                22
 
 #ifdef __cplusplus
 } /* extern "C" */
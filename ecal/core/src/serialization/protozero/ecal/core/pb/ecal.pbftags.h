@@ -20,6 +20,20 @@ inline constexpr uint32_t operator+(Content e) {
     return static_cast<uint32_t>(e);
 }
 
+enum class RegistrationState : ::protozero::pbf_tag_type {
+    optional_int32_protocol_version = 1,
+    optional_uint64_generation = 2,
+    optional_uint64_entity_id = 3,
+    optional_int32_process_id = 4,
+    optional_string_host_name = 5,
+    optional_uint64_descriptor_hash = 6,
+    optional_bytes_descriptor = 7
+};
+
+inline constexpr uint32_t operator+(RegistrationState e) {
+    return static_cast<uint32_t>(e);
+}
+
 enum class Sample : ::protozero::pbf_tag_type {
     optional_enum_cmd_type = 1,
     optional_message_host = 2,
@@ -28,7 +42,9 @@ enum class Sample : ::protozero::pbf_tag_type {
     optional_message_client = 7,
     optional_message_topic = 5,
     optional_message_content = 6,
-    optional_bytes_padding = 8
+    optional_bytes_padding = 8,
+    repeated_message_batch = 9,
+    optional_message_registration_state = 10
 };
 
 inline constexpr uint32_t operator+(Sample e) {
@@ -55,7 +71,13 @@ enum class eCmdType : std::int32_t {
     bct_unreg_subscriber = 13,
     bct_unreg_process = 14,
     bct_unreg_service = 15,
-    bct_unreg_client = 16
+    bct_unreg_client = 16,
+    bct_set_sample_batch = 17,
+    bct_reg_heartbeat = 18,
+    bct_reg_request = 19,
+    bct_reg_descriptor = 20,
+    bct_reg_descriptor_request = 21,
+    bct_set_sample_replay = 22
 };
 
 inline constexpr std::int32_t operator+(eCmdType v) {
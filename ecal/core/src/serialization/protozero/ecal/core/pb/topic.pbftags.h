@@ -7,6 +7,58 @@
 #include <cstdint>
 
 namespace eCAL { namespace pb { 
+enum class LatencyHistogram : ::protozero::pbf_tag_type {
+    repeated_int64_bucket_limits_us = 1,
+    repeated_int64_bucket_counts = 2
+};
+
+inline constexpr uint32_t operator+(LatencyHistogram e) {
+    return static_cast<uint32_t>(e);
+}
+
+enum class AcknowledgeStatistics : ::protozero::pbf_tag_type {
+    optional_int32_process_id = 1,
+    optional_int64_acknowledge_count = 2,
+    optional_int64_timeout_count = 3,
+    optional_message_latency = 4
+};
+
+inline constexpr uint32_t operator+(AcknowledgeStatistics e) {
+    return static_cast<uint32_t>(e);
+}
+
+enum class CallbackStatistics : ::protozero::pbf_tag_type {
+    optional_int32_queue_size = 1,
+    optional_int32_queue_depth = 2,
+    optional_int64_executed_count = 3,
+    optional_int64_drop_count = 4,
+    optional_message_latency = 5
+};
+
+inline constexpr uint32_t operator+(CallbackStatistics e) {
+    return static_cast<uint32_t>(e);
+}
+
+enum class LatencyStatistics : ::protozero::pbf_tag_type {
+    optional_string_publisher_id = 1,
+    optional_enum_layer = 2,
+    optional_message_delivery_latency = 3,
+    optional_message_callback_latency = 4
+};
+
+inline constexpr uint32_t operator+(LatencyStatistics e) {
+    return static_cast<uint32_t>(e);
+}
+
+enum class SampleFilter : ::protozero::pbf_tag_type {
+    optional_int32_downsampling_factor = 1,
+    optional_int32_max_frequency = 2
+};
+
+inline constexpr uint32_t operator+(SampleFilter e) {
+    return static_cast<uint32_t>(e);
+}
+
 enum class Topic : ::protozero::pbf_tag_type {
     optional_int32_registration_clock = 1,
     optional_string_host_name = 2,
@@ -25,7 +77,14 @@ enum class Topic : ::protozero::pbf_tag_type {
     optional_int32_message_drops = 18,
     optional_int64_data_id = 19,
     optional_int64_data_clock = 20,
-    optional_int32_data_frequency = 21
+    optional_int32_data_frequency = 21,
+    repeated_message_acknowledge_statistics = 31,
+    optional_message_callback_statistics = 32,
+    repeated_message_latency_statistics = 33,
+    optional_int64_fec_recovered_messages = 34,
+    optional_int64_fec_lost_messages = 35,
+    optional_message_sample_filter = 36,
+    optional_uint64_datatype_descriptor_hash = 37
 };
 
 inline constexpr uint32_t operator+(Topic e) {
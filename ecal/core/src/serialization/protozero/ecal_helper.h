@@ -55,4 +55,18 @@ void AddRepeatedMessage(protozero::pbf_reader& parent_reader, eCAL::Util::CExpan
   protozero::pbf_reader message_reader = parent_reader.get_message();
   auto& new_assignee_element = assignee.push_back();
   convert(message_reader, new_assignee_element);
-}
\ No newline at end of file
+}
+
+// accepts packed (proto3 default) and unpacked encoded repeated int64 fields
+inline void AddRepeatedInt64(protozero::pbf_reader& reader, std::vector<int64_t>& assignee)
+{
+  if (reader.wire_type() == protozero::pbf_wire_type::length_delimited)
+  {
+    const auto packed_range = reader.get_packed_int64();
+    assignee.insert(assignee.end(), packed_range.begin(), packed_range.end());
+  }
+  else
+  {
+    assignee.push_back(reader.get_int64());
+  }
+}
@@ -0,0 +1,114 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  pool of reusable byte buffers, grouped by power of two size classes
+**/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace eCAL
+{
+  namespace Util
+  {
+    /**
+     * @brief Pool of std::vector<char> buffers, that are reused instead of being reallocated.
+     *
+     * Buffers are kept in power of two size classes (by capacity). Acquire returns an empty
+     * buffer with at least the requested capacity, Release gives it back to the pool.
+     * Every size class keeps at most MAX_BUFFERS_PER_CLASS buffers, further buffers are freed.
+     *
+     * This class is *not* threadsafe and needs to be protected by locks / mutexes in multithreaded environments.
+     */
+    template <std::size_t MAX_BUFFERS_PER_CLASS = 4>
+    class CBufferPool
+    {
+    public:
+      // returns an empty buffer with a capacity of at least size_
+      std::vector<char> Acquire(std::size_t size_)
+      {
+        const std::size_t size_class = SizeClass(size_);
+        auto& buffers = m_buffers[size_class];
+
+        std::vector<char> buffer;
+        if (!buffers.empty())
+        {
+          buffer = std::move(buffers.back());
+          buffers.pop_back();
+        }
+        else
+        {
+          buffer.reserve(ClassCapacity(size_class));
+        }
+        return buffer;
+      }
+
+      // hands the buffer back to the pool, the buffer is left empty
+      void Release(std::vector<char>& buffer_)
+      {
+        const std::size_t capacity = buffer_.capacity();
+        if (capacity == 0) return;
+
+        // a buffer is stored in the largest size class it can serve completely
+        std::size_t size_class = SizeClass(capacity);
+        if ((ClassCapacity(size_class) > capacity) && (size_class > 0)) --size_class;
+
+        auto& buffers = m_buffers[size_class];
+        if ((ClassCapacity(size_class) <= capacity) && (buffers.size() < MAX_BUFFERS_PER_CLASS))
+        {
+          buffer_.clear();
+          buffers.push_back(std::move(buffer_));
+        }
+        std::vector<char>().swap(buffer_);
+      }
+
+      // number of buffers currently kept by the pool
+      std::size_t Size() const
+      {
+        std::size_t size(0);
+        for (const auto& buffers : m_buffers) size += buffers.size();
+        return size;
+      }
+
+    private:
+      static constexpr std::size_t min_class_bits = 10;   // smallest size class 1 kB
+      static constexpr std::size_t class_count    = sizeof(std::size_t) * 8 - min_class_bits;
+
+      static std::size_t ClassCapacity(std::size_t size_class_)
+      {
+        return std::size_t(1) << (size_class_ + min_class_bits);
+      }
+
+      // smallest size class with a capacity of at least size_
+      static std::size_t SizeClass(std::size_t size_)
+      {
+        std::size_t size_class(0);
+        while ((size_class + 1 < class_count) && (ClassCapacity(size_class) < size_)) ++size_class;
+        return size_class;
+      }
+
+      std::array<std::vector<std::vector<char>>, class_count> m_buffers;
+    };
+  }
+}
@@ -0,0 +1,47 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace eCAL
+{
+  namespace Util
+  {
+    /*
+    * Content hash (64 bit FNV-1a) of a datatype descriptor.
+    * It is part of the registration protocol, so it must not depend on the platform (unlike std::hash).
+    * 0 is reserved for "no descriptor".
+    */
+    inline uint64_t ComputeDescriptorHash(const std::string& descriptor_)
+    {
+      if (descriptor_.empty()) return 0;
+
+      uint64_t hash = 14695981039346656037ULL;
+      for (const char c : descriptor_)
+      {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ULL;
+      }
+      return (hash != 0) ? hash : 1;
+    }
+  }
+}
@@ -0,0 +1,597 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL map with time expiration (hashed timer wheel)
+**/
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace eCAL
+{
+  namespace Util
+  {
+    /**
+     * @brief A map that stores key-value pairs and the time at which they have last been updated.
+     *
+     * @tparam Key       The type of the keys.
+     * @tparam T         The type of the values.
+     * @tparam ClockType The type of the clock based on which the Map expires its elements (has to be monotonic)
+     * @tparam Hash      Hash function of the keys.
+     * @tparam KeyEqual  Equality of the keys.
+     *
+     * This class is *not* threadsafe and needs to be protected by locks / mutexes in multithreaded environments.
+     *
+     * It provides the interface of CExpirationMap, but does not allocate on a regular access:
+     * - All entries live in one pool vector. Erased entries are kept in a free list and reused.
+     * - Keys are looked up in an open addressing index (linear probing) that refers to the pool entries.
+     * - Every entry is linked (intrusive prev / next pool indices) into one bucket of a hashed timer wheel,
+     *   selected by the time of its last access. Accessing an entry moves it to the bucket of the current time.
+     *
+     * erase_expired only visits the wheel buckets that became due since its last call, so its cost depends on
+     * the number of expired elements and not on the size of the map.
+     */
+    template<class Key,
+      class T,
+      class ClockType = std::chrono::steady_clock,
+      class Hash      = std::hash<Key>,
+      class KeyEqual  = std::equal_to<Key>>
+    class CTimerWheelExpirationMap
+    {
+    private:
+      using TimePointT = typename ClockType::time_point;
+      using DurationT  = typename ClockType::duration;
+
+      static constexpr uint32_t npos       = std::numeric_limits<uint32_t>::max();
+      static constexpr size_t   wheel_size = 256;   // has to be a power of 2
+
+      struct SEntry
+      {
+        Key        key{};
+        T          value{};
+        TimePointT timestamp{};
+        uint64_t   hash = 0;
+        uint32_t   prev = npos;     // previous entry in the wheel bucket
+        uint32_t   next = npos;     // next entry in the wheel bucket (or the free list)
+        bool       used = false;
+      };
+
+    public:
+      // Type declarations necessary to be compliant to a regular map.
+      using value_type  = std::pair<const Key, T>;
+      using size_type   = std::size_t;
+      using key_type    = Key;
+      using mapped_type = T;
+
+      class iterator
+      {
+        friend class const_iterator;
+        friend class CTimerWheelExpirationMap;
+
+      public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = std::pair<Key, T>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::pair<Key, T>*;
+        using reference         = std::pair<Key, T>&;
+
+        iterator(CTimerWheelExpirationMap* map_, uint32_t index_)
+          : map(map_), index(index_)
+        {}
+
+        iterator& operator++()
+        {
+          index = map->next_used(index);
+          return *this;
+        } //prefix increment
+
+        iterator& operator--()
+        {
+          index = map->prev_used(index);
+          return *this;
+        } //prefix decrement
+
+        std::pair<Key, T> operator*() const
+        {
+          const SEntry& entry = map->_entries[index];
+          return std::make_pair(entry.key, entry.value);
+        }
+
+        bool operator==(const iterator& rhs) const { return index == rhs.index; }
+        bool operator!=(const iterator& rhs) const { return index != rhs.index; }
+
+      private:
+        CTimerWheelExpirationMap* map;
+        uint32_t                  index;
+      };
+
+      class const_iterator
+      {
+      public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = std::pair<Key, T>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::pair<Key, T>*;
+        using reference         = std::pair<Key, T>&;
+
+        explicit const_iterator(const iterator& other)
+          : map(other.map), index(other.index)
+        {}
+
+        const_iterator(const CTimerWheelExpirationMap* map_, uint32_t index_)
+          : map(map_), index(index_)
+        {}
+
+        const_iterator& operator++()
+        {
+          index = map->next_used(index);
+          return *this;
+        } //prefix increment
+
+        const_iterator& operator--()
+        {
+          index = map->prev_used(index);
+          return *this;
+        } //prefix decrement
+
+        std::pair<Key, T> operator*() const
+        {
+          const SEntry& entry = map->_entries[index];
+          return std::make_pair(entry.key, entry.value);
+        }
+
+        bool operator==(const const_iterator& rhs) const { return index == rhs.index; }
+        bool operator!=(const const_iterator& rhs) const { return index != rhs.index; }
+
+      private:
+        const CTimerWheelExpirationMap* map;
+        uint32_t                        index;
+      };
+
+      // Constructor specifies the timeout of the map
+      CTimerWheelExpirationMap() : CTimerWheelExpirationMap(std::chrono::milliseconds(5000)) {}
+      explicit CTimerWheelExpirationMap(DurationT t)
+      {
+        clear();
+        set_expiration(t);
+      }
+
+      /**
+      * @brief  set expiration time
+      **/
+      void set_expiration(DurationT t)
+      {
+        _timeout = t;
+
+        // the timeout spans half of the wheel, so due buckets are rarely shared with live entries
+        _granularity = _timeout / static_cast<typename DurationT::rep>(wheel_size / 2);
+        if (_granularity <= DurationT::zero()) _granularity = DurationT(1);
+
+        // relink all entries with the new granularity
+        _wheel_head.fill(npos);
+        _wheel_tail.fill(npos);
+        _expire_tick_valid = false;
+        for (uint32_t index = 0; index < _entries.size(); ++index)
+        {
+          if (_entries[index].used) link(index);
+        }
+      }
+
+      // Iterators:
+      iterator begin() noexcept             { return iterator(this, first_used()); }
+      iterator end() noexcept               { return iterator(this, npos); }
+      const_iterator begin() const noexcept { return const_iterator(this, first_used()); }
+      const_iterator end() const noexcept   { return const_iterator(this, npos); }
+      const_iterator cbegin() const noexcept { return const_iterator(this, first_used()); }
+      const_iterator cend() const noexcept   { return const_iterator(this, npos); }
+
+      // Capacity
+      bool empty() const noexcept         { return _size == 0; }
+      size_type size() const noexcept     { return _size; }
+      size_type max_size() const noexcept { return static_cast<size_type>(npos - 1); }
+
+      /**
+       * @brief Accesses the value associated with the given key, resetting its expiration time.
+       *
+       * @param key  The key to access the value for.
+       *
+       * @return     The value associated with the key.
+       */
+      T& operator[](const Key& k)
+      {
+        const uint64_t hash  = hash_key(k);
+        uint32_t       index = find_index(k, hash);
+        if (index == npos)
+        {
+          index = emplace_entry(k, T{}, hash);
+        }
+        else
+        {
+          update_timestamp(index);
+        }
+        return _entries[index].value;
+      }
+
+      mapped_type& at(const key_type& k)
+      {
+        const uint32_t index = find_index(k, hash_key(k));
+        if (index == npos) throw std::out_of_range("CTimerWheelExpirationMap::at");
+        return _entries[index].value;
+      }
+
+      const mapped_type& at(const key_type& k) const
+      {
+        const uint32_t index = find_index(k, hash_key(k));
+        if (index == npos) throw std::out_of_range("CTimerWheelExpirationMap::at");
+        return _entries[index].value;
+      }
+
+      // Modifiers
+      std::pair<iterator, bool> insert(const value_type& val)
+      {
+        const uint64_t hash  = hash_key(val.first);
+        const uint32_t index = find_index(val.first, hash);
+        if (index != npos) return std::make_pair(iterator(this, index), false);
+        return std::make_pair(iterator(this, emplace_entry(val.first, val.second, hash)), true);
+      }
+
+      // Operations
+      iterator find(const key_type& k)
+      {
+        return iterator(this, find_index(k, hash_key(k)));
+      }
+
+      const_iterator find(const Key& k) const
+      {
+        return const_iterator(this, find_index(k, hash_key(k)));
+      }
+
+      /**
+       * @brief Erase all expired key-value pairs from the map.
+       *
+       * The expired values are moved to expired_(const Key&, T&&), which must not modify this map.
+       * The CTimerWheelExpirationMap class does not call this function internally, it has to be called explicitly by the user.
+       *
+       * @return number of erased elements
+       */
+      template <class ExpiredCallback>
+      size_type erase_expired(ExpiredCallback&& expired_)
+      {
+        const TimePointT eviction_limit = get_curr_time() - _timeout;
+        const int64_t    limit_tick     = get_tick(eviction_limit);
+
+        // buckets from the last call up to the eviction limit are due, but every bucket only once
+        int64_t first_tick = limit_tick - static_cast<int64_t>(wheel_size - 1);
+        if (_expire_tick_valid && (_expire_tick > first_tick)) first_tick = _expire_tick;
+
+        size_type erased = 0;
+        for (int64_t tick = first_tick; tick <= limit_tick; ++tick)
+        {
+          uint32_t index = _wheel_head[get_bucket(tick)];
+          while (index != npos)
+          {
+            SEntry& entry = _entries[index];
+            const uint32_t next = entry.next;
+            if (entry.timestamp < eviction_limit)
+            {
+              expired_(entry.key, std::move(entry.value));
+              erase_entry(index);
+              ++erased;
+            }
+            index = next;
+          }
+        }
+
+        // the bucket of the limit may still contain live entries, it is visited again
+        _expire_tick       = limit_tick;
+        _expire_tick_valid = true;
+        return erased;
+      }
+
+      /**
+       * @brief Erase all expired key-value pairs from the map.
+       *
+       * Same as CExpirationMap::erase_expired, prefer erase_expired(callback) to avoid creating the returned map.
+       */
+      std::map<Key, T> erase_expired()
+      {
+        std::map<Key, T> erased_values;
+        erase_expired([&erased_values](const Key& k, T&& v) { erased_values.emplace(k, std::move(v)); });
+        return erased_values;
+      }
+
+      // Remove specific element from the cache
+      bool erase(const Key& k)
+      {
+        const uint32_t index = find_index(k, hash_key(k));
+        if (index == npos) return false;
+        erase_entry(index);
+        return true;
+      }
+
+      // Remove all elements from the cache
+      void clear()
+      {
+        _entries.clear();
+        _index.clear();
+        _index_shift       = 64;
+        _free_head         = npos;
+        _size              = 0;
+        _expire_tick       = 0;
+        _expire_tick_valid = false;
+        _wheel_head.fill(npos);
+        _wheel_tail.fill(npos);
+      }
+
+      void update(iterator element)
+      {
+        update_timestamp(element.index);
+      }
+
+    private:
+      TimePointT get_curr_time() const
+      {
+        return ClockType::now();
+      }
+
+      // floor division, also correct for time points before the clock epoch
+      int64_t get_tick(const TimePointT& time_point_) const
+      {
+        const int64_t count       = static_cast<int64_t>(time_point_.time_since_epoch().count());
+        const int64_t granularity = static_cast<int64_t>(_granularity.count());
+        return (count >= 0) ? (count / granularity) : -((-count + granularity - 1) / granularity);
+      }
+
+      static size_t get_bucket(int64_t tick_)
+      {
+        return static_cast<size_t>(static_cast<uint64_t>(tick_) & (wheel_size - 1));
+      }
+
+      // fibonacci hashing, spreads identity hashes (e.g. of integer keys) over the index
+      static uint64_t hash_key(const Key& k)
+      {
+        return static_cast<uint64_t>(Hash()(k)) * 0x9E3779B97F4A7C15ULL;
+      }
+
+      size_t home_slot(uint64_t hash_) const
+      {
+        return static_cast<size_t>(hash_ >> _index_shift);
+      }
+
+      ////////////////////////////////////////
+      // index (open addressing)
+      ////////////////////////////////////////
+      // returns the pool index of the key or npos
+      uint32_t find_index(const Key& k, uint64_t hash_) const
+      {
+        if (_size == 0) return npos;
+
+        const size_t mask = _index.size() - 1;
+        for (size_t slot = home_slot(hash_);; slot = (slot + 1) & mask)
+        {
+          const uint32_t index = _index[slot];
+          if (index == npos) return npos;
+          const SEntry& entry = _entries[index];
+          if ((entry.hash == hash_) && KeyEqual()(entry.key, k)) return index;
+        }
+      }
+
+      void index_insert(uint32_t index_)
+      {
+        const size_t mask = _index.size() - 1;
+        size_t slot = home_slot(_entries[index_].hash);
+        while (_index[slot] != npos) slot = (slot + 1) & mask;
+        _index[slot] = index_;
+      }
+
+      // backward shift deletion, keeps the probe sequences intact without tombstones
+      void index_erase(uint32_t index_)
+      {
+        const size_t mask = _index.size() - 1;
+        size_t hole = home_slot(_entries[index_].hash);
+        while (_index[hole] != index_) hole = (hole + 1) & mask;
+
+        for (size_t slot = (hole + 1) & mask; _index[slot] != npos; slot = (slot + 1) & mask)
+        {
+          // an entry may fill the hole if its home slot is not within (hole, slot]
+          const size_t home = home_slot(_entries[_index[slot]].hash);
+          const bool   home_in_range = (hole <= slot) ? ((hole < home) && (home <= slot)) : ((hole < home) || (home <= slot));
+          if (!home_in_range)
+          {
+            _index[hole] = _index[slot];
+            hole = slot;
+          }
+        }
+        _index[hole] = npos;
+      }
+
+      // keeps the load factor of the index below 3/4
+      void reserve_index(size_t size_)
+      {
+        if (size_ * 4 < _index.size() * 3) return;
+
+        size_t capacity = _index.empty() ? 16 : _index.size() * 2;
+        while (size_ * 4 >= capacity * 3) capacity *= 2;
+
+        unsigned int bits = 0;
+        while ((size_t(1) << bits) < capacity) ++bits;
+        _index_shift = 64 - bits;
+
+        _index.assign(capacity, npos);
+        for (uint32_t index = 0; index < _entries.size(); ++index)
+        {
+          if (_entries[index].used) index_insert(index);
+        }
+      }
+
+      ////////////////////////////////////////
+      // timer wheel (intrusive links)
+      ////////////////////////////////////////
+      void link(uint32_t index_)
+      {
+        SEntry& entry  = _entries[index_];
+        const size_t bucket = get_bucket(get_tick(entry.timestamp));
+        entry.prev = _wheel_tail[bucket];
+        entry.next = npos;
+        if (entry.prev != npos) _entries[entry.prev].next = index_;
+        else                    _wheel_head[bucket] = index_;
+        _wheel_tail[bucket] = index_;
+      }
+
+      void unlink(uint32_t index_)
+      {
+        SEntry& entry  = _entries[index_];
+        const size_t bucket = get_bucket(get_tick(entry.timestamp));
+        if (entry.prev != npos) _entries[entry.prev].next = entry.next;
+        else                    _wheel_head[bucket] = entry.next;
+        if (entry.next != npos) _entries[entry.next].prev = entry.prev;
+        else                    _wheel_tail[bucket] = entry.prev;
+        entry.prev = npos;
+        entry.next = npos;
+      }
+
+      void update_timestamp(uint32_t index_)
+      {
+        const TimePointT now = get_curr_time();
+        SEntry& entry = _entries[index_];
+        if (get_tick(entry.timestamp) == get_tick(now))
+        {
+          // same bucket, the order within a bucket does not matter
+          entry.timestamp = now;
+          return;
+        }
+        unlink(index_);
+        entry.timestamp = now;
+        link(index_);
+      }
+
+      ////////////////////////////////////////
+      // entry pool
+      ////////////////////////////////////////
+      uint32_t emplace_entry(const Key& k, const T& v, uint64_t hash_)
+      {
+        reserve_index(_size + 1);
+
+        uint32_t index = _free_head;
+        if (index != npos)
+        {
+          _free_head = _entries[index].next;
+        }
+        else
+        {
+          index = static_cast<uint32_t>(_entries.size());
+          _entries.emplace_back();
+        }
+
+        SEntry& entry   = _entries[index];
+        entry.key       = k;
+        entry.value     = v;
+        entry.hash      = hash_;
+        entry.timestamp = get_curr_time();
+        entry.used      = true;
+        ++_size;
+
+        index_insert(index);
+        link(index);
+        return index;
+      }
+
+      void erase_entry(uint32_t index_)
+      {
+        index_erase(index_);
+        unlink(index_);
+
+        // release the memory held by key and value
+        SEntry& entry = _entries[index_];
+        entry.key   = Key{};
+        entry.value = T{};
+        entry.used  = false;
+        entry.next  = _free_head;
+        _free_head  = index_;
+        --_size;
+      }
+
+      uint32_t first_used() const
+      {
+        return next_used(npos);
+      }
+
+      // next used entry after index_ (npos starts from the beginning)
+      uint32_t next_used(uint32_t index_) const
+      {
+        const size_t count = _entries.size();
+        for (size_t index = (index_ == npos) ? 0 : size_t(index_) + 1; index < count; ++index)
+        {
+          if (_entries[index].used) return static_cast<uint32_t>(index);
+        }
+        return npos;
+      }
+
+      // previous used entry before index_ (npos starts from the end)
+      uint32_t prev_used(uint32_t index_) const
+      {
+        size_t index = (index_ == npos) ? _entries.size() : size_t(index_);
+        while (index > 0)
+        {
+          --index;
+          if (_entries[index].used) return static_cast<uint32_t>(index);
+        }
+        return npos;
+      }
+
+      // Entry pool, erased entries are chained by their next index
+      std::vector<SEntry>   _entries;
+      uint32_t              _free_head = npos;
+      size_type             _size      = 0;
+
+      // Key-to-pool-index lookup, size is a power of 2
+      std::vector<uint32_t> _index;
+      unsigned int          _index_shift = 64;
+
+      // Timer wheel, bucket lists of the entries accessed within one tick
+      std::array<uint32_t, wheel_size> _wheel_head;
+      std::array<uint32_t, wheel_size> _wheel_tail;
+      int64_t                          _expire_tick       = 0;
+      bool                             _expire_tick_valid = false;
+
+      // Timeout of map and duration of one wheel tick
+      DurationT _timeout;
+      DurationT _granularity;
+    };
+
+    // out of class definitions of the odr-used constants (required before C++17)
+    template<class Key, class T, class ClockType, class Hash, class KeyEqual>
+    constexpr uint32_t CTimerWheelExpirationMap<Key, T, ClockType, Hash, KeyEqual>::npos;
+
+    template<class Key, class T, class ClockType, class Hash, class KeyEqual>
+    constexpr size_t CTimerWheelExpirationMap<Key, T, ClockType, Hash, KeyEqual>::wheel_size;
+  }
+}
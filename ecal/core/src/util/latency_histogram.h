@@ -0,0 +1,192 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief This file provides a fixed bucket latency histogram.
+ *        CLatencyHistogram is NOT threadsafe, CAtomicLatencyHistogram can be
+ *        filled by several threads without locking.
+**/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace eCAL
+{
+  /*
+  * Latency histogram with fixed, log-linear bucket limits: 1 us wide buckets up to 16 us,
+  * above that every power of two magnitude (up to 2^20 us, ~1 s) is split into 8 linear
+  * sub-buckets, so a bucket limit is at most 12.5 % above the samples it counts.
+  * Every bucket counts the samples that are less or equal its limit,
+  * the last bucket counts all samples above the largest limit.
+  */
+  class CLatencyHistogram
+  {
+  public:
+    static constexpr std::size_t sub_bucket_count   = 8;
+    static constexpr std::size_t magnitude_count    = 17;  // 2^3 us .. 2^20 us
+    static constexpr std::size_t bucket_limit_count = sub_bucket_count + magnitude_count * sub_bucket_count;
+    static constexpr std::size_t bucket_count       = bucket_limit_count + 1;
+
+    // Upper bucket limits [us]
+    static const std::array<int64_t, bucket_limit_count>& BucketLimits()
+    {
+      static const std::array<int64_t, bucket_limit_count> limits = []()
+        {
+          std::array<int64_t, bucket_limit_count> bucket_limits{};
+          std::size_t bucket(0);
+          // 1 .. 8 us
+          for (std::size_t sub_bucket = 1; sub_bucket <= sub_bucket_count; ++sub_bucket) bucket_limits[bucket++] = static_cast<int64_t>(sub_bucket);
+          // (2^m .. 2^(m+1)] us in 8 linear steps
+          for (std::size_t magnitude = 3; magnitude < 3 + magnitude_count; ++magnitude)
+          {
+            const int64_t base = int64_t(1) << magnitude;
+            const int64_t step = base / static_cast<int64_t>(sub_bucket_count);
+            for (std::size_t sub_bucket = 1; sub_bucket <= sub_bucket_count; ++sub_bucket) bucket_limits[bucket++] = base + static_cast<int64_t>(sub_bucket) * step;
+          }
+          return bucket_limits;
+        }();
+      return limits;
+    }
+
+    // Index of the bucket that counts the given latency
+    static std::size_t BucketIndex(const std::chrono::nanoseconds& latency_)
+    {
+      // round up, so a sample is never above the limit of its bucket
+      const int64_t latency_us = (latency_.count() + 999) / 1000;
+      const auto& limits = BucketLimits();
+      return static_cast<std::size_t>(std::lower_bound(limits.begin(), limits.end(), latency_us) - limits.begin());
+    }
+
+    // Upper limit [us] of the bucket that holds the given percentile (0 .. 100) of the samples,
+    // 0 if there are no samples, INT64_MAX if it is above the largest limit
+    static int64_t Percentile(const std::array<int64_t, bucket_count>& bucket_counts_, double percentile_)
+    {
+      int64_t sample_count(0);
+      for (const auto count : bucket_counts_) sample_count += count;
+      if (sample_count == 0) return 0;
+
+      // rank of the sample, counted from 1
+      const double clamped = std::min(std::max(percentile_, 0.0), 100.0);
+      const int64_t rank = std::max<int64_t>(static_cast<int64_t>(std::ceil(clamped / 100.0 * static_cast<double>(sample_count))), 1);
+
+      int64_t counted(0);
+      for (std::size_t bucket = 0; bucket < bucket_limit_count; ++bucket)
+      {
+        counted += bucket_counts_[bucket];
+        if (counted >= rank) return BucketLimits()[bucket];
+      }
+      return std::numeric_limits<int64_t>::max();
+    }
+
+    void AddSample(const std::chrono::nanoseconds& latency_)
+    {
+      ++m_bucket_counts[BucketIndex(latency_)];
+      ++m_sample_count;
+    }
+
+    // Merge the samples of another histogram into this one
+    void Add(const CLatencyHistogram& other_)
+    {
+      for (std::size_t bucket = 0; bucket < bucket_count; ++bucket) m_bucket_counts[bucket] += other_.m_bucket_counts[bucket];
+      m_sample_count += other_.m_sample_count;
+    }
+
+    int64_t SampleCount() const
+    {
+      return m_sample_count;
+    }
+
+    const std::array<int64_t, bucket_count>& BucketCounts() const
+    {
+      return m_bucket_counts;
+    }
+
+    int64_t Percentile(double percentile_) const
+    {
+      return Percentile(m_bucket_counts, percentile_);
+    }
+
+    // Copy limits and counts into plain vectors (as used by registration and monitoring)
+    void Export(std::vector<int64_t>& bucket_limits_us_, std::vector<int64_t>& bucket_counts_) const
+    {
+      const auto& limits = BucketLimits();
+      bucket_limits_us_.assign(limits.begin(), limits.end());
+      bucket_counts_.assign(m_bucket_counts.begin(), m_bucket_counts.end());
+    }
+
+    void Reset()
+    {
+      m_bucket_counts.fill(0);
+      m_sample_count = 0;
+    }
+
+  private:
+    std::array<int64_t, bucket_count> m_bucket_counts{};
+    int64_t                           m_sample_count = 0;
+  };
+
+  /*
+  * Lock-free variant of the histogram above (same bucket limits) for hot paths
+  * that are executed by several threads. Samples are counted with relaxed atomics,
+  * so an export may be off by the samples added concurrently.
+  */
+  class CAtomicLatencyHistogram
+  {
+  public:
+    void AddSample(const std::chrono::nanoseconds& latency_)
+    {
+      m_bucket_counts[CLatencyHistogram::BucketIndex(latency_)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    int64_t SampleCount() const
+    {
+      int64_t sample_count(0);
+      for (const auto& bucket_count : m_bucket_counts) sample_count += bucket_count.load(std::memory_order_relaxed);
+      return sample_count;
+    }
+
+    int64_t Percentile(double percentile_) const
+    {
+      std::array<int64_t, CLatencyHistogram::bucket_count> bucket_counts{};
+      for (std::size_t bucket = 0; bucket < CLatencyHistogram::bucket_count; ++bucket) bucket_counts[bucket] = m_bucket_counts[bucket].load(std::memory_order_relaxed);
+      return CLatencyHistogram::Percentile(bucket_counts, percentile_);
+    }
+
+    // Copy limits and counts into plain vectors (as used by registration and monitoring)
+    void Export(std::vector<int64_t>& bucket_limits_us_, std::vector<int64_t>& bucket_counts_) const
+    {
+      const auto& limits = CLatencyHistogram::BucketLimits();
+      bucket_limits_us_.assign(limits.begin(), limits.end());
+      bucket_counts_.resize(CLatencyHistogram::bucket_count);
+      for (std::size_t bucket = 0; bucket < CLatencyHistogram::bucket_count; ++bucket) bucket_counts_[bucket] = m_bucket_counts[bucket].load(std::memory_order_relaxed);
+    }
+
+  private:
+    std::array<std::atomic<int64_t>, CLatencyHistogram::bucket_count> m_bucket_counts{};
+  };
+}
@@ -0,0 +1,241 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Read-copy-update pointer with epoch based reclamation
+**/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace eCAL
+{
+  namespace RCU
+  {
+    /*
+    * Every thread that reads an RCU pointer owns a reader record and publishes the
+    * epoch it entered its read section with. Readers only write their own record
+    * (an own cache line), so many threads can read concurrently without sharing
+    * a written cache line. A replaced object is retired with the current epoch and
+    * deleted as soon as no reader is inside a read section that started before.
+    * Read sections can be nested and may run for a long time (e.g. user callbacks),
+    * this only defers the reclamation.
+    */
+    class CDomain
+    {
+    public:
+      static CDomain& Instance()
+      {
+        static CDomain domain;
+        return domain;
+      }
+
+      void EnterRead()
+      {
+        SThreadState& state = ThreadState();
+        if (state.depth++ == 0)
+        {
+          state.record->active_epoch.store(m_epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+        }
+      }
+
+      void LeaveRead()
+      {
+        SThreadState& state = ThreadState();
+        if (--state.depth == 0)
+        {
+          state.record->active_epoch.store(0, std::memory_order_seq_cst);
+          if (m_retired_count.load(std::memory_order_relaxed) > 0) Reclaim();
+        }
+      }
+
+      // the deleter is called once all read sections that may still see the object are left
+      void Retire(std::function<void()> deleter_)
+      {
+        {
+          const std::lock_guard<std::mutex> lock(m_retired_mutex);
+          m_retired.emplace_back(m_epoch.fetch_add(1, std::memory_order_seq_cst), std::move(deleter_));
+          m_retired_count.store(m_retired.size(), std::memory_order_relaxed);
+        }
+        Reclaim();
+      }
+
+    private:
+      struct SReaderRecord
+      {
+        std::atomic<uint64_t> active_epoch{ 0 };  // 0 == not reading
+        std::atomic<bool>     in_use{ false };
+        SReaderRecord*        next = nullptr;     // records are never removed from the list
+        char                  padding[64];        // keep the records of different threads on different cache lines
+      };
+
+      struct SThreadState
+      {
+        SReaderRecord* record = nullptr;
+        unsigned int   depth  = 0;
+
+        ~SThreadState()
+        {
+          if (record == nullptr) return;
+          record->active_epoch.store(0, std::memory_order_seq_cst);
+          record->in_use.store(false, std::memory_order_release);
+        }
+      };
+
+      CDomain() = default;
+
+      SThreadState& ThreadState()
+      {
+        static thread_local SThreadState state;
+        if (state.record == nullptr) state.record = AcquireRecord();
+        return state;
+      }
+
+      SReaderRecord* AcquireRecord()
+      {
+        // reuse the record of an exited thread
+        for (SReaderRecord* record = m_records.load(std::memory_order_acquire); record != nullptr; record = record->next)
+        {
+          bool expected(false);
+          if (record->in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) return record;
+        }
+
+        // or add a new one (it lives as long as the process)
+        auto* record = new SReaderRecord();
+        record->in_use.store(true, std::memory_order_relaxed);
+        record->next = m_records.load(std::memory_order_relaxed);
+        while (!m_records.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed)) {}
+        return record;
+      }
+
+      void Reclaim()
+      {
+        std::vector<std::function<void()>> deleters;
+        {
+          const std::lock_guard<std::mutex> lock(m_retired_mutex);
+          if (m_retired.empty()) return;
+
+          // oldest epoch a reader is still inside
+          uint64_t oldest_active_epoch = UINT64_MAX;
+          for (SReaderRecord* record = m_records.load(std::memory_order_acquire); record != nullptr; record = record->next)
+          {
+            const uint64_t active_epoch = record->active_epoch.load(std::memory_order_seq_cst);
+            if ((active_epoch != 0) && (active_epoch < oldest_active_epoch)) oldest_active_epoch = active_epoch;
+          }
+
+          // objects retired at an epoch before all active readers entered are unreachable
+          auto iter = m_retired.begin();
+          while (iter != m_retired.end())
+          {
+            if (iter->first < oldest_active_epoch)
+            {
+              deleters.push_back(std::move(iter->second));
+              iter = m_retired.erase(iter);
+            }
+            else
+            {
+              ++iter;
+            }
+          }
+          m_retired_count.store(m_retired.size(), std::memory_order_relaxed);
+        }
+
+        // delete outside the lock, a deleter may release further objects
+        for (auto& deleter : deleters) deleter();
+      }
+
+      std::atomic<uint64_t>                                  m_epoch{ 1 };
+      std::atomic<SReaderRecord*>                            m_records{ nullptr };
+
+      std::mutex                                             m_retired_mutex;
+      std::vector<std::pair<uint64_t, std::function<void()>>> m_retired;
+      std::atomic<size_t>                                    m_retired_count{ 0 };
+    };
+
+    /*
+    * Pointer to an immutable object. Readers access the current object without locking,
+    * writers replace it by a new one (writers have to be serialized by the caller).
+    */
+    template <typename T>
+    class CPointer
+    {
+    public:
+      // protects the object that was current when the guard was created
+      class CReadGuard
+      {
+      public:
+        explicit CReadGuard(const CPointer& pointer_)
+        {
+          CDomain::Instance().EnterRead();
+          m_value = pointer_.m_value.load(std::memory_order_seq_cst);
+        }
+
+        ~CReadGuard()
+        {
+          CDomain::Instance().LeaveRead();
+        }
+
+        CReadGuard(const CReadGuard&) = delete;
+        CReadGuard& operator=(const CReadGuard&) = delete;
+
+        const T& operator*() const  { return *m_value; }
+        const T* operator->() const { return m_value; }
+
+      private:
+        const T* m_value = nullptr;
+      };
+
+      explicit CPointer(std::unique_ptr<const T> value_ = std::unique_ptr<const T>(new T())) :
+        m_value(value_.release())
+      {
+      }
+
+      // there must not be any reader left
+      ~CPointer()
+      {
+        delete m_value.load(std::memory_order_acquire);
+      }
+
+      CPointer(const CPointer&) = delete;
+      CPointer& operator=(const CPointer&) = delete;
+
+      // current object, for the (serialized) writers only
+      const T& Current() const
+      {
+        return *m_value.load(std::memory_order_acquire);
+      }
+
+      void Update(std::unique_ptr<const T> value_)
+      {
+        const T* previous_value = m_value.exchange(value_.release(), std::memory_order_seq_cst);
+        CDomain::Instance().Retire([previous_value]() { delete previous_value; });
+      }
+
+    private:
+      std::atomic<const T*> m_value;
+    };
+  }
+}
@@ -0,0 +1,114 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief This file provides the subscriber sample filter (downsampling and frequency limit).
+ *        CSampleFilter is NOT threadsafe.
+**/
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace eCAL
+{
+  /*
+  * Sample filter of one publisher / subscriber connection.
+  *
+  * A sample passes if at least downsampling_factor samples (by send clock) and at least
+  * the minimal interval (by send time stamp) lie between it and the last passed sample.
+  * The decision only depends on the clock and the time stamp of the samples, so the publisher
+  * and the subscriber pass exactly the same samples, even if the subscriber additionally
+  * receives samples the publisher could not filter (udp multicast, a shared shm event of
+  * several subscribers of one process).
+  */
+  class CSampleFilter
+  {
+  public:
+    CSampleFilter() = default;
+
+    // downsampling_factor_ : pass every Nth sample (0, 1 == every sample)
+    // max_frequency_mhz_   : maximum sample frequency [mHz] (0 == unlimited)
+    CSampleFilter(int32_t downsampling_factor_, int32_t max_frequency_mhz_)
+    {
+      SetParameter(downsampling_factor_, max_frequency_mhz_);
+    }
+
+    // changes the filter parameter, the last passed sample is kept
+    void SetParameter(int32_t downsampling_factor_, int32_t max_frequency_mhz_)
+    {
+      m_downsampling_factor = (downsampling_factor_ > 1) ? downsampling_factor_ : 1;
+      m_min_interval_us     = (max_frequency_mhz_ > 0) ? (1000000000LL + max_frequency_mhz_ - 1) / max_frequency_mhz_ : 0;
+    }
+
+    bool IsActive() const
+    {
+      return (m_downsampling_factor > 1) || (m_min_interval_us > 0);
+    }
+
+    // returns true if the sample passes and remembers it as last passed sample
+    bool Pass(int64_t clock_, int64_t time_us_)
+    {
+      if (!IsActive()) return true;
+
+      // a clock or time stamp running backwards (restarted publisher, replay) restarts the filter
+      if (m_passed_any && (clock_ >= m_last_clock) && (time_us_ >= m_last_time_us))
+      {
+        if (clock_ - m_last_clock < m_downsampling_factor) return false;
+        if (time_us_ - m_last_time_us < m_min_interval_us) return false;
+      }
+
+      m_passed_any   = true;
+      m_last_clock   = clock_;
+      m_last_time_us = time_us_;
+      return true;
+    }
+
+    // forget the last passed sample
+    void Reset()
+    {
+      m_passed_any = false;
+    }
+
+  private:
+    int64_t m_downsampling_factor = 1;
+    int64_t m_min_interval_us     = 0;
+
+    bool    m_passed_any   = false;
+    int64_t m_last_clock   = 0;
+    int64_t m_last_time_us = 0;
+  };
+
+  // downsampling factor as transported in the registration
+  inline int32_t SampleFilterDownsamplingFactor(unsigned int downsampling_factor_)
+  {
+    const unsigned int max_factor = static_cast<unsigned int>(std::numeric_limits<int32_t>::max());
+    return static_cast<int32_t>((downsampling_factor_ < max_factor) ? downsampling_factor_ : max_factor);
+  }
+
+  // maximum frequency [Hz] as transported in the registration [mHz], 0 == unlimited
+  inline int32_t SampleFilterFrequencyToMilliHertz(double max_frequency_)
+  {
+    if (!(max_frequency_ > 0.0)) return 0;
+    const double max_frequency_mhz = max_frequency_ * 1000.0;
+    if (max_frequency_mhz >= static_cast<double>(std::numeric_limits<int32_t>::max())) return 0;
+    return (max_frequency_mhz < 1.0) ? 1 : static_cast<int32_t>(max_frequency_mhz + 0.5);
+  }
+}
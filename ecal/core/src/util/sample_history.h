@@ -0,0 +1,91 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief This file provides the transient local sample history of a publisher.
+ *        CSampleHistory is NOT threadsafe.
+**/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace eCAL
+{
+  namespace Util
+  {
+    /*
+    * Keeps the last depth samples of a publisher.
+    *
+    * The history is a ring of sample entries, the payload buffer of the oldest entry
+    * is reused for a new sample, so a history that has been filled once does not allocate
+    * anymore as long as the payload size does not grow.
+    */
+    class CSampleHistory
+    {
+    public:
+      struct SSample
+      {
+        std::vector<char> payload;
+        long long         id    = 0;
+        long long         clock = 0;
+        long long         time  = 0;
+      };
+
+      explicit CSampleHistory(size_t depth_) : m_samples(depth_ > 0 ? depth_ : 1) {}
+
+      size_t Depth() const { return m_samples.size(); }
+      size_t Size()  const { return m_size; }
+
+      // adds a new sample (replacing the oldest one if the history is full),
+      // the payload buffer of the returned entry has the size len_ and needs to be filled by the caller
+      SSample& Push(size_t len_, long long id_, long long clock_, long long time_)
+      {
+        SSample& sample = m_samples[m_next];
+        sample.payload.resize(len_);
+        sample.id    = id_;
+        sample.clock = clock_;
+        sample.time  = time_;
+
+        m_next = (m_next + 1) % m_samples.size();
+        if (m_size < m_samples.size()) ++m_size;
+        return sample;
+      }
+
+      // index 0 is the oldest sample
+      const SSample& operator[](size_t index_) const
+      {
+        const size_t oldest = (m_next + m_samples.size() - m_size) % m_samples.size();
+        return m_samples[(oldest + index_) % m_samples.size()];
+      }
+
+      void Clear()
+      {
+        m_next = 0;
+        m_size = 0;
+      }
+
+    private:
+      std::vector<SSample> m_samples;
+      size_t               m_next = 0;
+      size_t               m_size = 0;
+    };
+  }
+}
@@ -0,0 +1,63 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief This file provides a pin that keeps a received payload buffer valid.
+**/
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <utility>
+
+namespace eCAL
+{
+  /*
+  * A transport layer that delivers a payload directly from its receive buffer
+  * (e.g. a pinned ring buffer memory file block) offers a pin with the sample.
+  * Everybody who keeps the payload beyond the receive callback keeps a reference
+  * to the pin, the buffer is released with the last reference, maybe from another
+  * thread. The buffer owner keeps the buffer mapped until then, even if the layer
+  * has stopped meanwhile.
+  */
+  class CSamplePin
+  {
+  public:
+    CSamplePin(std::shared_ptr<const void> buffer_owner_, std::function<void()> release_) :
+      m_buffer_owner(std::move(buffer_owner_)),
+      m_release(std::move(release_))
+    {
+    }
+
+    ~CSamplePin()
+    {
+      if (m_release) m_release();
+    }
+
+    CSamplePin(const CSamplePin&) = delete;
+    CSamplePin& operator=(const CSamplePin&) = delete;
+    CSamplePin(CSamplePin&&) = delete;
+    CSamplePin& operator=(CSamplePin&&) = delete;
+
+  private:
+    std::shared_ptr<const void> m_buffer_owner;   // keeps the pinned buffer mapped (e.g. a ring memory file)
+    std::function<void()>       m_release;        // releases the buffer for reuse
+  };
+}
@@ -252,14 +252,14 @@ namespace eCAL
        // or we do not have any subscription at all
        // then the data writer will only do some statistics
        // for the monitoring layer and return
+       const long long write_time = (time_ == DEFAULT_TIME_ARGUMENT) ? eCAL::Time::GetMicroSeconds() : time_;
        if (!IsSubscribed())
        {
-         m_publisher_impl->RefreshSendCounter();
+         m_publisher_impl->WriteUnsubscribed(payload_, write_time, m_filter_id);
          return(payload_.GetSize());
        }
 
        // send content via data writer layer
-       const long long write_time = (time_ == DEFAULT_TIME_ARGUMENT) ? eCAL::Time::GetMicroSeconds() : time_;
        const size_t written_bytes = m_publisher_impl->Write(payload_, write_time, m_filter_id);
 
        // return number of bytes written
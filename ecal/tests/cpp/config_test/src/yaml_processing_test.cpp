@@ -52,6 +52,9 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     // There is unfortunately only one transport type
     config.registration.network.transport_type = eCAL::Registration::Network::eTransportType::udp;
     config.registration.network.udp.port = 16000;
+    config.registration.delta.enable = true;
+    config.registration.delta.statistics_cycles = 5;
+    config.registration.delta.descriptor_hashing = true;
     
     config.transport_layer.udp.config_version = eCAL::Types::UdpConfigVersion::V1;
     config.transport_layer.udp.port = 17000;
@@ -60,6 +63,9 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     config.transport_layer.udp.receive_buffer = 6242881;
     config.transport_layer.udp.join_all_interfaces = true;
     config.transport_layer.udp.npcap_enabled = true;
+    config.transport_layer.udp.mmsg_enabled = true;
+    config.transport_layer.udp.receive_threads = 4;
+    config.transport_layer.udp.max_message_size = 1048576;
     config.transport_layer.udp.local.group = "129.255.255.254";
     config.transport_layer.udp.local.ttl = 7;
     config.transport_layer.udp.network.group = "238.1.2.3";
@@ -67,6 +73,8 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     config.transport_layer.tcp.number_executor_reader = 9;
     config.transport_layer.tcp.number_executor_writer = 10;
     config.transport_layer.tcp.max_reconnections = 11;
+    config.transport_layer.shm.observer_threads = 3;
+    config.transport_layer.shm.observer_cpu_affinity_mask = 5;
 
     config.publisher.layer.shm.enable = false;
     config.publisher.layer.shm.zero_copy_mode = true;
@@ -74,15 +82,36 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     config.publisher.layer.shm.memfile_buffer_count = 13;
     config.publisher.layer.shm.memfile_min_size_bytes = 8192;
     config.publisher.layer.shm.memfile_reserve_percent = 14;
+    config.publisher.layer.shm.memfile_ring_slots = 15;
+    config.publisher.layer.shm.futex_notification = true;
+    config.publisher.layer.shm.memfile_huge_pages = true;
+    config.publisher.layer.shm.memfile_prefault = true;
+    config.publisher.layer.shm.memfile_numa_node = 1;
     config.publisher.layer.udp.enable = false;
+    config.publisher.layer.udp.batching = true;
+    config.publisher.layer.udp.batch_max_size_bytes = 800;
+    config.publisher.layer.udp.batch_linger_time_us = 500;
+    config.publisher.layer.udp.fec_redundancy_percent = 25;
     config.publisher.layer.tcp.enable = false;
+    config.publisher.layer.tcp.batching = true;
+    config.publisher.layer.tcp.batch_max_size_bytes = 16384;
+    config.publisher.layer.tcp.batch_linger_time_us = 2000;
+    config.publisher.history.depth = 3;
     config.publisher.layer_priority_local = {eCAL::TransportLayer::eType::tcp, eCAL::TransportLayer::eType::shm, eCAL::TransportLayer::eType::udp_mc};
     config.publisher.layer_priority_remote = {eCAL::TransportLayer::eType::tcp, eCAL::TransportLayer::eType::udp_mc};
 
     config.subscriber.layer.shm.enable = false;
+    config.subscriber.layer.shm.max_pinned_samples = 4;
     config.subscriber.layer.udp.enable = false;
     config.subscriber.layer.tcp.enable = true;
+    config.subscriber.callback.executor = eCAL::Subscriber::Callback::eExecutor::shared_pool;
+    config.subscriber.callback.queue_policy = eCAL::Subscriber::Callback::eQueuePolicy::block_publisher;
+    config.subscriber.callback.queue_size = 16;
+    config.subscriber.callback.shared_pool_size = 4;
+    config.subscriber.filter.downsampling_factor = 10;
+    config.subscriber.filter.max_frequency = 2.5;
     config.subscriber.drop_out_of_order_messages = false;
+    config.subscriber.latency_tracing = true;
 
     config.timesync.timesync_module_replay = "my_replay";
     config.timesync.timesync_module_rt = "my_rt";
@@ -116,6 +145,9 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     EXPECT_EQ(config.registration.local.udp.port, config_from_yaml.registration.local.udp.port);
     EXPECT_EQ(config.registration.network.transport_type, config_from_yaml.registration.network.transport_type);
     EXPECT_EQ(config.registration.network.udp.port, config_from_yaml.registration.network.udp.port);
+    EXPECT_EQ(config.registration.delta.enable, config_from_yaml.registration.delta.enable);
+    EXPECT_EQ(config.registration.delta.statistics_cycles, config_from_yaml.registration.delta.statistics_cycles);
+    EXPECT_EQ(config.registration.delta.descriptor_hashing, config_from_yaml.registration.delta.descriptor_hashing);
     EXPECT_EQ(config.transport_layer.udp.config_version, config_from_yaml.transport_layer.udp.config_version);
     EXPECT_EQ(config.transport_layer.udp.port, config_from_yaml.transport_layer.udp.port);
     EXPECT_EQ(config.transport_layer.udp.mask, config_from_yaml.transport_layer.udp.mask);
@@ -123,6 +155,9 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     EXPECT_EQ(config.transport_layer.udp.receive_buffer, config_from_yaml.transport_layer.udp.receive_buffer);
     EXPECT_EQ(config.transport_layer.udp.join_all_interfaces, config_from_yaml.transport_layer.udp.join_all_interfaces);
     EXPECT_EQ(config.transport_layer.udp.npcap_enabled, config_from_yaml.transport_layer.udp.npcap_enabled);
+    EXPECT_EQ(config.transport_layer.udp.mmsg_enabled, config_from_yaml.transport_layer.udp.mmsg_enabled);
+    EXPECT_EQ(config.transport_layer.udp.receive_threads, config_from_yaml.transport_layer.udp.receive_threads);
+    EXPECT_EQ(config.transport_layer.udp.max_message_size, config_from_yaml.transport_layer.udp.max_message_size);
     EXPECT_EQ(config.transport_layer.udp.local.group, config_from_yaml.transport_layer.udp.local.group);
     EXPECT_EQ(config.transport_layer.udp.local.ttl, config_from_yaml.transport_layer.udp.local.ttl);
     EXPECT_EQ(config.transport_layer.udp.network.group, config_from_yaml.transport_layer.udp.network.group);
@@ -130,20 +165,43 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     EXPECT_EQ(config.transport_layer.tcp.number_executor_reader, config_from_yaml.transport_layer.tcp.number_executor_reader);
     EXPECT_EQ(config.transport_layer.tcp.number_executor_writer, config_from_yaml.transport_layer.tcp.number_executor_writer);
     EXPECT_EQ(config.transport_layer.tcp.max_reconnections, config_from_yaml.transport_layer.tcp.max_reconnections);
+    EXPECT_EQ(config.transport_layer.shm.observer_threads, config_from_yaml.transport_layer.shm.observer_threads);
+    EXPECT_EQ(config.transport_layer.shm.observer_cpu_affinity_mask, config_from_yaml.transport_layer.shm.observer_cpu_affinity_mask);
     EXPECT_EQ(config.publisher.layer.shm.enable, config_from_yaml.publisher.layer.shm.enable);
     EXPECT_EQ(config.publisher.layer.shm.zero_copy_mode, config_from_yaml.publisher.layer.shm.zero_copy_mode);
     EXPECT_EQ(config.publisher.layer.shm.acknowledge_timeout_ms, config_from_yaml.publisher.layer.shm.acknowledge_timeout_ms);
     EXPECT_EQ(config.publisher.layer.shm.memfile_buffer_count, config_from_yaml.publisher.layer.shm.memfile_buffer_count);
     EXPECT_EQ(config.publisher.layer.shm.memfile_min_size_bytes, config_from_yaml.publisher.layer.shm.memfile_min_size_bytes);
     EXPECT_EQ(config.publisher.layer.shm.memfile_reserve_percent, config_from_yaml.publisher.layer.shm.memfile_reserve_percent);
+    EXPECT_EQ(config.publisher.layer.shm.memfile_ring_slots, config_from_yaml.publisher.layer.shm.memfile_ring_slots);
+    EXPECT_EQ(config.publisher.layer.shm.futex_notification, config_from_yaml.publisher.layer.shm.futex_notification);
+    EXPECT_EQ(config.publisher.layer.shm.memfile_huge_pages, config_from_yaml.publisher.layer.shm.memfile_huge_pages);
+    EXPECT_EQ(config.publisher.layer.shm.memfile_prefault, config_from_yaml.publisher.layer.shm.memfile_prefault);
+    EXPECT_EQ(config.publisher.layer.shm.memfile_numa_node, config_from_yaml.publisher.layer.shm.memfile_numa_node);
     EXPECT_EQ(config.publisher.layer.udp.enable, config_from_yaml.publisher.layer.udp.enable);
+    EXPECT_EQ(config.publisher.layer.udp.batching, config_from_yaml.publisher.layer.udp.batching);
+    EXPECT_EQ(config.publisher.layer.udp.batch_max_size_bytes, config_from_yaml.publisher.layer.udp.batch_max_size_bytes);
+    EXPECT_EQ(config.publisher.layer.udp.batch_linger_time_us, config_from_yaml.publisher.layer.udp.batch_linger_time_us);
+    EXPECT_EQ(config.publisher.layer.udp.fec_redundancy_percent, config_from_yaml.publisher.layer.udp.fec_redundancy_percent);
     EXPECT_EQ(config.publisher.layer.tcp.enable, config_from_yaml.publisher.layer.tcp.enable);
+    EXPECT_EQ(config.publisher.layer.tcp.batching, config_from_yaml.publisher.layer.tcp.batching);
+    EXPECT_EQ(config.publisher.layer.tcp.batch_max_size_bytes, config_from_yaml.publisher.layer.tcp.batch_max_size_bytes);
+    EXPECT_EQ(config.publisher.layer.tcp.batch_linger_time_us, config_from_yaml.publisher.layer.tcp.batch_linger_time_us);
+    EXPECT_EQ(config.publisher.history.depth, config_from_yaml.publisher.history.depth);
     EXPECT_EQ(config.publisher.layer_priority_local, config_from_yaml.publisher.layer_priority_local);
     EXPECT_EQ(config.publisher.layer_priority_remote, config_from_yaml.publisher.layer_priority_remote);
     EXPECT_EQ(config.subscriber.layer.shm.enable, config_from_yaml.subscriber.layer.shm.enable);
+    EXPECT_EQ(config.subscriber.layer.shm.max_pinned_samples, config_from_yaml.subscriber.layer.shm.max_pinned_samples);
     EXPECT_EQ(config.subscriber.layer.udp.enable, config_from_yaml.subscriber.layer.udp.enable);
     EXPECT_EQ(config.subscriber.layer.tcp.enable, config_from_yaml.subscriber.layer.tcp.enable);
+    EXPECT_EQ(config.subscriber.callback.executor, config_from_yaml.subscriber.callback.executor);
+    EXPECT_EQ(config.subscriber.callback.queue_policy, config_from_yaml.subscriber.callback.queue_policy);
+    EXPECT_EQ(config.subscriber.callback.queue_size, config_from_yaml.subscriber.callback.queue_size);
+    EXPECT_EQ(config.subscriber.callback.shared_pool_size, config_from_yaml.subscriber.callback.shared_pool_size);
+    EXPECT_EQ(config.subscriber.filter.downsampling_factor, config_from_yaml.subscriber.filter.downsampling_factor);
+    EXPECT_EQ(config.subscriber.filter.max_frequency, config_from_yaml.subscriber.filter.max_frequency);
     EXPECT_EQ(config.subscriber.drop_out_of_order_messages, config_from_yaml.subscriber.drop_out_of_order_messages);
+    EXPECT_EQ(config.subscriber.latency_tracing, config_from_yaml.subscriber.latency_tracing);
     EXPECT_EQ(config.timesync.timesync_module_replay, config_from_yaml.timesync.timesync_module_replay);
     EXPECT_EQ(config.timesync.timesync_module_rt, config_from_yaml.timesync.timesync_module_rt);
     EXPECT_EQ(config.application.startup.terminal_emulator, config_from_yaml.application.startup.terminal_emulator);
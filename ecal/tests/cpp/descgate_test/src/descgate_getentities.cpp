@@ -217,6 +217,78 @@ TEST(core_cpp_descgate, ManyPublisher)
   EXPECT_EQ(0, desc_gate.GetPublisherIDs().size());
 }
 
+TEST(core_cpp_descgate, PublisherDescriptorHash)
+{
+  eCAL::CDescGate desc_gate;
+
+  // full registration, then registrations carrying the descriptor hash only (descriptor not received yet)
+  auto pub_sample = CreatePublisher("pub1", 1);
+  pub_sample.topic.datatype_descriptor_hash = 42;
+  desc_gate.ApplySample(pub_sample, eCAL::tl_none);
+
+  auto hash_only_sample = pub_sample;
+  hash_only_sample.topic.datatype_information.descriptor.clear();
+  desc_gate.ApplySample(hash_only_sample, eCAL::tl_none);
+
+  const auto id_set = desc_gate.GetPublisherIDs();
+  ASSERT_EQ(1, id_set.size());
+  eCAL::SDataTypeInformation topic_info;
+  EXPECT_TRUE(desc_gate.GetPublisherInfo(*id_set.begin(), topic_info));
+  EXPECT_EQ(pub_sample.topic.datatype_information, topic_info);
+
+  // another descriptor hash, the descriptor is unknown until the next registration with descriptor
+  hash_only_sample.topic.datatype_descriptor_hash = 43;
+  desc_gate.ApplySample(hash_only_sample, eCAL::tl_none);
+  EXPECT_TRUE(desc_gate.GetPublisherInfo(*id_set.begin(), topic_info));
+  EXPECT_EQ("pub1-datatype_information.name", topic_info.name);
+  EXPECT_TRUE(topic_info.descriptor.empty());
+
+  hash_only_sample.topic.datatype_information.descriptor = "new-descriptor";
+  desc_gate.ApplySample(hash_only_sample, eCAL::tl_none);
+  EXPECT_TRUE(desc_gate.GetPublisherInfo(*id_set.begin(), topic_info));
+  EXPECT_EQ("new-descriptor", topic_info.descriptor);
+}
+
+TEST(core_cpp_descgate, SharedDescriptors)
+{
+  eCAL::CDescGate desc_gate;
+
+  // publishers and subscribers of the same datatype, with and without descriptor hash
+  constexpr int num_entities(100);
+  for (auto id = 0; id < num_entities; ++id)
+  {
+    auto pub_sample = CreatePublisher("pub" + std::to_string(id), id);
+    pub_sample.topic.datatype_information.descriptor = "shared-descriptor";
+    if (id % 2 == 0) pub_sample.topic.datatype_descriptor_hash = 42;
+    desc_gate.ApplySample(pub_sample, eCAL::tl_none);
+
+    auto sub_sample = CreateSubscriber("sub" + std::to_string(id), num_entities + id);
+    sub_sample.topic.datatype_information.descriptor = "shared-descriptor";
+    desc_gate.ApplySample(sub_sample, eCAL::tl_none);
+  }
+
+  eCAL::SDataTypeInformation topic_info;
+  for (const auto& id : desc_gate.GetPublisherIDs())
+  {
+    EXPECT_TRUE(desc_gate.GetPublisherInfo(id, topic_info));
+    EXPECT_EQ("shared-descriptor", topic_info.descriptor);
+  }
+  for (const auto& id : desc_gate.GetSubscriberIDs())
+  {
+    EXPECT_TRUE(desc_gate.GetSubscriberInfo(id, topic_info));
+    EXPECT_EQ("shared-descriptor", topic_info.descriptor);
+  }
+
+  // a changed descriptor of one entity does not change the others
+  auto pub_sample = CreatePublisher("pub0", 0);
+  desc_gate.ApplySample(pub_sample, eCAL::tl_none);
+  for (const auto& id : desc_gate.GetPublisherIDs())
+  {
+    EXPECT_TRUE(desc_gate.GetPublisherInfo(id, topic_info));
+    EXPECT_EQ((id.topic_id.entity_id == 0) ? "pub0-datatype_information.descriptor" : "shared-descriptor", topic_info.descriptor);
+  }
+}
+
 TEST(core_cpp_descgate, SubscriberExpiration)
 {
   eCAL::CDescGate desc_gate;
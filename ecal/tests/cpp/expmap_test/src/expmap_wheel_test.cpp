@@ -0,0 +1,208 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "util/ecal_expmap.h"
+#include "util/ecal_expmap_wheel.h"
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  class WheelTestingClock {
+  public:
+    using duration = std::chrono::milliseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<WheelTestingClock>;
+    static const bool is_steady = false;
+
+    static time_point now() noexcept {
+      return time_point(current_time);
+    }
+
+    static void increment_time(const duration& d) {
+      current_time += d;
+    }
+
+  private:
+    static duration current_time;
+  };
+
+  WheelTestingClock::duration WheelTestingClock::current_time{ 0 };
+
+  using WheelMap = eCAL::Util::CTimerWheelExpirationMap<std::string, int, WheelTestingClock>;
+}
+
+TEST(core_cpp_core, ExpMapWheel_SetGet)
+{
+  WheelMap expmap(std::chrono::milliseconds(200));
+
+  expmap["A"] = 1;
+  EXPECT_EQ(1, expmap["A"]);
+  EXPECT_EQ(1U, expmap.size());
+
+  // access resets the timer
+  WheelTestingClock::increment_time(std::chrono::milliseconds(150));
+  EXPECT_EQ(1, expmap["A"]);
+  expmap.erase_expired();
+  EXPECT_EQ(1U, expmap.size());
+
+  WheelTestingClock::increment_time(std::chrono::milliseconds(150));
+  expmap.erase_expired();
+  EXPECT_EQ(1U, expmap.size());
+
+  WheelTestingClock::increment_time(std::chrono::milliseconds(150));
+  auto erased = expmap.erase_expired();
+  EXPECT_EQ(0U, expmap.size());
+  ASSERT_EQ(1U, erased.size());
+  EXPECT_EQ(1, erased["A"]);
+}
+
+TEST(core_cpp_core, ExpMapWheel_EraseExpiredCallback)
+{
+  WheelMap expmap(std::chrono::milliseconds(200));
+  expmap["A"] = 1;
+  WheelTestingClock::increment_time(std::chrono::milliseconds(150));
+  expmap["B"] = 2;
+  expmap["C"] = 3;
+  WheelTestingClock::increment_time(std::chrono::milliseconds(100));
+
+  std::map<std::string, int> erased;
+  const auto erased_count = expmap.erase_expired([&erased](const std::string& key_, int&& value_) { erased[key_] = value_; });
+  EXPECT_EQ(1U, erased_count);
+  EXPECT_EQ(2U, expmap.size());
+  EXPECT_EQ(1, erased["A"]);
+
+  WheelTestingClock::increment_time(std::chrono::milliseconds(150));
+  EXPECT_EQ(2U, expmap.erase_expired().size());
+  EXPECT_TRUE(expmap.empty());
+}
+
+TEST(core_cpp_core, ExpMapWheel_InsertFindUpdate)
+{
+  WheelMap expmap(std::chrono::milliseconds(200));
+  EXPECT_EQ(expmap.end(), expmap.find("A"));
+
+  auto ret = expmap.insert(std::make_pair("A", 1));
+  EXPECT_TRUE(ret.second);
+  EXPECT_EQ(std::string("A"), (*ret.first).first);
+  EXPECT_EQ(1, (*ret.first).second);
+
+  // an existing key is not replaced
+  ret = expmap.insert(std::make_pair("A", 2));
+  EXPECT_FALSE(ret.second);
+  EXPECT_EQ(1, expmap.at("A"));
+  EXPECT_THROW(expmap.at("B"), std::out_of_range);
+
+  WheelTestingClock::increment_time(std::chrono::milliseconds(100));
+  expmap.update(expmap.find("A"));
+
+  WheelTestingClock::increment_time(std::chrono::milliseconds(150));
+  expmap.erase_expired();
+  EXPECT_EQ(1U, expmap.size());
+
+  WheelTestingClock::increment_time(std::chrono::milliseconds(100));
+  expmap.erase_expired();
+  EXPECT_EQ(0U, expmap.size());
+
+  const auto& const_ref_expmap = expmap;
+  auto const_it = const_ref_expmap.find("A");
+  static_assert(std::is_same<decltype(const_it), WheelMap::const_iterator>::value, "We're not being returned a const_iterator from find.");
+  EXPECT_EQ(const_ref_expmap.end(), const_it);
+}
+
+TEST(core_cpp_core, ExpMapWheel_IterateErase)
+{
+  WheelMap expmap(std::chrono::milliseconds(200));
+  for (int i = 0; i < 100; ++i) expmap[std::to_string(i)] = i;
+  for (int i = 0; i < 100; i += 2) EXPECT_TRUE(expmap.erase(std::to_string(i)));
+  EXPECT_FALSE(expmap.erase("0"));
+  EXPECT_EQ(50U, expmap.size());
+
+  int sum = 0;
+  size_t count = 0;
+  for (auto&& entry : expmap)
+  {
+    EXPECT_EQ(std::to_string(entry.second), entry.first);
+    sum += entry.second;
+    ++count;
+  }
+  EXPECT_EQ(50U, count);
+  EXPECT_EQ(2500, sum);
+
+  // erased entries are reused
+  for (int i = 0; i < 100; i += 2) expmap[std::to_string(i)] = i;
+  EXPECT_EQ(100U, expmap.size());
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(i, expmap.at(std::to_string(i)));
+
+  expmap.clear();
+  EXPECT_TRUE(expmap.empty());
+  EXPECT_EQ(expmap.begin(), expmap.end());
+}
+
+// random operations, compared against CExpirationMap
+TEST(core_cpp_core, ExpMapWheel_SameAsExpirationMap)
+{
+  using ReferenceMap = eCAL::Util::CExpirationMap<uint64_t, uint64_t, WheelTestingClock>;
+  using TestMap      = eCAL::Util::CTimerWheelExpirationMap<uint64_t, uint64_t, WheelTestingClock>;
+
+  ReferenceMap reference(std::chrono::milliseconds(1000));
+  TestMap      wheel(std::chrono::milliseconds(1000));
+
+  std::mt19937_64 rng(42);
+  for (int step = 0; step < 20000; ++step)
+  {
+    const uint64_t key = rng() % 2000;
+    switch (rng() % 8)
+    {
+    case 0:
+      EXPECT_EQ(reference.erase(key), wheel.erase(key));
+      break;
+    case 1:
+    {
+      WheelTestingClock::increment_time(std::chrono::milliseconds(rng() % 50));
+      auto reference_erased = reference.erase_expired();
+      auto wheel_erased     = wheel.erase_expired();
+      EXPECT_EQ(reference_erased, wheel_erased);
+      break;
+    }
+    case 2:
+      if (step % 1000 == 0) WheelTestingClock::increment_time(std::chrono::milliseconds(5000));
+      break;
+    default:
+      reference[key] = static_cast<uint64_t>(step);
+      wheel[key]     = static_cast<uint64_t>(step);
+      break;
+    }
+    ASSERT_EQ(reference.size(), wheel.size());
+  }
+
+  for (auto&& entry : reference)
+  {
+    ASSERT_NE(wheel.find(entry.first), wheel.end());
+    EXPECT_EQ(entry.second, wheel.at(entry.first));
+  }
+}
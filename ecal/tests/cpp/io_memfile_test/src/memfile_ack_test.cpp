@@ -0,0 +1,151 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+#include "io/shm/ecal_memfile_ack.h"
+#include "io/shm/ecal_memfile_notify.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+TEST(core_cpp_core, MemFile_SharedAcknowledge)
+{
+  if (!eCAL::memfile::notify::IsSupported()) GTEST_SKIP() << "Futex notification not supported on this platform";
+
+  const std::string memfile_name = "my_memory_file_ack";
+  const int32_t reader1_pid = 1001;
+  const int32_t reader2_pid = 1002;
+
+  // writer side
+  eCAL::CMemoryFileAck writer;
+  ASSERT_EQ(true, writer.Create(memfile_name, true));
+  EXPECT_EQ(true, writer.AddProcess(reader1_pid));
+  EXPECT_EQ(true, writer.AddProcess(reader2_pid));
+  EXPECT_EQ(true, writer.HasProcess(reader1_pid));
+  EXPECT_EQ(false, writer.HasProcess(4711));
+
+  // reader side
+  eCAL::CMemoryFileAck reader1;
+  eCAL::CMemoryFileAck reader2;
+  ASSERT_EQ(true, reader1.Create(memfile_name, false));
+  ASSERT_EQ(true, reader2.Create(memfile_name, false));
+
+  // a process without slot cannot acknowledge
+  EXPECT_EQ(false, reader1.Acknowledge(4711, 1));
+
+  // nothing acknowledged -> timeout
+  const uint32_t start_seq = writer.LoadSequence();
+  EXPECT_EQ(false, writer.WaitForAcknowledge(start_seq, 10));
+  EXPECT_EQ(0u, writer.AckClock(reader1_pid));
+
+  // both readers acknowledge in parallel
+  std::thread reader1_thread([&]() { reader1.Acknowledge(reader1_pid, 42); });
+  std::thread reader2_thread([&]() { reader2.Acknowledge(reader2_pid, 42); });
+  reader1_thread.join();
+  reader2_thread.join();
+
+  EXPECT_NE(start_seq, writer.LoadSequence());
+  EXPECT_EQ(42u, writer.AckClock(reader1_pid));
+  EXPECT_EQ(42u, writer.AckClock(reader2_pid));
+
+  // an acknowledge wakes up a waiting writer
+  const uint32_t wait_seq = writer.LoadSequence();
+  std::atomic<bool> woken(false);
+  std::thread writer_thread([&]()
+    {
+      woken = writer.WaitForAcknowledge(wait_seq, 5000);
+    });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(true, reader1.Acknowledge(reader1_pid, 43));
+  writer_thread.join();
+  EXPECT_EQ(true, woken);
+  EXPECT_EQ(43u, writer.AckClock(reader1_pid));
+
+  // releasing a process marks its slot and a reconnect reactivates it
+  EXPECT_EQ(true, writer.ReleaseProcess(reader2_pid));
+  EXPECT_EQ(eCAL::CMemoryFileAck::released_clock, writer.AckClock(reader2_pid));
+  EXPECT_EQ(true, writer.AddProcess(reader2_pid));
+  EXPECT_EQ(0u, writer.AckClock(reader2_pid));
+
+  EXPECT_EQ(true, reader1.Destroy());
+  EXPECT_EQ(true, reader2.Destroy());
+  EXPECT_EQ(true, writer.Destroy());
+
+  // the segment is removed with the writer
+  eCAL::CMemoryFileAck late_reader;
+  EXPECT_EQ(false, late_reader.Create(memfile_name, false));
+}
+
+TEST(core_cpp_core, MemFile_SharedAcknowledgeSlotReclaim)
+{
+  if (!eCAL::memfile::notify::IsSupported()) GTEST_SKIP() << "Futex notification not supported on this platform";
+
+  const std::string memfile_name = "my_memory_file_ack_reclaim";
+  // process ids above the linux pid limit, so they belong to no (living) process
+  const int32_t dead_pid_base = 0x7F000000;
+
+  eCAL::CMemoryFileAck writer;
+  ASSERT_EQ(true, writer.Create(memfile_name, true));
+  eCAL::CMemoryFileAck reader;
+  ASSERT_EQ(true, reader.Create(memfile_name, false));
+
+  // subscribers come and go, many more than there are slots
+  const int32_t churn_count = static_cast<int32_t>(4 * eCAL::CMemoryFileAck::max_processes);
+  for (int32_t subscriber = 0; subscriber < churn_count; ++subscriber)
+  {
+    const int32_t pid = dead_pid_base + subscriber;
+    ASSERT_EQ(true, writer.AddProcess(pid));
+    EXPECT_EQ(true, reader.Acknowledge(pid, 7));
+    EXPECT_EQ(7u, writer.AckClock(pid));
+    EXPECT_EQ(true, writer.ReleaseProcess(pid));
+  }
+
+  // fill all slots with processes that are still connected, one of them alive
+  const int32_t live_pid = static_cast<int32_t>(::getpid());
+  ASSERT_EQ(true, writer.AddProcess(live_pid));
+  for (int32_t subscriber = 0; subscriber < churn_count; ++subscriber)
+  {
+    // the slots of released and dead processes are reused, the live one keeps its slot
+    const int32_t pid = dead_pid_base + churn_count + subscriber;
+    ASSERT_EQ(true, writer.AddProcess(pid));
+    EXPECT_EQ(true, writer.HasProcess(live_pid));
+  }
+  EXPECT_EQ(true, reader.Acknowledge(live_pid, 11));
+  EXPECT_EQ(11u, writer.AckClock(live_pid));
+
+  // the remaining slots are owned by the latest processes, the others lost their slot
+  // to a later one and cannot acknowledge anymore
+  size_t slot_owner_count(0);
+  for (int32_t subscriber = 0; subscriber < churn_count; ++subscriber)
+  {
+    const int32_t pid = dead_pid_base + churn_count + subscriber;
+    if (writer.HasProcess(pid)) ++slot_owner_count;
+    else                        EXPECT_EQ(false, reader.Acknowledge(pid, 12));
+  }
+  EXPECT_EQ(eCAL::CMemoryFileAck::max_processes - 1, slot_owner_count);
+
+  EXPECT_EQ(true, reader.Destroy());
+  EXPECT_EQ(true, writer.Destroy());
+}
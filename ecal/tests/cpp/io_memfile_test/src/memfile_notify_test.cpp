@@ -0,0 +1,125 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "io/shm/ecal_memfile.h"
+#include "io/shm/ecal_memfile_notify.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+TEST(core_cpp_core, MemFile_FutexNotification)
+{
+  if (!eCAL::memfile::notify::IsSupported()) GTEST_SKIP() << "Futex notification not supported on this platform";
+
+  const std::string memfile_name = "my_memory_file_futex";
+
+  // writer side
+  eCAL::CMemoryFile writer;
+  ASSERT_EQ(true, writer.Create(memfile_name.c_str(), true, 1024));
+  EXPECT_EQ(false, writer.HasFutexNotification());
+  EXPECT_EQ(true, writer.EnableFutexNotification());
+  EXPECT_EQ(true, writer.HasFutexNotification());
+
+  // reader side detects the notification mode from the header
+  eCAL::CMemoryFile reader;
+  ASSERT_EQ(true, reader.Create(memfile_name.c_str(), false));
+  EXPECT_EQ(true, reader.HasFutexNotification());
+
+  std::uint32_t* writer_word = writer.GetNotifyAddress();
+  const std::uint32_t* reader_word = reader.GetNotifyAddress();
+  ASSERT_NE(nullptr, writer_word);
+  ASSERT_NE(nullptr, reader_word);
+
+  const std::uint32_t start_seq = eCAL::memfile::notify::Load(reader_word);
+
+  // nothing signaled -> timeout
+  EXPECT_EQ(false, eCAL::memfile::notify::Wait(reader_word, start_seq, 10));
+
+  // one signal wakes up a waiting reader
+  std::atomic<bool> woken(false);
+  std::thread reader_thread([&]()
+    {
+      woken = eCAL::memfile::notify::Wait(reader_word, start_seq, 5000);
+    });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  eCAL::memfile::notify::Signal(writer_word);
+  reader_thread.join();
+
+  EXPECT_EQ(true, woken);
+  EXPECT_EQ(start_seq + 1, eCAL::memfile::notify::Load(reader_word));
+
+  EXPECT_EQ(true, reader.Destroy(false));
+  EXPECT_EQ(true, writer.Destroy(true));
+}
+
+TEST(core_cpp_core, MemFile_FutexNotificationWaitAny)
+{
+  if (!eCAL::memfile::notify::IsWaitAnySupported()) GTEST_SKIP() << "Waiting on several futex words not supported on this platform";
+
+  const std::string memfile_name1 = "my_memory_file_futex_any1";
+  const std::string memfile_name2 = "my_memory_file_futex_any2";
+
+  // two writers with futex notification
+  eCAL::CMemoryFile writer1;
+  eCAL::CMemoryFile writer2;
+  ASSERT_EQ(true, writer1.Create(memfile_name1.c_str(), true, 1024));
+  ASSERT_EQ(true, writer2.Create(memfile_name2.c_str(), true, 1024));
+  EXPECT_EQ(true, writer1.EnableFutexNotification());
+  EXPECT_EQ(true, writer2.EnableFutexNotification());
+
+  // one reader observing both files
+  eCAL::CMemoryFile reader1;
+  eCAL::CMemoryFile reader2;
+  ASSERT_EQ(true, reader1.Create(memfile_name1.c_str(), false));
+  ASSERT_EQ(true, reader2.Create(memfile_name2.c_str(), false));
+
+  const std::uint32_t* words[2] = { reader1.GetNotifyAddress(), reader2.GetNotifyAddress() };
+  std::uint32_t seqs[2] = { eCAL::memfile::notify::Load(words[0]), eCAL::memfile::notify::Load(words[1]) };
+
+  // nothing signaled -> timeout
+  EXPECT_EQ(false, eCAL::memfile::notify::WaitAny(words, seqs, 2, 10));
+
+  // a signal on the second word wakes up the waiting reader
+  std::atomic<bool> woken(false);
+  std::thread reader_thread([&]()
+    {
+      woken = eCAL::memfile::notify::WaitAny(words, seqs, 2, 5000);
+    });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  eCAL::memfile::notify::Signal(writer2.GetNotifyAddress());
+  reader_thread.join();
+
+  EXPECT_EQ(true, woken);
+  EXPECT_EQ(seqs[0], eCAL::memfile::notify::Load(words[0]));
+  EXPECT_EQ(seqs[1] + 1, eCAL::memfile::notify::Load(words[1]));
+
+  // an outdated expected value returns immediately
+  EXPECT_EQ(true, eCAL::memfile::notify::WaitAny(words, seqs, 2, 5000));
+
+  EXPECT_EQ(true, reader1.Destroy(false));
+  EXPECT_EQ(true, reader2.Destroy(false));
+  EXPECT_EQ(true, writer1.Destroy(true));
+  EXPECT_EQ(true, writer2.Destroy(true));
+}
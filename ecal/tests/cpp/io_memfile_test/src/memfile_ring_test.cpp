@@ -0,0 +1,420 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "io/shm/ecal_memfile.h"
+#include "io/shm/ecal_memfile_ring.h"
+#include "readwrite/ecal_writer_buffer_payload.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  bool WriteString(eCAL::CMemoryFileRing& ring_, const std::string& content_, uint64_t clock_)
+  {
+    eCAL::CBufferPayloadWriter payload(content_.data(), content_.size());
+    eCAL::SMemFileHeader header;
+    header.data_size = content_.size();
+    header.clock     = clock_;
+    return ring_.Write(payload, header);
+  }
+}
+
+TEST(core_cpp_core, MemFileRing_ReadWrite)
+{
+  const std::string memfile_name = "my_memory_file_ring";
+
+  eCAL::CMemoryFileRing writer;
+  EXPECT_EQ(false, writer.IsCreated());
+  EXPECT_EQ(true,  writer.Create(memfile_name, true, 4, 64));
+  EXPECT_EQ(true,  writer.IsCreated());
+  EXPECT_EQ(4U,    writer.SlotCount());
+  EXPECT_EQ(64U,   writer.SlotSize());
+
+  eCAL::CMemoryFileRing reader;
+  EXPECT_EQ(true, reader.Create(memfile_name, false));
+  EXPECT_EQ(4U,   reader.SlotCount());
+
+  uint64_t               read_count(0);
+  uint64_t               dropped(0);
+  eCAL::SMemFileHeader   header;
+  std::vector<char>      buffer;
+
+  // empty ring
+  EXPECT_EQ(false, reader.Read(read_count, header, buffer, dropped));
+
+  // payload larger than a slot is rejected
+  EXPECT_EQ(false, WriteString(writer, std::string(65, 'x'), 1));
+
+  // write and read in order
+  EXPECT_EQ(true, WriteString(writer, "sample_1", 1));
+  EXPECT_EQ(true, WriteString(writer, "sample_2", 2));
+
+  EXPECT_EQ(true, reader.Read(read_count, header, buffer, dropped));
+  EXPECT_EQ(1U, header.clock);
+  EXPECT_EQ("sample_1", std::string(buffer.begin(), buffer.end()));
+
+  EXPECT_EQ(true, reader.Read(read_count, header, buffer, dropped));
+  EXPECT_EQ(2U, header.clock);
+  EXPECT_EQ("sample_2", std::string(buffer.begin(), buffer.end()));
+
+  EXPECT_EQ(false, reader.Read(read_count, header, buffer, dropped));
+  EXPECT_EQ(0U, dropped);
+
+  // overrun the reader, the oldest samples get lost
+  for (uint64_t clock = 3; clock <= 8; ++clock)
+  {
+    EXPECT_EQ(true, WriteString(writer, "sample_" + std::to_string(clock), clock));
+  }
+
+  EXPECT_EQ(true, reader.Read(read_count, header, buffer, dropped));
+  EXPECT_EQ(5U, header.clock);
+  EXPECT_EQ(2U, dropped);
+
+  EXPECT_EQ(true, reader.Destroy(false));
+  EXPECT_EQ(true, writer.Destroy(true));
+}
+
+TEST(core_cpp_core, MemFileRing_LoanSlot)
+{
+  const std::string memfile_name = "my_memory_file_ring_loan";
+
+  eCAL::CMemoryFileRing writer;
+  EXPECT_EQ(true, writer.Create(memfile_name, true, 2, 64));
+
+  eCAL::CMemoryFileRing reader;
+  EXPECT_EQ(true, reader.Create(memfile_name, false));
+
+  uint64_t               read_count(0);
+  uint64_t               dropped(0);
+  eCAL::SMemFileHeader   header;
+  std::vector<char>      buffer;
+
+  // payload larger than a slot is rejected, nothing to commit
+  EXPECT_EQ(nullptr, writer.LoanSlot(65));
+  EXPECT_EQ(false,   writer.CommitSlot(header));
+
+  // construct the sample in place
+  const std::string content = "in_place";
+  char* slot_payload = writer.LoanSlot(content.size());
+  ASSERT_NE(nullptr, slot_payload);
+  content.copy(slot_payload, content.size());
+
+  // not visible before it is committed
+  EXPECT_EQ(false, reader.Read(read_count, header, buffer, dropped));
+
+  eCAL::SMemFileHeader write_header;
+  write_header.data_size = content.size();
+  write_header.clock     = 1;
+  EXPECT_EQ(true,  writer.CommitSlot(write_header));
+  EXPECT_EQ(false, writer.CommitSlot(write_header));
+
+  EXPECT_EQ(true, reader.Read(read_count, header, buffer, dropped));
+  EXPECT_EQ(1U, header.clock);
+  EXPECT_EQ(content, std::string(buffer.begin(), buffer.end()));
+  EXPECT_EQ(0U, dropped);
+
+  EXPECT_EQ(true, reader.Destroy(false));
+  EXPECT_EQ(true, writer.Destroy(true));
+}
+
+TEST(core_cpp_core, MemFileRing_RejectClassicMemFile)
+{
+  const std::string memfile_name = "my_memory_file_no_ring";
+
+  // a classic memory file must not be detected as ring
+  eCAL::CMemoryFile mem_file;
+  EXPECT_EQ(true, mem_file.Create(memfile_name.c_str(), true, 1024));
+
+  eCAL::CMemoryFileRing reader;
+  EXPECT_EQ(false, reader.Create(memfile_name, false));
+  EXPECT_EQ(false, reader.IsCreated());
+
+  EXPECT_EQ(true, mem_file.Destroy(true));
+}
+
+TEST(core_cpp_core, MemFileRing_Concurrency)
+{
+  const std::string memfile_name = "my_memory_file_ring_concurrency";
+  const uint64_t    sample_count = 100000;
+  const size_t      sample_size  = 256;
+
+  eCAL::CMemoryFileRing writer;
+  ASSERT_EQ(true, writer.Create(memfile_name, true, 8, sample_size));
+
+  eCAL::CMemoryFileRing reader;
+  ASSERT_EQ(true, reader.Create(memfile_name, false));
+
+  std::atomic<bool> writer_done(false);
+  uint64_t          read_samples(0);
+  uint64_t          torn_samples(0);
+  uint64_t          dropped(0);
+
+  std::thread reader_thread([&]()
+    {
+      uint64_t             read_count(0);
+      uint64_t             last_clock(0);
+      eCAL::SMemFileHeader header;
+      std::vector<char>    buffer;
+      for (;;)
+      {
+        const bool done = writer_done;
+        while (reader.Read(read_count, header, buffer, dropped))
+        {
+          // every payload byte carries the low byte of the sample clock
+          for (const auto& byte : buffer)
+          {
+            if (static_cast<uint8_t>(byte) != static_cast<uint8_t>(header.clock)) { torn_samples++; break; }
+          }
+          EXPECT_GT(header.clock, last_clock);
+          last_clock = header.clock;
+          read_samples++;
+        }
+        if (done) break;
+      }
+    });
+
+  // the writer never blocks on the reader
+  std::vector<char> payload(sample_size);
+  for (uint64_t clock = 1; clock <= sample_count; ++clock)
+  {
+    std::fill(payload.begin(), payload.end(), static_cast<char>(static_cast<uint8_t>(clock)));
+    eCAL::CBufferPayloadWriter payload_writer(payload.data(), payload.size());
+    eCAL::SMemFileHeader header;
+    header.data_size = payload.size();
+    header.clock     = clock;
+    EXPECT_EQ(true, writer.Write(payload_writer, header));
+  }
+  writer_done = true;
+  reader_thread.join();
+
+  EXPECT_EQ(0U, torn_samples);
+  EXPECT_EQ(sample_count, read_samples + dropped);
+
+  EXPECT_EQ(true, reader.Destroy(false));
+  EXPECT_EQ(true, writer.Destroy(true));
+}
+
+TEST(core_cpp_core, MemFileRing_PinnedSample)
+{
+  const std::string memfile_name = "my_memory_file_ring_pinned";
+
+  eCAL::CMemoryFileRing writer;
+  ASSERT_EQ(true, writer.Create(memfile_name, true, 4, 64, eCAL::SMemFileAllocation(), 2));
+  EXPECT_EQ(2U, writer.PinSlots());
+
+  eCAL::CMemoryFileRing reader;
+  ASSERT_EQ(true, reader.Create(memfile_name, false));
+  EXPECT_EQ(2U, reader.PinSlots());
+
+  uint64_t             read_count(0);
+  uint64_t             dropped(0);
+  eCAL::SMemFileHeader header;
+  const char*          payload(nullptr);
+  uint64_t             block(0);
+
+  // nothing to pin
+  EXPECT_EQ(false, reader.ReadPinned(read_count, header, payload, block, dropped));
+
+  EXPECT_EQ(true, WriteString(writer, "pinned_1", 1));
+  ASSERT_EQ(true, reader.ReadPinned(read_count, header, payload, block, dropped));
+  EXPECT_EQ(1U, header.clock);
+  EXPECT_EQ("pinned_1", std::string(payload, static_cast<size_t>(header.data_size)));
+
+  // the writer laps the ring several times without waiting for the pinned sample
+  for (uint64_t clock = 2; clock <= 12; ++clock)
+  {
+    EXPECT_EQ(true, WriteString(writer, "sample_" + std::to_string(clock), clock));
+  }
+
+  // the pinned payload is untouched
+  EXPECT_EQ("pinned_1", std::string(payload, static_cast<size_t>(header.data_size)));
+
+  // and the latest samples are all readable
+  std::vector<char> buffer;
+  for (uint64_t clock = 9; clock <= 12; ++clock)
+  {
+    ASSERT_EQ(true, reader.Read(read_count, header, buffer, dropped));
+    EXPECT_EQ(clock, header.clock);
+    EXPECT_EQ("sample_" + std::to_string(clock), std::string(buffer.begin(), buffer.end()));
+  }
+  EXPECT_EQ(7U, dropped);
+
+  reader.Unpin(block);
+
+  EXPECT_EQ(true, reader.Destroy(false));
+  EXPECT_EQ(true, writer.Destroy(true));
+}
+
+TEST(core_cpp_core, MemFileRing_PinSlotsExhausted)
+{
+  const std::string memfile_name = "my_memory_file_ring_pin_slots";
+
+  eCAL::CMemoryFileRing writer;
+  ASSERT_EQ(true, writer.Create(memfile_name, true, 4, 64, eCAL::SMemFileAllocation(), 1));
+
+  eCAL::CMemoryFileRing reader;
+  ASSERT_EQ(true, reader.Create(memfile_name, false));
+
+  uint64_t             read_count(0);
+  uint64_t             dropped(0);
+  eCAL::SMemFileHeader header;
+  const char*          payload(nullptr);
+  uint64_t             block(0);
+  std::vector<char>    buffer;
+
+  EXPECT_EQ(true, WriteString(writer, "sample_1", 1));
+  EXPECT_EQ(true, WriteString(writer, "sample_2", 2));
+
+  // the only pin slot is taken by the first sample
+  ASSERT_EQ(true, reader.ReadPinned(read_count, header, payload, block, dropped));
+  EXPECT_EQ(1U, header.clock);
+
+  // the second sample stays unread, so it can be copied instead
+  EXPECT_EQ(false, reader.ReadPinned(read_count, header, payload, block, dropped));
+  ASSERT_EQ(true, reader.Read(read_count, header, buffer, dropped));
+  EXPECT_EQ(2U, header.clock);
+  EXPECT_EQ("sample_2", std::string(buffer.begin(), buffer.end()));
+
+  // unpinning returns the pin slot
+  reader.Unpin(block);
+  EXPECT_EQ(true, WriteString(writer, "sample_3", 3));
+  ASSERT_EQ(true, reader.ReadPinned(read_count, header, payload, block, dropped));
+  EXPECT_EQ(3U, header.clock);
+  EXPECT_EQ("sample_3", std::string(payload, static_cast<size_t>(header.data_size)));
+  reader.Unpin(block);
+  EXPECT_EQ(0U, dropped);
+
+  // rings without pin slots are always copied
+  eCAL::CMemoryFileRing writer_no_pins;
+  ASSERT_EQ(true, writer_no_pins.Create(memfile_name + "_no_pins", true, 4, 64));
+  eCAL::CMemoryFileRing reader_no_pins;
+  ASSERT_EQ(true, reader_no_pins.Create(memfile_name + "_no_pins", false));
+  EXPECT_EQ(0U, reader_no_pins.PinSlots());
+  EXPECT_EQ(true, WriteString(writer_no_pins, "sample_1", 1));
+  read_count = 0;
+  EXPECT_EQ(false, reader_no_pins.ReadPinned(read_count, header, payload, block, dropped));
+  EXPECT_EQ(true,  reader_no_pins.Read(read_count, header, buffer, dropped));
+
+  EXPECT_EQ(true, reader_no_pins.Destroy(false));
+  EXPECT_EQ(true, writer_no_pins.Destroy(true));
+  EXPECT_EQ(true, reader.Destroy(false));
+  EXPECT_EQ(true, writer.Destroy(true));
+}
+
+TEST(core_cpp_core, MemFileRing_PinConcurrency)
+{
+  const std::string memfile_name = "my_memory_file_ring_pin_concurrency";
+  const uint64_t    sample_count = 100000;
+  const size_t      sample_size  = 256;
+  const size_t      pin_slots    = 2;
+
+  eCAL::CMemoryFileRing writer;
+  ASSERT_EQ(true, writer.Create(memfile_name, true, 8, sample_size, eCAL::SMemFileAllocation(), pin_slots));
+
+  eCAL::CMemoryFileRing reader;
+  ASSERT_EQ(true, reader.Create(memfile_name, false));
+
+  std::atomic<bool> writer_done(false);
+  uint64_t          read_samples(0);
+  uint64_t          torn_samples(0);
+  uint64_t          dropped(0);
+
+  std::thread reader_thread([&]()
+    {
+      struct SPinned
+      {
+        const char* payload;
+        uint64_t    block;
+        uint64_t    clock;
+      };
+      std::vector<SPinned> pinned;
+
+      // a pinned payload must not change as long as it is pinned
+      auto check = [&torn_samples](const SPinned& pinned_)
+        {
+          for (size_t pos = 0; pos < sample_size; ++pos)
+          {
+            if (static_cast<uint8_t>(pinned_.payload[pos]) != static_cast<uint8_t>(pinned_.clock)) { torn_samples++; break; }
+          }
+        };
+
+      uint64_t             read_count(0);
+      eCAL::SMemFileHeader header;
+      std::vector<char>    buffer;
+      for (;;)
+      {
+        const bool done = writer_done;
+        for (;;)
+        {
+          SPinned sample{};
+          if (reader.ReadPinned(read_count, header, sample.payload, sample.block, dropped))
+          {
+            sample.clock = header.clock;
+            check(sample);
+            pinned.push_back(sample);
+            read_samples++;
+            continue;
+          }
+          if (!reader.Read(read_count, header, buffer, dropped)) break;
+          read_samples++;
+
+          // keep the pins a while, release the oldest one
+          if (!pinned.empty())
+          {
+            check(pinned.front());
+            reader.Unpin(pinned.front().block);
+            pinned.erase(pinned.begin());
+          }
+        }
+        if (done) break;
+      }
+      for (const auto& sample : pinned)
+      {
+        check(sample);
+        reader.Unpin(sample.block);
+      }
+    });
+
+  // the writer never blocks on the reader
+  std::vector<char> payload(sample_size);
+  for (uint64_t clock = 1; clock <= sample_count; ++clock)
+  {
+    std::fill(payload.begin(), payload.end(), static_cast<char>(static_cast<uint8_t>(clock)));
+    eCAL::CBufferPayloadWriter payload_writer(payload.data(), payload.size());
+    eCAL::SMemFileHeader header;
+    header.data_size = payload.size();
+    header.clock     = clock;
+    EXPECT_EQ(true, writer.Write(payload_writer, header));
+  }
+  writer_done = true;
+  reader_thread.join();
+
+  EXPECT_EQ(0U, torn_samples);
+  EXPECT_EQ(sample_count, read_samples + dropped);
+
+  EXPECT_EQ(true, reader.Destroy(false));
+  EXPECT_EQ(true, writer.Destroy(true));
+}
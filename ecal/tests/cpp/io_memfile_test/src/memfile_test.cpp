@@ -20,6 +20,7 @@
 
 #include "io/shm/ecal_memfile.h"
 #include "io/shm/ecal_memfile_db.h"
+#include "io/shm/ecal_memfile_os.h"
 #include <cstddef>
 #include <ecal/ecal.h>
 
@@ -300,3 +301,95 @@ TEST(core_cpp_core, MemFile_Concurrency)
   // destroy memory file
   EXPECT_EQ(true, mem_file.Destroy(true));
 }
+
+TEST(core_cpp_core, MemFile_Allocation)
+{
+  // huge pages fall back to regular shared memory if there is no usable hugetlbfs mount,
+  // a failing numa binding is reported but does not prevent the memory file creation
+  eCAL::SMemFileAllocation allocation;
+  allocation.huge_pages = true;
+  allocation.prefault   = true;
+  allocation.numa_node  = 0;
+
+  const std::string memfile_name = "my_allocation_memory_file";
+  const std::string send_s(3 * 1024 * 1024, 'x');
+
+  eCAL::CMemoryFile mem_file;
+  EXPECT_EQ(true, mem_file.Create(memfile_name.c_str(), true, send_s.size(), false, allocation));
+
+  EXPECT_EQ(true, mem_file.GetWriteAccess(100));
+  EXPECT_EQ(send_s.size(), mem_file.WriteBuffer(send_s.data(), send_s.size(), 0));
+  EXPECT_EQ(true, mem_file.ReleaseWriteAccess());
+
+  // open the file like a subscriber process, not knowing where it was placed
+  eCAL::SMemFileInfo reader_info;
+  EXPECT_EQ(true, eCAL::memfile::os::AllocFile(memfile_name, false, reader_info));
+  EXPECT_EQ(true, eCAL::memfile::os::CheckFileSize(send_s.size() + sizeof(eCAL::CMemoryFile::SInternalHeader), false, reader_info));
+  ASSERT_NE(nullptr, reader_info.mem_address);
+  if (reader_info.huge_pages)
+  {
+    EXPECT_EQ(0, reader_info.size % reader_info.page_size);
+  }
+
+  const auto* payload = static_cast<const char*>(reader_info.mem_address) + sizeof(eCAL::CMemoryFile::SInternalHeader);
+  EXPECT_EQ(send_s, std::string(payload, send_s.size()));
+
+  eCAL::memfile::os::UnMapFile(reader_info);
+  eCAL::memfile::os::DeAllocFile(reader_info);
+
+  EXPECT_EQ(true, mem_file.Destroy(true));
+}
+
+TEST(core_cpp_core, MemFile_Grow)
+{
+  const std::string memfile_name = "my_growing_memory_file";
+  const std::string small_s(1024, 's');
+  const std::string large_s(5 * 1024 * 1024, 'l');
+
+  eCAL::CMemoryFile mem_file;
+  EXPECT_EQ(true, mem_file.Create(memfile_name.c_str(), true, small_s.size()));
+
+  EXPECT_EQ(true, mem_file.GetWriteAccess(100));
+  EXPECT_EQ(small_s.size(), mem_file.WriteBuffer(small_s.data(), small_s.size(), 0));
+  EXPECT_EQ(true, mem_file.ReleaseWriteAccess());
+
+  // a reader process maps the small file
+  eCAL::SMemFileInfo reader_info;
+  EXPECT_EQ(true, eCAL::memfile::os::AllocFile(memfile_name, false, reader_info));
+  EXPECT_EQ(true, eCAL::memfile::os::CheckFileSize(small_s.size() + sizeof(eCAL::CMemoryFile::SInternalHeader), false, reader_info));
+  ASSERT_NE(nullptr, reader_info.mem_address);
+
+  // the file can not grow while it is opened
+  EXPECT_EQ(true, mem_file.GetWriteAccess(100));
+  EXPECT_EQ(false, mem_file.Grow(large_s.size(), 100));
+  EXPECT_EQ(true, mem_file.ReleaseWriteAccess());
+
+  // grow in place, name and content are kept
+  EXPECT_EQ(true, mem_file.Grow(large_s.size(), 100));
+  EXPECT_EQ(large_s.size(), mem_file.MaxDataSize());
+  EXPECT_EQ(memfile_name, mem_file.Name());
+
+  std::string read_s(small_s.size(), ' ');
+  EXPECT_EQ(true, mem_file.GetReadAccess(100));
+  EXPECT_EQ(small_s.size(), mem_file.Read(&read_s[0], read_s.size(), 0));
+  EXPECT_EQ(true, mem_file.ReleaseReadAccess());
+  EXPECT_EQ(small_s, read_s);
+
+  EXPECT_EQ(true, mem_file.GetWriteAccess(100));
+  EXPECT_EQ(large_s.size(), mem_file.WriteBuffer(large_s.data(), large_s.size(), 0));
+  EXPECT_EQ(true, mem_file.ReleaseWriteAccess());
+
+  // the reader sees the new size in the header and remaps the file
+  const auto* reader_header = static_cast<const eCAL::CMemoryFile::SInternalHeader*>(reader_info.mem_address);
+  EXPECT_EQ(large_s.size(), reader_header->max_data_size);
+  EXPECT_EQ(true, eCAL::memfile::os::CheckFileSize(large_s.size() + sizeof(eCAL::CMemoryFile::SInternalHeader), false, reader_info));
+  ASSERT_NE(nullptr, reader_info.mem_address);
+
+  const auto* payload = static_cast<const char*>(reader_info.mem_address) + sizeof(eCAL::CMemoryFile::SInternalHeader);
+  EXPECT_EQ(large_s, std::string(payload, large_s.size()));
+
+  eCAL::memfile::os::UnMapFile(reader_info);
+  eCAL::memfile::os::DeAllocFile(reader_info);
+
+  EXPECT_EQ(true, mem_file.Destroy(true));
+}
@@ -0,0 +1,292 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "ecal_def.h"
+#include "io/udp/ecal_udp_fec.h"
+
+#ifndef _WIN32
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+#include <ecal_utils/portable_endian.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  const std::string sample_name("fec_topic");
+  const size_t      block_size(1000);
+
+  std::vector<char> CreateMessage(size_t size_)
+  {
+    std::vector<char> message(size_);
+    for (size_t i = 0; i < size_; ++i) message[i] = static_cast<char>(i * 7 + 3);
+    return message;
+  }
+
+  struct SDecoderResult
+  {
+    std::vector<std::vector<char>> messages;
+    int                            recovered = 0;
+    int                            lost      = 0;
+  };
+
+  eCAL::UDP::FEC::CDecoder CreateDecoder(SDecoderResult& result_, size_t max_message_size_ = NET_UDP_MAX_MESSAGE_SIZE)
+  {
+    return eCAL::UDP::FEC::CDecoder(
+      [&result_](const char* data_, size_t size_) { result_.messages.emplace_back(data_, data_ + size_); },
+      [&result_](const std::string& name_, bool recovered_)
+      {
+        EXPECT_EQ(sample_name, name_);
+        if (recovered_) result_.recovered++;
+        else            result_.lost++;
+      },
+      max_message_size_);
+  }
+
+  // encode the message and hand over all packets to the decoder, except the dropped ones
+  void Transmit(eCAL::UDP::FEC::CEncoder& encoder_, eCAL::UDP::FEC::CDecoder& decoder_, const std::vector<char>& message_, const std::vector<size_t>& dropped_packets_)
+  {
+    size_t packet_index(0);
+    encoder_.Encode(message_, block_size, [&](const std::vector<char>& packet_)
+      {
+        const bool drop = std::find(dropped_packets_.begin(), dropped_packets_.end(), packet_index++) != dropped_packets_.end();
+        if (!drop) decoder_.ApplyPacket(sample_name, packet_.data(), packet_.size());
+        return true;
+      });
+  }
+}
+
+TEST(core_cpp_io_udp, FecNoLoss)
+{
+  eCAL::UDP::FEC::CEncoder encoder(25);
+  SDecoderResult result;
+  auto decoder = CreateDecoder(result);
+
+  const std::vector<size_t> message_sizes{ 0, 1, block_size - 1, block_size, block_size + 1, 100 * 1000 + 17 };
+  for (const auto message_size : message_sizes)
+  {
+    Transmit(encoder, decoder, CreateMessage(message_size), {});
+  }
+
+  ASSERT_EQ(message_sizes.size(), result.messages.size());
+  for (size_t i = 0; i < message_sizes.size(); ++i)
+  {
+    EXPECT_EQ(CreateMessage(message_sizes[i]), result.messages[i]);
+  }
+  EXPECT_EQ(0, result.recovered);
+  EXPECT_EQ(0, result.lost);
+}
+
+TEST(core_cpp_io_udp, FecRecoverOneBlockPerGroup)
+{
+  // 40 data blocks, 25 % redundancy -> 10 parity blocks, block i belongs to group i % 10
+  eCAL::UDP::FEC::CEncoder encoder(25);
+  SDecoderResult result;
+  auto decoder = CreateDecoder(result);
+
+  const std::vector<char> message = CreateMessage(40 * block_size - 123);
+
+  // lose one data block of every group, including the last (short) block
+  Transmit(encoder, decoder, message, { 0, 11, 22, 33, 4, 15, 26, 37, 18, 39 });
+  // the 2nd message has no loss
+  Transmit(encoder, decoder, message, {});
+
+  ASSERT_EQ(2u, result.messages.size());
+  EXPECT_EQ(message, result.messages[0]);
+  EXPECT_EQ(message, result.messages[1]);
+  EXPECT_EQ(1, result.recovered);
+  EXPECT_EQ(0, result.lost);
+}
+
+TEST(core_cpp_io_udp, FecUnrecoverableLoss)
+{
+  eCAL::UDP::FEC::CEncoder encoder(25);
+  SDecoderResult result;
+  auto decoder = CreateDecoder(result);
+
+  const std::vector<char> message = CreateMessage(40 * block_size);
+
+  // two lost data blocks of group 0
+  Transmit(encoder, decoder, message, { 0, 10 });
+  EXPECT_EQ(0u, result.messages.size());
+
+  // the incomplete message is reported as lost after the timeout
+  std::this_thread::sleep_for(std::chrono::milliseconds(2 * NET_UDP_REASSEMBLY_TIMEOUT + 100));
+  Transmit(encoder, decoder, message, {});
+
+  ASSERT_EQ(1u, result.messages.size());
+  EXPECT_EQ(message, result.messages[0]);
+  EXPECT_EQ(0, result.recovered);
+  EXPECT_EQ(1, result.lost);
+}
+
+TEST(core_cpp_io_udp, FecDuplicateAndLatePackets)
+{
+  eCAL::UDP::FEC::CEncoder encoder(10);
+  SDecoderResult result;
+  auto decoder = CreateDecoder(result);
+
+  // every packet is delivered twice, the message must be applied only once
+  const std::vector<char> message = CreateMessage(20 * block_size);
+  encoder.Encode(message, block_size, [&decoder](const std::vector<char>& packet_)
+    {
+      decoder.ApplyPacket(sample_name, packet_.data(), packet_.size());
+      decoder.ApplyPacket(sample_name, packet_.data(), packet_.size());
+      return true;
+    });
+
+  ASSERT_EQ(1u, result.messages.size());
+  EXPECT_EQ(message, result.messages[0]);
+  EXPECT_EQ(0, result.recovered);
+  EXPECT_EQ(0, result.lost);
+}
+
+TEST(core_cpp_io_udp, FecOversizedMessages)
+{
+  eCAL::UDP::FEC::CEncoder encoder(25);
+  SDecoderResult result;
+  auto decoder = CreateDecoder(result, 10 * block_size);
+
+  // messages above the maximum message size are dropped, smaller ones are still applied
+  Transmit(encoder, decoder, CreateMessage(10 * block_size + 1), {});
+  Transmit(encoder, decoder, CreateMessage(10 * block_size), {});
+  ASSERT_EQ(1u, result.messages.size());
+  EXPECT_EQ(10 * block_size, result.messages[0].size());
+
+  // damaged / hostile headers announcing huge messages or tiny blocks
+  const auto apply_header = [&decoder](uint32_t message_size_, uint32_t block_size_, uint32_t data_blocks_)
+  {
+    eCAL::UDP::FEC::SPacketHeader header{};
+    header.magic         = { { 'E', 'F', 'E', 'C' } };
+    header.message_size  = htole32(message_size_);
+    header.block_size    = htole32(block_size_);
+    header.data_blocks   = htole32(data_blocks_);
+    header.parity_blocks = htole32(1);
+    std::vector<char> packet(sizeof(header) + block_size_);
+    memcpy(packet.data(), &header, sizeof(header));
+    decoder.ApplyPacket(sample_name, packet.data(), packet.size());
+  };
+  apply_header(0xFFFFFFFFU, 1400, 0xFFFFFFFFU / 1400 + 1);
+  apply_header(4000, 1, 4000);
+  EXPECT_EQ(1u, result.messages.size());
+  EXPECT_EQ(0, result.lost);
+}
+
+TEST(core_cpp_io_udp, FecPendingMessageLimit)
+{
+  eCAL::UDP::FEC::CEncoder encoder(25);
+  SDecoderResult result;
+  auto decoder = CreateDecoder(result);
+
+  // incomplete messages (two lost data blocks of group 0) pile up without waiting for the timeout
+  const std::vector<char> message = CreateMessage(40 * block_size);
+  const size_t incomplete_messages = 2 * NET_UDP_MAX_PENDING_REASSEMBLIES;
+  for (size_t i = 0; i < incomplete_messages; ++i)
+  {
+    Transmit(encoder, decoder, message, { 0, 10 });
+  }
+
+  // the oldest ones are given up immediately, the limit is kept
+  EXPECT_EQ(0u, result.messages.size());
+  EXPECT_EQ(static_cast<int>(incomplete_messages - NET_UDP_MAX_PENDING_REASSEMBLIES), result.lost);
+
+  // a new message gives up one more pending message and is applied, it is removed on delivery,
+  // so its late packets do not create a new pending message
+  std::vector<std::vector<char>> packets;
+  encoder.Encode(message, block_size, [&packets](const std::vector<char>& packet_) { packets.push_back(packet_); return true; });
+  for (const auto& packet : packets) decoder.ApplyPacket(sample_name, packet.data(), packet.size());
+  for (const auto& packet : packets) decoder.ApplyPacket(sample_name, packet.data(), packet.size());
+
+  ASSERT_EQ(1u, result.messages.size());
+  EXPECT_EQ(message, result.messages[0]);
+  EXPECT_EQ(static_cast<int>(incomplete_messages - NET_UDP_MAX_PENDING_REASSEMBLIES + 1), result.lost);
+
+  // only the pending incomplete messages are reported after the timeout
+  std::this_thread::sleep_for(std::chrono::milliseconds(2 * NET_UDP_REASSEMBLY_TIMEOUT + 100));
+  Transmit(encoder, decoder, message, {});
+
+  ASSERT_EQ(2u, result.messages.size());
+  EXPECT_EQ(static_cast<int>(incomplete_messages), result.lost);
+}
+
+#ifndef _WIN32
+TEST(core_cpp_io_udp, FecLossyLoopbackSocket)
+{
+  // receiver socket on the loopback interface
+  const int rcv_socket = socket(AF_INET, SOCK_DGRAM, 0);
+  ASSERT_GE(rcv_socket, 0);
+  sockaddr_in address{};
+  address.sin_family      = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port        = 0;
+  ASSERT_EQ(0, bind(rcv_socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)));
+  socklen_t address_len = sizeof(address);
+  ASSERT_EQ(0, getsockname(rcv_socket, reinterpret_cast<sockaddr*>(&address), &address_len));
+  const int rcvbuf = 4 * 1024 * 1024;
+  setsockopt(rcv_socket, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+  timeval timeout{ 1, 0 };
+  setsockopt(rcv_socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+  const int snd_socket = socket(AF_INET, SOCK_DGRAM, 0);
+  ASSERT_GE(snd_socket, 0);
+
+  // 64 data blocks, 50 % redundancy -> 32 parity blocks, every 7th datagram is lost on the way
+  eCAL::UDP::FEC::CEncoder encoder(50);
+  const std::vector<char> message = CreateMessage(64 * block_size);
+  size_t packet_index(0);
+  size_t packets_sent(0);
+  encoder.Encode(message, block_size, [&](const std::vector<char>& packet_)
+    {
+      if (packet_index++ % 7 == 0) return true;
+      packets_sent++;
+      return sendto(snd_socket, packet_.data(), packet_.size(), 0, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == static_cast<ssize_t>(packet_.size());
+    });
+
+  SDecoderResult result;
+  auto decoder = CreateDecoder(result);
+  std::vector<char> receive_buffer(64 * 1024);
+  for (size_t packet = 0; packet < packets_sent; ++packet)
+  {
+    const ssize_t received = recv(rcv_socket, receive_buffer.data(), receive_buffer.size(), 0);
+    if (received < 0) break;
+    decoder.ApplyPacket(sample_name, receive_buffer.data(), static_cast<size_t>(received));
+  }
+
+  close(snd_socket);
+  close(rcv_socket);
+
+  ASSERT_EQ(1u, result.messages.size());
+  EXPECT_EQ(message, result.messages[0]);
+  EXPECT_EQ(1, result.recovered);
+  EXPECT_EQ(0, result.lost);
+}
+#endif
@@ -0,0 +1,237 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/ecal.h>
+#include <ecal/pubsub/publisher.h>
+#include <ecal/pubsub/subscriber.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  const int registration_delay_ms = 2000;
+  const int sample_delay_ms       = 50;
+
+  // receive callback that blocks until it is released
+  class CBlockingReceiver
+  {
+  public:
+    void operator()(const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_received.emplace_back(static_cast<const char*>(data_.buffer), data_.buffer_size);
+      m_cv.notify_all();
+      m_cv.wait(lock, [this]() { return m_released; });
+    }
+
+    void Release()
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      m_released = true;
+      m_cv.notify_all();
+    }
+
+    bool WaitForSamples(size_t count_, std::chrono::milliseconds timeout_)
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      return m_cv.wait_for(lock, timeout_, [this, count_]() { return m_received.size() >= count_; });
+    }
+
+    std::vector<std::string> Received()
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      return m_received;
+    }
+
+  private:
+    std::mutex               m_mutex;
+    std::condition_variable  m_cv;
+    bool                     m_released = false;
+    std::vector<std::string> m_received;
+  };
+
+  eCAL::Subscriber::Configuration AsyncSubscriberConfiguration(eCAL::Subscriber::Callback::eQueuePolicy queue_policy_, size_t queue_size_)
+  {
+    eCAL::Subscriber::Configuration sub_config;
+    sub_config.layer.udp.enable       = false;
+    sub_config.layer.tcp.enable       = false;
+    sub_config.callback.executor      = eCAL::Subscriber::Callback::eExecutor::dedicated_thread;
+    sub_config.callback.queue_policy  = queue_policy_;
+    sub_config.callback.queue_size    = queue_size_;
+    return sub_config;
+  }
+
+  eCAL::Publisher::Configuration ShmPublisherConfiguration()
+  {
+    eCAL::Publisher::Configuration pub_config;
+    pub_config.layer.udp.enable = false;
+    pub_config.layer.tcp.enable = false;
+    return pub_config;
+  }
+}
+
+// the oldest samples are dropped while the callback is busy
+TEST(core_cpp_pubsub, CallbackExecutorKeepLatest)
+{
+  EXPECT_TRUE(eCAL::Initialize("CallbackExecutorKeepLatest"));
+  {
+    eCAL::CPublisher  pub("callback_executor_keep_latest", {}, ShmPublisherConfiguration());
+    eCAL::CSubscriber sub("callback_executor_keep_latest", {}, AsyncSubscriberConfiguration(eCAL::Subscriber::Callback::eQueuePolicy::keep_latest, 1));
+
+    CBlockingReceiver receiver;
+    sub.SetReceiveCallback(std::ref(receiver));
+    std::this_thread::sleep_for(std::chrono::milliseconds(registration_delay_ms));
+
+    // the first sample blocks the executor, the transport layer keeps on receiving
+    pub.Send("1");
+    EXPECT_TRUE(receiver.WaitForSamples(1, std::chrono::seconds(1)));
+    for (const std::string sample : { "2", "3", "4", "5" })
+    {
+      pub.Send(sample);
+      std::this_thread::sleep_for(std::chrono::milliseconds(sample_delay_ms));
+    }
+
+    receiver.Release();
+    EXPECT_TRUE(receiver.WaitForSamples(2, std::chrono::seconds(1)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(sample_delay_ms));
+
+    const std::vector<std::string> expected{ "1", "5" };
+    EXPECT_EQ(expected, receiver.Received());
+
+    sub.RemoveReceiveCallback();
+  }
+  EXPECT_TRUE(eCAL::Finalize());
+}
+
+// new samples are dropped while the queue is full
+TEST(core_cpp_pubsub, CallbackExecutorKeepAll)
+{
+  EXPECT_TRUE(eCAL::Initialize("CallbackExecutorKeepAll"));
+  {
+    eCAL::CPublisher  pub("callback_executor_keep_all", {}, ShmPublisherConfiguration());
+    eCAL::CSubscriber sub("callback_executor_keep_all", {}, AsyncSubscriberConfiguration(eCAL::Subscriber::Callback::eQueuePolicy::keep_all, 2));
+
+    CBlockingReceiver receiver;
+    sub.SetReceiveCallback(std::ref(receiver));
+    std::this_thread::sleep_for(std::chrono::milliseconds(registration_delay_ms));
+
+    pub.Send("1");
+    EXPECT_TRUE(receiver.WaitForSamples(1, std::chrono::seconds(1)));
+    for (const std::string sample : { "2", "3", "4", "5" })
+    {
+      pub.Send(sample);
+      std::this_thread::sleep_for(std::chrono::milliseconds(sample_delay_ms));
+    }
+
+    receiver.Release();
+    EXPECT_TRUE(receiver.WaitForSamples(3, std::chrono::seconds(1)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(sample_delay_ms));
+
+    const std::vector<std::string> expected{ "1", "2", "3" };
+    EXPECT_EQ(expected, receiver.Received());
+
+    sub.RemoveReceiveCallback();
+  }
+  EXPECT_TRUE(eCAL::Finalize());
+}
+
+// an acknowledging shm publisher waits until the queue has space again
+TEST(core_cpp_pubsub, CallbackExecutorBlockPublisher)
+{
+  EXPECT_TRUE(eCAL::Initialize("CallbackExecutorBlockPublisher"));
+  {
+    auto pub_config = ShmPublisherConfiguration();
+    pub_config.layer.shm.acknowledge_timeout_ms = 5000;
+
+    eCAL::CPublisher  pub("callback_executor_block_publisher", {}, pub_config);
+    eCAL::CSubscriber sub("callback_executor_block_publisher", {}, AsyncSubscriberConfiguration(eCAL::Subscriber::Callback::eQueuePolicy::block_publisher, 1));
+
+    CBlockingReceiver receiver;
+    sub.SetReceiveCallback(std::ref(receiver));
+    std::this_thread::sleep_for(std::chrono::milliseconds(registration_delay_ms));
+
+    // release the callback later, meanwhile the third send has to wait
+    std::thread releaser([&receiver]()
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        receiver.Release();
+      });
+
+    const auto start = std::chrono::steady_clock::now();
+    for (const std::string sample : { "1", "2", "3", "4" })
+    {
+      pub.Send(sample);
+    }
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(400));
+    releaser.join();
+
+    EXPECT_TRUE(receiver.WaitForSamples(4, std::chrono::seconds(1)));
+    const std::vector<std::string> expected{ "1", "2", "3", "4" };
+    EXPECT_EQ(expected, receiver.Received());
+
+    sub.RemoveReceiveCallback();
+  }
+  EXPECT_TRUE(eCAL::Finalize());
+}
+
+// a slow subscriber of the shared pool does not stall the others
+TEST(core_cpp_pubsub, CallbackExecutorSharedPool)
+{
+  EXPECT_TRUE(eCAL::Initialize("CallbackExecutorSharedPool"));
+  {
+    auto sub_config = AsyncSubscriberConfiguration(eCAL::Subscriber::Callback::eQueuePolicy::keep_all, 10);
+    sub_config.callback.executor         = eCAL::Subscriber::Callback::eExecutor::shared_pool;
+    sub_config.callback.shared_pool_size = 2;
+
+    eCAL::CPublisher  slow_pub("callback_executor_shared_pool_slow", {}, ShmPublisherConfiguration());
+    eCAL::CPublisher  fast_pub("callback_executor_shared_pool_fast", {}, ShmPublisherConfiguration());
+    eCAL::CSubscriber slow_sub("callback_executor_shared_pool_slow", {}, sub_config);
+    eCAL::CSubscriber fast_sub("callback_executor_shared_pool_fast", {}, sub_config);
+
+    CBlockingReceiver slow_receiver;
+    slow_sub.SetReceiveCallback(std::ref(slow_receiver));
+
+    std::atomic<int> fast_received(0);
+    fast_sub.SetReceiveCallback([&fast_received](const eCAL::STopicId&, const eCAL::SDataTypeInformation&, const eCAL::SReceiveCallbackData&) { fast_received++; });
+    std::this_thread::sleep_for(std::chrono::milliseconds(registration_delay_ms));
+
+    slow_pub.Send("blocking");
+    EXPECT_TRUE(slow_receiver.WaitForSamples(1, std::chrono::seconds(1)));
+
+    for (int i = 0; i < 5; ++i)
+    {
+      fast_pub.Send("fast");
+      std::this_thread::sleep_for(std::chrono::milliseconds(sample_delay_ms));
+    }
+    EXPECT_EQ(5, fast_received);
+
+    slow_receiver.Release();
+    slow_sub.RemoveReceiveCallback();
+    fast_sub.RemoveReceiveCallback();
+  }
+  EXPECT_TRUE(eCAL::Finalize());
+}
@@ -22,12 +22,16 @@
 #include <ecal/pubsub/publisher.h>
 #include <ecal/pubsub/subscriber.h>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <utility>
 
 #include <gtest/gtest.h>
 #include <vector>
@@ -153,6 +157,512 @@ TEST(core_cpp_pubsub, MultipleSendsSHM)
   eCAL::Finalize();
 }
 
+TEST(core_cpp_pubsub, LoanedPayloadSHM)
+{
+  std::string last_received_msg;
+
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber for topic "A"
+  eCAL::CSubscriber sub("A");
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = true;
+  pub_config.layer.udp.enable = false;
+  pub_config.layer.tcp.enable = false;
+
+  // create publisher for topic "A"
+  eCAL::CPublisher pub("A", {}, pub_config);
+
+  // add callback
+  auto save_data = [&last_received_msg](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+  {
+    last_received_msg = std::string{ (const char*)data_.buffer, (size_t)data_.buffer_size };
+  };
+  sub.SetReceiveCallback(save_data);
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  const std::vector<std::string> send_vector{ "this", "is", "a", "loaned", "payload" };
+  for (const auto& send_s : send_vector)
+  {
+    // construct the message in place
+    auto loan = pub.Loan(send_s.size());
+    ASSERT_TRUE(loan.IsValid());
+    EXPECT_EQ(send_s.size(), loan.GetSize());
+    send_s.copy(static_cast<char*>(loan.GetData()), send_s.size());
+
+    // only one loan at a time, and no sending while it is pending
+    EXPECT_FALSE(pub.Loan(1).IsValid());
+    EXPECT_FALSE(pub.Send(send_s));
+
+    EXPECT_TRUE(pub.Publish(std::move(loan)));
+    EXPECT_FALSE(loan.IsValid());
+    eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+
+    EXPECT_EQ(send_s, last_received_msg);
+  }
+
+  // a loan that is not published is given back
+  {
+    auto loan = pub.Loan(8);
+    EXPECT_TRUE(loan.IsValid());
+  }
+  EXPECT_TRUE(pub.Send("sent"));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+  EXPECT_EQ("sent", last_received_msg);
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, LoanedPayloadOtherThreadSHM)
+{
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // classic memory file and ring buffer memory file
+  for (const unsigned int ring_slots : { 0U, 4U })
+  {
+    std::mutex              received_mtx;
+    std::condition_variable received_cv;
+    std::string             last_received_msg;
+
+    // create subscriber for topic "A"
+    eCAL::CSubscriber sub("A");
+    sub.SetReceiveCallback([&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+      {
+        const std::lock_guard<std::mutex> lock(received_mtx);
+        last_received_msg = std::string{ (const char*)data_.buffer, (size_t)data_.buffer_size };
+        received_cv.notify_all();
+      });
+
+    // create publisher for topic "A" (shm only)
+    eCAL::Publisher::Configuration pub_config;
+    pub_config.layer.shm.enable = true;
+    pub_config.layer.udp.enable = false;
+    pub_config.layer.tcp.enable = false;
+    pub_config.layer.shm.memfile_ring_slots = ring_slots;
+    eCAL::CPublisher pub("A", {}, pub_config);
+
+    // let's match them
+    eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+    // loan on this thread, fill and publish on another one
+    const std::string send_s("published by another thread");
+    auto loan = pub.Loan(send_s.size());
+    ASSERT_TRUE(loan.IsValid());
+
+    bool published(false);
+    std::thread publish_thread([&pub, &send_s, &published](eCAL::CPayloadLoan loan_)
+      {
+        send_s.copy(static_cast<char*>(loan_.GetData()), send_s.size());
+        published = pub.Publish(std::move(loan_));
+      }, std::move(loan));
+    publish_thread.join();
+    EXPECT_TRUE(published);
+
+    {
+      std::unique_lock<std::mutex> lock(received_mtx);
+      received_cv.wait_for(lock, std::chrono::milliseconds(10 * DATA_FLOW_TIME_MS), [&last_received_msg, &send_s]() { return last_received_msg == send_s; });
+      EXPECT_EQ(send_s, last_received_msg);
+    }
+
+    // a loan given back by another thread does not block this one
+    loan = pub.Loan(8);
+    ASSERT_TRUE(loan.IsValid());
+    std::thread([](eCAL::CPayloadLoan loan_) { loan_.Return(); }, std::move(loan)).join();
+
+    EXPECT_TRUE(pub.Send("sent"));
+    {
+      std::unique_lock<std::mutex> lock(received_mtx);
+      received_cv.wait_for(lock, std::chrono::milliseconds(10 * DATA_FLOW_TIME_MS), [&last_received_msg]() { return last_received_msg == "sent"; });
+      EXPECT_EQ("sent", last_received_msg);
+    }
+  }
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, ReceiveSampleSHM)
+{
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber for topic "A" pinning ring samples (default configuration)
+  eCAL::CSubscriber sub_pinned("A");
+
+  // create subscriber for topic "A" that always copies
+  eCAL::Subscriber::Configuration sub_config;
+  sub_config.layer.shm.max_pinned_samples = 0;
+  eCAL::CSubscriber sub_copied("A", {}, sub_config);
+
+  // create ring buffer memory file publisher for topic "A"
+  eCAL::Publisher::Configuration pub_config;
+  pub_config.layer.shm.enable             = true;
+  pub_config.layer.udp.enable             = false;
+  pub_config.layer.tcp.enable             = false;
+  pub_config.layer.shm.memfile_ring_slots = 4;
+  eCAL::CPublisher pub("A", {}, pub_config);
+
+  // keep the samples beyond the callbacks
+  std::mutex                        samples_mtx;
+  std::vector<eCAL::CReceiveSample> pinned_samples;
+  std::vector<eCAL::CReceiveSample> copied_samples;
+  sub_pinned.SetReceiveSampleCallback([&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::CReceiveSample& sample_)
+    {
+      const std::lock_guard<std::mutex> lock(samples_mtx);
+      pinned_samples.push_back(sample_);
+    });
+  sub_copied.SetReceiveSampleCallback([&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::CReceiveSample& sample_)
+    {
+      const std::lock_guard<std::mutex> lock(samples_mtx);
+      copied_samples.push_back(sample_);
+    });
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  const std::string send_s = "pinned sample";
+  EXPECT_TRUE(pub.Send(send_s));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+
+  eCAL::CReceiveSample pinned_sample;
+  eCAL::CReceiveSample copied_sample;
+  {
+    const std::lock_guard<std::mutex> lock(samples_mtx);
+    ASSERT_EQ(1, pinned_samples.size());
+    ASSERT_EQ(1, copied_samples.size());
+    pinned_sample = std::move(pinned_samples.front());
+    copied_sample = std::move(copied_samples.front());
+    pinned_samples.clear();
+    copied_samples.clear();
+  }
+  EXPECT_TRUE(pinned_sample.IsPinned());
+  EXPECT_FALSE(copied_sample.IsPinned());
+
+  // hand the pinned sample over to another thread and release it there
+  std::string pinned_content;
+  std::thread consumer([&pinned_content, &pinned_sample]()
+    {
+      pinned_content = std::string{ static_cast<const char*>(pinned_sample.GetBuffer()), pinned_sample.GetBufferSize() };
+      pinned_sample.Release();
+    });
+  consumer.join();
+  EXPECT_EQ(send_s, pinned_content);
+  EXPECT_FALSE(pinned_sample.IsValid());
+  EXPECT_EQ(send_s, std::string(static_cast<const char*>(copied_sample.GetBuffer()), copied_sample.GetBufferSize()));
+
+  // after the release the next sample can be pinned again
+  EXPECT_TRUE(pub.Send("next"));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+  {
+    const std::lock_guard<std::mutex> lock(samples_mtx);
+    ASSERT_EQ(1, pinned_samples.size());
+    EXPECT_EQ("next", std::string(static_cast<const char*>(pinned_samples.front().GetBuffer()), pinned_samples.front().GetBufferSize()));
+    pinned_samples.clear();
+    copied_samples.clear();
+  }
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, ReceiveSampleOutlivesConnectionSHM)
+{
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  const std::string send_s = "pinned sample of a dropped publisher";
+  eCAL::CReceiveSample pinned_sample;
+  {
+    // create subscriber for topic "A" pinning ring samples (default configuration)
+    eCAL::CSubscriber sub("A");
+
+    // create ring buffer memory file publisher for topic "A"
+    eCAL::Publisher::Configuration pub_config;
+    pub_config.layer.shm.enable             = true;
+    pub_config.layer.udp.enable             = false;
+    pub_config.layer.tcp.enable             = false;
+    pub_config.layer.shm.memfile_ring_slots = 4;
+    auto pub = std::make_unique<eCAL::CPublisher>("A", eCAL::SDataTypeInformation(), pub_config);
+
+    std::mutex sample_mtx;
+    sub.SetReceiveSampleCallback([&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::CReceiveSample& sample_)
+      {
+        const std::lock_guard<std::mutex> lock(sample_mtx);
+        pinned_sample = sample_;
+      });
+
+    // let's match them
+    eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+    EXPECT_TRUE(pub->Send(send_s));
+    eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+
+    {
+      const std::lock_guard<std::mutex> lock(sample_mtx);
+      ASSERT_TRUE(pinned_sample.IsValid());
+      EXPECT_TRUE(pinned_sample.IsPinned());
+    }
+
+    // drop the publisher while the sample is pinned, it removes its memory file
+    pub.reset();
+    eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+    // and the subscriber, that stops observing the memory file
+    sub.RemoveReceiveCallback();
+  }
+
+  // the sample still points into the (unlinked, but still mapped) memory file
+  EXPECT_EQ(send_s, std::string(static_cast<const char*>(pinned_sample.GetBuffer()), pinned_sample.GetBufferSize()));
+
+  // finalize eCAL API
+  eCAL::Finalize();
+
+  // even after finalization
+  EXPECT_EQ(send_s, std::string(static_cast<const char*>(pinned_sample.GetBuffer()), pinned_sample.GetBufferSize()));
+  pinned_sample.Release();
+}
+
+TEST(core_cpp_pubsub, ReceiveSampleDoesNotBlockPublisherSHM)
+{
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // classic memory file (samples are copied) and ring buffer memory file (samples are pinned)
+  for (const unsigned int ring_slots : { 0U, 4U })
+  {
+    // create subscriber for topic "A" pinning ring samples (default configuration)
+    eCAL::CSubscriber sub("A");
+
+    // create publisher for topic "A" (shm only)
+    eCAL::Publisher::Configuration pub_config;
+    pub_config.layer.shm.enable             = true;
+    pub_config.layer.udp.enable             = false;
+    pub_config.layer.tcp.enable             = false;
+    pub_config.layer.shm.zero_copy_mode     = true;
+    pub_config.layer.shm.memfile_ring_slots = ring_slots;
+    eCAL::CPublisher pub("A", {}, pub_config);
+
+    // hold the first sample, count all of them
+    std::mutex           received_mtx;
+    eCAL::CReceiveSample held_sample;
+    size_t               received_count(0);
+    sub.SetReceiveSampleCallback([&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::CReceiveSample& sample_)
+      {
+        const std::lock_guard<std::mutex> lock(received_mtx);
+        if (!held_sample.IsValid()) held_sample = sample_;
+        received_count++;
+      });
+
+    // let's match them
+    eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+    // keep sending while the first sample is held for more than the memory file open timeout (200 ms),
+    // a publisher waiting for the held sample would recreate its memory file and lose samples
+    const size_t send_count = 40;
+    std::chrono::steady_clock::duration max_send_duration(0);
+    for (size_t i = 0; i < send_count; ++i)
+    {
+      const auto send_start = std::chrono::steady_clock::now();
+      EXPECT_TRUE(pub.Send(std::to_string(i)));
+      max_send_duration = std::max(max_send_duration, std::chrono::steady_clock::now() - send_start);
+      eCAL::Process::SleepMS(10);
+    }
+    eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+
+    EXPECT_LT(max_send_duration, std::chrono::milliseconds(100));
+    {
+      const std::lock_guard<std::mutex> lock(received_mtx);
+      EXPECT_EQ(send_count, received_count);
+      ASSERT_TRUE(held_sample.IsValid());
+      EXPECT_EQ(ring_slots > 0, held_sample.IsPinned());
+      EXPECT_EQ("0", std::string(static_cast<const char*>(held_sample.GetBuffer()), held_sample.GetBufferSize()));
+      held_sample.Release();
+    }
+  }
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, GrowingPayloadRingSHM)
+{
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber for topic "A"
+  eCAL::CSubscriber sub("A");
+
+  // create publisher for topic "A" (shm only) with a small ring, the ring is recreated for larger samples
+  eCAL::Publisher::Configuration pub_config;
+  pub_config.layer.shm.enable                 = true;
+  pub_config.layer.udp.enable                 = false;
+  pub_config.layer.tcp.enable                 = false;
+  pub_config.layer.shm.memfile_ring_slots     = 4;
+  pub_config.layer.shm.memfile_min_size_bytes = 4096;
+  eCAL::CPublisher pub("A", {}, pub_config);
+
+  std::mutex          received_mtx;
+  std::vector<size_t> received_sizes;
+  sub.SetReceiveCallback([&received_mtx, &received_sizes](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+    {
+      const std::lock_guard<std::mutex> lock(received_mtx);
+      received_sizes.push_back(data_.buffer_size);
+    });
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // every size step outgrows the ring, the following samples are sent faster than a subscriber could reattach
+  std::vector<size_t> send_sizes;
+  for (size_t size = 1024; size <= 1024 * 1024; size *= 4)
+  {
+    for (int i = 0; i < 3; ++i)
+    {
+      EXPECT_TRUE(pub.Send(std::string(size, 'x')));
+      send_sizes.push_back(size);
+      eCAL::Process::SleepMS(1);
+    }
+  }
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+
+  // no sample is lost, the first sample of a new ring waits until the subscriber has reattached
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    EXPECT_EQ(send_sizes, received_sizes);
+  }
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, HistoryLateJoinerSHM)
+{
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = true;
+  pub_config.layer.udp.enable = false;
+  pub_config.layer.tcp.enable = false;
+  // keep the last 3 samples for late joining subscribers
+  pub_config.history.depth = 3;
+
+  // create publisher for topic "A" and send samples nobody is listening to
+  eCAL::CPublisher pub("A", {}, pub_config);
+  for (int i = 0; i < 5; ++i)
+  {
+    pub.Send(std::to_string(i));
+  }
+
+  std::mutex               received_mtx;
+  std::vector<std::string> received;
+
+  // create the late joining subscriber for topic "A"
+  eCAL::CSubscriber sub("A");
+
+  // add callback
+  auto save_data = [&received_mtx, &received](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    received.emplace_back(static_cast<const char*>(data_.buffer), data_.buffer_size);
+  };
+  sub.SetReceiveCallback(save_data);
+
+  // let's match them and give the publisher the time to replay its history (repeated on layers without acknowledge)
+  eCAL::Process::SleepMS(5 * CMN_REGISTRATION_REFRESH_MS);
+
+  // the live samples follow the history
+  EXPECT_TRUE(pub.Send("5"));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+
+  // the last 3 samples are received once, in the right order
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    EXPECT_EQ(std::vector<std::string>({ "2", "3", "4", "5" }), received);
+  }
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, HistoryLateJoinerWhilePublishingSHM)
+{
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = true;
+  pub_config.layer.udp.enable = false;
+  pub_config.layer.tcp.enable = false;
+  // keep the last 3 samples for late joining subscribers
+  pub_config.history.depth = 3;
+
+  // create publisher for topic "A" and send samples nobody is listening to
+  eCAL::CPublisher pub("A", {}, pub_config);
+  for (int i = 0; i < 5; ++i)
+  {
+    pub.Send("history_" + std::to_string(i));
+  }
+
+  // keep on publishing while the subscriber connects, so it receives live samples before the history replay
+  std::atomic<bool> publishing(true);
+  std::thread publish_thread([&pub, &publishing]()
+    {
+      int live_count(0);
+      while (publishing)
+      {
+        pub.Send("live_" + std::to_string(live_count++));
+        eCAL::Process::SleepMS(10);
+      }
+    });
+
+  std::mutex               received_mtx;
+  std::vector<std::string> received;
+
+  // create the late joining subscriber for topic "A"
+  eCAL::CSubscriber sub("A");
+
+  // add callback
+  auto save_data = [&received_mtx, &received](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    received.emplace_back(static_cast<const char*>(data_.buffer), data_.buffer_size);
+  };
+  sub.SetReceiveCallback(save_data);
+
+  // let's match them and give the publisher the time to replay its history (repeated on layers without acknowledge)
+  eCAL::Process::SleepMS(5 * CMN_REGISTRATION_REFRESH_MS);
+
+  publishing = false;
+  publish_thread.join();
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+
+  // every history sample is received once, although live samples with a newer clock have been received before
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    for (const std::string history_sample : { "history_2", "history_3", "history_4" })
+    {
+      EXPECT_EQ(1, std::count(received.begin(), received.end(), history_sample)) << history_sample;
+    }
+    EXPECT_EQ(0, std::count(received.begin(), received.end(), "history_1"));
+  }
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
 TEST(core_cpp_pubsub, SubscriberFastReconnectionSHM) {
   /* Test setup :
    * publisher runs permanently in a thread
@@ -0,0 +1,92 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/ecal.h>
+#include <ecal/pubsub/publisher.h>
+#include <ecal/pubsub/subscriber.h>
+
+#include <mutex>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+enum {
+  CMN_REGISTRATION_REFRESH_MS = 1000,
+  DATA_FLOW_TIME_MS = 50,
+};
+
+TEST(core_cpp_pubsub, HistoryLateJoinerTCP)
+{
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = false;
+  pub_config.layer.udp.enable = false;
+  pub_config.layer.tcp.enable = true;
+  // keep the last 3 samples for late joining subscribers
+  pub_config.history.depth = 3;
+
+  // create publisher for topic "A" and send samples nobody is listening to
+  eCAL::CPublisher pub("A", {}, pub_config);
+  for (int i = 0; i < 5; ++i)
+  {
+    pub.Send(std::to_string(i));
+  }
+
+  std::mutex               received_mtx;
+  std::vector<std::string> received;
+
+  // create subscriber config
+  eCAL::Subscriber::Configuration sub_config;
+  // set transport layer
+  sub_config.layer.shm.enable = false;
+  sub_config.layer.udp.enable = false;
+  sub_config.layer.tcp.enable = true;
+
+  // create the late joining subscriber for topic "A"
+  eCAL::CSubscriber sub("A", {}, sub_config);
+
+  // add callback
+  auto save_data = [&received_mtx, &received](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    received.emplace_back(static_cast<const char*>(data_.buffer), data_.buffer_size);
+  };
+  sub.SetReceiveCallback(save_data);
+
+  // let's match them and give the publisher the time to replay its history (repeated on layers without acknowledge)
+  eCAL::Process::SleepMS(5 * CMN_REGISTRATION_REFRESH_MS);
+
+  // the live samples follow the history
+  EXPECT_TRUE(pub.Send("5"));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+
+  // the last 3 samples are received once, in the right order
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    EXPECT_EQ(std::vector<std::string>({ "2", "3", "4", "5" }), received);
+  }
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
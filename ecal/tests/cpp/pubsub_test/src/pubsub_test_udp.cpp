@@ -22,9 +22,12 @@
 #include <ecal/pubsub/publisher.h>
 #include <ecal/pubsub/subscriber.h>
 
+#include <algorithm>
 #include <atomic>
 #include <functional>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include <gtest/gtest.h>
 #include <vector>
@@ -136,3 +139,289 @@ TEST(core_cpp_pubsub, MultipleSendsUDP)
   // finalize eCAL API
   eCAL::Finalize();
 }
+
+TEST(core_cpp_pubsub, BatchedSendsUDP)
+{
+  // default send string
+  const std::vector<std::string> send_vector{ "this", "is", "a", "", "batched", "testtest" };
+  std::vector<std::string> received_msgs;
+  std::vector<long long>   received_timestamps;
+  std::mutex               received_mutex;
+
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber for topic "A"
+  eCAL::CSubscriber sub("A");
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = false;
+  pub_config.layer.udp.enable = true;
+  pub_config.layer.tcp.enable = false;
+  // collect all samples in one batch
+  pub_config.layer.udp.batching             = true;
+  pub_config.layer.udp.batch_max_size_bytes = 1200;
+  pub_config.layer.udp.batch_linger_time_us = 10 * 1000;
+
+  // create publisher for topic "A"
+  eCAL::CPublisher pub("A", {}, pub_config);
+
+  // add callback
+  auto save_data = [&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+  {
+    const std::lock_guard<std::mutex> lock(received_mutex);
+    received_msgs.emplace_back((const char*)data_.buffer, (size_t)data_.buffer_size);
+    received_timestamps.push_back(data_.send_timestamp);
+  };
+  sub.SetReceiveCallback(save_data);
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+  long long timestamp = 1;
+  for (const auto& elem : send_vector)
+  {
+    EXPECT_TRUE(pub.Send(elem, timestamp));
+    ++timestamp;
+  }
+
+  // wait for the linger time to expire
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+
+  // all samples are received in send order
+  {
+    const std::lock_guard<std::mutex> lock(received_mutex);
+    EXPECT_EQ(send_vector, received_msgs);
+    const std::vector<long long> expected_timestamps{ 1, 2, 3, 4, 5, 6 };
+    EXPECT_EQ(expected_timestamps, received_timestamps);
+  }
+
+  sub.RemoveReceiveCallback();
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, MultipleSendsUDPMmsg)
+{
+  // small and fragmented messages
+  const std::vector<std::string> send_vector{ "this", "is", "a", "", std::string(4 * 1024 * 1024, 'x'), "testtest" };
+  std::string last_received_msg;
+
+  // initialize eCAL API with the sendmmsg / recvmmsg udp backend (ignored on non linux systems)
+  auto config = eCAL::Init::Configuration();
+  config.transport_layer.udp.mmsg_enabled   = true;
+  config.transport_layer.udp.send_buffer    = 16 * 1024 * 1024;
+  config.transport_layer.udp.receive_buffer = 16 * 1024 * 1024;
+  eCAL::Initialize(config, "pubsub_test");
+
+  // create subscriber for topic "A"
+  eCAL::CSubscriber sub("A");
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = false;
+  pub_config.layer.udp.enable = true;
+  pub_config.layer.tcp.enable = false;
+
+  // create publisher for topic "A"
+  eCAL::CPublisher pub("A", {}, pub_config);
+
+  // add callback
+  std::mutex received_mutex;
+  auto save_data = [&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+  {
+    const std::lock_guard<std::mutex> lock(received_mutex);
+    last_received_msg = std::string{ (const char*)data_.buffer, (size_t)data_.buffer_size };
+  };
+  sub.SetReceiveCallback(save_data);
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+  for (const auto& elem : send_vector)
+  {
+    EXPECT_TRUE(pub.Send(elem));
+    eCAL::Process::SleepMS(2 * DATA_FLOW_TIME_MS);
+    const std::lock_guard<std::mutex> lock(received_mutex);
+    EXPECT_EQ(last_received_msg, elem);
+  }
+
+  sub.RemoveReceiveCallback();
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, ForwardErrorCorrectionSendsUDP)
+{
+  // small and large messages, every message is sent as data and parity blocks
+  const std::vector<std::string> send_vector{ "this", "is", "a", "", std::string(1024 * 1024, 'x'), "testtest" };
+  std::string last_received_msg;
+
+  // initialize eCAL API
+  auto config = eCAL::Init::Configuration();
+  config.transport_layer.udp.send_buffer    = 16 * 1024 * 1024;
+  config.transport_layer.udp.receive_buffer = 16 * 1024 * 1024;
+  eCAL::Initialize(config, "pubsub_test");
+
+  // create subscriber for topic "A"
+  eCAL::CSubscriber sub("A");
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = false;
+  pub_config.layer.udp.enable = true;
+  pub_config.layer.tcp.enable = false;
+  // add 25 % parity data
+  pub_config.layer.udp.fec_redundancy_percent = 25;
+
+  // create publisher for topic "A"
+  eCAL::CPublisher pub("A", {}, pub_config);
+
+  // add callback
+  std::mutex received_mutex;
+  auto save_data = [&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+  {
+    const std::lock_guard<std::mutex> lock(received_mutex);
+    last_received_msg = std::string{ (const char*)data_.buffer, (size_t)data_.buffer_size };
+  };
+  sub.SetReceiveCallback(save_data);
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+  for (const auto& elem : send_vector)
+  {
+    EXPECT_TRUE(pub.Send(elem));
+    eCAL::Process::SleepMS(2 * DATA_FLOW_TIME_MS);
+    const std::lock_guard<std::mutex> lock(received_mutex);
+    EXPECT_EQ(last_received_msg, elem);
+  }
+
+  sub.RemoveReceiveCallback();
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, HistoryLateJoinerUDP)
+{
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = false;
+  pub_config.layer.udp.enable = true;
+  pub_config.layer.tcp.enable = false;
+  // keep the last 3 samples for late joining subscribers
+  pub_config.history.depth = 3;
+
+  // create publisher for topic "A" and send samples nobody is listening to
+  eCAL::CPublisher pub("A", {}, pub_config);
+  for (int i = 0; i < 5; ++i)
+  {
+    pub.Send(std::to_string(i));
+  }
+
+  std::mutex               received_mtx;
+  std::vector<std::string> received;
+
+  // create the late joining subscriber for topic "A"
+  eCAL::CSubscriber sub("A");
+
+  // add callback
+  auto save_data = [&received_mtx, &received](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    received.emplace_back(static_cast<const char*>(data_.buffer), data_.buffer_size);
+  };
+  sub.SetReceiveCallback(save_data);
+
+  // let's match them and give the publisher the time to replay its history (repeated on layers without acknowledge)
+  eCAL::Process::SleepMS(5 * CMN_REGISTRATION_REFRESH_MS);
+
+  // the live samples follow the history
+  EXPECT_TRUE(pub.Send("5"));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+
+  // the last 3 samples are received once, in the right order
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    EXPECT_EQ(std::vector<std::string>({ "2", "3", "4", "5" }), received);
+  }
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, HistoryLateJoinerWhilePublishingUDP)
+{
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = false;
+  pub_config.layer.udp.enable = true;
+  pub_config.layer.tcp.enable = false;
+  // keep the last 3 samples for late joining subscribers
+  pub_config.history.depth = 3;
+
+  // create publisher for topic "A" and send samples nobody is listening to
+  eCAL::CPublisher pub("A", {}, pub_config);
+  for (int i = 0; i < 5; ++i)
+  {
+    pub.Send("history_" + std::to_string(i));
+  }
+
+  // keep on publishing while the subscriber connects, so it receives live samples before the history replay
+  std::atomic<bool> publishing(true);
+  std::thread publish_thread([&pub, &publishing]()
+    {
+      int live_count(0);
+      while (publishing)
+      {
+        pub.Send("live_" + std::to_string(live_count++));
+        eCAL::Process::SleepMS(10);
+      }
+    });
+
+  std::mutex               received_mtx;
+  std::vector<std::string> received;
+
+  // create the late joining subscriber for topic "A"
+  eCAL::CSubscriber sub("A");
+
+  // add callback
+  auto save_data = [&received_mtx, &received](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    received.emplace_back(static_cast<const char*>(data_.buffer), data_.buffer_size);
+  };
+  sub.SetReceiveCallback(save_data);
+
+  // let's match them and give the publisher the time to replay its history (repeated on layers without acknowledge)
+  eCAL::Process::SleepMS(5 * CMN_REGISTRATION_REFRESH_MS);
+
+  publishing = false;
+  publish_thread.join();
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+
+  // every history sample is received once, although live samples with a newer clock have been received before
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    for (const std::string history_sample : { "history_2", "history_3", "history_4" })
+    {
+      EXPECT_EQ(1, std::count(received.begin(), received.end(), history_sample)) << history_sample;
+    }
+    EXPECT_EQ(0, std::count(received.begin(), received.end(), "history_1"));
+  }
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
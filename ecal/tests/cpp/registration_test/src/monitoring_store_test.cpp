@@ -0,0 +1,223 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "monitoring/ecal_monitoring_store.h"
+#include "serialization/ecal_struct_sample_registration.h"
+
+namespace
+{
+  eCAL::Registration::Sample CreateTopicSample(eCAL::eCmdType cmd_type_, eCAL::EntityIdT entity_id_)
+  {
+    eCAL::Registration::Sample sample;
+    sample.cmd_type = cmd_type_;
+    sample.identifier.host_name = "host0";
+    sample.identifier.process_id = 1000;
+    sample.identifier.entity_id = entity_id_;
+    sample.topic.process_name = "process_a";
+    sample.topic.topic_name = "topic_" + std::to_string(entity_id_);
+    sample.topic.datatype_information = { "a", "b", "c" };
+    sample.topic.data_clock = 1;
+    return sample;
+  }
+
+  eCAL::Registration::Sample CreateProcessSample(eCAL::EntityIdT entity_id_)
+  {
+    eCAL::Registration::Sample sample;
+    sample.cmd_type = eCAL::bct_reg_process;
+    sample.identifier.host_name = "host0";
+    sample.identifier.process_id = static_cast<int32_t>(entity_id_);
+    sample.identifier.entity_id = entity_id_;
+    sample.process.process_name = "process_a";
+    return sample;
+  }
+}
+
+TEST(core_cpp_monitoring_store, FullStateForUnknownGeneration)
+{
+  eCAL::Monitoring::CMonitoringStore store;
+  store.ApplySample(CreateProcessSample(1));
+  store.ApplySample(CreateTopicSample(eCAL::bct_reg_publisher, 2));
+  store.ApplySample(CreateTopicSample(eCAL::bct_reg_subscriber, 3));
+
+  eCAL::Monitoring::SMonitoringChanges changes;
+  store.GetMonitoringChanges(changes, 0, eCAL::Monitoring::Entity::All);
+  EXPECT_TRUE(changes.full_state);
+  EXPECT_EQ(changes.generation, store.GetGeneration());
+  EXPECT_EQ(changes.monitoring.processes.size(), 1U);
+  EXPECT_EQ(changes.monitoring.publishers.size(), 1U);
+  EXPECT_EQ(changes.monitoring.subscribers.size(), 1U);
+  EXPECT_EQ(changes.monitoring.subscribers[0].direction, "subscriber");
+
+  // a generation this store never handed out
+  store.GetMonitoringChanges(changes, store.GetGeneration() + 1, eCAL::Monitoring::Entity::All);
+  EXPECT_TRUE(changes.full_state);
+  EXPECT_EQ(changes.monitoring.publishers.size(), 1U);
+}
+
+TEST(core_cpp_monitoring_store, FullStateForGenerationOfAnotherStore)
+{
+  // the store of a former initialization
+  eCAL::Monitoring::SMonitoringChanges changes;
+  uint64_t former_generation(0);
+  {
+    eCAL::Monitoring::CMonitoringStore former_store;
+    former_store.ApplySample(CreateTopicSample(eCAL::bct_reg_publisher, 1));
+    former_store.GetMonitoringChanges(changes, 0, eCAL::Monitoring::Entity::All);
+    former_generation = changes.generation;
+  }
+
+  // the new store has seen more changes than the former one
+  eCAL::Monitoring::CMonitoringStore store;
+  store.ApplySample(CreateTopicSample(eCAL::bct_reg_publisher, 2));
+  store.ApplySample(CreateTopicSample(eCAL::bct_reg_publisher, 3));
+  store.ApplySample(CreateTopicSample(eCAL::bct_reg_publisher, 4));
+  EXPECT_NE(former_generation, store.GetGeneration());
+
+  store.GetMonitoringChanges(changes, former_generation, eCAL::Monitoring::Entity::All);
+  EXPECT_TRUE(changes.full_state);
+  EXPECT_EQ(changes.monitoring.publishers.size(), 3U);
+  EXPECT_EQ(changes.generation, store.GetGeneration());
+
+  // the handed out generation is known to the new store
+  store.GetMonitoringChanges(changes, changes.generation, eCAL::Monitoring::Entity::All);
+  EXPECT_FALSE(changes.full_state);
+  EXPECT_TRUE(changes.monitoring.publishers.empty());
+}
+
+TEST(core_cpp_monitoring_store, OnlyChangedEntities)
+{
+  eCAL::Monitoring::CMonitoringStore store;
+  auto pub1 = CreateTopicSample(eCAL::bct_reg_publisher, 1);
+  auto pub2 = CreateTopicSample(eCAL::bct_reg_publisher, 2);
+  store.ApplySample(pub1);
+  store.ApplySample(pub2);
+
+  eCAL::Monitoring::SMonitoringChanges changes;
+  store.GetMonitoringChanges(changes, 0, eCAL::Monitoring::Entity::All);
+  const uint64_t generation = changes.generation;
+
+  // a registration without changes is no change, even if the registration clock moves on
+  pub1.topic.registration_clock++;
+  store.ApplySample(pub1);
+  store.GetMonitoringChanges(changes, generation, eCAL::Monitoring::Entity::All);
+  EXPECT_FALSE(changes.full_state);
+  EXPECT_EQ(changes.generation, generation);
+  EXPECT_TRUE(changes.monitoring.publishers.empty());
+
+  // the data clock is
+  pub2.topic.data_clock++;
+  store.ApplySample(pub2);
+  store.GetMonitoringChanges(changes, generation, eCAL::Monitoring::Entity::All);
+  EXPECT_FALSE(changes.full_state);
+  EXPECT_GT(changes.generation, generation);
+  ASSERT_EQ(changes.monitoring.publishers.size(), 1U);
+  EXPECT_EQ(changes.monitoring.publishers[0].topic_id, 2U);
+  EXPECT_EQ(changes.monitoring.publishers[0].data_clock, 2);
+
+  // entities that were not asked for are not reported
+  store.GetMonitoringChanges(changes, generation, eCAL::Monitoring::Entity::Subscriber);
+  EXPECT_TRUE(changes.monitoring.publishers.empty());
+}
+
+TEST(core_cpp_monitoring_store, RemovedEntities)
+{
+  eCAL::Monitoring::CMonitoringStore store;
+  store.ApplySample(CreateTopicSample(eCAL::bct_reg_subscriber, 1));
+  store.ApplySample(CreateTopicSample(eCAL::bct_reg_subscriber, 2));
+
+  eCAL::Monitoring::SMonitoringChanges changes;
+  store.GetMonitoringChanges(changes, 0, eCAL::Monitoring::Entity::All);
+  const uint64_t generation = changes.generation;
+
+  store.ApplySample(CreateTopicSample(eCAL::bct_unreg_subscriber, 1));
+  store.GetMonitoringChanges(changes, generation, eCAL::Monitoring::Entity::All);
+  EXPECT_FALSE(changes.full_state);
+  EXPECT_TRUE(changes.monitoring.subscribers.empty());
+  ASSERT_EQ(changes.removed_subscribers.size(), 1U);
+  EXPECT_EQ(changes.removed_subscribers[0], 1U);
+
+  // registered again, removal and registration are both reported
+  store.ApplySample(CreateTopicSample(eCAL::bct_reg_subscriber, 1));
+  store.GetMonitoringChanges(changes, generation, eCAL::Monitoring::Entity::All);
+  EXPECT_EQ(changes.removed_subscribers.size(), 1U);
+  EXPECT_EQ(changes.monitoring.subscribers.size(), 1U);
+
+  eCAL::Monitoring::SMonitoring monitoring;
+  store.GetMonitoring(monitoring, eCAL::Monitoring::Entity::All);
+  EXPECT_EQ(monitoring.subscribers.size(), 2U);
+}
+
+TEST(core_cpp_monitoring_store, ForgottenRemovalsFallBackToFullState)
+{
+  using TopicShards = eCAL::Monitoring::CEntityShards<eCAL::Monitoring::STopic>;
+  const size_t topic_count = TopicShards::shard_count * TopicShards::removed_history_size * 2;
+
+  eCAL::Monitoring::CMonitoringStore store;
+  store.ApplySample(CreateTopicSample(eCAL::bct_reg_publisher, 1));
+
+  eCAL::Monitoring::SMonitoringChanges changes;
+  store.GetMonitoringChanges(changes, 0, eCAL::Monitoring::Entity::All);
+  const uint64_t generation = changes.generation;
+
+  for (eCAL::EntityIdT id = 100; id < 100 + topic_count; ++id)
+  {
+    store.ApplySample(CreateTopicSample(eCAL::bct_reg_publisher, id));
+    store.ApplySample(CreateTopicSample(eCAL::bct_unreg_publisher, id));
+  }
+
+  store.GetMonitoringChanges(changes, generation, eCAL::Monitoring::Entity::All);
+  EXPECT_TRUE(changes.full_state);
+  EXPECT_TRUE(changes.removed_publishers.empty());
+  EXPECT_EQ(changes.monitoring.publishers.size(), 1U);
+}
+
+TEST(core_cpp_monitoring_store, ConcurrentRegistrations)
+{
+  const size_t thread_count = 4;
+  const size_t topics_per_thread = 1000;
+
+  eCAL::Monitoring::CMonitoringStore store;
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < thread_count; ++t)
+  {
+    threads.emplace_back([&store, t, topics_per_thread]()
+      {
+        for (size_t i = 0; i < topics_per_thread; ++i)
+        {
+          store.ApplySample(CreateTopicSample(eCAL::bct_reg_publisher, t * topics_per_thread + i + 1));
+        }
+      });
+  }
+
+  // read while registering
+  eCAL::Monitoring::SMonitoring monitoring;
+  store.GetMonitoring(monitoring, eCAL::Monitoring::Entity::All);
+
+  for (auto& thread : threads) thread.join();
+
+  store.GetMonitoring(monitoring, eCAL::Monitoring::Entity::All);
+  EXPECT_EQ(monitoring.publishers.size(), thread_count * topics_per_thread);
+  EXPECT_EQ(store.GetChangeCount(), thread_count * topics_per_thread);
+}
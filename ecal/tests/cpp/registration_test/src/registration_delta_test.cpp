@@ -0,0 +1,313 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <chrono>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ecal_def.h"
+#include "registration/ecal_registration_delta.h"
+#include "serialization/ecal_struct_sample_registration.h"
+
+namespace
+{
+  class DeltaTestingClock {
+  public:
+    using duration = std::chrono::milliseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<DeltaTestingClock>;
+    static const bool is_steady = false;
+
+    static time_point now() noexcept {
+      return time_point(current_time);
+    }
+
+    static void set_time(const time_point& tp) {
+      current_time = tp.time_since_epoch();
+    }
+
+    static void increment_time(const duration& d) {
+      current_time += d;
+    }
+
+  private:
+    static duration current_time;
+  };
+
+  DeltaTestingClock::duration DeltaTestingClock::current_time{ 0 };
+
+  using DeltaProvider = eCAL::Registration::CDeltaProvider<DeltaTestingClock>;
+  using DeltaReceiver = eCAL::Registration::CDeltaReceiver<DeltaTestingClock>;
+
+  eCAL::Registration::Sample CreatePublisherSample()
+  {
+    eCAL::Registration::Sample sample;
+    sample.cmd_type = eCAL::bct_reg_publisher;
+    sample.identifier.host_name = "host0";
+    sample.identifier.process_id = 1000;
+    sample.identifier.entity_id = 42;
+    sample.topic.shm_transport_domain = "host0";
+    sample.topic.process_name = "process_a";
+    sample.topic.topic_name = "foo";
+    sample.topic.direction = "publisher";
+    sample.topic.datatype_information = { "a", "b", "c" };
+    sample.topic.topic_size = 100;
+    sample.topic.registration_clock = 1;
+    sample.topic.data_clock = 1;
+    sample.topic.data_frequency = 10;
+    return sample;
+  }
+
+  // next registration cycle of an unchanged entity
+  eCAL::Registration::Sample NextCycle(const eCAL::Registration::Sample& sample_)
+  {
+    eCAL::Registration::Sample next = sample_;
+    next.topic.registration_clock++;
+    return next;
+  }
+
+  // runs one registration cycle of the provider with a single sample
+  eCAL::Registration::Sample SendCycle(DeltaProvider& provider_, const eCAL::Registration::Sample& sample_)
+  {
+    eCAL::Registration::SampleList sample_list;
+    sample_list.push_back(sample_);
+    provider_.ApplySampleList(sample_list);
+    return sample_list[0];
+  }
+
+  class core_cpp_registration_delta : public ::testing::Test {
+  protected:
+    void SetUp() override {
+      DeltaTestingClock::set_time(DeltaTestingClock::time_point(std::chrono::milliseconds(0)));
+    }
+  };
+}
+
+TEST_F(core_cpp_registration_delta, DisabledSendsFullState)
+{
+  DeltaProvider provider(false, 10, std::chrono::seconds(10));
+
+  auto sample = CreatePublisherSample();
+  for (int i = 0; i < 3; ++i)
+  {
+    const auto sent = SendCycle(provider, sample);
+    EXPECT_EQ(sent.cmd_type, eCAL::bct_reg_publisher);
+    EXPECT_EQ(sent.protocol_version, REGISTRATION_PROTOCOL_VERSION);
+    EXPECT_EQ(sent.generation, 0U);
+    sample = NextCycle(sample);
+  }
+}
+
+TEST_F(core_cpp_registration_delta, FullStateThenHeartbeats)
+{
+  DeltaProvider provider(true, 10, std::chrono::seconds(10));
+
+  auto sample = CreatePublisherSample();
+  const auto first = SendCycle(provider, sample);
+  EXPECT_EQ(first.cmd_type, eCAL::bct_reg_publisher);
+  EXPECT_EQ(first.generation, 1U);
+  EXPECT_EQ(first.topic.topic_name, "foo");
+
+  for (int i = 0; i < 5; ++i)
+  {
+    sample = NextCycle(sample);
+    const auto heartbeat = SendCycle(provider, sample);
+    EXPECT_EQ(heartbeat.cmd_type, eCAL::bct_reg_heartbeat);
+    EXPECT_EQ(heartbeat.protocol_version, REGISTRATION_PROTOCOL_VERSION);
+    EXPECT_EQ(heartbeat.generation, 1U);
+    EXPECT_EQ(heartbeat.identifier, sample.identifier);
+    EXPECT_TRUE(heartbeat.topic.topic_name.empty());
+  }
+}
+
+TEST_F(core_cpp_registration_delta, StructureChangeSendsFullState)
+{
+  DeltaProvider provider(true, 10, std::chrono::seconds(10));
+
+  auto sample = CreatePublisherSample();
+  SendCycle(provider, sample);
+
+  sample = NextCycle(sample);
+  sample.topic.topic_size = 200;
+  const auto changed = SendCycle(provider, sample);
+  EXPECT_EQ(changed.cmd_type, eCAL::bct_reg_publisher);
+  EXPECT_EQ(changed.generation, 2U);
+  EXPECT_EQ(changed.topic.topic_size, 200);
+
+  sample = NextCycle(sample);
+  const auto heartbeat = SendCycle(provider, sample);
+  EXPECT_EQ(heartbeat.cmd_type, eCAL::bct_reg_heartbeat);
+  EXPECT_EQ(heartbeat.generation, 2U);
+}
+
+TEST_F(core_cpp_registration_delta, StatisticsChangeIsDelayed)
+{
+  const unsigned int statistics_cycles = 3;
+  DeltaProvider provider(true, statistics_cycles, std::chrono::seconds(10));
+
+  auto sample = CreatePublisherSample();
+  SendCycle(provider, sample);
+
+  // data clock changes every cycle, the full state is sent every statistics_cycles cycles
+  for (unsigned int i = 1; i < statistics_cycles; ++i)
+  {
+    sample = NextCycle(sample);
+    sample.topic.data_clock++;
+    const auto heartbeat = SendCycle(provider, sample);
+    EXPECT_EQ(heartbeat.cmd_type, eCAL::bct_reg_heartbeat);
+    EXPECT_EQ(heartbeat.generation, 1U);
+  }
+
+  sample = NextCycle(sample);
+  sample.topic.data_clock++;
+  const auto statistics = SendCycle(provider, sample);
+  EXPECT_EQ(statistics.cmd_type, eCAL::bct_reg_publisher);
+  EXPECT_EQ(statistics.generation, 2U);
+  EXPECT_EQ(statistics.topic.data_clock, sample.topic.data_clock);
+}
+
+TEST_F(core_cpp_registration_delta, RequestFullState)
+{
+  DeltaProvider provider(true, 10, std::chrono::seconds(10));
+
+  auto sample = CreatePublisherSample();
+  SendCycle(provider, sample);
+
+  provider.RequestFullState();
+
+  // unchanged entity is sent in full with its current generation, only once
+  sample = NextCycle(sample);
+  const auto requested = SendCycle(provider, sample);
+  EXPECT_EQ(requested.cmd_type, eCAL::bct_reg_publisher);
+  EXPECT_EQ(requested.generation, 1U);
+
+  sample = NextCycle(sample);
+  const auto heartbeat = SendCycle(provider, sample);
+  EXPECT_EQ(heartbeat.cmd_type, eCAL::bct_reg_heartbeat);
+  EXPECT_EQ(heartbeat.generation, 1U);
+}
+
+TEST_F(core_cpp_registration_delta, LegacyPeerForcesFullState)
+{
+  DeltaProvider provider(true, 10, std::chrono::seconds(5));
+
+  auto sample = CreatePublisherSample();
+  SendCycle(provider, sample);
+
+  provider.RegisterLegacyPeer();
+  for (int i = 0; i < 3; ++i)
+  {
+    DeltaTestingClock::increment_time(std::chrono::seconds(1));
+    sample = NextCycle(sample);
+    const auto full = SendCycle(provider, sample);
+    EXPECT_EQ(full.cmd_type, eCAL::bct_reg_publisher);
+    EXPECT_EQ(full.generation, 1U);
+  }
+
+  // legacy peer was not seen within the timeout
+  DeltaTestingClock::increment_time(std::chrono::seconds(5));
+  sample = NextCycle(sample);
+  const auto heartbeat = SendCycle(provider, sample);
+  EXPECT_EQ(heartbeat.cmd_type, eCAL::bct_reg_heartbeat);
+}
+
+TEST_F(core_cpp_registration_delta, UnregisteredEntityStartsOver)
+{
+  DeltaProvider provider(true, 10, std::chrono::seconds(10));
+
+  auto sample = CreatePublisherSample();
+  SendCycle(provider, sample);
+
+  // entity missing in one cycle
+  eCAL::Registration::SampleList empty_list;
+  provider.ApplySampleList(empty_list);
+
+  sample = NextCycle(sample);
+  const auto full = SendCycle(provider, sample);
+  EXPECT_EQ(full.cmd_type, eCAL::bct_reg_publisher);
+  EXPECT_EQ(full.generation, 1U);
+}
+
+TEST_F(core_cpp_registration_delta, ReceiverResolvesHeartbeats)
+{
+  std::vector<eCAL::Registration::Sample> applied_samples;
+  std::vector<eCAL::Registration::Sample> request_samples;
+  DeltaReceiver receiver(std::chrono::seconds(5), std::chrono::seconds(1),
+    [&applied_samples](const eCAL::Registration::Sample& sample_) { applied_samples.push_back(sample_); return true; },
+    [&request_samples](const eCAL::Registration::Sample& sample_) { request_samples.push_back(sample_); return true; });
+
+  DeltaProvider provider(true, 10, std::chrono::seconds(10));
+
+  auto sample = CreatePublisherSample();
+  const auto full = SendCycle(provider, sample);
+  EXPECT_TRUE(receiver.ApplySample(full));
+
+  sample = NextCycle(sample);
+  const auto heartbeat = SendCycle(provider, sample);
+  ASSERT_EQ(heartbeat.cmd_type, eCAL::bct_reg_heartbeat);
+  EXPECT_TRUE(receiver.ApplySample(heartbeat));
+
+  // the heartbeat is applied as the cached full state
+  ASSERT_EQ(applied_samples.size(), 2U);
+  EXPECT_EQ(applied_samples[1], full);
+  EXPECT_TRUE(request_samples.empty());
+}
+
+TEST_F(core_cpp_registration_delta, ReceiverRequestsFullStateOnMismatch)
+{
+  std::vector<eCAL::Registration::Sample> applied_samples;
+  std::vector<eCAL::Registration::Sample> request_samples;
+  DeltaReceiver receiver(std::chrono::seconds(5), std::chrono::seconds(1),
+    [&applied_samples](const eCAL::Registration::Sample& sample_) { applied_samples.push_back(sample_); return true; },
+    [&request_samples](const eCAL::Registration::Sample& sample_) { request_samples.push_back(sample_); return true; });
+
+  DeltaProvider provider(true, 10, std::chrono::seconds(10));
+
+  // we missed the full state
+  auto sample = CreatePublisherSample();
+  SendCycle(provider, sample);
+  sample = NextCycle(sample);
+  const auto heartbeat = SendCycle(provider, sample);
+
+  EXPECT_FALSE(receiver.ApplySample(heartbeat));
+  EXPECT_FALSE(receiver.ApplySample(heartbeat));
+  EXPECT_TRUE(applied_samples.empty());
+
+  // requested once per request interval
+  ASSERT_EQ(request_samples.size(), 1U);
+  EXPECT_EQ(request_samples[0].cmd_type, eCAL::bct_reg_request);
+  EXPECT_EQ(request_samples[0].identifier.process_id, sample.identifier.process_id);
+  EXPECT_EQ(request_samples[0].identifier.host_name, sample.identifier.host_name);
+
+  DeltaTestingClock::increment_time(std::chrono::seconds(2));
+  EXPECT_FALSE(receiver.ApplySample(heartbeat));
+  EXPECT_EQ(request_samples.size(), 2U);
+
+  // the provider answers the request with the full state
+  provider.RequestFullState();
+  sample = NextCycle(sample);
+  EXPECT_TRUE(receiver.ApplySample(SendCycle(provider, sample)));
+
+  sample = NextCycle(sample);
+  EXPECT_TRUE(receiver.ApplySample(SendCycle(provider, sample)));
+  EXPECT_EQ(applied_samples.size(), 2U);
+  EXPECT_EQ(request_samples.size(), 2U);
+}
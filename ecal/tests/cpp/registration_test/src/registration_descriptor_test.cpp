@@ -0,0 +1,368 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ecal_def.h"
+#include "registration/ecal_registration_delta.h"
+#include "registration/ecal_registration_descriptor.h"
+#include "serialization/ecal_struct_sample_registration.h"
+#include "util/descriptor_hash.h"
+
+namespace
+{
+  class DescriptorTestingClock {
+  public:
+    using duration = std::chrono::milliseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<DescriptorTestingClock>;
+    static const bool is_steady = false;
+
+    static time_point now() noexcept {
+      return time_point(current_time);
+    }
+
+    static void set_time(const time_point& tp) {
+      current_time = tp.time_since_epoch();
+    }
+
+    static void increment_time(const duration& d) {
+      current_time += d;
+    }
+
+  private:
+    static duration current_time;
+  };
+
+  DescriptorTestingClock::duration DescriptorTestingClock::current_time{ 0 };
+
+  using DescriptorProvider = eCAL::Registration::CDescriptorProvider<DescriptorTestingClock>;
+  using DescriptorReceiver = eCAL::Registration::CDescriptorReceiver<DescriptorTestingClock>;
+
+  const std::string descriptor_a(1024, 'a');
+  const std::string descriptor_b(1024, 'b');
+
+  eCAL::Registration::Sample CreateTopicSample(eCAL::eCmdType cmd_type_, eCAL::EntityIdT entity_id_, const std::string& descriptor_)
+  {
+    eCAL::Registration::Sample sample;
+    sample.cmd_type = cmd_type_;
+    sample.identifier.host_name = "host0";
+    sample.identifier.process_id = 1000;
+    sample.identifier.entity_id = entity_id_;
+    sample.topic.process_name = "process_a";
+    sample.topic.topic_name = "topic_" + std::to_string(entity_id_);
+    sample.topic.datatype_information = { "pb.Type", "proto", descriptor_ };
+    return sample;
+  }
+
+  // runs one registration cycle of the provider
+  eCAL::Registration::SampleList SendCycle(DescriptorProvider& provider_, const std::vector<eCAL::Registration::Sample>& samples_)
+  {
+    eCAL::Registration::SampleList sample_list;
+    for (const auto& sample : samples_) sample_list.push_back(sample);
+    provider_.ApplySampleList(sample_list);
+    return sample_list;
+  }
+
+  size_t CountDescriptorSamples(const eCAL::Registration::SampleList& sample_list_)
+  {
+    size_t count = 0;
+    for (const auto& sample : sample_list_)
+    {
+      if (sample.cmd_type == eCAL::bct_reg_descriptor) ++count;
+    }
+    return count;
+  }
+
+  class core_cpp_registration_descriptor : public ::testing::Test {
+  protected:
+    void SetUp() override {
+      DescriptorTestingClock::set_time(DescriptorTestingClock::time_point(std::chrono::milliseconds(0)));
+    }
+  };
+}
+
+TEST_F(core_cpp_registration_descriptor, Hash)
+{
+  EXPECT_EQ(eCAL::Util::ComputeDescriptorHash(""), 0U);
+  EXPECT_NE(eCAL::Util::ComputeDescriptorHash(descriptor_a), 0U);
+  EXPECT_EQ(eCAL::Util::ComputeDescriptorHash(descriptor_a), eCAL::Util::ComputeDescriptorHash(std::string(1024, 'a')));
+  EXPECT_NE(eCAL::Util::ComputeDescriptorHash(descriptor_a), eCAL::Util::ComputeDescriptorHash(descriptor_b));
+  // the hash is part of the protocol, it must be the same on all platforms (FNV-1a 64 of "a")
+  EXPECT_EQ(eCAL::Util::ComputeDescriptorHash("a"), 0xaf63dc4c8601ec8cULL);
+}
+
+TEST_F(core_cpp_registration_descriptor, DisabledKeepsDescriptors)
+{
+  DescriptorProvider provider(false, std::chrono::seconds(10));
+
+  const auto sent = SendCycle(provider, { CreateTopicSample(eCAL::bct_reg_publisher, 1, descriptor_a) });
+  ASSERT_EQ(sent.size(), 1U);
+  EXPECT_EQ(sent[0].topic.datatype_information.descriptor, descriptor_a);
+  EXPECT_EQ(sent[0].topic.datatype_descriptor_hash, 0U);
+}
+
+TEST_F(core_cpp_registration_descriptor, DescriptorSentOnce)
+{
+  DescriptorProvider provider(true, std::chrono::seconds(10));
+  const std::vector<eCAL::Registration::Sample> samples{
+    CreateTopicSample(eCAL::bct_reg_publisher,  1, descriptor_a),
+    CreateTopicSample(eCAL::bct_reg_subscriber, 2, descriptor_a),
+    CreateTopicSample(eCAL::bct_reg_publisher,  3, descriptor_b),
+  };
+
+  // first cycle, one descriptor sample per descriptor in front of the registrations
+  auto sent = SendCycle(provider, samples);
+  ASSERT_EQ(sent.size(), 5U);
+  EXPECT_EQ(CountDescriptorSamples(sent), 2U);
+  EXPECT_EQ(sent[0].cmd_type, eCAL::bct_reg_descriptor);
+  EXPECT_EQ(sent[0].topic.datatype_descriptor_hash, eCAL::Util::ComputeDescriptorHash(descriptor_a));
+  EXPECT_EQ(sent[0].topic.datatype_information.descriptor, descriptor_a);
+  EXPECT_EQ(sent[1].cmd_type, eCAL::bct_reg_descriptor);
+  EXPECT_EQ(sent[1].topic.datatype_information.descriptor, descriptor_b);
+  for (size_t i = 2; i < sent.size(); ++i)
+  {
+    EXPECT_EQ(sent[i].identifier, samples[i - 2].identifier);
+    EXPECT_TRUE(sent[i].topic.datatype_information.descriptor.empty());
+    EXPECT_EQ(sent[i].topic.datatype_information.name, "pb.Type");
+    EXPECT_EQ(sent[i].topic.datatype_descriptor_hash, eCAL::Util::ComputeDescriptorHash(samples[i - 2].topic.datatype_information.descriptor));
+  }
+
+  // following cycles, hashes only
+  sent = SendCycle(provider, samples);
+  ASSERT_EQ(sent.size(), 3U);
+  EXPECT_EQ(CountDescriptorSamples(sent), 0U);
+  EXPECT_TRUE(sent[0].topic.datatype_information.descriptor.empty());
+
+  // unregistrations are sent unchanged
+  sent = SendCycle(provider, { CreateTopicSample(eCAL::bct_unreg_publisher, 1, descriptor_a) });
+  ASSERT_EQ(sent.size(), 1U);
+  EXPECT_EQ(sent[0].topic.datatype_information.descriptor, descriptor_a);
+}
+
+TEST_F(core_cpp_registration_descriptor, RequestedDescriptorIsSentAgain)
+{
+  DescriptorProvider provider(true, std::chrono::seconds(10));
+  const std::vector<eCAL::Registration::Sample> samples{ CreateTopicSample(eCAL::bct_reg_publisher, 1, descriptor_a) };
+  SendCycle(provider, samples);
+
+  // unknown hashes are ignored
+  provider.RequestDescriptor(eCAL::Util::ComputeDescriptorHash(descriptor_a));
+  provider.RequestDescriptor(eCAL::Util::ComputeDescriptorHash(descriptor_a));
+  provider.RequestDescriptor(eCAL::Util::ComputeDescriptorHash(descriptor_b));
+
+  auto sent = SendCycle(provider, samples);
+  ASSERT_EQ(sent.size(), 2U);
+  EXPECT_EQ(sent[0].cmd_type, eCAL::bct_reg_publisher);
+  EXPECT_EQ(sent[1].cmd_type, eCAL::bct_reg_descriptor);
+  EXPECT_EQ(sent[1].topic.datatype_information.descriptor, descriptor_a);
+
+  sent = SendCycle(provider, samples);
+  EXPECT_EQ(CountDescriptorSamples(sent), 0U);
+}
+
+TEST_F(core_cpp_registration_descriptor, LegacyPeerGetsDescriptors)
+{
+  DescriptorProvider provider(true, std::chrono::seconds(10));
+  const std::vector<eCAL::Registration::Sample> samples{ CreateTopicSample(eCAL::bct_reg_publisher, 1, descriptor_a) };
+  SendCycle(provider, samples);
+
+  provider.RegisterLegacyPeer();
+  auto sent = SendCycle(provider, samples);
+  ASSERT_EQ(sent.size(), 1U);
+  EXPECT_EQ(sent[0].topic.datatype_information.descriptor, descriptor_a);
+  EXPECT_EQ(sent[0].topic.datatype_descriptor_hash, 0U);
+
+  // legacy peer gone, the descriptor is announced again
+  DescriptorTestingClock::increment_time(std::chrono::seconds(11));
+  sent = SendCycle(provider, samples);
+  ASSERT_EQ(sent.size(), 2U);
+  EXPECT_EQ(sent[0].cmd_type, eCAL::bct_reg_descriptor);
+  EXPECT_TRUE(sent[1].topic.datatype_information.descriptor.empty());
+}
+
+TEST_F(core_cpp_registration_descriptor, ReceiverResolvesDescriptors)
+{
+  std::vector<eCAL::Registration::Sample> applied;
+  std::vector<eCAL::Registration::Sample> requests;
+  DescriptorReceiver receiver(std::chrono::seconds(10), std::chrono::seconds(2),
+    [&applied](const eCAL::Registration::Sample& sample_) { applied.push_back(sample_); return true; },
+    [&requests](const eCAL::Registration::Sample& sample_) { requests.push_back(sample_); return true; });
+
+  DescriptorProvider provider(true, std::chrono::seconds(10));
+  const std::vector<eCAL::Registration::Sample> samples{
+    CreateTopicSample(eCAL::bct_reg_publisher,  1, descriptor_a),
+    CreateTopicSample(eCAL::bct_reg_subscriber, 2, descriptor_a),
+  };
+  for (const auto& sample : SendCycle(provider, samples)) receiver.ApplySample(sample);
+
+  // the descriptor sample itself is not forwarded
+  ASSERT_EQ(applied.size(), 2U);
+  EXPECT_TRUE(requests.empty());
+  for (size_t i = 0; i < applied.size(); ++i)
+  {
+    EXPECT_EQ(applied[i].identifier, samples[i].identifier);
+    EXPECT_EQ(applied[i].topic.datatype_information, samples[i].topic.datatype_information);
+  }
+
+  // hash only registrations of the next cycles are resolved from the cache
+  applied.clear();
+  for (const auto& sample : SendCycle(provider, samples)) receiver.ApplySample(sample);
+  ASSERT_EQ(applied.size(), 2U);
+  EXPECT_EQ(applied[0].topic.datatype_information.descriptor, descriptor_a);
+
+  // samples without descriptor hash are forwarded unchanged
+  applied.clear();
+  receiver.ApplySample(CreateTopicSample(eCAL::bct_reg_publisher, 3, descriptor_b));
+  ASSERT_EQ(applied.size(), 1U);
+  EXPECT_EQ(applied[0].topic.datatype_information.descriptor, descriptor_b);
+}
+
+TEST_F(core_cpp_registration_descriptor, ReceiverRequestsUnknownDescriptors)
+{
+  std::vector<eCAL::Registration::Sample> applied;
+  std::vector<eCAL::Registration::Sample> requests;
+  DescriptorReceiver receiver(std::chrono::seconds(10), std::chrono::seconds(2),
+    [&applied](const eCAL::Registration::Sample& sample_) { applied.push_back(sample_); return true; },
+    [&requests](const eCAL::Registration::Sample& sample_) { requests.push_back(sample_); return true; });
+
+  DescriptorProvider provider(true, std::chrono::seconds(10));
+  const std::vector<eCAL::Registration::Sample> samples{ CreateTopicSample(eCAL::bct_reg_publisher, 1, descriptor_a) };
+  auto sent = SendCycle(provider, samples);
+
+  // lost descriptor sample, the registration is applied without descriptor and the descriptor is requested
+  receiver.ApplySample(sent[1]);
+  receiver.ApplySample(sent[1]);
+  ASSERT_EQ(applied.size(), 2U);
+  EXPECT_TRUE(applied[0].topic.datatype_information.descriptor.empty());
+  EXPECT_EQ(applied[0].topic.datatype_information.name, "pb.Type");
+  ASSERT_EQ(requests.size(), 1U);
+  EXPECT_EQ(requests[0].cmd_type, eCAL::bct_reg_descriptor_request);
+  EXPECT_EQ(requests[0].identifier.process_id, 1000);
+  EXPECT_EQ(requests[0].identifier.host_name, "host0");
+  EXPECT_EQ(requests[0].topic.datatype_descriptor_hash, eCAL::Util::ComputeDescriptorHash(descriptor_a));
+
+  // requested again after the request interval
+  DescriptorTestingClock::increment_time(std::chrono::seconds(3));
+  receiver.ApplySample(sent[1]);
+  EXPECT_EQ(requests.size(), 2U);
+
+  // the provider answers the request
+  provider.RequestDescriptor(requests[0].topic.datatype_descriptor_hash);
+  applied.clear();
+  for (const auto& sample : SendCycle(provider, samples)) receiver.ApplySample(sample);
+  ASSERT_EQ(applied.size(), 1U);
+  EXPECT_TRUE(applied[0].topic.datatype_information.descriptor.empty());
+
+  applied.clear();
+  receiver.ApplySample(sent[1]);
+  ASSERT_EQ(applied.size(), 1U);
+  EXPECT_EQ(applied[0].topic.datatype_information.descriptor, descriptor_a);
+}
+
+TEST_F(core_cpp_registration_descriptor, ReceiverRejectsWrongHash)
+{
+  std::vector<eCAL::Registration::Sample> applied;
+  DescriptorReceiver receiver(std::chrono::seconds(10), std::chrono::seconds(2),
+    [&applied](const eCAL::Registration::Sample& sample_) { applied.push_back(sample_); return true; },
+    [](const eCAL::Registration::Sample& /*sample_*/) { return true; });
+
+  eCAL::Registration::Sample descriptor_sample;
+  eCAL::Registration::AssignDescriptorSample(descriptor_sample, eCAL::Util::ComputeDescriptorHash(descriptor_a), descriptor_b);
+  EXPECT_FALSE(receiver.ApplySample(descriptor_sample));
+
+  auto registration = CreateTopicSample(eCAL::bct_reg_publisher, 1, "");
+  registration.topic.datatype_descriptor_hash = eCAL::Util::ComputeDescriptorHash(descriptor_a);
+  receiver.ApplySample(registration);
+  ASSERT_EQ(applied.size(), 1U);
+  EXPECT_TRUE(applied[0].topic.datatype_information.descriptor.empty());
+}
+
+TEST_F(core_cpp_registration_descriptor, ReceiverForgetsUnusedDescriptors)
+{
+  std::vector<eCAL::Registration::Sample> applied;
+  DescriptorReceiver receiver(std::chrono::seconds(10), std::chrono::seconds(2),
+    [&applied](const eCAL::Registration::Sample& sample_) { applied.push_back(sample_); return true; },
+    [](const eCAL::Registration::Sample& /*sample_*/) { return true; });
+
+  DescriptorProvider provider(true, std::chrono::seconds(10));
+  const auto sent = SendCycle(provider, { CreateTopicSample(eCAL::bct_reg_publisher, 1, descriptor_a) });
+  for (const auto& sample : sent) receiver.ApplySample(sample);
+
+  // used descriptors stay
+  DescriptorTestingClock::increment_time(std::chrono::seconds(8));
+  receiver.ApplySample(sent[1]);
+  DescriptorTestingClock::increment_time(std::chrono::seconds(8));
+  receiver.CheckForTimeouts();
+  applied.clear();
+  receiver.ApplySample(sent[1]);
+  ASSERT_EQ(applied.size(), 1U);
+  EXPECT_EQ(applied[0].topic.datatype_information.descriptor, descriptor_a);
+
+  // unused descriptors are removed
+  DescriptorTestingClock::increment_time(std::chrono::seconds(11));
+  receiver.CheckForTimeouts();
+  applied.clear();
+  receiver.ApplySample(sent[1]);
+  ASSERT_EQ(applied.size(), 1U);
+  EXPECT_TRUE(applied[0].topic.datatype_information.descriptor.empty());
+}
+
+// descriptor hashing in front of delta registration, the cached full states of the delta receiver carry the hash only
+TEST_F(core_cpp_registration_descriptor, WithDeltaRegistration)
+{
+  std::vector<eCAL::Registration::Sample> applied;
+  DescriptorReceiver descriptor_receiver(std::chrono::seconds(10), std::chrono::seconds(2),
+    [&applied](const eCAL::Registration::Sample& sample_) { applied.push_back(sample_); return true; },
+    [](const eCAL::Registration::Sample& /*sample_*/) { return true; });
+  eCAL::Registration::CDeltaReceiver<DescriptorTestingClock> delta_receiver(std::chrono::seconds(10), std::chrono::seconds(2),
+    [&descriptor_receiver](const eCAL::Registration::Sample& sample_) { return descriptor_receiver.ApplySample(sample_); },
+    [](const eCAL::Registration::Sample& /*sample_*/) { return true; });
+
+  DescriptorProvider descriptor_provider(true, std::chrono::seconds(10));
+  eCAL::Registration::CDeltaProvider<DescriptorTestingClock> delta_provider(true, 10, std::chrono::seconds(10));
+
+  auto sample = CreateTopicSample(eCAL::bct_reg_publisher, 1, descriptor_a);
+  for (int cycle = 0; cycle < 3; ++cycle)
+  {
+    eCAL::Registration::SampleList sample_list;
+    sample_list.push_back(sample);
+    descriptor_provider.ApplySampleList(sample_list);
+    delta_provider.ApplySampleList(sample_list);
+
+    EXPECT_EQ(CountDescriptorSamples(sample_list), (cycle == 0) ? 1U : 0U);
+    if (cycle > 0)
+    {
+      ASSERT_EQ(sample_list.size(), 1U);
+      EXPECT_EQ(sample_list[0].cmd_type, eCAL::bct_reg_heartbeat);
+    }
+
+    applied.clear();
+    for (const auto& sent : sample_list) delta_receiver.ApplySample(sent);
+    ASSERT_EQ(applied.size(), 1U);
+    EXPECT_EQ(applied[0].topic.datatype_information.descriptor, descriptor_a);
+
+    sample.topic.registration_clock++;
+  }
+}
@@ -20,12 +20,69 @@
 #include "monitoring_compare.h"
 
 #include <cstddef>
+#include <vector>
 #include <ecal/types/monitoring.h>
 
 namespace eCAL
 {
   namespace Monitoring
   {
+    // compare two acknowledge statistics lists
+    bool CompareAcknowledgeStatistics(const std::vector<SAcknowledgeStatistics>& ack_statistics1, const std::vector<SAcknowledgeStatistics>& ack_statistics2)
+    {
+      if (ack_statistics1.size() != ack_statistics2.size())
+      {
+        return false;
+      }
+
+      for (size_t i = 0; i < ack_statistics1.size(); ++i)
+      {
+        if (ack_statistics1[i].process_id != ack_statistics2[i].process_id ||
+          ack_statistics1[i].acknowledge_count != ack_statistics2[i].acknowledge_count ||
+          ack_statistics1[i].timeout_count != ack_statistics2[i].timeout_count ||
+          ack_statistics1[i].latency.bucket_limits_us != ack_statistics2[i].latency.bucket_limits_us ||
+          ack_statistics1[i].latency.bucket_counts != ack_statistics2[i].latency.bucket_counts)
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    // compare two callback statistics
+    bool CompareCallbackStatistics(const SCallbackStatistics& callback_statistics1, const SCallbackStatistics& callback_statistics2)
+    {
+      return callback_statistics1.queue_size == callback_statistics2.queue_size &&
+        callback_statistics1.queue_depth == callback_statistics2.queue_depth &&
+        callback_statistics1.executed_count == callback_statistics2.executed_count &&
+        callback_statistics1.drop_count == callback_statistics2.drop_count &&
+        callback_statistics1.latency.bucket_limits_us == callback_statistics2.latency.bucket_limits_us &&
+        callback_statistics1.latency.bucket_counts == callback_statistics2.latency.bucket_counts;
+    }
+
+    // compare two latency statistics lists
+    bool CompareLatencyStatistics(const std::vector<SLatencyStatistics>& latency_statistics1, const std::vector<SLatencyStatistics>& latency_statistics2)
+    {
+      if (latency_statistics1.size() != latency_statistics2.size())
+      {
+        return false;
+      }
+
+      for (size_t i = 0; i < latency_statistics1.size(); ++i)
+      {
+        if (latency_statistics1[i].publisher_id != latency_statistics2[i].publisher_id ||
+          latency_statistics1[i].layer != latency_statistics2[i].layer ||
+          latency_statistics1[i].delivery_latency.bucket_limits_us != latency_statistics2[i].delivery_latency.bucket_limits_us ||
+          latency_statistics1[i].delivery_latency.bucket_counts != latency_statistics2[i].delivery_latency.bucket_counts ||
+          latency_statistics1[i].callback_latency.bucket_limits_us != latency_statistics2[i].callback_latency.bucket_limits_us ||
+          latency_statistics1[i].callback_latency.bucket_counts != latency_statistics2[i].callback_latency.bucket_counts)
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
     // compare two monitoring structs
     bool CompareMonitorings(const SMonitoring& monitoring1, const SMonitoring& monitoring2)
     {
@@ -84,7 +141,12 @@ namespace eCAL
           monitoring1.publishers[i].message_drops != monitoring2.publishers[i].message_drops ||
           monitoring1.publishers[i].data_id != monitoring2.publishers[i].data_id ||
           monitoring1.publishers[i].data_clock != monitoring2.publishers[i].data_clock ||
-          monitoring1.publishers[i].data_frequency != monitoring2.publishers[i].data_frequency)
+          monitoring1.publishers[i].data_frequency != monitoring2.publishers[i].data_frequency ||
+          monitoring1.publishers[i].fec_recovered_messages != monitoring2.publishers[i].fec_recovered_messages ||
+          monitoring1.publishers[i].fec_lost_messages != monitoring2.publishers[i].fec_lost_messages ||
+          !CompareAcknowledgeStatistics(monitoring1.publishers[i].acknowledge_statistics, monitoring2.publishers[i].acknowledge_statistics) ||
+          !CompareCallbackStatistics(monitoring1.publishers[i].callback_statistics, monitoring2.publishers[i].callback_statistics) ||
+          !CompareLatencyStatistics(monitoring1.publishers[i].latency_statistics, monitoring2.publishers[i].latency_statistics))
         {
           return false;
         }
@@ -115,7 +177,12 @@ namespace eCAL
           monitoring1.subscribers[i].message_drops != monitoring2.subscribers[i].message_drops ||
           monitoring1.subscribers[i].data_id != monitoring2.subscribers[i].data_id ||
           monitoring1.subscribers[i].data_clock != monitoring2.subscribers[i].data_clock ||
-          monitoring1.subscribers[i].data_frequency != monitoring2.subscribers[i].data_frequency)
+          monitoring1.subscribers[i].data_frequency != monitoring2.subscribers[i].data_frequency ||
+          monitoring1.subscribers[i].fec_recovered_messages != monitoring2.subscribers[i].fec_recovered_messages ||
+          monitoring1.subscribers[i].fec_lost_messages != monitoring2.subscribers[i].fec_lost_messages ||
+          !CompareAcknowledgeStatistics(monitoring1.subscribers[i].acknowledge_statistics, monitoring2.subscribers[i].acknowledge_statistics) ||
+          !CompareCallbackStatistics(monitoring1.subscribers[i].callback_statistics, monitoring2.subscribers[i].callback_statistics) ||
+          !CompareLatencyStatistics(monitoring1.subscribers[i].latency_statistics, monitoring2.subscribers[i].latency_statistics))
         {
           return false;
         }
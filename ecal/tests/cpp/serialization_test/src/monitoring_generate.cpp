@@ -51,6 +51,44 @@ namespace eCAL
       return process;
     }
 
+    // generate acknowledge statistics
+    SAcknowledgeStatistics GenerateAcknowledgeStatistics()
+    {
+      SAcknowledgeStatistics ack_statistics;
+      ack_statistics.process_id              = rand() % 1000;
+      ack_statistics.acknowledge_count       = rand() % 10000;
+      ack_statistics.timeout_count           = rand() % 10;
+      ack_statistics.latency.bucket_limits_us = { 10, 100, 1000 };
+      ack_statistics.latency.bucket_counts    = { rand() % 100, rand() % 100, rand() % 100, rand() % 100 };
+      return ack_statistics;
+    }
+
+    // generate callback statistics
+    SCallbackStatistics GenerateCallbackStatistics()
+    {
+      SCallbackStatistics callback_statistics;
+      callback_statistics.queue_size               = rand() % 10 + 1;
+      callback_statistics.queue_depth              = rand() % 10;
+      callback_statistics.executed_count           = rand() % 10000;
+      callback_statistics.drop_count               = rand() % 100;
+      callback_statistics.latency.bucket_limits_us = { 10, 100, 1000 };
+      callback_statistics.latency.bucket_counts    = { rand() % 100, rand() % 100, rand() % 100, rand() % 100 };
+      return callback_statistics;
+    }
+
+    // generate latency statistics
+    SLatencyStatistics GenerateLatencyStatistics()
+    {
+      SLatencyStatistics latency_statistics;
+      latency_statistics.publisher_id                      = rand();
+      latency_statistics.layer                             = eTransportLayerType::shm;
+      latency_statistics.delivery_latency.bucket_limits_us = { 10, 100, 1000 };
+      latency_statistics.delivery_latency.bucket_counts    = { rand() % 100, rand() % 100, rand() % 100, rand() % 100 };
+      latency_statistics.callback_latency.bucket_limits_us = { 10, 100, 1000 };
+      latency_statistics.callback_latency.bucket_counts    = { rand() % 100, rand() % 100, rand() % 100, rand() % 100 };
+      return latency_statistics;
+    }
+
     // generate topic
     STopic GenerateTopic(const std::string& direction)
     {
@@ -73,6 +111,18 @@ namespace eCAL
       topic.data_id              = rand() % 10000;
       topic.data_clock           = rand() % 10000;
       topic.data_frequency       = rand() % 100;
+      if (direction == "publisher")
+      {
+        topic.acknowledge_statistics.push_back(GenerateAcknowledgeStatistics());
+      }
+      else
+      {
+        topic.callback_statistics = GenerateCallbackStatistics();
+        topic.fec_recovered_messages = rand() % 100;
+        topic.fec_lost_messages      = rand() % 100;
+        topic.latency_statistics.push_back(GenerateLatencyStatistics());
+        topic.latency_statistics.push_back(GenerateLatencyStatistics());
+      }
       return topic;
     }
 
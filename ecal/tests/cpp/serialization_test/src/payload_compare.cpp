@@ -26,6 +26,51 @@ namespace eCAL
 {
   namespace Payload
   {
+    namespace
+    {
+      // compare two contents for equality
+      bool CompareContents(const Content& content1, const Content& content2)
+      {
+        if (content1.id    != content2.id ||
+            content1.clock != content2.clock ||
+            content1.time  != content2.time ||
+            content1.hash  != content2.hash ||
+            content1.size  != content2.size) {
+          return false;
+        }
+
+        // deserialized payloads (content2) must always use payload type 'pl_vec'
+        if (content2.payload.type != pl_vec) {
+          return false;
+        }
+
+        if ((content1.payload.type != pl_none) &&
+            (content2.payload.type != pl_none))
+        {
+          // extract payload1
+          std::vector<char> payload1_vec;
+          switch (content1.payload.type)
+          {
+          case pl_none:
+            break;
+          case pl_raw:
+            payload1_vec = std::vector<char>(content1.payload.raw_addr, content1.payload.raw_addr + content1.payload.raw_size);
+            break;
+          case pl_vec:
+            payload1_vec = content1.payload.vec;
+            break;
+          }
+
+          // compare payloads
+          if (payload1_vec != content2.payload.vec) {
+            return false;
+          }
+        }
+
+        return true;
+      }
+    }
+
     // compare two samples for equality
     bool ComparePayloadSamples(const Sample& sample1, const Sample& sample2)
     {
@@ -43,47 +88,26 @@ namespace eCAL
       }
 
       // compare content
-      if (sample1.content.id    != sample2.content.id ||
-          sample1.content.clock != sample2.content.clock ||
-          sample1.content.time  != sample2.content.time ||
-          sample1.content.hash  != sample2.content.hash ||
-          sample1.content.size  != sample2.content.size) {
+      if (!CompareContents(sample1.content, sample2.content)) {
         return false;
       }
 
-      // deserialized payloads (sample2) must always use payload type 'pl_vec'
-      if (sample2.content.payload.type != pl_vec) {
+      // compare padding
+      if (sample1.padding != sample2.padding) {
         return false;
       }
 
-      if ((sample1.content.payload.type != pl_none) &&
-          (sample2.content.payload.type != pl_none))
+      // compare batch
+      if (sample1.batch.size() != sample2.batch.size()) {
+        return false;
+      }
+      for (size_t i = 0; i < sample1.batch.size(); ++i)
       {
-        // extract payload1
-        std::vector<char> payload1_vec;
-        switch (sample1.content.payload.type)
-        {
-        case pl_none:
-          break;
-        case pl_raw:
-          payload1_vec = std::vector<char>(sample1.content.payload.raw_addr, sample1.content.payload.raw_addr + sample1.content.payload.raw_size);
-          break;
-        case pl_vec:
-          payload1_vec = sample1.content.payload.vec;
-          break;
-        }
-
-        // compare payloads
-        if (payload1_vec != sample2.content.payload.vec) {
+        if (!CompareContents(sample1.batch[i], sample2.batch[i])) {
           return false;
         }
       }
 
-      // compare padding
-      if (sample1.padding != sample2.padding) {
-        return false;
-      }
-
       // all comparisons passed, samples are equal
       return true;
     }
@@ -111,5 +111,19 @@ namespace eCAL
 
       return sample;
     }
+
+    // generate Payload Sample Batch (payload vectors)
+    Sample GeneratePayloadBatchSample(const std::vector<std::vector<char>>& payload_vecs)
+    {
+      Sample sample;
+      sample.cmd_type   = bct_set_sample_batch;
+      sample.topic_info = GenerateTopic();
+      for (const auto& payload_vec : payload_vecs)
+      {
+        sample.batch.push_back(GenerateContent(payload_vec));
+      }
+
+      return sample;
+    }
   }
 }
@@ -47,5 +47,8 @@ namespace eCAL
 
     // generate Payload Sample (payload vector)
     Sample GeneratePayloadSample(const std::vector<char>& payload_vec);
+
+    // generate Payload Sample Batch (payload vectors)
+    Sample GeneratePayloadBatchSample(const std::vector<std::vector<char>>& payload_vecs);
   }
 }
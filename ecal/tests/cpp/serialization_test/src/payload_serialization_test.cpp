@@ -18,12 +18,15 @@
 */
 
 #include <cstddef>
+#include <serialization/ecal_serialize_sample_header.h>
 #include <serialization/ecal_serialize_sample_payload.h>
 
 #include "payload_generate.h"
 #include "payload_compare.h"
 
 #include <gtest/gtest.h>
+#include <cstring>
+#include <limits>
 #include <random>
 #include <string>
 #include <vector>
@@ -129,6 +132,141 @@ namespace eCAL
       ASSERT_TRUE(ComparePayloadSamples(sample_in, sample_out));
     }
 
+    TEST(core_cpp_serialization, BatchPayload2Vector)
+    {
+      std::vector<std::vector<char>> payloads(3);
+      InitializeVec(payloads[0], 32);
+      InitializeVec(payloads[1], 0);
+      InitializeVec(payloads[2], 64);
+
+      Sample sample_in = GeneratePayloadBatchSample(payloads);
+
+      std::vector<char> sample_buffer;
+      ASSERT_TRUE(SerializeToBuffer(sample_in, sample_buffer));
+
+      Sample sample_out;
+      ASSERT_TRUE(DeserializeFromBuffer(sample_buffer.data(), sample_buffer.size(), sample_out));
+
+      ASSERT_EQ(3u, sample_out.batch.size());
+      ASSERT_TRUE(ComparePayloadSamples(sample_in, sample_out));
+    }
+
+    TEST(core_cpp_serialization, VecPayloadNoCopy)
+    {
+      std::vector<char> payload;
+      InitializeVec(payload, 1024);
+
+      Sample sample_in = GeneratePayloadSample(payload);
+
+      std::vector<char> sample_buffer;
+      ASSERT_TRUE(SerializeToBuffer(sample_in, sample_buffer));
+
+      Sample sample_out;
+      ASSERT_TRUE(DeserializeFromBufferNoCopy(sample_buffer.data(), sample_buffer.size(), sample_out));
+
+      // the payload references the serialized buffer
+      ASSERT_EQ(pl_raw, sample_out.content.payload.type);
+      ASSERT_TRUE(sample_out.content.payload.vec.empty());
+      ASSERT_GE(sample_out.content.payload.raw_addr, sample_buffer.data());
+      ASSERT_LE(sample_out.content.payload.raw_addr + sample_out.content.payload.raw_size, sample_buffer.data() + sample_buffer.size());
+      ASSERT_EQ(payload, std::vector<char>(sample_out.content.payload.raw_addr, sample_out.content.payload.raw_addr + sample_out.content.payload.raw_size));
+
+      ASSERT_EQ(sample_in.topic_info.topic_name, sample_out.topic_info.topic_name);
+      ASSERT_EQ(sample_in.content.id,            sample_out.content.id);
+      ASSERT_EQ(sample_in.content.clock,         sample_out.content.clock);
+      ASSERT_EQ(sample_in.content.time,          sample_out.content.time);
+    }
+
+    TEST(core_cpp_serialization, BatchPayloadNoCopy)
+    {
+      std::vector<std::vector<char>> payloads(3);
+      InitializeVec(payloads[0], 32);
+      InitializeVec(payloads[1], 0);
+      InitializeVec(payloads[2], 64);
+
+      Sample sample_in = GeneratePayloadBatchSample(payloads);
+
+      std::vector<char> sample_buffer;
+      ASSERT_TRUE(SerializeToBuffer(sample_in, sample_buffer));
+
+      Sample sample_out;
+      ASSERT_TRUE(DeserializeFromBufferNoCopy(sample_buffer.data(), sample_buffer.size(), sample_out));
+
+      ASSERT_EQ(3u, sample_out.batch.size());
+      for (size_t i = 0; i < payloads.size(); ++i)
+      {
+        const auto& content = sample_out.batch[i];
+        ASSERT_EQ(pl_raw, content.payload.type);
+        ASSERT_EQ(payloads[i], std::vector<char>(content.payload.raw_addr, content.payload.raw_addr + content.payload.raw_size));
+      }
+    }
+
+    TEST(core_cpp_serialization, FixedHeaderWithPayload)
+    {
+      const TopicInfo topic_info = GenerateTopic();
+      const CFixedSampleHeader header(topic_info, true);
+
+      // the header is copied once, every message only patches the content fields
+      std::vector<char> sample_buffer(header.Data());
+      const std::vector<size_t> payload_sizes{ 1024, 0, 17, 200 * 1024 };
+      for (const auto payload_size : payload_sizes)
+      {
+        std::vector<char> payload;
+        InitializeVec(payload, payload_size);
+
+        const int64_t id    = -1;
+        const int64_t clock = std::numeric_limits<int64_t>::max();
+        const int64_t time  = std::numeric_limits<int64_t>::min();
+        const int64_t hash  = static_cast<int64_t>(payload_size);
+        sample_buffer.resize(header.Size() + payload.size());
+        header.PatchContent(sample_buffer.data(), id, clock, time, hash, 0, payload.size());
+        if (!payload.empty()) memcpy(sample_buffer.data() + header.Size(), payload.data(), payload.size());
+
+        Sample sample_out;
+        ASSERT_TRUE(DeserializeFromBuffer(sample_buffer.data(), sample_buffer.size(), sample_out));
+
+        ASSERT_EQ(bct_set_sample,        sample_out.cmd_type);
+        ASSERT_EQ(topic_info.topic_name, sample_out.topic_info.topic_name);
+        ASSERT_EQ(topic_info.topic_id,   sample_out.topic_info.topic_id);
+        ASSERT_EQ(topic_info.process_id, sample_out.topic_info.process_id);
+        ASSERT_EQ(topic_info.host_name,  sample_out.topic_info.host_name);
+        ASSERT_EQ(id,                    sample_out.content.id);
+        ASSERT_EQ(clock,                 sample_out.content.clock);
+        ASSERT_EQ(time,                  sample_out.content.time);
+        ASSERT_EQ(hash,                  sample_out.content.hash);
+        ASSERT_EQ(payload,               sample_out.content.payload.vec);
+        ASSERT_TRUE(sample_out.batch.empty());
+      }
+    }
+
+    TEST(core_cpp_serialization, FixedHeaderOnly)
+    {
+      const TopicInfo topic_info = GenerateTopic();
+      CFixedSampleHeader header(topic_info, false, 5);
+      header.SetContent(42, 43, 44, 45, -46);
+
+      Sample sample_out;
+      ASSERT_TRUE(DeserializeFromBuffer(header.Data().data(), header.Size(), sample_out));
+
+      ASSERT_EQ(bct_set_sample,        sample_out.cmd_type);
+      ASSERT_EQ(topic_info.topic_name, sample_out.topic_info.topic_name);
+      ASSERT_EQ(42,                    sample_out.content.id);
+      ASSERT_EQ(43,                    sample_out.content.clock);
+      ASSERT_EQ(44,                    sample_out.content.time);
+      ASSERT_EQ(45,                    sample_out.content.hash);
+      ASSERT_EQ(-46,                   sample_out.content.size);
+      ASSERT_TRUE(sample_out.content.payload.vec.empty());
+      ASSERT_EQ(5u,                    sample_out.padding.size());
+
+      // the header size does not depend on the content values
+      const size_t header_size = header.Size();
+      header.SetContent(std::numeric_limits<int64_t>::min(), 0, 0, 0, std::numeric_limits<int32_t>::max());
+      ASSERT_EQ(header_size, header.Size());
+      ASSERT_TRUE(DeserializeFromBuffer(header.Data().data(), header.Size(), sample_out));
+      ASSERT_EQ(std::numeric_limits<int64_t>::min(), sample_out.content.id);
+      ASSERT_EQ(std::numeric_limits<int32_t>::max(), sample_out.content.size);
+    }
+
     TEST(core_cpp_serialization, RawPayloadEmpty)
     {
       Sample sample_in = GeneratePayloadSample(nullptr, 0);
@@ -112,6 +112,44 @@ namespace eCAL
       return layer;
     }
 
+    // generate AcknowledgeStatistics
+    AcknowledgeStatistics GenerateAcknowledgeStatistics()
+    {
+      AcknowledgeStatistics ack_statistics;
+      ack_statistics.process_id        = rand() % 1000;
+      ack_statistics.acknowledge_count = rand() % 10000;
+      ack_statistics.timeout_count     = rand() % 10;
+      ack_statistics.latency.bucket_limits_us = { 10, 100, 1000 };
+      ack_statistics.latency.bucket_counts    = { rand() % 100, rand() % 100, rand() % 100, rand() % 100 };
+      return ack_statistics;
+    }
+
+    // generate CallbackStatistics
+    CallbackStatistics GenerateCallbackStatistics()
+    {
+      CallbackStatistics callback_statistics;
+      callback_statistics.queue_size     = rand() % 10 + 1;
+      callback_statistics.queue_depth    = rand() % 10;
+      callback_statistics.executed_count = rand() % 10000;
+      callback_statistics.drop_count     = rand() % 100;
+      callback_statistics.latency.bucket_limits_us = { 10, 100, 1000 };
+      callback_statistics.latency.bucket_counts    = { rand() % 100, rand() % 100, rand() % 100, rand() % 100 };
+      return callback_statistics;
+    }
+
+    // generate LatencyStatistics
+    LatencyStatistics GenerateLatencyStatistics()
+    {
+      LatencyStatistics latency_statistics;
+      latency_statistics.publisher_id = rand();
+      latency_statistics.layer        = tl_ecal_udp;
+      latency_statistics.delivery_latency.bucket_limits_us = { 10, 100, 1000 };
+      latency_statistics.delivery_latency.bucket_counts    = { rand() % 100, rand() % 100, rand() % 100, rand() % 100 };
+      latency_statistics.callback_latency.bucket_limits_us = { 10, 100, 1000 };
+      latency_statistics.callback_latency.bucket_counts    = { rand() % 100, rand() % 100, rand() % 100, rand() % 100 };
+      return latency_statistics;
+    }
+
     // generate Topic
     Topic GenerateTopic()
     {
@@ -133,6 +171,14 @@ namespace eCAL
       topic.data_id              = rand();
       topic.data_clock           = rand();
       topic.data_frequency       = rand() % 100;
+      topic.fec_recovered_messages = rand() % 100;
+      topic.fec_lost_messages    = rand() % 100;
+      topic.acknowledge_statistics.push_back(GenerateAcknowledgeStatistics());
+      topic.acknowledge_statistics.push_back(GenerateAcknowledgeStatistics());
+      topic.callback_statistics  = GenerateCallbackStatistics();
+      topic.sample_filter.downsampling_factor = rand() % 10;
+      topic.sample_filter.max_frequency       = rand() % 100000;
+      topic.latency_statistics.push_back(GenerateLatencyStatistics());
       return topic;
     }
 
@@ -182,6 +228,8 @@ namespace eCAL
       sample.cmd_type = bct_reg_publisher;
       sample.identifier = GenerateIdentifier();
       sample.topic = GenerateTopic();
+      sample.protocol_version = 1;
+      sample.generation = rand();
       return sample;
     }
 
@@ -202,5 +250,24 @@ namespace eCAL
       sample.client = GenerateClient();
       return sample;
     }
+
+    Sample GenerateHeartbeatSample()
+    {
+      Sample sample;
+      sample.cmd_type = bct_reg_heartbeat;
+      sample.identifier = GenerateIdentifier();
+      sample.protocol_version = 1;
+      sample.generation = rand();
+      return sample;
+    }
+
+    Sample GenerateRequestSample()
+    {
+      Sample sample;
+      sample.cmd_type = bct_reg_request;
+      sample.identifier = GenerateIdentifier();
+      sample.protocol_version = 1;
+      return sample;
+    }
   }
 }
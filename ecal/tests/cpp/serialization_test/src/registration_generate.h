@@ -30,5 +30,7 @@ namespace eCAL
     Sample GenerateTopicSample();
     Sample GenerateServiceSample();
     Sample GenerateClientSample();
+    Sample GenerateHeartbeatSample();
+    Sample GenerateRequestSample();
   }
 }
\ No newline at end of file
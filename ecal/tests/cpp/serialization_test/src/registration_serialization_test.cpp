@@ -18,6 +18,7 @@
 */
 
 #include <serialization/ecal_serialize_sample_registration.h>
+#include <serialization/ecal_serialize_sample_registration_cache.h>
 #include "registration_generate.h"
 
 #include <gtest/gtest.h>
@@ -36,6 +37,8 @@ namespace eCAL
         samples.push_back(GenerateTopicSample());
         samples.push_back(GenerateServiceSample());
         samples.push_back(GenerateClientSample());
+        samples.push_back(GenerateHeartbeatSample());
+        samples.push_back(GenerateRequestSample());
       }
 
     protected:
@@ -107,5 +110,78 @@ namespace eCAL
       EXPECT_TRUE(sample_list_in.size() == sample_list_out.size());
       EXPECT_EQ(sample_list_in, sample_list_out);
     }
+
+    TEST_F(core_cpp_registration_serialization, RegistrationEncodingCache)
+    {
+      CSampleEncodingCache encoding_cache;
+      for (auto& sample_in : samples)
+      {
+        // first encoding, next encoding with changed counters only, next encoding with changed structure
+        for (int i = 0; i < 3; ++i)
+        {
+          if (i == 1)
+          {
+            sample_in.process.registration_clock++;
+            sample_in.service.registration_clock++;
+            sample_in.client.registration_clock++;
+            sample_in.topic.registration_clock++;
+            sample_in.topic.data_clock += 100;
+            sample_in.topic.data_frequency = -1;
+            sample_in.topic.connections_local++;
+          }
+          if (i == 2)
+          {
+            sample_in.process.unit_name += "_changed";
+            sample_in.service.service_name += "_changed";
+            sample_in.client.service_name += "_changed";
+            sample_in.topic.topic_name += "_changed";
+          }
+
+          const std::vector<char>& sample_buffer = encoding_cache.Encode(sample_in);
+
+          Sample sample_out;
+          EXPECT_TRUE(DeserializeFromBuffer(sample_buffer.data(), sample_buffer.size(), sample_out));
+
+          EXPECT_EQ(sample_in, sample_out);
+        }
+      }
+    }
+
+    TEST_F(core_cpp_registration_serialization, RegistrationListEncodingCache)
+    {
+      SampleList sample_list_in;
+      for (const auto& sample_in : samples)
+      {
+        sample_list_in.push_back(sample_in);
+      }
+
+      CSampleEncodingCache encoding_cache;
+      std::vector<char> sample_buffer;
+      for (int i = 0; i < 2; ++i)
+      {
+        for (auto& sample_in : sample_list_in)
+        {
+          sample_in.process.registration_clock++;
+          sample_in.topic.registration_clock++;
+          sample_in.topic.data_clock++;
+        }
+        encoding_cache.EncodeSampleList(sample_list_in, sample_buffer);
+
+        SampleList sample_list_out;
+        EXPECT_TRUE(DeserializeFromBuffer(sample_buffer.data(), sample_buffer.size(), sample_list_out));
+
+        EXPECT_TRUE(sample_list_in.size() == sample_list_out.size());
+        EXPECT_EQ(sample_list_in, sample_list_out);
+      }
+
+      // process, topic, service and client registration are cached
+      EXPECT_EQ(encoding_cache.GetCachedEntityCount(), 4U);
+
+      // entities not part of the list anymore are removed
+      SampleList process_sample_list;
+      process_sample_list.push_back(sample_list_in[0]);
+      encoding_cache.EncodeSampleList(process_sample_list, sample_buffer);
+      EXPECT_EQ(encoding_cache.GetCachedEntityCount(), 1U);
+    }
   }
 }
@@ -163,3 +163,26 @@ TEST(core_cpp_core, Topic2Mcast_LegacyBehavior)
     EXPECT_EQ(eCAL::UDP::V1::topic2mcast_hash(object.hash, object.ip, object.mask), object.result);
   }
 }
+
+TEST(core_cpp_core, Topic2Mcast_Mcast2Shard)
+{
+  // single shard
+  EXPECT_EQ(eCAL::UDP::mcast2shard("239.0.0.17", 0), 0u);
+  EXPECT_EQ(eCAL::UDP::mcast2shard("239.0.0.17", 1), 0u);
+
+  // consecutive groups are distributed round robin
+  const size_t shard_count = 4;
+  std::vector<size_t> groups_per_shard(shard_count, 0);
+  for (int group = 0; group < 16; ++group)
+  {
+    const std::string mcast_address = "239.0.0." + std::to_string(group);
+    const size_t shard = eCAL::UDP::mcast2shard(mcast_address, shard_count);
+    ASSERT_LT(shard, shard_count);
+    EXPECT_EQ(shard, eCAL::UDP::mcast2shard(mcast_address, shard_count));
+    groups_per_shard[shard]++;
+  }
+  for (const auto groups : groups_per_shard)
+  {
+    EXPECT_EQ(groups, 4u);
+  }
+}
@@ -0,0 +1,93 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "util/buffer_pool.h"
+
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace eCAL::Util;
+
+TEST(core_cpp_util_buffer_pool, AcquireCapacity)
+{
+  CBufferPool<> pool;
+  for (const size_t size : { size_t(0), size_t(1), size_t(1024), size_t(1025), size_t(1024 * 1024 + 17) })
+  {
+    const std::vector<char> buffer = pool.Acquire(size);
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_GE(buffer.capacity(), size);
+  }
+  EXPECT_EQ(0u, pool.Size());
+}
+
+TEST(core_cpp_util_buffer_pool, ReuseReleasedBuffer)
+{
+  CBufferPool<> pool;
+
+  std::vector<char> buffer = pool.Acquire(3000);
+  buffer.assign(3000, 'x');
+  const char* data = buffer.data();
+
+  pool.Release(buffer);
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_EQ(1u, pool.Size());
+
+  // a message of the same size class gets the same memory back
+  std::vector<char> reused = pool.Acquire(2500);
+  EXPECT_EQ(0u, pool.Size());
+  EXPECT_TRUE(reused.empty());
+  EXPECT_GE(reused.capacity(), 2500u);
+  reused.resize(2500);
+  EXPECT_EQ(data, reused.data());
+
+  // a larger size class does not
+  pool.Release(reused);
+  const std::vector<char> larger = pool.Acquire(8000);
+  EXPECT_GE(larger.capacity(), 8000u);
+  EXPECT_EQ(1u, pool.Size());
+}
+
+TEST(core_cpp_util_buffer_pool, ForeignBufferCapacity)
+{
+  CBufferPool<> pool;
+
+  // a buffer with a capacity between two size classes serves the smaller class
+  std::vector<char> buffer;
+  buffer.reserve(3000);
+  pool.Release(buffer);
+  EXPECT_EQ(1u, pool.Size());
+
+  EXPECT_GE(pool.Acquire(4096).capacity(), 4096u);
+  EXPECT_EQ(1u, pool.Size());
+  EXPECT_GE(pool.Acquire(2048).capacity(), 2048u);
+  EXPECT_EQ(0u, pool.Size());
+}
+
+TEST(core_cpp_util_buffer_pool, LimitPerSizeClass)
+{
+  CBufferPool<2> pool;
+
+  std::vector<std::vector<char>> buffers;
+  for (int i = 0; i < 4; ++i) buffers.push_back(pool.Acquire(64 * 1024));
+  for (auto& buffer : buffers) pool.Release(buffer);
+
+  EXPECT_EQ(2u, pool.Size());
+}
@@ -0,0 +1,101 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "util/latency_histogram.h"
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace eCAL;
+
+TEST(core_cpp_util_latency_histogram, BucketLimits)
+{
+  const auto& limits = CLatencyHistogram::BucketLimits();
+
+  // 1 us resolution below 16 us
+  for (int64_t limit = 1; limit <= 16; ++limit) EXPECT_EQ(limit, limits[static_cast<size_t>(limit - 1)]);
+
+  // strictly increasing, with at most 12.5 % between neighbours, up to ~1 s
+  for (size_t bucket = 1; bucket < CLatencyHistogram::bucket_limit_count; ++bucket)
+  {
+    EXPECT_GT(limits[bucket], limits[bucket - 1]);
+    if (limits[bucket - 1] >= 8)
+    {
+      EXPECT_LE(limits[bucket] * 8, limits[bucket - 1] * 9);
+    }
+  }
+  EXPECT_EQ(int64_t(1) << 20, limits.back());
+}
+
+TEST(core_cpp_util_latency_histogram, PercentilesBelow10us)
+{
+  CLatencyHistogram histogram;
+  EXPECT_EQ(0, histogram.Percentile(50.0));
+
+  // 98 samples of 2 us, 2 samples of 7 us
+  for (int i = 0; i < 98; ++i) histogram.AddSample(std::chrono::microseconds(2));
+  for (int i = 0; i < 2; ++i)  histogram.AddSample(std::chrono::microseconds(7));
+
+  EXPECT_EQ(100, histogram.SampleCount());
+  EXPECT_EQ(2, histogram.Percentile(50.0));
+  EXPECT_EQ(2, histogram.Percentile(98.0));
+  EXPECT_EQ(7, histogram.Percentile(99.0));
+  EXPECT_EQ(7, histogram.Percentile(100.0));
+}
+
+TEST(core_cpp_util_latency_histogram, PercentilesSubMicrosecond)
+{
+  CAtomicLatencyHistogram histogram;
+
+  // sub microsecond latencies end up in the first bucket, a partial microsecond rounds up
+  for (int i = 0; i < 90; ++i) histogram.AddSample(std::chrono::nanoseconds(400));
+  for (int i = 0; i < 10; ++i) histogram.AddSample(std::chrono::nanoseconds(3200));
+
+  EXPECT_EQ(100, histogram.SampleCount());
+  EXPECT_EQ(1, histogram.Percentile(50.0));
+  EXPECT_EQ(1, histogram.Percentile(90.0));
+  EXPECT_EQ(4, histogram.Percentile(99.0));
+}
+
+TEST(core_cpp_util_latency_histogram, PercentilesLargeLatencies)
+{
+  CLatencyHistogram histogram;
+  for (int i = 0; i < 50; ++i) histogram.AddSample(std::chrono::microseconds(1500));
+  for (int i = 0; i < 49; ++i) histogram.AddSample(std::chrono::milliseconds(20));
+  histogram.AddSample(std::chrono::seconds(2));
+
+  // the percentile is reported as upper limit of its bucket, at most 12.5 % above the sample
+  EXPECT_GE(histogram.Percentile(50.0), 1500);
+  EXPECT_LE(histogram.Percentile(50.0) * 8, 1500 * 9);
+  EXPECT_GE(histogram.Percentile(99.0), 20000);
+  EXPECT_LE(histogram.Percentile(99.0) * 8, 20000 * 9);
+
+  // above the largest limit
+  EXPECT_EQ(std::numeric_limits<int64_t>::max(), histogram.Percentile(100.0));
+
+  std::vector<int64_t> limits;
+  std::vector<int64_t> counts;
+  histogram.Export(limits, counts);
+  EXPECT_EQ(limits.size() + 1, counts.size());
+  EXPECT_EQ(1, counts.back());
+}
@@ -0,0 +1,144 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "util/rcu_pointer.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  std::atomic<int> alive_values{ 0 };
+
+  struct SValue
+  {
+    explicit SValue(int value_ = 0) : value(value_) { alive_values++; }
+    ~SValue() { alive_values--; }
+    int value;
+  };
+
+  using ValuePointerT = eCAL::RCU::CPointer<SValue>;
+}
+
+TEST(core_cpp_util_rcu_pointer, UpdateWithoutReaders)
+{
+  {
+    ValuePointerT pointer(std::unique_ptr<const SValue>(new SValue(1)));
+    EXPECT_EQ(1, alive_values);
+
+    pointer.Update(std::unique_ptr<const SValue>(new SValue(2)));
+    // no reader, the previous value is deleted immediately
+    EXPECT_EQ(1, alive_values);
+    EXPECT_EQ(2, pointer.Current().value);
+
+    const ValuePointerT::CReadGuard guard(pointer);
+    EXPECT_EQ(2, guard->value);
+  }
+  EXPECT_EQ(0, alive_values);
+}
+
+TEST(core_cpp_util_rcu_pointer, ReaderKeepsValue)
+{
+  ValuePointerT pointer(std::unique_ptr<const SValue>(new SValue(1)));
+  {
+    const ValuePointerT::CReadGuard guard(pointer);
+
+    pointer.Update(std::unique_ptr<const SValue>(new SValue(2)));
+    pointer.Update(std::unique_ptr<const SValue>(new SValue(3)));
+
+    // the reader still sees the value it started with, a nested reader sees the current one
+    EXPECT_EQ(1, guard->value);
+    {
+      const ValuePointerT::CReadGuard nested_guard(pointer);
+      EXPECT_EQ(3, nested_guard->value);
+    }
+    EXPECT_EQ(1, guard->value);
+    EXPECT_EQ(3, alive_values);
+  }
+  // all previous values are deleted when the reader leaves
+  EXPECT_EQ(1, alive_values);
+}
+
+TEST(core_cpp_util_rcu_pointer, ReaderOnOtherThread)
+{
+  ValuePointerT pointer(std::unique_ptr<const SValue>(new SValue(1)));
+
+  std::atomic<bool> reading{ false };
+  std::atomic<bool> updated{ false };
+  int read_value(0);
+  std::thread reader([&]()
+    {
+      const ValuePointerT::CReadGuard guard(pointer);
+      reading = true;
+      while (!updated) std::this_thread::yield();
+      read_value = guard->value;
+    });
+
+  while (!reading) std::this_thread::yield();
+  pointer.Update(std::unique_ptr<const SValue>(new SValue(2)));
+  EXPECT_EQ(2, alive_values);
+  updated = true;
+  reader.join();
+
+  EXPECT_EQ(1, read_value);
+  EXPECT_EQ(1, alive_values);
+}
+
+TEST(core_cpp_util_rcu_pointer, ConcurrentReadersAndWriter)
+{
+  {
+    ValuePointerT pointer(std::unique_ptr<const SValue>(new SValue(0)));
+
+    std::atomic<bool> stop{ false };
+    std::atomic<bool> monotonic{ true };
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; ++i)
+    {
+      readers.emplace_back([&]()
+        {
+          int last_value(0);
+          while (!stop)
+          {
+            const ValuePointerT::CReadGuard guard(pointer);
+            if (guard->value < last_value) monotonic = false;
+            last_value = guard->value;
+          }
+        });
+    }
+
+    for (int value = 1; value <= 10000; ++value)
+    {
+      pointer.Update(std::unique_ptr<const SValue>(new SValue(value)));
+    }
+    stop = true;
+    for (auto& reader : readers) reader.join();
+
+    EXPECT_TRUE(monotonic);
+    EXPECT_EQ(10000, pointer.Current().value);
+
+    // the next update reclaims everything that is left
+    pointer.Update(std::unique_ptr<const SValue>(new SValue(0)));
+    EXPECT_EQ(1, alive_values);
+  }
+  EXPECT_EQ(0, alive_values);
+}
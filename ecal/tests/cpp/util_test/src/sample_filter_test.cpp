@@ -0,0 +1,129 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "util/sample_filter.h"
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace eCAL;
+
+TEST(core_cpp_util_sample_filter, Inactive)
+{
+  CSampleFilter filter(0, 0);
+  EXPECT_FALSE(filter.IsActive());
+  for (int64_t clock = 1; clock < 10; ++clock)
+  {
+    EXPECT_TRUE(filter.Pass(clock, 0));
+  }
+
+  filter.SetParameter(1, 0);
+  EXPECT_FALSE(filter.IsActive());
+}
+
+TEST(core_cpp_util_sample_filter, Downsampling)
+{
+  CSampleFilter filter(3, 0);
+  EXPECT_TRUE(filter.IsActive());
+
+  std::vector<int64_t> passed;
+  for (int64_t clock = 1; clock <= 10; ++clock)
+  {
+    if (filter.Pass(clock, clock * 1000)) passed.push_back(clock);
+  }
+  EXPECT_EQ(std::vector<int64_t>({ 1, 4, 7, 10 }), passed);
+}
+
+TEST(core_cpp_util_sample_filter, DownsamplingWithGaps)
+{
+  // samples lost on the way are counted by the send clock
+  CSampleFilter filter(3, 0);
+  EXPECT_TRUE(filter.Pass(1, 0));
+  EXPECT_FALSE(filter.Pass(2, 0));
+  EXPECT_TRUE(filter.Pass(5, 0));
+  EXPECT_FALSE(filter.Pass(7, 0));
+  EXPECT_TRUE(filter.Pass(8, 0));
+}
+
+TEST(core_cpp_util_sample_filter, MaxFrequency)
+{
+  // 10 Hz -> 100 ms minimal interval
+  CSampleFilter filter(0, SampleFilterFrequencyToMilliHertz(10.0));
+  EXPECT_TRUE(filter.IsActive());
+
+  std::vector<int64_t> passed;
+  for (int64_t clock = 1; clock <= 100; ++clock)
+  {
+    // 100 Hz input
+    const int64_t time_us = clock * 10000;
+    if (filter.Pass(clock, time_us)) passed.push_back(clock);
+  }
+  EXPECT_EQ(std::vector<int64_t>({ 1, 11, 21, 31, 41, 51, 61, 71, 81, 91 }), passed);
+}
+
+TEST(core_cpp_util_sample_filter, Combined)
+{
+  // every 2nd sample, at most 1 Hz
+  CSampleFilter filter(2, SampleFilterFrequencyToMilliHertz(1.0));
+  EXPECT_TRUE(filter.Pass(1, 0));
+  EXPECT_FALSE(filter.Pass(2, 2000000));   // downsampling
+  EXPECT_FALSE(filter.Pass(3, 500000));    // frequency
+  EXPECT_TRUE(filter.Pass(4, 1000000));
+}
+
+TEST(core_cpp_util_sample_filter, RestartOnBackwardsClock)
+{
+  CSampleFilter filter(10, 0);
+  EXPECT_TRUE(filter.Pass(100, 0));
+  EXPECT_FALSE(filter.Pass(101, 0));
+
+  // restarted publisher
+  EXPECT_TRUE(filter.Pass(1, 0));
+  EXPECT_FALSE(filter.Pass(2, 0));
+  EXPECT_TRUE(filter.Pass(11, 0));
+}
+
+TEST(core_cpp_util_sample_filter, SetParameterKeepsState)
+{
+  CSampleFilter filter(2, 0);
+  EXPECT_TRUE(filter.Pass(1, 0));
+
+  // a registration refresh must not pass the next sample
+  filter.SetParameter(2, 0);
+  EXPECT_FALSE(filter.Pass(2, 0));
+  EXPECT_TRUE(filter.Pass(3, 0));
+
+  filter.Reset();
+  EXPECT_TRUE(filter.Pass(4, 0));
+}
+
+TEST(core_cpp_util_sample_filter, FrequencyConversion)
+{
+  EXPECT_EQ(0, SampleFilterFrequencyToMilliHertz(0.0));
+  EXPECT_EQ(0, SampleFilterFrequencyToMilliHertz(-1.0));
+  EXPECT_EQ(0, SampleFilterFrequencyToMilliHertz(1.0e12));
+  EXPECT_EQ(1, SampleFilterFrequencyToMilliHertz(0.0001));
+  EXPECT_EQ(2500, SampleFilterFrequencyToMilliHertz(2.5));
+
+  EXPECT_EQ(0, SampleFilterDownsamplingFactor(0u));
+  EXPECT_EQ(10, SampleFilterDownsamplingFactor(10u));
+  EXPECT_EQ(INT32_MAX, SampleFilterDownsamplingFactor(0xFFFFFFFFu));
+}
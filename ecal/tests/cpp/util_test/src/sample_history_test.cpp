@@ -0,0 +1,106 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "util/sample_history.h"
+
+#include <cstddef>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace eCAL::Util;
+
+namespace
+{
+  void PushString(CSampleHistory& history_, const std::string& payload_, long long clock_)
+  {
+    auto& sample = history_.Push(payload_.size(), 0, clock_, clock_ * 1000);
+    payload_.copy(sample.payload.data(), payload_.size());
+  }
+
+  std::string PayloadString(const CSampleHistory::SSample& sample_)
+  {
+    return std::string(sample_.payload.begin(), sample_.payload.end());
+  }
+}
+
+TEST(core_cpp_util_sample_history, Empty)
+{
+  const CSampleHistory history(3);
+  EXPECT_EQ(3u, history.Depth());
+  EXPECT_EQ(0u, history.Size());
+}
+
+TEST(core_cpp_util_sample_history, FillUp)
+{
+  CSampleHistory history(3);
+  PushString(history, "one", 1);
+  PushString(history, "two", 2);
+
+  ASSERT_EQ(2u, history.Size());
+  EXPECT_EQ("one", PayloadString(history[0]));
+  EXPECT_EQ(1, history[0].clock);
+  EXPECT_EQ(1000, history[0].time);
+  EXPECT_EQ("two", PayloadString(history[1]));
+  EXPECT_EQ(2, history[1].clock);
+}
+
+TEST(core_cpp_util_sample_history, KeepsLastSamples)
+{
+  CSampleHistory history(3);
+  for (long long clock = 1; clock <= 10; ++clock)
+  {
+    PushString(history, std::string(static_cast<size_t>(clock), 'x'), clock);
+  }
+
+  // oldest first
+  ASSERT_EQ(3u, history.Size());
+  for (size_t i = 0; i < history.Size(); ++i)
+  {
+    const long long clock = static_cast<long long>(8 + i);
+    EXPECT_EQ(clock, history[i].clock);
+    EXPECT_EQ(std::string(static_cast<size_t>(clock), 'x'), PayloadString(history[i]));
+  }
+}
+
+TEST(core_cpp_util_sample_history, ReusesBuffers)
+{
+  CSampleHistory history(2);
+  PushString(history, std::string(1024, 'a'), 1);
+  PushString(history, std::string(1024, 'b'), 2);
+  const char* first_buffer = history[0].payload.data();
+
+  // the oldest entry (and its buffer) is overwritten
+  PushString(history, "c", 3);
+  EXPECT_EQ(first_buffer, history[1].payload.data());
+  EXPECT_EQ("c", PayloadString(history[1]));
+  EXPECT_EQ(std::string(1024, 'b'), PayloadString(history[0]));
+}
+
+TEST(core_cpp_util_sample_history, Clear)
+{
+  CSampleHistory history(2);
+  PushString(history, "one", 1);
+  history.Clear();
+  EXPECT_EQ(0u, history.Size());
+
+  PushString(history, "two", 2);
+  ASSERT_EQ(1u, history.Size());
+  EXPECT_EQ("two", PayloadString(history[0]));
+}
@@ -103,16 +103,31 @@ struct eCAL_Publisher_Layer_SHM_Configuration
   unsigned int memfile_buffer_count; /*!< Maximum number of used buffers (needs to be greater than 1, default = 1) */
   unsigned int memfile_min_size_bytes; //!< Default memory file size for new publisher (Default: 4096)
   unsigned int memfile_reserve_percent; //!< Dynamic file size reserve before recreating memory file if topic size changes (Default: 50)
+  unsigned int memfile_ring_slots; //!< Number of slots of the lock-free ring buffer memory file (0 == single slot memory file guarded by a mutex, Default: 0)
+  int futex_notification; //!< Signal subscribers via one futex word in the memory file instead of one named event per process (Linux only, Default: false)
+  int memfile_huge_pages; //!< Back memory files by huge pages of the hugetlbfs mount /dev/hugepages (Linux only, Default: false)
+  int memfile_prefault; //!< Fault in all pages of a memory file when it is created instead of on first write (Default: false)
+  int memfile_numa_node; //!< Bind the pages of memory files to this NUMA node (Linux only, -1 == no binding, Default: -1)
 };
 
 struct eCAL_Publisher_Layer_UDP_Configuration
 {
   int enable; //!< enable layer
+
+  int batching; //!< Collect multiple samples and send them in one udp datagram (Default: false)
+  unsigned int batch_max_size_bytes; //!< Send the batch as soon as its payload reaches this size (Default: 1200)
+  unsigned int batch_linger_time_us; //!< Maximum time a sample waits in the batch before it is sent (Default: 1000)
+
+  unsigned int fec_redundancy_percent; //!< Forward error correction parity data in percent of the message size (0 == disabled, Default: 0)
 };
 
 struct eCAL_Publisher_Layer_TCP_Configuration
 {
   int enable; //!< enable layer
+
+  int batching; //!< Collect multiple samples and send them in one tcp frame (Default: false)
+  unsigned int batch_max_size_bytes; //!< Send the batch as soon as its payload reaches this size (Default: 65536)
+  unsigned int batch_linger_time_us; //!< Maximum time a sample waits in the batch before it is sent (Default: 1000)
 };
 
 struct eCAL_Publisher_Layer_Configuration
@@ -122,9 +137,15 @@ struct eCAL_Publisher_Layer_Configuration
   struct eCAL_Publisher_Layer_TCP_Configuration tcp;
 };
 
+struct eCAL_Publisher_History_Configuration
+{
+  unsigned int depth; //!< Number of last samples replayed to late joining subscribers (0 == no history, Default: 0)
+};
+
 struct eCAL_Publisher_Configuration
 {
   struct eCAL_Publisher_Layer_Configuration layer; //!< Layer configuration
+  struct eCAL_Publisher_History_Configuration history; //!< Transient local history configuration
 
   enum eCAL_TransportLayer_eType layer_priority_local[8];
   size_t layer_priority_local_length;
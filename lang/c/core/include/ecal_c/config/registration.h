@@ -67,6 +67,13 @@ struct eCAL_Registration_Network_Configuration
   struct eCAL_Registration_Network_UDP_Configuration udp;
 };
 
+struct eCAL_Registration_Delta_Configuration
+{
+  int enable; //!< Send the full registration state of an entity only if it changed and small heartbeats otherwise (Default: false)
+  unsigned int statistics_cycles; //!< Number of registration refresh cycles after which entities with changed statistics only send their full state (Default: 10)
+  int descriptor_hashing; //!< Send datatype descriptors once keyed by their content hash, registrations carry the hash only (Default: false)
+};
+
 struct eCAL_Registration_Configuration
 {
   unsigned int registration_timeout; //!< Timeout for topic registration in ms (internal) (Default: 10000)
@@ -75,6 +82,7 @@ struct eCAL_Registration_Configuration
   const char* shm_transport_domain; //!< Common shm transport domain that enables interprocess mechanisms across (virtual) host borders (e.g., Docker); by default equivalent to local host name (Default: "")
   struct eCAL_Registration_Local_Configuration local;
   struct eCAL_Registration_Network_Configuration network;
+  struct eCAL_Registration_Delta_Configuration delta;
 };
 
 #endif /* ecal_c_config_registration_h_included */
\ No newline at end of file
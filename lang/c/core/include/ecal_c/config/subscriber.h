@@ -25,9 +25,12 @@
 #ifndef ecal_c_config_subscriber_h_included
 #define ecal_c_config_subscriber_h_included
 
+#include <stddef.h>
+
 struct eCAL_Subscriber_Layer_SHM_Configuration
 {
   int enable;  //!< enable layer (Default: true)
+  size_t max_pinned_samples; //!< maximum number of zero copy samples a sample callback receiver can hold at once, further samples are copied (0 == always copy, Default: 1)
 };
 
 struct eCAL_Subscriber_Layer_UDP_Configuration
@@ -47,11 +50,42 @@ struct eCAL_Subscriber_Layer_Configuration
   struct eCAL_Subscriber_Layer_TCP_Configuration tcp;
 };
 
+enum eCAL_Subscriber_Callback_eExecutor
+{
+  eCAL_Subscriber_Callback_eExecutor_synchronous,
+  eCAL_Subscriber_Callback_eExecutor_dedicated_thread,
+  eCAL_Subscriber_Callback_eExecutor_shared_pool
+};
+
+enum eCAL_Subscriber_Callback_eQueuePolicy
+{
+  eCAL_Subscriber_Callback_eQueuePolicy_keep_latest,
+  eCAL_Subscriber_Callback_eQueuePolicy_keep_all,
+  eCAL_Subscriber_Callback_eQueuePolicy_block_publisher
+};
+
+struct eCAL_Subscriber_Callback_Configuration
+{
+  enum eCAL_Subscriber_Callback_eExecutor executor;        //!< receive callback executor (Default: synchronous)
+  enum eCAL_Subscriber_Callback_eQueuePolicy queue_policy; //!< behavior of a full receive queue, asynchronous executors only (Default: keep_latest)
+  size_t queue_size;                                       //!< maximum number of queued samples, asynchronous executors only (Default: 1)
+  size_t shared_pool_size;                                 //!< number of threads of the process wide shared pool, applied by the first subscriber that creates the pool (Default: 2)
+};
+
+struct eCAL_Subscriber_Filter_Configuration
+{
+  unsigned int downsampling_factor; //!< pass only every Nth sample of a publisher (0, 1 == every sample, Default: 1)
+  double max_frequency;             //!< pass samples of a publisher with at most this frequency [Hz] (0 == unlimited, Default: 0)
+};
+
 struct eCAL_Subscriber_Configuration
 {
   struct eCAL_Subscriber_Layer_Configuration layer;
+  struct eCAL_Subscriber_Callback_Configuration callback;
+  struct eCAL_Subscriber_Filter_Configuration filter;
 
   int drop_out_of_order_messages;  //!< Enable dropping of payload messages that arrive out of order (Default: true)
+  int latency_tracing;             //!< Collect delivery latency and callback execution time histograms per publisher and transport layer (Default: false)
 };
 
 #endif /* ecal_c_config_subscriber_h_included */
\ No newline at end of file
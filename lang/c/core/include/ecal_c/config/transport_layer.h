@@ -52,6 +52,9 @@ struct eCAL_TransportLayer_UDP_Configuration
   unsigned int receive_buffer; //!< UDP receive buffer in bytes (Default: 5242880)
   int join_all_interfaces; //!< Linux specific setting to enable joining multicast groups on all network interfaces
   int npcap_enabled; //!< Enable to receive UDP traffic with the Npcap based receiver (Default: false)
+  int mmsg_enabled; //!< Linux specific setting to send and receive the topic payload with the sendmmsg / recvmmsg based UDP backend (Default: false)
+  unsigned int receive_threads; //!< Number of threads receiving the topic payload, topics are distributed by their multicast group (Linux, network mode only, Default: 1)
+  unsigned int max_message_size; //!< Maximum size of a received topic payload message in bytes, larger messages are dropped (Default: 64 MiB)
   struct eCAL_TransportLayer_UDP_MulticastConfiguration network; //!< default: "239.0.0.1", 3U
   struct eCAL_TransportLayer_UDP_MulticastConfiguration local; //!< default: "127.255.255.255", 1U
 };
@@ -63,10 +66,17 @@ struct eCAL_TransportLayer_TCP_Configuration
   int max_reconnections; //!< Reconnection attempts the session will try to reconnect in (Default: 5)
 };
 
+struct eCAL_TransportLayer_SHM_Configuration
+{
+  size_t observer_threads; //!< Number of threads that share the observation of memory files of publishers using futex notification, only applies to publishers with futex_notification enabled (0 == one thread per memory file, Linux only, Default: 0)
+  unsigned long long observer_cpu_affinity_mask; //!< CPUs the shared observer threads are distributed to (bit n == CPU n, 0 == no affinity, Linux only, Default: 0)
+};
+
 struct eCAL_TransportLayer_Configuration
 {
   struct eCAL_TransportLayer_UDP_Configuration udp;
   struct eCAL_TransportLayer_TCP_Configuration tcp;
+  struct eCAL_TransportLayer_SHM_Configuration shm;
 };
 
 #endif /* ecal_c_config_transport_layer_h_included */
\ No newline at end of file
@@ -67,6 +67,22 @@ struct eCAL_Monitoring_STransportLayer
   int active;                                   // transport layer used?
 };
 
+struct eCAL_Monitoring_SLatencyHistogram
+{
+  int64_t* bucket_limits_us;                    // upper bucket limits [us], one more bucket counts all greater latencies
+  size_t bucket_limits_us_length;               // array of bucket limits
+  int64_t* bucket_counts;                       // number of samples per bucket
+  size_t bucket_counts_length;                  // array of bucket counts
+};
+
+struct eCAL_Monitoring_SLatencyStatistics
+{
+  eCAL_EntityIdT publisher_id;                  // publisher entity id
+  enum eCAL_Monitoring_eTransportLayerType layer; // receiving transport layer
+  struct eCAL_Monitoring_SLatencyHistogram delivery_latency; // latency from the send time stamp to the reception (requires synchronized clocks for remote publishers)
+  struct eCAL_Monitoring_SLatencyHistogram callback_latency; // execution time of the receive callback
+};
+
 struct eCAL_Monitoring_STopic
 {
   int32_t registration_clock;                   // registration clock (heart beat)
@@ -88,6 +104,8 @@ struct eCAL_Monitoring_STopic
   int64_t data_id;                              // data send id (publisher setid)
   int64_t data_clock;                           // data clock (send / receive action)
   int32_t data_frequency;                       // data frequency (send / receive samples per second) [mHz]
+  struct eCAL_Monitoring_SLatencyStatistics* latency_statistics; // receive latency per publisher and transport layer (subscriber only, latency tracing enabled)
+  size_t latency_statistics_length;             // array of receive latency statistics
 };
 
 struct eCAL_Monitoring_SProcess
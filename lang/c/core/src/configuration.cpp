@@ -61,6 +61,28 @@ enum eCAL_Registration_Network_eTransportType Convert_Registration_Network_eTran
   return transport_type_map.at(transport_type_);
 }
 
+enum eCAL_Subscriber_Callback_eExecutor Convert_Subscriber_Callback_eExecutor(eCAL::Subscriber::Callback::eExecutor executor_)
+{
+  static const std::map<eCAL::Subscriber::Callback::eExecutor, enum eCAL_Subscriber_Callback_eExecutor> executor_map
+  {
+    {eCAL::Subscriber::Callback::eExecutor::synchronous, eCAL_Subscriber_Callback_eExecutor_synchronous},
+    {eCAL::Subscriber::Callback::eExecutor::dedicated_thread, eCAL_Subscriber_Callback_eExecutor_dedicated_thread},
+    {eCAL::Subscriber::Callback::eExecutor::shared_pool, eCAL_Subscriber_Callback_eExecutor_shared_pool}
+  };
+  return executor_map.at(executor_);
+}
+
+enum eCAL_Subscriber_Callback_eQueuePolicy Convert_Subscriber_Callback_eQueuePolicy(eCAL::Subscriber::Callback::eQueuePolicy queue_policy_)
+{
+  static const std::map<eCAL::Subscriber::Callback::eQueuePolicy, enum eCAL_Subscriber_Callback_eQueuePolicy> queue_policy_map
+  {
+    {eCAL::Subscriber::Callback::eQueuePolicy::keep_latest, eCAL_Subscriber_Callback_eQueuePolicy_keep_latest},
+    {eCAL::Subscriber::Callback::eQueuePolicy::keep_all, eCAL_Subscriber_Callback_eQueuePolicy_keep_all},
+    {eCAL::Subscriber::Callback::eQueuePolicy::block_publisher, eCAL_Subscriber_Callback_eQueuePolicy_block_publisher}
+  };
+  return queue_policy_map.at(queue_policy_);
+}
+
 enum eCAL_Types_UdpConfigVersion Convert_Types_UdpConfigVersion(eCAL::Types::UdpConfigVersion udp_config_version_)
 {
   static const std::map<eCAL::Types::UdpConfigVersion, enum eCAL_Types_UdpConfigVersion> udp_config_version_map
@@ -142,9 +164,24 @@ void Assign_Publisher_Configuration(struct eCAL_Publisher_Configuration* configu
   configuration_c_->layer.shm.memfile_buffer_count = configuration_.layer.shm.memfile_buffer_count;
   configuration_c_->layer.shm.memfile_min_size_bytes = configuration_.layer.shm.memfile_min_size_bytes;
   configuration_c_->layer.shm.memfile_reserve_percent = configuration_.layer.shm.memfile_reserve_percent;
+  configuration_c_->layer.shm.memfile_ring_slots = configuration_.layer.shm.memfile_ring_slots;
+  configuration_c_->layer.shm.futex_notification = configuration_.layer.shm.futex_notification;
+  configuration_c_->layer.shm.memfile_huge_pages = configuration_.layer.shm.memfile_huge_pages;
+  configuration_c_->layer.shm.memfile_prefault = configuration_.layer.shm.memfile_prefault;
+  configuration_c_->layer.shm.memfile_numa_node = configuration_.layer.shm.memfile_numa_node;
 
   configuration_c_->layer.udp.enable = configuration_.layer.udp.enable;
+  configuration_c_->layer.udp.batching = configuration_.layer.udp.batching;
+  configuration_c_->layer.udp.batch_max_size_bytes = configuration_.layer.udp.batch_max_size_bytes;
+  configuration_c_->layer.udp.batch_linger_time_us = configuration_.layer.udp.batch_linger_time_us;
+  configuration_c_->layer.udp.fec_redundancy_percent = configuration_.layer.udp.fec_redundancy_percent;
   configuration_c_->layer.tcp.enable = configuration_.layer.tcp.enable;
+  configuration_c_->layer.tcp.batching = configuration_.layer.tcp.batching;
+  configuration_c_->layer.tcp.batch_max_size_bytes = configuration_.layer.tcp.batch_max_size_bytes;
+  configuration_c_->layer.tcp.batch_linger_time_us = configuration_.layer.tcp.batch_linger_time_us;
+
+  // Assign History::Configuration
+  configuration_c_->history.depth = configuration_.history.depth;
 
   // Assign layer_priority_local
   configuration_c_->layer_priority_local_length = configuration_.layer_priority_local.size();
@@ -181,17 +218,34 @@ void Assign_Registration_Configuration(struct eCAL_Registration_Configuration* c
   configuration_c_->network.transport_type = Convert_Registration_Network_eTransportType(configuration_.network.transport_type);
 
   configuration_c_->network.udp.port = configuration_.network.udp.port;
+
+  // Assign Delta::Configuration
+  configuration_c_->delta.enable = configuration_.delta.enable;
+  configuration_c_->delta.statistics_cycles = configuration_.delta.statistics_cycles;
+  configuration_c_->delta.descriptor_hashing = configuration_.delta.descriptor_hashing;
 }
 
 void Assign_Subscriber_Configuration(struct eCAL_Subscriber_Configuration* configuration_c_, const eCAL::Subscriber::Configuration& configuration_)
 {
   // Assign Layer::Configuration
   configuration_c_->layer.shm.enable = configuration_.layer.shm.enable;
+  configuration_c_->layer.shm.max_pinned_samples = configuration_.layer.shm.max_pinned_samples;
   configuration_c_->layer.udp.enable = configuration_.layer.udp.enable;
   configuration_c_->layer.tcp.enable = configuration_.layer.tcp.enable;
 
+  // Assign Callback::Configuration
+  configuration_c_->callback.executor = Convert_Subscriber_Callback_eExecutor(configuration_.callback.executor);
+  configuration_c_->callback.queue_policy = Convert_Subscriber_Callback_eQueuePolicy(configuration_.callback.queue_policy);
+  configuration_c_->callback.queue_size = configuration_.callback.queue_size;
+  configuration_c_->callback.shared_pool_size = configuration_.callback.shared_pool_size;
+
+  // Assign Subscriber::Filter configuration
+  configuration_c_->filter.downsampling_factor = configuration_.filter.downsampling_factor;
+  configuration_c_->filter.max_frequency = configuration_.filter.max_frequency;
+
   // Assign Subscriber configuration
   configuration_c_->drop_out_of_order_messages = configuration_.drop_out_of_order_messages;
+  configuration_c_->latency_tracing = configuration_.latency_tracing;
 }
 
 void Assign_Time_Configuration(struct eCAL_Time_Configuration* configuration_c_, const eCAL::Time::Configuration& configuration_)
@@ -211,6 +265,9 @@ void Assign_TransportLayer_Configuration(struct eCAL_TransportLayer_Configuratio
   configuration_c_->udp.receive_buffer = configuration_.udp.receive_buffer;
   configuration_c_->udp.join_all_interfaces = configuration_.udp.join_all_interfaces;
   configuration_c_->udp.npcap_enabled = configuration_.udp.npcap_enabled;
+  configuration_c_->udp.mmsg_enabled = configuration_.udp.mmsg_enabled;
+  configuration_c_->udp.receive_threads = configuration_.udp.receive_threads;
+  configuration_c_->udp.max_message_size = configuration_.udp.max_message_size;
 
   strncpy(configuration_c_->udp.network.group, configuration_.udp.network.group.Get().c_str(), sizeof(configuration_c_->udp.network.group));
   configuration_c_->udp.network.ttl = configuration_.udp.network.ttl;
@@ -222,6 +279,10 @@ void Assign_TransportLayer_Configuration(struct eCAL_TransportLayer_Configuratio
   configuration_c_->tcp.number_executor_reader = configuration_.tcp.number_executor_reader;
   configuration_c_->tcp.number_executor_writer = configuration_.tcp.number_executor_writer;
   configuration_c_->tcp.max_reconnections = configuration_.tcp.max_reconnections;
+
+  // Assign SHM::Configuration
+  configuration_c_->shm.observer_threads = configuration_.shm.observer_threads;
+  configuration_c_->shm.observer_cpu_affinity_mask = configuration_.shm.observer_cpu_affinity_mask;
 }
 
 void Assign_Configuration(eCAL_Configuration* configuration_c_, const eCAL::Configuration& configuration_)
@@ -288,6 +349,28 @@ eCAL::Registration::Network::eTransportType Convert_Registration_Network_eTransp
   return transport_type_map.at(transport_type_);
 }
 
+eCAL::Subscriber::Callback::eExecutor Convert_Subscriber_Callback_eExecutor(enum eCAL_Subscriber_Callback_eExecutor executor_)
+{
+  static const std::map<enum eCAL_Subscriber_Callback_eExecutor, eCAL::Subscriber::Callback::eExecutor> executor_map
+  {
+    {eCAL_Subscriber_Callback_eExecutor_synchronous, eCAL::Subscriber::Callback::eExecutor::synchronous},
+    {eCAL_Subscriber_Callback_eExecutor_dedicated_thread, eCAL::Subscriber::Callback::eExecutor::dedicated_thread},
+    {eCAL_Subscriber_Callback_eExecutor_shared_pool, eCAL::Subscriber::Callback::eExecutor::shared_pool}
+  };
+  return executor_map.at(executor_);
+}
+
+eCAL::Subscriber::Callback::eQueuePolicy Convert_Subscriber_Callback_eQueuePolicy(enum eCAL_Subscriber_Callback_eQueuePolicy queue_policy_)
+{
+  static const std::map<enum eCAL_Subscriber_Callback_eQueuePolicy, eCAL::Subscriber::Callback::eQueuePolicy> queue_policy_map
+  {
+    {eCAL_Subscriber_Callback_eQueuePolicy_keep_latest, eCAL::Subscriber::Callback::eQueuePolicy::keep_latest},
+    {eCAL_Subscriber_Callback_eQueuePolicy_keep_all, eCAL::Subscriber::Callback::eQueuePolicy::keep_all},
+    {eCAL_Subscriber_Callback_eQueuePolicy_block_publisher, eCAL::Subscriber::Callback::eQueuePolicy::block_publisher}
+  };
+  return queue_policy_map.at(queue_policy_);
+}
+
 eCAL::Types::UdpConfigVersion Convert_Types_UdpConfigVersion(enum eCAL_Types_UdpConfigVersion udp_config_version_)
 {
   static const std::map<enum eCAL_Types_UdpConfigVersion, eCAL::Types::UdpConfigVersion> udp_config_version_map
@@ -368,9 +451,24 @@ void Assign_Publisher_Configuration(eCAL::Publisher::Configuration& configuratio
   configuration_.layer.shm.memfile_buffer_count = configuration_c_->layer.shm.memfile_buffer_count;
   configuration_.layer.shm.memfile_min_size_bytes = configuration_c_->layer.shm.memfile_min_size_bytes;
   configuration_.layer.shm.memfile_reserve_percent = configuration_c_->layer.shm.memfile_reserve_percent;
+  configuration_.layer.shm.memfile_ring_slots = configuration_c_->layer.shm.memfile_ring_slots;
+  configuration_.layer.shm.futex_notification = static_cast<bool>(configuration_c_->layer.shm.futex_notification);
+  configuration_.layer.shm.memfile_huge_pages = static_cast<bool>(configuration_c_->layer.shm.memfile_huge_pages);
+  configuration_.layer.shm.memfile_prefault = static_cast<bool>(configuration_c_->layer.shm.memfile_prefault);
+  configuration_.layer.shm.memfile_numa_node = configuration_c_->layer.shm.memfile_numa_node;
 
   configuration_.layer.udp.enable = static_cast<bool>(configuration_c_->layer.udp.enable);
+  configuration_.layer.udp.batching = static_cast<bool>(configuration_c_->layer.udp.batching);
+  configuration_.layer.udp.batch_max_size_bytes = configuration_c_->layer.udp.batch_max_size_bytes;
+  configuration_.layer.udp.batch_linger_time_us = configuration_c_->layer.udp.batch_linger_time_us;
+  configuration_.layer.udp.fec_redundancy_percent = configuration_c_->layer.udp.fec_redundancy_percent;
   configuration_.layer.tcp.enable = static_cast<bool>(configuration_c_->layer.tcp.enable);
+  configuration_.layer.tcp.batching = static_cast<bool>(configuration_c_->layer.tcp.batching);
+  configuration_.layer.tcp.batch_max_size_bytes = configuration_c_->layer.tcp.batch_max_size_bytes;
+  configuration_.layer.tcp.batch_linger_time_us = configuration_c_->layer.tcp.batch_linger_time_us;
+
+  // Assign History::Configuration
+  configuration_.history.depth = configuration_c_->history.depth;
 
   // Assign layer_priority_local
   configuration_.layer_priority_local.resize(configuration_c_->layer_priority_local_length);
@@ -404,17 +502,34 @@ void Assign_Registration_Configuration(eCAL::Registration::Configuration& config
   // Assign Network::Configuration
   configuration_.network.transport_type = Convert_Registration_Network_eTransportType(configuration_c_->network.transport_type);
   configuration_.network.udp.port = configuration_c_->network.udp.port;
+
+  // Assign Delta::Configuration
+  configuration_.delta.enable = static_cast<bool>(configuration_c_->delta.enable);
+  configuration_.delta.statistics_cycles = configuration_c_->delta.statistics_cycles;
+  configuration_.delta.descriptor_hashing = static_cast<bool>(configuration_c_->delta.descriptor_hashing);
 }
 
 void Assign_Subscriber_Configuration(eCAL::Subscriber::Configuration& configuration_, const struct eCAL_Subscriber_Configuration* configuration_c_)
 {
   // Assign Layer::Configuration
   configuration_.layer.shm.enable = static_cast<bool>(configuration_c_->layer.shm.enable);
+  configuration_.layer.shm.max_pinned_samples = configuration_c_->layer.shm.max_pinned_samples;
   configuration_.layer.udp.enable = static_cast<bool>(configuration_c_->layer.udp.enable);
   configuration_.layer.tcp.enable = static_cast<bool>(configuration_c_->layer.tcp.enable);
 
+  // Assign Callback::Configuration
+  configuration_.callback.executor = Convert_Subscriber_Callback_eExecutor(configuration_c_->callback.executor);
+  configuration_.callback.queue_policy = Convert_Subscriber_Callback_eQueuePolicy(configuration_c_->callback.queue_policy);
+  configuration_.callback.queue_size = configuration_c_->callback.queue_size;
+  configuration_.callback.shared_pool_size = configuration_c_->callback.shared_pool_size;
+
+  // Assign Subscriber::Filter configuration
+  configuration_.filter.downsampling_factor = configuration_c_->filter.downsampling_factor;
+  configuration_.filter.max_frequency = configuration_c_->filter.max_frequency;
+
   // Assign Subscriber configuration
   configuration_.drop_out_of_order_messages = static_cast<bool>(configuration_c_->drop_out_of_order_messages);
+  configuration_.latency_tracing = static_cast<bool>(configuration_c_->latency_tracing);
 }
 
 void Assign_Time_Configuration(eCAL::Time::Configuration& configuration_, const struct eCAL_Time_Configuration* configuration_c_)
@@ -434,6 +549,9 @@ void Assign_TransportLayer_Configuration(eCAL::TransportLayer::Configuration& co
   configuration_.udp.receive_buffer = configuration_c_->udp.receive_buffer;
   configuration_.udp.join_all_interfaces = static_cast<bool>(configuration_c_->udp.join_all_interfaces);
   configuration_.udp.npcap_enabled = static_cast<bool>(configuration_c_->udp.npcap_enabled);
+  configuration_.udp.mmsg_enabled = static_cast<bool>(configuration_c_->udp.mmsg_enabled);
+  configuration_.udp.receive_threads = configuration_c_->udp.receive_threads;
+  configuration_.udp.max_message_size = configuration_c_->udp.max_message_size;
 
   configuration_.udp.network.group = configuration_c_->udp.network.group;
   configuration_.udp.network.ttl = configuration_c_->udp.network.ttl;
@@ -445,6 +563,10 @@ void Assign_TransportLayer_Configuration(eCAL::TransportLayer::Configuration& co
   configuration_.tcp.number_executor_reader = configuration_c_->tcp.number_executor_reader;
   configuration_.tcp.number_executor_writer = configuration_c_->tcp.number_executor_writer;
   configuration_.tcp.max_reconnections = configuration_c_->tcp.max_reconnections;
+
+  // Assign SHM::Configuration
+  configuration_.shm.observer_threads = configuration_c_->shm.observer_threads;
+  configuration_.shm.observer_cpu_affinity_mask = configuration_c_->shm.observer_cpu_affinity_mask;
 }
 
 void Assign_Configuration(eCAL::Configuration& configuration_, const eCAL_Configuration* configuration_c_)
@@ -28,6 +28,7 @@
 
 #include "common.h"
 
+#include <algorithm>
 #include <map>
 #include <cassert>
 #include <numeric>
@@ -82,6 +83,28 @@ namespace
     return aligned_size(sizeof(struct eCAL_Monitoring_STransportLayer) * transport_layers_.size());
   }
 
+  size_t ExtSize_Int64Array(const std::vector<int64_t>& values_)
+  {
+    return aligned_size(sizeof(int64_t) * values_.size());
+  }
+
+  size_t ExtSize_Monitoring_SLatencyHistogram(const eCAL::Monitoring::SLatencyHistogram& histogram_)
+  {
+    return ExtSize_Int64Array(histogram_.bucket_limits_us) +
+      ExtSize_Int64Array(histogram_.bucket_counts);
+  }
+
+  size_t ExtSize_Monitoring_SLatencyStatistics(const eCAL::Monitoring::SLatencyStatistics& latency_statistics_)
+  {
+    return ExtSize_Monitoring_SLatencyHistogram(latency_statistics_.delivery_latency) +
+      ExtSize_Monitoring_SLatencyHistogram(latency_statistics_.callback_latency);
+  }
+
+  size_t ExtSize_Monitoring_SLatencyStatisticsArray(const std::vector<eCAL::Monitoring::SLatencyStatistics>& latency_statistics_)
+  {
+    return aligned_size(sizeof(struct eCAL_Monitoring_SLatencyStatistics) * latency_statistics_.size());
+  }
+
   size_t ExtSize_Monitoring_STopic(const eCAL::Monitoring::STopic& topic_)
   {
     return ExtSize_SDataTypeInformation(topic_.datatype_information) +
@@ -91,7 +114,12 @@ namespace
       ExtSize_String(topic_.shm_transport_domain) +
       ExtSize_String(topic_.topic_name) +
       ExtSize_String(topic_.unit_name) +
-      ExtSize_Monitoring_STransportLayerArray(topic_.transport_layer);
+      ExtSize_Monitoring_STransportLayerArray(topic_.transport_layer) +
+      ExtSize_Monitoring_SLatencyStatisticsArray(topic_.latency_statistics) +
+      std::accumulate(topic_.latency_statistics.begin(), topic_.latency_statistics.end(), size_t{ 0 },
+        [](auto size_, const auto& latency_statistics_) {
+          return size_ + ExtSize_Monitoring_SLatencyStatistics(latency_statistics_);
+        });
   }
 
   size_t ExtSize_Monitoring_STopicArray(const std::vector<eCAL::Monitoring::STopic>& topics_)
@@ -196,7 +224,7 @@ namespace
     process_c_->unit_name = Convert_String(process_.unit_name, offset_);
   }
 
-  void Assign_Monitoring_STransportLayer(struct eCAL_Monitoring_STransportLayer* transport_layer_c_, const eCAL::Monitoring::STransportLayer& transport_layer_)
+  eCAL_Monitoring_eTransportLayerType Convert_Monitoring_eTransportLayerType(eCAL::Monitoring::eTransportLayerType type_)
   {
     static const std::map<eCAL::Monitoring::eTransportLayerType, eCAL_Monitoring_eTransportLayerType> transport_layer_type_map
     {
@@ -205,9 +233,13 @@ namespace
       {eCAL::Monitoring::eTransportLayerType::shm, eCAL_Monitoring_eTransportLayerType_shm},
       {eCAL::Monitoring::eTransportLayerType::tcp, eCAL_Monitoring_eTransportLayerType_tcp}
     };
+    return transport_layer_type_map.at(type_);
+  }
 
+  void Assign_Monitoring_STransportLayer(struct eCAL_Monitoring_STransportLayer* transport_layer_c_, const eCAL::Monitoring::STransportLayer& transport_layer_)
+  {
     transport_layer_c_->active = transport_layer_.active;
-    transport_layer_c_->type = transport_layer_type_map.at(transport_layer_.type);
+    transport_layer_c_->type = Convert_Monitoring_eTransportLayerType(transport_layer_.type);
     transport_layer_c_->version = transport_layer_.version;
   }
 
@@ -221,6 +253,39 @@ namespace
     }
   }
 
+  void Assign_Int64Array(int64_t** values_c_, const std::vector<int64_t>& values_, char** offset_)
+  {
+    *values_c_ = reinterpret_cast<int64_t*>(*offset_);
+    *offset_ += ExtSize_Int64Array(values_);
+    std::copy(values_.begin(), values_.end(), *values_c_);
+  }
+
+  void Assign_Monitoring_SLatencyHistogram(struct eCAL_Monitoring_SLatencyHistogram* histogram_c_, const eCAL::Monitoring::SLatencyHistogram& histogram_, char** offset_)
+  {
+    Assign_Int64Array(&(histogram_c_->bucket_limits_us), histogram_.bucket_limits_us, offset_);
+    histogram_c_->bucket_limits_us_length = histogram_.bucket_limits_us.size();
+    Assign_Int64Array(&(histogram_c_->bucket_counts), histogram_.bucket_counts, offset_);
+    histogram_c_->bucket_counts_length = histogram_.bucket_counts.size();
+  }
+
+  void Assign_Monitoring_SLatencyStatistics(struct eCAL_Monitoring_SLatencyStatistics* latency_statistics_c_, const eCAL::Monitoring::SLatencyStatistics& latency_statistics_, char** offset_)
+  {
+    latency_statistics_c_->publisher_id = latency_statistics_.publisher_id;
+    latency_statistics_c_->layer = Convert_Monitoring_eTransportLayerType(latency_statistics_.layer);
+    Assign_Monitoring_SLatencyHistogram(&(latency_statistics_c_->delivery_latency), latency_statistics_.delivery_latency, offset_);
+    Assign_Monitoring_SLatencyHistogram(&(latency_statistics_c_->callback_latency), latency_statistics_.callback_latency, offset_);
+  }
+
+  void Assign_Monitoring_SLatencyStatisticsArray(struct eCAL_Monitoring_SLatencyStatistics** latency_statistics_c_, const std::vector<eCAL::Monitoring::SLatencyStatistics>& latency_statistics_, char** offset_)
+  {
+    *latency_statistics_c_ = reinterpret_cast<eCAL_Monitoring_SLatencyStatistics*>(*offset_);
+    *offset_ += ExtSize_Monitoring_SLatencyStatisticsArray(latency_statistics_);
+    for (size_t i = 0; i < latency_statistics_.size(); ++i)
+    {
+      Assign_Monitoring_SLatencyStatistics(&((*latency_statistics_c_)[i]), latency_statistics_.at(i), offset_);
+    }
+  }
+
   void Assign_Monitoring_STopic(struct eCAL_Monitoring_STopic* topic_c_, const eCAL::Monitoring::STopic& topic_, char** offset_)
   {
     topic_c_->registration_clock = topic_.registration_clock;
@@ -242,6 +307,8 @@ namespace
     topic_c_->data_id = topic_.data_id;
     topic_c_->data_clock = topic_.data_clock;
     topic_c_->data_frequency = topic_.data_frequency;
+    Assign_Monitoring_SLatencyStatisticsArray(&(topic_c_->latency_statistics), topic_.latency_statistics, offset_);
+    topic_c_->latency_statistics_length = topic_.latency_statistics.size();
   }
 
   void Assign_Monitoring_SMethod(struct eCAL_Monitoring_SMethod* method_c_, const eCAL::Monitoring::SMethod& method_, char** offset_)
@@ -197,4 +197,69 @@ TEST_F(pubsub_test_c, pub_SendPayloadWriter)
   eCAL_Process_SleepMS(2000);
 
   EXPECT_EQ(0, eCAL_Publisher_SendPayloadWriter(publisher, &writer, nullptr));
-}
\ No newline at end of file
+}
+TEST(pubsub_test_c_monitoring, LatencyStatistics)
+{
+  const char* topic_name = "C-Binding-Latency-Test";
+  const char* snd_s = "HELLO WORLD FROM C";
+
+  // initialize eCAL API with monitoring
+  EXPECT_EQ(0, eCAL_Initialize("pubsub_test_c", &eCAL_Init_All, NULL));
+
+  // subscriber with latency tracing
+  struct eCAL_Subscriber_Configuration subscriber_configuration = *eCAL_GetSubscriberConfiguration();
+  subscriber_configuration.latency_tracing = 1;
+  eCAL_Subscriber* subscriber = eCAL_Subscriber_New(topic_name, NULL, NULL, &subscriber_configuration);
+  eCAL_Publisher* publisher = eCAL_Publisher_New(topic_name, NULL, NULL, NULL);
+
+  int callback_count = 0;
+  eCAL_Subscriber_SetReceiveCallback(subscriber, OnReceive, &callback_count);
+
+  // let's match them
+  eCAL_Process_SleepMS(2000);
+
+  for (int i = 0; i < 10; i++)
+  {
+    EXPECT_EQ(0, eCAL_Publisher_Send(publisher, snd_s, strlen(snd_s), NULL));
+    eCAL_Process_SleepMS(10);
+  }
+  EXPECT_EQ(10, callback_count);
+
+  // wait for the next registration of the subscriber
+  eCAL_Process_SleepMS(2000);
+
+  struct eCAL_Monitoring_SMonitoring* monitoring = NULL;
+  const unsigned int entities = eCAL_Monitoring_Entity_Subscriber;
+  ASSERT_EQ(0, eCAL_Monitoring_GetMonitoring(&monitoring, &entities));
+  ASSERT_NE(nullptr, monitoring);
+
+  const struct eCAL_Monitoring_STopic* subscriber_info = NULL;
+  for (size_t i = 0; i < monitoring->subscribers_length; ++i)
+  {
+    if (strcmp(monitoring->subscribers[i].topic_name, topic_name) == 0) subscriber_info = &monitoring->subscribers[i];
+  }
+  ASSERT_NE(nullptr, subscriber_info);
+
+  // one publisher on one layer
+  ASSERT_EQ(1, subscriber_info->latency_statistics_length);
+  const struct eCAL_Monitoring_SLatencyStatistics* latency_statistics = &subscriber_info->latency_statistics[0];
+  EXPECT_EQ(eCAL_Publisher_GetTopicId(publisher)->topic_id.entity_id, latency_statistics->publisher_id);
+  EXPECT_NE(eCAL_Monitoring_eTransportLayerType_none, latency_statistics->layer);
+
+  // all samples are counted in both histograms, the last bucket counts all greater latencies
+  const struct eCAL_Monitoring_SLatencyHistogram* histograms[] = { &latency_statistics->delivery_latency, &latency_statistics->callback_latency };
+  for (const auto* histogram : histograms)
+  {
+    EXPECT_LT(0U, histogram->bucket_limits_us_length);
+    ASSERT_EQ(histogram->bucket_limits_us_length + 1, histogram->bucket_counts_length);
+    int64_t sample_count = 0;
+    for (size_t i = 0; i < histogram->bucket_counts_length; ++i) sample_count += histogram->bucket_counts[i];
+    EXPECT_EQ(10, sample_count);
+  }
+
+  eCAL_Free(monitoring);
+
+  eCAL_Subscriber_Delete(subscriber);
+  eCAL_Publisher_Delete(publisher);
+  eCAL_Finalize();
+}
@@ -38,17 +38,41 @@ void AddConfigPublisher(nanobind::module_& module)
     .def_rw("memfile_min_size_bytes", &Layer::SHM::Configuration::memfile_min_size_bytes,
       "Default memory file size for new publishers")
     .def_rw("memfile_reserve_percent", &Layer::SHM::Configuration::memfile_reserve_percent,
-      "Dynamic memory file size reserve before recreation");
+      "Dynamic memory file size reserve before recreation")
+    .def_rw("memfile_ring_slots", &Layer::SHM::Configuration::memfile_ring_slots,
+      "Number of lock-free ring buffer slots (0 = single slot memory file)")
+    .def_rw("futex_notification", &Layer::SHM::Configuration::futex_notification,
+      "Signal subscribers via one futex word instead of named events (Linux only)")
+    .def_rw("memfile_huge_pages", &Layer::SHM::Configuration::memfile_huge_pages,
+      "Back memory files by huge pages of the hugetlbfs mount (Linux only)")
+    .def_rw("memfile_prefault", &Layer::SHM::Configuration::memfile_prefault,
+      "Fault in all pages of a memory file when it is created")
+    .def_rw("memfile_numa_node", &Layer::SHM::Configuration::memfile_numa_node,
+      "Bind memory file pages to this NUMA node (Linux only, -1 = no binding)");
 
   // Bind Publisher::Layer::UDP::Configuration struct
   nb::class_<Layer::UDP::Configuration>(module, "PublisherLayerUDPConfiguration")
     .def(nb::init<>()) // Default constructor
-    .def_rw("enable", &Layer::UDP::Configuration::enable, "Enable UDP layer");
+    .def_rw("enable", &Layer::UDP::Configuration::enable, "Enable UDP layer")
+    .def_rw("batching", &Layer::UDP::Configuration::batching,
+      "Collect multiple samples and send them in one udp datagram")
+    .def_rw("batch_max_size_bytes", &Layer::UDP::Configuration::batch_max_size_bytes,
+      "Send the batch as soon as its payload reaches this size")
+    .def_rw("batch_linger_time_us", &Layer::UDP::Configuration::batch_linger_time_us,
+      "Maximum time a sample waits in the batch before it is sent")
+    .def_rw("fec_redundancy_percent", &Layer::UDP::Configuration::fec_redundancy_percent,
+      "Forward error correction parity data in percent of the message size (0 = disabled)");
 
   // Bind Publisher::Layer::TCP::Configuration struct
   nb::class_<Layer::TCP::Configuration>(module, "PublisherLayerTCPConfiguration")
     .def(nb::init<>()) // Default constructor
-    .def_rw("enable", &Layer::TCP::Configuration::enable, "Enable TCP layer");
+    .def_rw("enable", &Layer::TCP::Configuration::enable, "Enable TCP layer")
+    .def_rw("batching", &Layer::TCP::Configuration::batching,
+      "Collect multiple samples and send them in one tcp frame")
+    .def_rw("batch_max_size_bytes", &Layer::TCP::Configuration::batch_max_size_bytes,
+      "Send the batch as soon as its payload reaches this size")
+    .def_rw("batch_linger_time_us", &Layer::TCP::Configuration::batch_linger_time_us,
+      "Maximum time a sample waits in the batch before it is sent");
 
   // Bind Publisher::Layer::Configuration struct
   nb::class_<Layer::Configuration>(module, "PublisherLayerConfiguration")
@@ -57,10 +81,17 @@ void AddConfigPublisher(nanobind::module_& module)
     .def_rw("udp", &Layer::Configuration::udp, "UDP layer configuration")
     .def_rw("tcp", &Layer::Configuration::tcp, "TCP layer configuration");
 
+  // Bind Publisher::History::Configuration struct
+  nb::class_<History::Configuration>(module, "PublisherHistoryConfiguration")
+    .def(nb::init<>()) // Default constructor
+    .def_rw("depth", &History::Configuration::depth,
+      "Number of last samples replayed to late joining subscribers (0 = no history)");
+
   // Bind Publisher::Configuration struct
   nb::class_<Configuration>(module, "PublisherConfiguration")
     .def(nb::init<>()) // Default constructor
     .def_rw("layer", &Configuration::layer, "Layer configuration")
+    .def_rw("history", &Configuration::history, "Transient local history configuration")
     .def_rw("layer_priority_local", &Configuration::layer_priority_local,
       "Transport layer priority for local communication")
     .def_rw("layer_priority_remote", &Configuration::layer_priority_remote,
@@ -65,6 +65,13 @@ void AddConfigRegistration(nanobind::module_& module)
     .def_rw("transport_type", &eCAL::Registration::Network::Configuration::transport_type)
     .def_rw("udp", &eCAL::Registration::Network::Configuration::udp);
 
+  // Delta::Configuration
+  nb::class_<eCAL::Registration::Delta::Configuration>(module, "DeltaConfig")
+    .def(nb::init<>())
+    .def_rw("enable", &eCAL::Registration::Delta::Configuration::enable)
+    .def_rw("statistics_cycles", &eCAL::Registration::Delta::Configuration::statistics_cycles)
+    .def_rw("descriptor_hashing", &eCAL::Registration::Delta::Configuration::descriptor_hashing);
+
   // Root Configuration
   nb::class_<eCAL::Registration::Configuration>(module, "RegistrationConfig")
     .def(nb::init<>())
@@ -73,5 +80,6 @@ void AddConfigRegistration(nanobind::module_& module)
     .def_rw("loopback", &eCAL::Registration::Configuration::loopback)
     .def_rw("shm_transport_domain", &eCAL::Registration::Configuration::shm_transport_domain)
     .def_rw("local", &eCAL::Registration::Configuration::local)
-    .def_rw("network", &eCAL::Registration::Configuration::network);
+    .def_rw("network", &eCAL::Registration::Configuration::network)
+    .def_rw("delta", &eCAL::Registration::Configuration::delta);
 }
\ No newline at end of file
@@ -28,7 +28,9 @@ void AddConfigSubscriber(nanobind::module_& module)
   // Bind Subscriber::Layer::SHM::Configuration struct
   nb::class_<Layer::SHM::Configuration>(module, "SubscriberLayerSHMConfiguration")
     .def(nb::init<>()) // Default constructor
-    .def_rw("enable", &Layer::SHM::Configuration::enable, "Enable SHM layer (Default: true)");
+    .def_rw("enable", &Layer::SHM::Configuration::enable, "Enable SHM layer (Default: true)")
+    .def_rw("max_pinned_samples", &Layer::SHM::Configuration::max_pinned_samples,
+      "Maximum number of zero copy samples a sample callback receiver can hold at once, further samples are copied (0 == always copy, Default: 1)");
 
   // Bind Subscriber::Layer::UDP::Configuration struct
   nb::class_<Layer::UDP::Configuration>(module, "SubscriberLayerUDPConfiguration")
@@ -47,10 +49,40 @@ void AddConfigSubscriber(nanobind::module_& module)
     .def_rw("udp", &Layer::Configuration::udp, "UDP layer configuration")
     .def_rw("tcp", &Layer::Configuration::tcp, "TCP layer configuration");
 
+  // Bind Subscriber::Callback enums
+  nb::enum_<Callback::eExecutor>(module, "SubscriberCallbackExecutor")
+    .value("SYNCHRONOUS", Callback::eExecutor::synchronous)
+    .value("DEDICATED_THREAD", Callback::eExecutor::dedicated_thread)
+    .value("SHARED_POOL", Callback::eExecutor::shared_pool);
+
+  nb::enum_<Callback::eQueuePolicy>(module, "SubscriberCallbackQueuePolicy")
+    .value("KEEP_LATEST", Callback::eQueuePolicy::keep_latest)
+    .value("KEEP_ALL", Callback::eQueuePolicy::keep_all)
+    .value("BLOCK_PUBLISHER", Callback::eQueuePolicy::block_publisher);
+
+  // Bind Subscriber::Callback::Configuration struct
+  nb::class_<Callback::Configuration>(module, "SubscriberCallbackConfiguration")
+    .def(nb::init<>()) // Default constructor
+    .def_rw("executor", &Callback::Configuration::executor, "Receive callback executor (Default: SYNCHRONOUS)")
+    .def_rw("queue_policy", &Callback::Configuration::queue_policy, "Behavior of a full receive queue, asynchronous executors only (Default: KEEP_LATEST)")
+    .def_rw("queue_size", &Callback::Configuration::queue_size, "Maximum number of queued samples, asynchronous executors only (Default: 1)")
+    .def_rw("shared_pool_size", &Callback::Configuration::shared_pool_size,
+      "Number of threads of the process wide shared pool, applied by the first subscriber that creates the pool (Default: 2)");
+
+  // Bind Subscriber::Filter::Configuration struct
+  nb::class_<Filter::Configuration>(module, "SubscriberFilterConfiguration")
+    .def(nb::init<>()) // Default constructor
+    .def_rw("downsampling_factor", &Filter::Configuration::downsampling_factor, "Pass only every Nth sample of a publisher (0, 1 == every sample, Default: 1)")
+    .def_rw("max_frequency", &Filter::Configuration::max_frequency, "Pass samples of a publisher with at most this frequency [Hz] (0 == unlimited, Default: 0)");
+
   // Bind Subscriber::Configuration struct
   nb::class_<Configuration>(module, "SubscriberConfiguration")
     .def(nb::init<>()) // Default constructor
     .def_rw("layer", &Configuration::layer, "Layer configuration for subscriber")
+    .def_rw("callback", &Configuration::callback, "Receive callback execution configuration for subscriber")
+    .def_rw("filter", &Configuration::filter, "Sample filter configuration for subscriber, applied by the publishers")
     .def_rw("drop_out_of_order_messages", &Configuration::drop_out_of_order_messages,
-      "Enable dropping of out-of-order messages (Default: true)");
+      "Enable dropping of out-of-order messages (Default: true)")
+    .def_rw("latency_tracing", &Configuration::latency_tracing,
+      "Collect delivery latency and callback execution time histograms per publisher and transport layer (Default: false)");
 }
@@ -51,6 +51,12 @@ void AddConfigTransportLayer(nanobind::module_& module)
       "Enable joining multicast groups on all network interfaces (Linux-specific)")
     .def_rw("npcap_enabled", &UDP::Configuration::npcap_enabled,
       "Enable UDP traffic reception with Npcap-based receiver")
+    .def_rw("mmsg_enabled", &UDP::Configuration::mmsg_enabled,
+      "Send and receive topic payload with the sendmmsg / recvmmsg based UDP backend (Linux-specific)")
+    .def_rw("receive_threads", &UDP::Configuration::receive_threads,
+      "Number of threads receiving the topic payload, topics are distributed by their multicast group (Linux-specific)")
+    .def_rw("max_message_size", &UDP::Configuration::max_message_size,
+      "Maximum size of a received topic payload message in bytes, larger messages are dropped")
     .def_rw("network", &UDP::Configuration::network, "Network multicast configuration")
     .def_rw("local", &UDP::Configuration::local, "Local multicast configuration");
 
@@ -64,9 +70,18 @@ void AddConfigTransportLayer(nanobind::module_& module)
     .def_rw("max_reconnections", &TCP::Configuration::max_reconnections,
       "Maximum number of reconnection attempts (Default: 5)");
 
+  // Bind TransportLayer::SHM::Configuration struct
+  nb::class_<SHM::Configuration>(module, "SHMConfiguration")
+    .def(nb::init<>()) // Default constructor
+    .def_rw("observer_threads", &SHM::Configuration::observer_threads,
+      "Number of threads that share the observation of futex notified memory files, only applies to publishers with futex_notification enabled (0 == one thread per memory file)")
+    .def_rw("observer_cpu_affinity_mask", &SHM::Configuration::observer_cpu_affinity_mask,
+      "CPUs the shared observer threads are distributed to (bit n == CPU n, 0 == no affinity)");
+
   // Bind TransportLayer::Configuration struct
   nb::class_<Configuration>(module, "TransportLayerConfiguration")
     .def(nb::init<>()) // Default constructor
     .def_rw("udp", &Configuration::udp, "UDP transport layer configuration")
-    .def_rw("tcp", &Configuration::tcp, "TCP transport layer configuration");
+    .def_rw("tcp", &Configuration::tcp, "TCP transport layer configuration")
+    .def_rw("shm", &Configuration::shm, "SHM transport layer configuration");
 }
\ No newline at end of file
@@ -60,6 +60,20 @@ void AddTypesMonitoring(nanobind::module_& m)
     .def_rw("version", &STransportLayer::version)
     .def_rw("active", &STransportLayer::active);
 
+  // SLatencyHistogram
+  nb::class_<SLatencyHistogram>(m_monitoring, "LatencyHistogram")
+    .def(nb::init<>())
+    .def_rw("bucket_limits_us", &SLatencyHistogram::bucket_limits_us)
+    .def_rw("bucket_counts", &SLatencyHistogram::bucket_counts);
+
+  // SLatencyStatistics
+  nb::class_<SLatencyStatistics>(m_monitoring, "LatencyStatistics")
+    .def(nb::init<>())
+    .def_rw("publisher_id", &SLatencyStatistics::publisher_id)
+    .def_rw("layer", &SLatencyStatistics::layer)
+    .def_rw("delivery_latency", &SLatencyStatistics::delivery_latency)
+    .def_rw("callback_latency", &SLatencyStatistics::callback_latency);
+
   // STopic
   nb::class_<STopic>(m_monitoring, "Topic")
     .def(nb::init<>())
@@ -80,7 +94,8 @@ void AddTypesMonitoring(nanobind::module_& m)
     .def_rw("message_drops", &STopic::message_drops)
     .def_rw("data_id", &STopic::data_id)
     .def_rw("data_clock", &STopic::data_clock)
-    .def_rw("data_frequency", &STopic::data_frequency);
+    .def_rw("data_frequency", &STopic::data_frequency)
+    .def_rw("latency_statistics", &STopic::latency_statistics);
 
   // SProcess
   nb::class_<SProcess>(m_monitoring, "Process")
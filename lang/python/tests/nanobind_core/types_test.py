@@ -55,4 +55,35 @@ class TestDataTypeInformation:
     )
     assert default_datatype_info.name == MY_NAME
     assert default_datatype_info.encoding == MY_ENCODING
-    assert default_datatype_info.descriptor == MY_DESCRIPTOR
\ No newline at end of file
+    assert default_datatype_info.descriptor == MY_DESCRIPTOR
+
+class TestMonitoringLatencyStatistics:
+  def test_constructor_empty(self):
+    latency_statistics = ecal_core.monitoring.LatencyStatistics()
+    assert latency_statistics.publisher_id == 0
+    assert latency_statistics.layer == ecal_core.monitoring.TransportLayerType.NONE
+    assert latency_statistics.delivery_latency.bucket_limits_us == []
+    assert latency_statistics.delivery_latency.bucket_counts == []
+    assert latency_statistics.callback_latency.bucket_limits_us == []
+    assert latency_statistics.callback_latency.bucket_counts == []
+
+  def test_topic_latency_statistics(self):
+    histogram = ecal_core.monitoring.LatencyHistogram()
+    histogram.bucket_limits_us = [10, 20, 50]
+    histogram.bucket_counts = [1, 2, 3, 4]
+
+    latency_statistics = ecal_core.monitoring.LatencyStatistics()
+    latency_statistics.publisher_id = 42
+    latency_statistics.layer = ecal_core.monitoring.TransportLayerType.SHM
+    latency_statistics.delivery_latency = histogram
+    latency_statistics.callback_latency = histogram
+
+    topic = ecal_core.monitoring.Topic()
+    assert topic.latency_statistics == []
+    topic.latency_statistics = [latency_statistics]
+
+    assert len(topic.latency_statistics) == 1
+    assert topic.latency_statistics[0].publisher_id == 42
+    assert topic.latency_statistics[0].layer == ecal_core.monitoring.TransportLayerType.SHM
+    assert topic.latency_statistics[0].delivery_latency.bucket_limits_us == [10, 20, 50]
+    assert topic.latency_statistics[0].callback_latency.bucket_counts == [1, 2, 3, 4]